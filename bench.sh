@@ -0,0 +1,102 @@
+#!/bin/bash
+# /** AUTHOR
+#  *
+#  * @author agent <agent@local>
+#  * @file bench.sh
+#  * @date 19.10.2026
+#  * @brief This script measures the compile throughput over programs of growing size, made by bench/generator.c.
+#  * @note this script is run by the Makefile (make bench), the results are written as CSV and JSON
+#  */
+
+# ANSI escape codes for colored output
+RESET="\033[0m"
+RED="\033[1;31m"
+GREEN="\033[1;32m"
+CYAN="\033[1;36m"
+
+# Settings, every one can be given by the environment, the sizes are multiplied by the scale
+COMPILER=${COMPILER:-./main}                 # measured compiler
+STATS_COMPILER=${STATS_COMPILER:-./main_stats} # the same compiler with the counters, for the tokens and memory
+GENERATOR=${GENERATOR:-./build/generator}    # generator of the programs
+SCALES=${SCALES:-"1 2 4 8 16"}               # sizes of the sweep
+REPEAT=${REPEAT:-5}                          # runs of every size, the fastest one counts
+FUNCTIONS=${FUNCTIONS:-20}                   # functions at the scale 1
+STATEMENTS=${STATEMENTS:-10}                 # locals in every function
+DEPTH=${DEPTH:-2}                            # nesting of every assignment
+OPERANDS=${OPERANDS:-6}                      # operands of every expression
+STRINGS=${STRINGS:-64}                       # bytes of the string literal of every function
+FLAGS=${FLAGS:-}                             # options of the compiler, e.g. "-j 4"
+OUTPUT=${OUTPUT:-bench_results}              # the results go to $OUTPUT.csv and $OUTPUT.json
+
+for binary in "$COMPILER" "$STATS_COMPILER" "$GENERATOR"; do
+    if [ ! -x "$binary" ]; then
+        echo -e "${RED}Error: $binary not found, run make bench.${RESET}"
+        exit 1
+    fi
+done
+
+# Function to get a number from the JSON of --stats=json
+json_number() {
+    grep -o "\"$2\": [0-9.]*" "$1" | head -n 1 | sed 's/.*: //'
+}
+
+# Function to get the current time in nanoseconds
+now() {
+    date +%s%N
+}
+
+WORK_DIR=$(mktemp -d)
+trap 'rm -rf "$WORK_DIR"' EXIT
+
+CSV_HEADER="scale,functions,statements,depth,operands,string_bytes,source_bytes,lines,tokens,seconds,tokens_per_sec,lines_per_sec,peak_rss_kib,peak_heap_bytes"
+echo "$CSV_HEADER" > "$OUTPUT.csv"
+echo "[" > "$OUTPUT.json"
+
+echo -e "${CYAN}Compiler: $COMPILER${FLAGS:+ $FLAGS}, the fastest of $REPEAT runs${RESET}"
+printf "%6s %10s %10s %12s %10s %14s %14s %12s %14s\n" "scale" "bytes" "lines" "tokens" "ms" "tokens/s" "lines/s" "RSS KiB" "heap B"
+
+first=true
+for scale in $SCALES; do
+    functions=$((FUNCTIONS * scale))
+    source="$WORK_DIR/program_$scale.zig"
+    "$GENERATOR" -f "$functions" -s "$STATEMENTS" -d "$DEPTH" -e "$OPERANDS" -l "$STRINGS" > "$source"
+    bytes=$(wc -c < "$source")
+    lines=$(wc -l < "$source")
+
+    # the counters slow the compiler down, so they are taken from a separate run
+    "$STATS_COMPILER" $FLAGS --stats=json < "$source" > /dev/null 2> "$WORK_DIR/stats.json"
+    status=$?
+    if [ $status -ne 0 ]; then
+        echo -e "${RED}Error: the program of the scale $scale did not compile, exit code $status${RESET}"
+        exit 1
+    fi
+    tokens=$(json_number "$WORK_DIR/stats.json" tokens)
+    rss=$(json_number "$WORK_DIR/stats.json" peak_rss_kib)
+    heap=$(json_number "$WORK_DIR/stats.json" peak_bytes)
+
+    best=0
+    for ((run = 0; run < REPEAT; run++)); do
+        start=$(now)
+        "$COMPILER" $FLAGS < "$source" > /dev/null
+        elapsed=$(($(now) - start))
+        if [ $best -eq 0 ] || [ $elapsed -lt $best ]; then best=$elapsed; fi
+    done
+
+    seconds=$(awk -v ns="$best" 'BEGIN { printf "%.6f", ns / 1e9 }')
+    tokensPerSec=$(awk -v n="$tokens" -v ns="$best" 'BEGIN { printf "%.0f", n * 1e9 / ns }')
+    linesPerSec=$(awk -v n="$lines" -v ns="$best" 'BEGIN { printf "%.0f", n * 1e9 / ns }')
+
+    printf "%6s %10s %10s %12s %10.2f %14s %14s %12s %14s\n" "$scale" "$bytes" "$lines" "$tokens" \
+        "$(awk -v ns="$best" 'BEGIN { print ns / 1e6 }')" "$tokensPerSec" "$linesPerSec" "$rss" "$heap"
+    echo "$scale,$functions,$STATEMENTS,$DEPTH,$OPERANDS,$STRINGS,$bytes,$lines,$tokens,$seconds,$tokensPerSec,$linesPerSec,$rss,$heap" >> "$OUTPUT.csv"
+
+    if [ "$first" = false ]; then echo "," >> "$OUTPUT.json"; fi
+    first=false
+    printf '  {"scale": %s, "functions": %s, "statements": %s, "depth": %s, "operands": %s, "string_bytes": %s, "source_bytes": %s, "lines": %s, "tokens": %s, "seconds": %s, "tokens_per_sec": %s, "lines_per_sec": %s, "peak_rss_kib": %s, "peak_heap_bytes": %s}' \
+        "$scale" "$functions" "$STATEMENTS" "$DEPTH" "$OPERANDS" "$STRINGS" "$bytes" "$lines" "$tokens" "$seconds" \
+        "$tokensPerSec" "$linesPerSec" "$rss" "$heap" >> "$OUTPUT.json"
+done
+
+printf '\n]\n' >> "$OUTPUT.json"
+echo -e "${GREEN}Results written to $OUTPUT.csv and $OUTPUT.json${RESET}"
+exit 0
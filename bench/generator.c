@@ -0,0 +1,154 @@
+/** AUTHOR
+ *
+ * @author agent <agent@local>
+ * @file generator.c
+ * @date 19.10.2026
+ * @brief Generator of valid IFJ24 programs of a given size, for the benchmarks
+ *
+ * Every function declares its statements as locals, each of them nested into alternating ifs and whiles
+ * and assigned an expression of the given amount of operands. The whiles only count up to zero,
+ * so the generated programs also terminate, when they are run.
+ *
+ * Usage: generator [-f functions] [-s statements] [-d depth] [-e operands] [-l string bytes] [-c]
+ */
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Struct for the size of the generated program
+typedef struct GeneratorOptions {
+    unsigned long functions; // functions besides the main
+    unsigned long statements; // locals declared in every function
+    unsigned long depth; // ifs and whiles around the assignment of every local
+    unsigned long operands; // operands of every expression
+    unsigned long strings; // bytes of the string literal written by every function
+    bool chain; // every function calls the previous one, instead of all being called by the main
+} GeneratorOptions;
+
+// deepest indented level, a deeper nesting keeps the source linear in its depth
+#define GENERATOR_MAX_INDENT 8
+
+// Function to print the indentation of the given level
+void generateIndent(unsigned long level) {
+    if (level > GENERATOR_MAX_INDENT) level = GENERATOR_MAX_INDENT;
+    for (unsigned long i = 0; i < level; i++) fputs("    ", stdout);
+}
+
+// Function to print an expression of the given amount of operands, the operands are the parameter,
+// the previous local and literals, the value does not grow with the size
+void generateExpression(unsigned long operands, unsigned long local) {
+    static const char *operators[] = {" + ", " - ", " * "};
+    for (unsigned long i = 0; i < operands; i++) {
+        if (i > 0) fputs(operators[i % 3], stdout);
+
+        // a product is always by one
+        if (i > 0 && i % 3 == 2) fputs("1", stdout);
+        else if (i % 4 == 0) fputs("a", stdout);
+        else if (i % 4 == 1 && local > 0) printf("v%lu", local - 1);
+        else printf("%lu", i % 10);
+    }
+}
+
+// Function to print a single local, the assignment is nested to the given depth
+void generateStatement(GeneratorOptions *options, unsigned long local) {
+    generateIndent(1);
+    printf("var v%lu: i32 = ", local);
+    generateExpression(options->operands, local);
+    fputs(";\n", stdout);
+
+    for (unsigned long level = 0; level < options->depth; level++) {
+        generateIndent(level + 1);
+        if (level % 2 == 0) printf("if (v%lu > %lu) {\n", local, level);
+        else printf("while (v%lu < 0) {\n", local);
+    }
+
+    generateIndent(options->depth + 1);
+    printf("v%lu = v%lu + ", local, local);
+    generateExpression(options->operands > 1 ? options->operands - 1 : 1, local);
+    fputs(";\n", stdout);
+
+    for (unsigned long level = options->depth; level-- > 0;) {
+        // every if has an else
+        generateIndent(level + 1);
+        if (level % 2 == 0) {
+            fputs("} else {\n", stdout);
+            generateIndent(level + 2);
+            printf("v%lu = v%lu - 1;\n", local, local);
+            generateIndent(level + 1);
+        }
+        fputs("}\n", stdout);
+    }
+}
+
+// Function to print a single function, it is named fn<index>, as f64 and similar names are keywords
+void generateFunction(GeneratorOptions *options, unsigned long index) {
+    printf("pub fn fn%lu(a: i32) i32 {\n", index);
+
+    // the literal is split into words, so it stays a valid source for any size
+    if (options->strings > 0) {
+        generateIndent(1);
+        fputs("ifj.write(\"", stdout);
+        for (unsigned long i = 0; i < options->strings; i++) putchar((i % 8 == 7) ? ' ' : 'a' + (char)((index + i) % 26));
+        fputs("\\n\");\n", stdout);
+    }
+
+    unsigned long statements = options->statements ? options->statements : 1;
+    for (unsigned long i = 0; i < statements; i++) generateStatement(options, i);
+
+    if (options->chain && index > 0) {
+        generateIndent(1);
+        printf("const r = fn%lu(v%lu);\n", index - 1, statements - 1);
+        generateIndent(1);
+        printf("return r + v0;\n");
+    } else {
+        generateIndent(1);
+        printf("return v%lu + v0;\n", statements - 1);
+    }
+    fputs("}\n\n", stdout);
+}
+
+// Function to print the whole program
+void generateProgram(GeneratorOptions *options) {
+    fputs("const ifj = @import(\"ifj24.zig\");\n\n", stdout);
+    for (unsigned long i = 0; i < options->functions; i++) generateFunction(options, i);
+
+    fputs("pub fn main() void {\n", stdout);
+    unsigned long called = options->chain ? (options->functions > 0) : options->functions;
+    for (unsigned long i = 0; i < called; i++) {
+        unsigned long index = options->chain ? options->functions - 1 : i;
+        generateIndent(1);
+        printf("const r%lu = fn%lu(%lu);\n", i, index, i % 7);
+        generateIndent(1);
+        printf("ifj.write(r%lu);\n", i);
+    }
+    generateIndent(1);
+    fputs("ifj.write(\"\\n\");\n}\n", stdout);
+}
+
+int main(int argc, char **argv) {
+    GeneratorOptions options = {.functions = 10, .statements = 10, .depth = 2, .operands = 5, .strings = 0, .chain = false};
+    for (int i = 1; i < argc; i++) {
+        unsigned long *value = NULL;
+        if (strcmp(argv[i], "-f") == 0) value = &options.functions;
+        else if (strcmp(argv[i], "-s") == 0) value = &options.statements;
+        else if (strcmp(argv[i], "-d") == 0) value = &options.depth;
+        else if (strcmp(argv[i], "-e") == 0) value = &options.operands;
+        else if (strcmp(argv[i], "-l") == 0) value = &options.strings;
+        else if (strcmp(argv[i], "-c") == 0) {
+            options.chain = true;
+            continue;
+        }
+
+        if (!value || i + 1 >= argc) {
+            fprintf(stderr, "usage: %s [-f functions] [-s statements] [-d depth] [-e operands] [-l string bytes] [-c]\n", argv[0]);
+            return 1;
+        }
+        *value = strtoul(argv[++i], NULL, 10);
+    }
+    if (options.operands == 0) options.operands = 1;
+
+    generateProgram(&options);
+    return 0;
+}
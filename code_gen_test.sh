@@ -29,6 +29,13 @@ fi
 # Binary name
 BINARY_NAME=$1
 
+# Interpreter of the generated code, the one of the repository by default (make interpreter)
+INTERPRETER=${INTERPRETER:-./build/ic24int}
+if [ ! -x "$INTERPRETER" ]; then
+    echo -e "${RED}Error: $INTERPRETER not found, run make interpreter.${RESET}"
+    exit 1
+fi
+
 # Path to the input Zig file and the expected output file
 ZIG_FILE="./test_inputs/code_gen/code_gen.zig"
 EXPECTED_OUTPUT="./test_inputs/code_gen/expected_out.txt"
@@ -49,8 +56,8 @@ fi
 
 # Run the interpreter
 print_section "Running the interpreter"
-echo -e "${YELLOW}Running with: ic24int $PROGRAM_CODE > $PRG_OUT${RESET}"
-ic24int $PROGRAM_CODE > $PRG_OUT
+echo -e "${YELLOW}Running with: $INTERPRETER $PROGRAM_CODE > $PRG_OUT${RESET}"
+"$INTERPRETER" $PROGRAM_CODE > $PRG_OUT
 if [ $? -ne 0 ]; then
     echo -e "${RED}Error running the interpreter!${RESET}"
     rm -f ./$BINARY_NAME $PROGRAM_CODE
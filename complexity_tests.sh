@@ -0,0 +1,144 @@
+#!/bin/bash
+# /** AUTHOR
+#  *
+#  * @author agent <agent@local>
+#  * @file complexity_tests.sh
+#  * @date 19.10.2026
+#  * @brief This script compiles pathological programs of the sizes N, 2N, 4N and 8N and fails, if the compile time
+#  *        grows faster than the allowed exponent of N.
+#  * @note this script is run by the Makefile (make complexity), the programs are made by bench/generator.c
+#  */
+
+# Define color constants
+COLOR_WARN="\033[1;33m"   # Yellow
+COLOR_PASS="\033[1;32m"   # Green
+COLOR_FAIL="\033[1;31m"   # Red
+COLOR_RESET="\033[0m"     # Reset color
+
+# Settings, every one can be given by the environment
+COMPILER=${COMPILER:-./main}               # measured compiler
+GENERATOR=${GENERATOR:-./build/generator}  # generator of the programs
+MAX_EXPONENT=${MAX_EXPONENT:-1.5}          # allowed growth of the compile time, t ~ N^exponent
+SCALE=${SCALE:-1}                          # multiplies every N
+REPEAT=${REPEAT:-3}                        # runs of every size, the fastest one counts
+FLAGS=${FLAGS:-}                           # options of the compiler, e.g. "-j 4"
+
+# Shapes: name, N, the generator options with N in place of the size, the allowed exponent (empty for MAX_EXPONENT)
+SHAPES=(
+    "nesting|250|-f 1 -s 1 -d N -e 2|${MAX_EXPONENT_nesting:-}"
+    "expression|2000|-f 1 -s 1 -d 0 -e N|${MAX_EXPONENT_expression:-}"
+    "locals|500|-f 1 -s N -d 0 -e 2|${MAX_EXPONENT_locals:-}"
+    "functions|300|-f N -s 1 -d 0 -e 2|${MAX_EXPONENT_functions:-}"
+    "strings|200000|-f 1 -s 1 -d 0 -e 1 -l N|${MAX_EXPONENT_strings:-}"
+)
+
+# Initialize test instance
+function initTestInstance() {
+    local testName=$1
+    echo -e "\n\n${COLOR_WARN}=========== $testName ===========${COLOR_RESET}\n"
+}
+
+# Test case function
+function testCase() {
+    local testNum=$1
+    local testName=$2
+    local testResult=$3
+    local passMsg=$4
+    local failMsg=$5
+    echo -e "TEST $testNum: $testName"
+    if [ $testResult -eq 1 ]; then
+        echo -e "  ${COLOR_PASS}PASS${COLOR_RESET}: $passMsg\n"
+    else
+        echo -e "  ${COLOR_FAIL}FAIL${COLOR_RESET}: $failMsg\n"
+    fi
+}
+
+# Finish test instance
+function finishTestInstance() {
+    local totalTests=$1
+    local passedTests=$2
+    local failedTests=$((totalTests - passedTests))
+    echo -e "\n${COLOR_WARN}=========== SUMMARY ===========${COLOR_RESET}"
+    echo -e "${COLOR_PASS}PASSED${COLOR_RESET}: $passedTests/$totalTests"
+    echo -e "${COLOR_FAIL}FAILED${COLOR_RESET}: $failedTests/$totalTests"
+    if [ $failedTests -eq 0 ]; then
+        echo -e "${COLOR_PASS}** ALL TESTS PASSED **${COLOR_RESET}"
+    else
+        echo -e "${COLOR_FAIL}SOME TESTS FAILED${COLOR_RESET}"
+    fi
+}
+
+# Function to measure the compile time of a program in milliseconds, the fastest of the runs,
+# the time is taken by the compiler itself, so the start of the process is not counted
+function compileTime() {
+    local source=$1
+    local best=""
+    for ((run = 0; run < REPEAT; run++)); do
+        local time
+        time=$("$COMPILER" $FLAGS --time-passes < "$source" 2>&1 >/dev/null | grep -o "[0-9.]* ms wall" | cut -d' ' -f1)
+        if [ -z "$time" ]; then return 1; fi
+        if [ -z "$best" ] || awk -v a="$time" -v b="$best" 'BEGIN { exit !(a < b) }'; then best=$time; fi
+    done
+    echo "$best"
+}
+
+# Function to fit the exponent of t ~ N^exponent by the least squares over the logarithms
+function fitExponent() {
+    awk '{ x = log($1); y = log($2); n++; sx += x; sy += y; sxx += x * x; sxy += x * y }
+         END { printf "%.2f", (n * sxy - sx * sy) / (n * sxx - sx * sx) }'
+}
+
+for binary in "$COMPILER" "$GENERATOR"; do
+    if [ ! -x "$binary" ]; then
+        echo -e "${COLOR_FAIL}Error: $binary not found, run make complexity.${COLOR_RESET}"
+        exit 1
+    fi
+done
+
+WORK_DIR=$(mktemp -d)
+trap 'rm -rf "$WORK_DIR"' EXIT
+
+initTestInstance "Complexity Tests"
+echo -e "Compiler: ${COLOR_WARN}$COMPILER${FLAGS:+ $FLAGS}${COLOR_RESET}, the fastest of $REPEAT runs, allowed exponent $MAX_EXPONENT\n"
+
+all_tests=0
+passed_tests=0
+for shape in "${SHAPES[@]}"; do
+    IFS='|' read -r name base options limit <<< "$shape"
+    limit=${limit:-$MAX_EXPONENT}
+    all_tests=$((all_tests + 1))
+
+    # the times of N, 2N, 4N and 8N, a failed compilation fails the shape
+    points=""
+    failed=""
+    for multiple in 1 2 4 8; do
+        size=$((base * SCALE * multiple))
+        source="$WORK_DIR/$name.zig"
+        "$GENERATOR" ${options//N/$size} > "$source"
+        time=$(compileTime "$source")
+        if [ $? -ne 0 ] || [ -z "$time" ]; then
+            failed="the program of the size $size did not compile"
+            break
+        fi
+        echo "  $name N=$size: $time ms"
+        points+="$size $time"$'\n'
+    done
+
+    if [ -n "$failed" ]; then
+        testCase "$all_tests" "Shape $name" 0 "" "$failed"
+        continue
+    fi
+
+    exponent=$(printf "%s" "$points" | fitExponent)
+    passMsg="The time grows as N^$exponent, at most N^$limit allowed"
+    failMsg="The time grows as N^$exponent, more than the allowed N^$limit"
+    if awk -v e="$exponent" -v l="$limit" 'BEGIN { exit !(e <= l) }'; then
+        testCase "$all_tests" "Shape $name" 1 "$passMsg" "$failMsg"
+        passed_tests=$((passed_tests + 1))
+    else
+        testCase "$all_tests" "Shape $name" 0 "$passMsg" "$failMsg"
+    fi
+done
+
+finishTestInstance "$all_tests" "$passed_tests"
+[ "$passed_tests" -eq "$all_tests" ]
@@ -0,0 +1,77 @@
+/** AUTHOR
+ *
+ * @author agent <agent@local>
+ * @file batch.h
+ * @date 19.10.2026
+ * @brief Header file for the batch mode, compiles many files on a pool of worker threads
+ */
+
+#ifndef BATCH_H
+#define BATCH_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "cache.h"
+#include "ifj24.h"
+
+// extension of the generated files
+#define BATCH_OUTPUT_EXTENSION ".ifjcode"
+
+// Struct for a single file of the batch
+typedef struct BatchFile {
+    char *input; // path of the source
+    char *output; // path of the generated code
+    size_t bytes; // size of the source
+    double latency; // seconds from reading the source to writing the code
+    int error; // exit code of the compiler, E_INTERNAL if the files could not be read or written
+    char diagnostic[IFJ24_DIAGNOSTIC_LENGTH]; // description of the error
+} BatchFile;
+
+// Struct for the whole batch
+typedef struct Batch {
+    BatchFile *files; // the files in the order they were given
+    size_t count; // amount of files
+    size_t capacity; // allocated amount of files
+    const char *outputDir; // where the generated code is written, NULL writes it next to the source
+    unsigned int jobs; // amount of worker threads
+    CompileCache *cache; // the code of the unchanged sources is taken from here, NULL compiles every file
+} Batch;
+
+/**
+ * Runs the batch mode, the arguments are [-j <jobs>] [-o <output dir>] [-c <cache dir>] <file or directory>...
+ * Every .zig file of a directory is compiled, the code of <name>.zig is written to <name>.ifjcode.
+ * Prints the errors, throughput and latency percentiles.
+ *
+ * @param argc amount of the arguments
+ * @param argv the arguments, without the program name and the --batch flag
+ * @return 0 if every file compiled, the exit code of the first failed file otherwise
+ */
+int batchMain(int argc, char **argv);
+
+/**
+ * Adds a file or all the .zig files of a directory, sorted by name, to the batch
+ *
+ * @param batch the batch
+ * @param path path of the file or directory
+ * @return true on success, false if the path does not exist or on allocation failure
+ */
+bool batchAddPath(Batch *batch, const char *path);
+
+/**
+ * Compiles all the files of the batch on the worker threads
+ *
+ * @param batch the batch
+ * @param steals if not NULL, amount of files done by another worker, than the one they were given to
+ * @return true on success, false if the workers could not be started
+ */
+bool batchRun(Batch *batch, size_t *steals);
+
+/**
+ * Frees all the files of the batch
+ *
+ * @param batch the batch
+ */
+void batchFree(Batch *batch);
+
+#endif // BATCH_H
@@ -0,0 +1,142 @@
+/** AUTHOR
+ *
+ * @author agent <agent@local>
+ * @file cache.h
+ * @date 19.10.2026
+ * @brief Header file for the on-disk compile cache, the generated code is stored under the hash of the source
+ */
+
+#ifndef CACHE_H
+#define CACHE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stddef.h>
+
+#include "ifj24.h"
+
+// extension of the cached code, the other files in the directory are left alone
+#define COMPILE_CACHE_EXTENSION ".ifjcode"
+
+// length of the key, two 64 bit hashes in hex, without the null terminator
+#define COMPILE_CACHE_KEY_LENGTH 32
+
+// default size limit of the cache in bytes
+#ifndef COMPILE_CACHE_LIMIT
+#define COMPILE_CACHE_LIMIT (64u << 20)
+#endif
+
+// Struct for the cache, the counters can be updated by more threads
+typedef struct CompileCache {
+    const char *dir; // the cache directory
+    const char *build; // identity of the generated code, a part of every key, ifj24BuildId() by default
+    size_t limit; // the least recently used entries are removed over this total size, 0 is no limit
+    size_t size; // total size of the entries since the directory was last scanned, SIZE_MAX before the first scan
+    size_t hits; // lookups, that found the code
+    size_t misses; // lookups, that did not
+    size_t stores; // entries written
+    size_t evictions; // entries removed over the limit
+} CompileCache;
+
+// Struct for the two hashes of a key, computed in a single pass
+typedef struct CompileCacheHash {
+    uint64_t fnv; // FNV-1a
+    uint64_t mix; // multiply and shift, so a collision of both is unlikely
+} CompileCacheHash;
+
+/**
+ * Opens the cache, the directory is created if it does not exist
+ *
+ * @param cache the cache to initialize
+ * @param dir the cache directory, it has to outlive the cache
+ * @param limit size limit in bytes, 0 is no limit
+ * @return true on success, false if the directory cannot be created
+ */
+bool compileCacheInit(CompileCache *cache, const char *dir, size_t limit);
+
+/**
+ * Hashes the source together with the identity of the generated code and the options, that change it
+ *
+ * @param cache the cache, its build is hashed
+ * @param source the source code
+ * @param length length of the source
+ * @param options the options, NULL are the defaults
+ * @param key where the key is written, COMPILE_CACHE_KEY_LENGTH + 1 characters
+ */
+void compileCacheKey(const CompileCache *cache, const char *source, size_t length, const Ifj24Options *options, char *key);
+
+/**
+ * Starts hashing a key
+ *
+ * @param hash the hash to initialize
+ */
+void compileCacheHashInit(CompileCacheHash *hash);
+
+/**
+ * Adds bytes to the hashed key
+ *
+ * @param hash the hash
+ * @param data the bytes
+ * @param length amount of the bytes
+ */
+void compileCacheHashAdd(CompileCacheHash *hash, const void *data, size_t length);
+
+/**
+ * Writes the hashed key
+ *
+ * @param hash the hash
+ * @param key where the key is written, COMPILE_CACHE_KEY_LENGTH + 1 characters
+ */
+void compileCacheHashKey(CompileCacheHash *hash, char *key);
+
+/**
+ * Reads the cached code of the key, a hit makes the entry the most recently used
+ *
+ * @param cache the cache
+ * @param key the key of the source
+ * @param length where the length of the code is stored on a hit
+ * @return the null terminated code, has to be freed, NULL on a miss, or if the entry cannot be read
+ */
+char *compileCacheLoad(CompileCache *cache, const char *key, size_t *length);
+
+/**
+ * Counts a loaded entry, that could not be used, as a miss instead of a hit
+ *
+ * @param cache the cache
+ */
+void compileCacheReject(CompileCache *cache);
+
+/**
+ * Writes the cached code of the key to the stream, the entry is read whole first,
+ * so nothing is written, if it cannot be read
+ *
+ * @param cache the cache
+ * @param key the key of the source
+ * @param output where the code is written
+ * @return true on a hit, false on a miss, or if the entry cannot be read
+ */
+bool compileCacheLookup(CompileCache *cache, const char *key, FILE *output);
+
+/**
+ * Stores the code under the key, it is written to a temporary file and renamed, so a concurrent
+ * lookup never sees a partial entry. Once the stored entries could be over the limit, the directory
+ * is scanned and the least recently used entries are removed.
+ *
+ * @param cache the cache
+ * @param key the key of the source
+ * @param code the generated code
+ * @param length length of the code
+ * @return true on success
+ */
+bool compileCacheStore(CompileCache *cache, const char *key, const char *code, size_t length);
+
+/**
+ * Prints the hits, misses, stored and evicted entries
+ *
+ * @param cache the cache
+ * @param output where the statistics are printed
+ */
+void compileCachePrintStats(CompileCache *cache, FILE *output);
+
+#endif // CACHE_H
@@ -9,74 +9,108 @@
 #ifndef BUILTIN_GENERATOR_H
 #define BUILTIN_GENERATOR_H
 
+#ifdef USE_CUSTOM_STRUCTURE
+#include "utility/output_buffer.h"
+#else
+#include "output_buffer.h"
+#endif
+
 /**
  * Generates the built-in function for writing output.
+ * 
+ * @param out The output buffer for the generated code.
  */
-void generateFuncWrite(void);
+void generateFuncWrite(OutputBuffer *out);
 
 /**
  * Generates the built-in function for reading a string input.
+ * 
+ * @param out The output buffer for the generated code.
  */
-void generateFuncReadStr(void);
+void generateFuncReadStr(OutputBuffer *out);
 
 /**
  * Generates the built-in function for reading an integer input.
+ * 
+ * @param out The output buffer for the generated code.
  */
-void generateFuncReadInt(void);
+void generateFuncReadInt(OutputBuffer *out);
 
 /**
  * Generates the built-in function for reading a float input.
+ * 
+ * @param out The output buffer for the generated code.
  */
-void generateFuncReadFloat(void);
+void generateFuncReadFloat(OutputBuffer *out);
 
 /**
  * Generates the built-in function for converting an integer to a float.
+ * 
+ * @param out The output buffer for the generated code.
  */
-void generateFuncInt2Float(void);
+void generateFuncInt2Float(OutputBuffer *out);
 
 /**
  * Generates the built-in function for converting a float to an integer.
+ * 
+ * @param out The output buffer for the generated code.
  */
-void generateFuncFloat2Int(void);
+void generateFuncFloat2Int(OutputBuffer *out);
 
 /**
  * Generates the built-in function for handling string operations.
+ * 
+ * @param out The output buffer for the generated code.
  */
-void generateFuncString(void);
+void generateFuncString(OutputBuffer *out);
 
 /**
  * Generates the built-in function for calculating the length of a string.
+ * 
+ * @param out The output buffer for the generated code.
  */
-void generateFuncLength(void);
+void generateFuncLength(OutputBuffer *out);
 
 /**
  * Generates the built-in function for concatenating two strings.
+ * 
+ * @param out The output buffer for the generated code.
  */
-void generateFuncConcat(void);
+void generateFuncConcat(OutputBuffer *out);
 
 /**
  * Generates the built-in function for extracting a substring from a string.
+ * 
+ * @param out The output buffer for the generated code.
  */
-void generateFuncSubStr(void);
+void generateFuncSubStr(OutputBuffer *out);
 
 /**
  * Generates the built-in function for comparing two strings.
+ * 
+ * @param out The output buffer for the generated code.
  */
-void generateFuncStrCompare(void);
+void generateFuncStrCompare(OutputBuffer *out);
 
 /**
  * Generates the built-in function for getting the ordinal value of a character in a string.
+ * 
+ * @param out The output buffer for the generated code.
  */
-void generateFuncStrOrd(void);
+void generateFuncStrOrd(OutputBuffer *out);
 
 /**
  * Generates the built-in function for getting the character from an ordinal value.
+ * 
+ * @param out The output buffer for the generated code.
  */
-void generateFuncStrChr(void);
+void generateFuncStrChr(OutputBuffer *out);
 
 /**
  * Generates all the built-in functions.
+ * 
+ * @param out The output buffer for the generated code.
  */
-void generateBuiltins(void);
+void generateBuiltins(OutputBuffer *out);
 
 #endif // BUILTIN_GENERATOR_H
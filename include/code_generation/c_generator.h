@@ -0,0 +1,165 @@
+/** AUTHOR
+ *
+ * @author agent <agent@local>
+ * @file c_generator.h
+ * @date 19.10.2026
+ * @brief Declarations for the C backend, the analyzed program is generated as a portable C99 source
+ *
+ * Every function becomes a static C function and every variable a typed C local, i32 is an ifj_i32
+ * (64 bit, as the ints of IFJcode24), f64 a double and []u8 an ifj_u8 slice. The nullable values are
+ * tagged structs, ifj_opt_i32, ifj_opt_f64 and ifj_opt_u8. The builtins are the runtime emitted by
+ * c_runtime.h at the start of the source, so the result only needs the C standard library.
+ */
+
+#ifndef C_GENERATOR_H
+#define C_GENERATOR_H
+
+#ifdef USE_CUSTOM_STRUCTURE
+#include "syntaxical/ast.h"
+#include "utility/compiler_context.h"
+#else
+#include "ast.h"
+#include "compiler_context.h"
+#endif
+
+/**
+ * Function to generate the C source of the entire program, the functions are not inlined by the compiler,
+ * that is left to the C compiler.
+ *
+ * @param program Pointer to the analyzed Program structure.
+ * @param ctx Pointer to the CompilerContext, holds the OutputBuffer the source is written to.
+ */
+void generateCProgram(Program *program, CompilerContext *ctx);
+
+/**
+ * Function to generate the declaration of a function, without the semicolon or the body.
+ *
+ * @param function Pointer to the Function structure.
+ * @param ctx Pointer to the CompilerContext.
+ */
+void generateCFunctionHead(Function *function, CompilerContext *ctx);
+
+/**
+ * Function to generate the definition of a function.
+ *
+ * @param function Pointer to the Function structure.
+ * @param ctx Pointer to the CompilerContext.
+ */
+void generateCFunction(Function *function, CompilerContext *ctx);
+
+/**
+ * Function to generate the statements of a body, indented one level deeper than the current one.
+ *
+ * @param body Pointer to the Body structure.
+ * @param ctx Pointer to the CompilerContext.
+ */
+void generateCBody(Body *body, CompilerContext *ctx);
+
+/**
+ * Function to generate a single statement.
+ *
+ * @param statement Pointer to the Statement structure.
+ * @param ctx Pointer to the CompilerContext.
+ */
+void generateCStatement(Statement *statement, CompilerContext *ctx);
+
+/**
+ * Function to generate a variable definition, the variable is declared in the C block of its scope.
+ *
+ * @param statement Pointer to the VariableDefinitionStatement structure.
+ * @param ctx Pointer to the CompilerContext.
+ */
+void generateCVariableDefinitionStatement(VariableDefinitionStatement *statement, CompilerContext *ctx);
+
+/**
+ * Function to generate an assignment, or the evaluation of a discarded value.
+ *
+ * @param statement Pointer to the AssigmentStatement structure.
+ * @param ctx Pointer to the CompilerContext.
+ */
+void generateCAssigmentStatement(AssigmentStatement *statement, CompilerContext *ctx);
+
+/**
+ * Function to generate an if statement, the optional value of a nullable condition is kept in its own local.
+ *
+ * @param statement Pointer to the IfStatement structure.
+ * @param ctx Pointer to the CompilerContext.
+ */
+void generateCIfStatement(IfStatement *statement, CompilerContext *ctx);
+
+/**
+ * Function to generate a while statement, a nullable condition is tested at the start of the loop body.
+ *
+ * @param statement Pointer to the WhileStatement structure.
+ * @param ctx Pointer to the CompilerContext.
+ */
+void generateCWhileStatement(WhileStatement *statement, CompilerContext *ctx);
+
+/**
+ * Function to generate a return statement, the value is converted to the return type of the function.
+ *
+ * @param statement Pointer to the ReturnStatement structure.
+ * @param ctx Pointer to the CompilerContext, its labelScope is the name of the generated function.
+ */
+void generateCReturnStatement(ReturnStatement *statement, CompilerContext *ctx);
+
+/**
+ * Function to generate an expression with its implicit conversion.
+ *
+ * @param expression Pointer to the Expression structure.
+ * @param ctx Pointer to the CompilerContext.
+ */
+void generateCExpression(Expression *expression, CompilerContext *ctx);
+
+/**
+ * Function to generate an expression converted to the given type, the non nullable values
+ * and the null literal are wrapped into the optional struct of a nullable type.
+ *
+ * @param expression Pointer to the Expression structure.
+ * @param type The target type.
+ * @param nullable If the target type is nullable.
+ * @param ctx Pointer to the CompilerContext.
+ */
+void generateCValue(Expression *expression, enum DATA_TYPES type, bool nullable, CompilerContext *ctx);
+
+/**
+ * Function to generate a call of a user function or of a builtin of the runtime.
+ *
+ * @param function_call Pointer to the FunctionCall structure.
+ * @param ctx Pointer to the CompilerContext.
+ */
+void generateCFunctionCall(FunctionCall *function_call, CompilerContext *ctx);
+
+/**
+ * Function to generate a literal.
+ *
+ * @param literal Pointer to the Literal structure.
+ * @param ctx Pointer to the CompilerContext.
+ */
+void generateCLiteral(Literal *literal, CompilerContext *ctx);
+
+/**
+ * Function to generate a binary expression, the i32 arithmetic wraps around and the division is checked.
+ *
+ * @param binary_expression Pointer to the BinaryExpression structure.
+ * @param ctx Pointer to the CompilerContext.
+ */
+void generateCBinaryExpression(BinaryExpression *binary_expression, CompilerContext *ctx);
+
+/**
+ * Function to get the type of an expression after its implicit conversion.
+ *
+ * @param expression Pointer to the Expression structure.
+ * @return The data type of the generated C expression.
+ */
+enum DATA_TYPES cExpressionType(Expression *expression);
+
+/**
+ * Function to determin, if the generated C expression is an optional struct.
+ *
+ * @param expression Pointer to the Expression structure.
+ * @return true for the nullable variables and calls.
+ */
+bool cExpressionNullable(Expression *expression);
+
+#endif // C_GENERATOR_H
@@ -0,0 +1,70 @@
+/** AUTHOR
+ *
+ * @author agent <agent@local>
+ * @file c_runtime.h
+ * @date 19.10.2026
+ * @brief Declarations of the runtime of the C backend, it is emitted at the start of every generated C source
+ *
+ * The runtime gives the same results and the same exit codes as the IFJcode24 interpreter. The strings are
+ * immutable slices, they are never freed, a substring shares the data of its string.
+ */
+
+#ifndef C_RUNTIME_H
+#define C_RUNTIME_H
+
+#ifdef USE_CUSTOM_STRUCTURE
+#include "utility/output_buffer.h"
+#else
+#include "output_buffer.h"
+#endif
+
+/**
+ * Generates the includes and the types of the values.
+ *
+ * @param out The output buffer for the generated source.
+ */
+void generateCRuntimeTypes(OutputBuffer *out);
+
+/**
+ * Generates the optional values, their constructors and their comparison.
+ *
+ * @param out The output buffer for the generated source.
+ */
+void generateCRuntimeOptionals(OutputBuffer *out);
+
+/**
+ * Generates the arithmetic of the numbers and the conversions ifj.i2f and ifj.f2i.
+ *
+ * @param out The output buffer for the generated source.
+ */
+void generateCRuntimeNumbers(OutputBuffer *out);
+
+/**
+ * Generates the string builtins.
+ *
+ * @param out The output buffer for the generated source.
+ */
+void generateCRuntimeStrings(OutputBuffer *out);
+
+/**
+ * Generates the builtins ifj.readstr, ifj.readi32 and ifj.readf64.
+ *
+ * @param out The output buffer for the generated source.
+ */
+void generateCRuntimeInput(OutputBuffer *out);
+
+/**
+ * Generates the builtin ifj.write for every type.
+ *
+ * @param out The output buffer for the generated source.
+ */
+void generateCRuntimeOutput(OutputBuffer *out);
+
+/**
+ * Generates the whole runtime.
+ *
+ * @param out The output buffer for the generated source.
+ */
+void generateCRuntime(OutputBuffer *out);
+
+#endif // C_RUNTIME_H
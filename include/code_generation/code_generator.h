@@ -11,148 +11,263 @@
 
 #ifdef USE_CUSTOM_STRUCTURE
 #include "syntaxical/ast.h"
+#include "utility/compiler_context.h"
 #else
 #include "ast.h"
+#include "compiler_context.h"
 #endif
 
+// Struct for the generation of a single function into its own buffer, the functions are generated in parallel
+typedef struct FunctionGeneration {
+    Function *function; // the generated function
+    CompilerContext ctx; // copy of the context, with its own OutputBuffer and label counters
+} FunctionGeneration;
+
 /**
  * Function to generate code for the entire program.
  * 
  * @param program Pointer to the Program structure.
+ * @param ctx Pointer to the CompilerContext, holds the OutputBuffer the code is written to.
+ */
+void generateCodeProgram(Program *program, CompilerContext *ctx);
+
+/**
+ * Function to generate the code before the functions, the global variables and the call of main.
+ * 
+ * @param ctx Pointer to the CompilerContext, holds the OutputBuffer the code is written to.
+ */
+void generateCodeHeader(CompilerContext *ctx);
+
+/**
+ * Function to generate all the functions on the work pool, every one into its own buffer,
+ * the buffers are then appended in the source order.
+ * 
+ * @param program Pointer to the Program structure.
+ * @param jobs Amount of worker threads.
+ * @param ctx Pointer to the CompilerContext, holds the OutputBuffer the code is appended to.
+ * @return true on success, false if nothing was generated, because of an allocation or thread failure.
  */
-void generateCodeProgram(Program *program);
+bool generateCodeFunctionsParallel(Program *program, unsigned int jobs, CompilerContext *ctx);
+
+/**
+ * Function to generate a single function, the task of the work pool.
+ * 
+ * @param data Array of FunctionGeneration.
+ * @param index Index of the generated function.
+ */
+void generateCodeFunctionTask(void *data, size_t index);
 
 /**
  * Function to generate code for a function.
  * 
  * @param function Pointer to the Function structure.
+ * @param ctx Pointer to the CompilerContext, holds the OutputBuffer the code is written to.
  */
-void generateCodeFunction(Function *function);
+void generateCodeFunction(Function *function, CompilerContext *ctx);
+
+/**
+ * Function to generate the entry of a tail recursive function, the params are popped after its label.
+ * 
+ * @param function Pointer to the Function structure.
+ * @param ctx Pointer to the CompilerContext, holds the OutputBuffer the code is written to.
+ */
+void generateCodeTailEntry(Function *function, CompilerContext *ctx);
 
 /**
  * Function to generate code for the body of a function or program.
  * 
  * @param body Pointer to the Body structure.
+ * @param ctx Pointer to the CompilerContext, holds the OutputBuffer the code is written to.
  */
-void generateCodeBody(Body *body);
+void generateCodeBody(Body *body, CompilerContext *ctx);
 
 /**
  * Function to generate code for a statement.
  * 
  * @param statement Pointer to the Statement structure.
+ * @param ctx Pointer to the CompilerContext, holds the OutputBuffer the code is written to.
+ */
+void generateCodeStatement(Statement *statement, CompilerContext *ctx);
+
+/**
+ * Function to generate an instruction with a single local variable operand, eg. POPS TF@a_3.
+ * 
+ * @param instruction Name of the instruction.
+ * @param name Name of the variable.
+ * @param id Unique id of the variable.
+ * @param ctx Pointer to the CompilerContext, holds the OutputBuffer the code is written to.
  */
-void generateCodeStatement(Statement *statement);
+void generateCodeVarInstruction(const char *instruction, char *name, int id, CompilerContext *ctx);
+
+/**
+ * Function to generate a label of an if or while, numbered inside the current function, eg. JUMP $if_main_3_end.
+ * 
+ * @param prefix Part before the id, the name of the function is appended to it.
+ * @param id Number of the statement inside the function.
+ * @param suffix Part after the id.
+ * @param ctx Pointer to the CompilerContext, holds the OutputBuffer the code is written to.
+ */
+void generateCodeScopedLabel(const char *prefix, int id, const char *suffix, CompilerContext *ctx);
 
 /**
  * Function to generate code for a parameter.
  * 
  * @param param Pointer to the Param structure.
+ * @param ctx Pointer to the CompilerContext, holds the OutputBuffer the code is written to.
  */
-void generateCodeParam(Param *param);
+void generateCodeParam(Param *param, CompilerContext *ctx);
 
 /**
  * Function to generate code for a variable definition statement.
  * 
  * @param statement Pointer to the VariableDefinitionStatement structure.
+ * @param ctx Pointer to the CompilerContext, holds the OutputBuffer the code is written to.
  */
-void generateCodeVariableDefinitionStatement(VariableDefinitionStatement *statement);
+void generateCodeVariableDefinitionStatement(VariableDefinitionStatement *statement, CompilerContext *ctx);
 
 /**
  * Function to generate code for an assignment statement.
  * 
  * @param statement Pointer to the AssigmentStatement structure.
+ * @param ctx Pointer to the CompilerContext, holds the OutputBuffer the code is written to.
  */
-void generateCodeAssigmentStatement(AssigmentStatement *statement);
+void generateCodeAssigmentStatement(AssigmentStatement *statement, CompilerContext *ctx);
 
 /**
  * Function to generate code for an if statement.
  * 
  * @param statement Pointer to the IfStatement structure.
+ * @param ctx Pointer to the CompilerContext, holds the OutputBuffer the code is written to.
  */
-void generateCodeIfStatement(IfStatement *statement);
+void generateCodeIfStatement(IfStatement *statement, CompilerContext *ctx);
 
 /**
  * Function to generate code for a while statement.
  * 
  * @param statement Pointer to the WhileStatement structure.
+ * @param ctx Pointer to the CompilerContext, holds the OutputBuffer the code is written to.
  */
-void generateCodeWhileStatement(WhileStatement *statement);
+void generateCodeWhileStatement(WhileStatement *statement, CompilerContext *ctx);
 
 /**
  * Function to generate code for a return statement.
  * 
  * @param statement Pointer to the ReturnStatement structure.
+ * @param ctx Pointer to the CompilerContext, holds the OutputBuffer the code is written to.
  */
-void generateCodeReturnStatement(ReturnStatement *statement);
+void generateCodeReturnStatement(ReturnStatement *statement, CompilerContext *ctx);
 
 /**
  * Function to generate code for an expression.
  * 
  * @param expression Pointer to the Expression structure.
+ * @param ctx Pointer to the CompilerContext, holds the OutputBuffer the code is written to.
  */
-void generateCodeExpression(Expression *expression);
+void generateCodeExpression(Expression *expression, CompilerContext *ctx);
 
 /**
  * Function to generate code for a function call.
  * 
  * @param function_call Pointer to the FunctionCall structure.
+ * @param ctx Pointer to the CompilerContext, holds the OutputBuffer the code is written to.
+ */
+void generateCodeFunctionCall(FunctionCall *function_call, CompilerContext *ctx);
+
+/**
+ * Function to generate the inlined body of a user function in place of its call.
+ * 
+ * @param function_call Pointer to the FunctionCall structure, its inlined_body is set.
+ * @param ctx Pointer to the CompilerContext, holds the OutputBuffer the code is written to.
+ */
+void generateCodeInlinedCall(FunctionCall *function_call, CompilerContext *ctx);
+
+/**
+ * Function to generate a builtin call inline, without the CALL and frame handling.
+ * 
+ * @param function_call Pointer to the FunctionCall structure, its arguments are already on the stack.
+ * @param ctx Pointer to the CompilerContext, holds the OutputBuffer the code is written to.
+ * @return true if the builtin was generated inline, false if a CALL is needed.
  */
-void generateCodeFunctionCall(FunctionCall *function_call);
+bool generateInlineBuiltin(FunctionCall *function_call, CompilerContext *ctx);
 
 /**
  * Function to generate code for an identifier.
  * 
  * @param identifier Pointer to the Identifier structure.
+ * @param ctx Pointer to the CompilerContext, holds the OutputBuffer the code is written to.
  */
-void generateCodeIdentifier(Identifier *identifier);
+void generateCodeIdentifier(Identifier *identifier, CompilerContext *ctx);
 
 /**
  * Function to generate code for a literal value.
  * 
  * @param literal Pointer to the Literal structure.
+ * @param ctx Pointer to the CompilerContext, holds the OutputBuffer the code is written to.
  */
-void generateCodeLiteral(Literal *literal);
+void generateCodeLiteral(Literal *literal, CompilerContext *ctx);
 
 /**
  * Function to generate code for a binary expression.
  * 
  * @param binary_expression Pointer to the BinaryExpression structure.
+ * @param ctx Pointer to the CompilerContext, holds the OutputBuffer the code is written to.
  */
-void generateCodeBinaryExpression(BinaryExpression *binary_expression);
+void generateCodeBinaryExpression(BinaryExpression *binary_expression, CompilerContext *ctx);
 
 /**
  * Function to pre-generate code for the body of a function or program.
  * 
  * @param body Pointer to the Body structure.
+ * @param ctx Pointer to the CompilerContext, holds the OutputBuffer the code is written to.
  */
-void preGenerateBody(Body *body);
+void preGenerateBody(Body *body, CompilerContext *ctx);
 
 /**
  * Function to pre-generate code for a statement.
  * 
  * @param statement Pointer to the Statement structure.
+ * @param ctx Pointer to the CompilerContext, holds the OutputBuffer the code is written to.
+ */
+void preGenerateStatement(Statement *statement, CompilerContext *ctx);
+
+/**
+ * Function to pre-generate code for an expression.
+ * 
+ * @param expression Pointer to the Expression structure.
+ * @param ctx Pointer to the CompilerContext, holds the OutputBuffer the code is written to.
+ */
+void preGenerateExpression(Expression *expression, CompilerContext *ctx);
+
+/**
+ * Function to pre-generate code for a function call, only inlined calls define variables.
+ * 
+ * @param function_call Pointer to the FunctionCall structure.
+ * @param ctx Pointer to the CompilerContext, holds the OutputBuffer the code is written to.
  */
-void preGenerateStatement(Statement *statement);
+void preGenerateFunctionCall(FunctionCall *function_call, CompilerContext *ctx);
 
 /**
  * Function to pre-generate code for a variable definition statement.
  * 
  * @param statement Pointer to the VariableDefinitionStatement structure.
+ * @param ctx Pointer to the CompilerContext, holds the OutputBuffer the code is written to.
  */
-void preGenerateVariableDefinitionStatement(VariableDefinitionStatement *statement);
+void preGenerateVariableDefinitionStatement(VariableDefinitionStatement *statement, CompilerContext *ctx);
 
 /**
  * Function to pre-generate code for an if statement.
  * 
  * @param statement Pointer to the IfStatement structure.
+ * @param ctx Pointer to the CompilerContext, holds the OutputBuffer the code is written to.
  */
-void preGenerateIfStatement(IfStatement *statement);
+void preGenerateIfStatement(IfStatement *statement, CompilerContext *ctx);
 
 /**
  * Function to pre-generate code for a while statement.
  * 
  * @param statement Pointer to the WhileStatement structure.
+ * @param ctx Pointer to the CompilerContext, holds the OutputBuffer the code is written to.
  */
-void preGenerateWhileStatement(WhileStatement *statement);
+void preGenerateWhileStatement(WhileStatement *statement, CompilerContext *ctx);
 
 #endif //CODE_GENERATOR_H
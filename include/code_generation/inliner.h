@@ -0,0 +1,206 @@
+/** AUTHOR
+ *
+ * @author agent <agent@local>
+ * @file inliner.h
+ * @date 19.10.2026
+ * @brief Declarations for the AST level inliner of small user functions
+ */
+
+#ifndef INLINER_H
+#define INLINER_H
+
+#include <stdio.h>
+
+#ifdef USE_CUSTOM_STRUCTURE
+#include "syntaxical/ast.h"
+#include "utility/binary_search_tree.h"
+#include "utility/enumerations.h"
+#else
+#include "ast.h"
+#include "binary_search_tree.h"
+#include "enumerations.h"
+#endif
+
+// max amount of statements (nested ones included) of a function, that can still be inlined, 0 disables inlining
+#ifndef INLINE_STATEMENT_BUDGET
+#define INLINE_STATEMENT_BUDGET 8
+#endif
+
+// stream for the diagnostics dump of the inlined call sites, enabled by compiling with -DINLINE_REPORT
+#ifdef INLINE_REPORT
+#define INLINE_REPORT_STREAM stderr
+#else
+#define INLINE_REPORT_STREAM NULL
+#endif
+
+// Mapping of a callee variable to its renamed copy at one call site
+typedef struct InlineVarMapping {
+    SymVariable *original;
+    SymVariable *copy;
+} InlineVarMapping;
+
+// Inlining information of one user function, computed once, before its callers are inlined
+typedef struct InlineFunctionInfo {
+    Function *function;
+    unsigned int index; // order of the discovery by the search of the call graph, 0 for not discovered yet
+    unsigned int lowLink; // smallest index reachable from the function, that is still on the search stack
+    bool onStack; // the function is on the search stack
+    bool recursive; // the function can reach itself through calls
+    bool inlinable; // not main, not recursive and small enough, after its own call sites were inlined
+} InlineFunctionInfo;
+
+// State of one inlining run over the program
+typedef struct Inliner {
+    Program *program;
+    SymTable *table;
+    unsigned int siteCount; // amount of inlined call sites, also used as the id of the next one
+    FILE *report; // where to dump the inlined call sites, NULL for no report
+    InlineFunctionInfo *functions; // information of every user function, in the order of the program
+    unsigned int functionCount;
+    BST *names; // hash of the function name -> list of the functions with the same hash
+    InlineFunctionInfo **stack; // search stack of the call graph
+    unsigned int stackSize;
+    unsigned int searchIndex; // index of the last discovered function
+} Inliner;
+
+/**
+ * Function to inline calls of small, non recursive user functions in the whole program
+ *
+ * @param program - the analyzed program
+ * @param table - the symbol table, the renamed variables are registered in it
+ * @param report - stream for the diagnostics dump of the inlined call sites, NULL for none
+ * @return enum ERR_CODES - the error code
+ */
+enum ERR_CODES inlineProgram(Program *program, SymTable *table, FILE *report);
+
+/**
+ * Function to init the inliner, every user function is registered under its name
+ *
+ * @param inliner - the inliner to init
+ * @param program - the analyzed program
+ * @param table - the symbol table, the renamed variables are registered in it
+ * @param report - stream for the diagnostics dump of the inlined call sites, NULL for none
+ * @return enum ERR_CODES - the error code
+ */
+enum ERR_CODES inlineInit(Inliner *inliner, Program *program, SymTable *table, FILE *report);
+
+/**
+ * Function to free the inliner, the program is kept
+ *
+ * @param inliner - the inliner to free
+ */
+void inlineFree(Inliner *inliner);
+
+/**
+ * Function to search the call graph from a function (Tarjan), every strongly connected component is
+ * finished after all the functions it calls, so the callees are inlined before their callers
+ *
+ * @param inliner - the inliner state
+ * @param info - the function to search from, not discovered yet
+ * @return enum ERR_CODES - the error code
+ */
+enum ERR_CODES inlineVisitFunction(Inliner *inliner, InlineFunctionInfo *info);
+
+/**
+ * Function to search the calls of a body of the visited function
+ *
+ * @param inliner - the inliner state
+ * @param info - the visited function
+ * @param body - the body to search for calls
+ * @return enum ERR_CODES - the error code
+ */
+enum ERR_CODES inlineVisitBody(Inliner *inliner, InlineFunctionInfo *info, Body *body);
+
+/**
+ * Function to finish a strongly connected component, its functions are taken from the search stack,
+ * their call sites are inlined and then it is decided, if they can be inlined themselves
+ *
+ * @param inliner - the inliner state
+ * @param root - the first discovered function of the component
+ * @return enum ERR_CODES - the error code
+ */
+enum ERR_CODES inlineFinishComponent(Inliner *inliner, InlineFunctionInfo *root);
+
+/**
+ * Function to inline the call sites inside of a body
+ *
+ * @param inliner - the inliner state
+ * @param caller - the function, the body belongs to
+ * @param body - the body to go through
+ * @return enum ERR_CODES - the error code
+ */
+enum ERR_CODES inlineBody(Inliner *inliner, Function *caller, Body *body);
+
+/**
+ * Function to inline a single call site, if the callee is small enough
+ *
+ * @param inliner - the inliner state
+ * @param caller - the function containing the call
+ * @param function_call - the call to inline
+ * @return enum ERR_CODES - the error code
+ */
+enum ERR_CODES inlineFunctionCall(Inliner *inliner, Function *caller, FunctionCall *function_call);
+
+/**
+ * Function to find the inlining information of a user function
+ *
+ * @param inliner - the inliner state
+ * @param name - name of the function
+ * @return pointer to the information, NULL for builtins or unknown functions
+ */
+InlineFunctionInfo *inlineFindFunction(Inliner *inliner, char *name);
+
+/**
+ * Function to count the statements of a body, nested bodies and the inlined copies included
+ *
+ * @param body - the body to count
+ * @return amount of statements
+ */
+unsigned int inlineCountStatements(Body *body);
+
+/**
+ * Function to copy a body, renaming all the callee variables
+ *
+ * @param inliner - the inliner state
+ * @param body - the body to copy
+ * @param copy - where the copy will be stored
+ * @param mapping - the variable mapping of the call site
+ * @param call - the inlined call site
+ * @return true, if the copy was successful
+ */
+bool inlineCopyBody(Inliner *inliner, Body *body, Body *copy, LinkedList *mapping, FunctionCall *call);
+
+/**
+ * Function to copy a statement, renaming all the callee variables
+ *
+ * @param inliner - the inliner state
+ * @param statement - the statement to copy
+ * @param copy - where the copy will be stored
+ * @param mapping - the variable mapping of the call site
+ * @param call - the inlined call site
+ * @return true, if the copy was successful
+ */
+bool inlineCopyStatement(Inliner *inliner, Statement *statement, Statement *copy, LinkedList *mapping, FunctionCall *call);
+
+/**
+ * Function to copy an expression, renaming all the callee variables
+ *
+ * @param inliner - the inliner state
+ * @param expr - the expression to copy
+ * @param copy - where the copy will be stored
+ * @param mapping - the variable mapping of the call site
+ * @return true, if the copy was successful
+ */
+bool inlineCopyExpression(Inliner *inliner, Expression *expr, Expression *copy, LinkedList *mapping);
+
+/**
+ * Function to get the renamed copy of a callee variable, a new one is created on the first use
+ *
+ * @param inliner - the inliner state
+ * @param var - the original variable
+ * @param mapping - the variable mapping of the call site
+ * @return pointer to the renamed variable, NULL on allocation failure
+ */
+SymVariable *inlineRenameVariable(Inliner *inliner, SymVariable *var, LinkedList *mapping);
+
+#endif // INLINER_H
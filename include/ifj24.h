@@ -0,0 +1,108 @@
+/** AUTHOR
+ *
+ * @author agent <agent@local>
+ * @file ifj24.h
+ * @date 19.10.2026
+ * @brief Public C API of the IFJ24 compiler library (libifj24), compiles a source in memory to IFJcode24
+ *
+ * The header is self contained, it only needs the standard library. Every call uses its own state,
+ * so more sources can be compiled in parallel from different threads.
+ */
+
+#ifndef IFJ24_H
+#define IFJ24_H
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// version of the compiler, changes every time the generated code can change
+#define IFJ24_VERSION "1.2.0"
+
+// maximum length of the diagnostic message, including the null terminator
+#define IFJ24_DIAGNOSTIC_LENGTH 256
+
+// Struct for the options of a compilation, set the defaults by ifj24OptionsInit
+typedef struct Ifj24Options {
+    unsigned int jobs; // worker threads of the parallel phases, 1 compiles on the calling thread only
+    int pipeline; // nonzero lexes the source and collects the function definitions on two more threads, while it is parsed
+    int streaming; // nonzero compiles a function at a time in bounded memory, the functions are not inlined into each other
+    struct CompileCache *functionCache; // not NULL compiles in the streaming mode, the code of the unchanged functions is taken from the cache
+    struct Timing *timing; // not NULL records the time of every phase and of every function in it
+    int emitC; // nonzero generates a C99 source instead of IFJcode24, the functions are not inlined, that is left to the C compiler
+} Ifj24Options;
+
+// Struct for the result of a single compilation
+typedef struct Ifj24Result {
+    int error; // 0 on success, otherwise the exit code of the compiler (1 - 10, 99)
+    char *code; // the generated IFJcode24 (or the C source), null terminated, NULL on error
+    size_t codeLength; // length of the generated code without the null terminator
+    char diagnostic[IFJ24_DIAGNOSTIC_LENGTH]; // human readable description of the error, empty on success
+} Ifj24Result;
+
+/**
+ * Compiles an IFJ24 source in memory
+ *
+ * @param source the source code, it does not have to be null terminated
+ * @param length length of the source code in bytes
+ * @param result where the result is stored, has to be freed by ifj24ResultFree
+ * @return the error code, the same as result->error
+ */
+int ifj24Compile(const char *source, size_t length, Ifj24Result *result);
+
+/**
+ * Compiles an IFJ24 source in memory with the given options, the generated code does not depend on them,
+ * except for the streaming and the incremental mode, that do not inline the functions
+ *
+ * @param source the source code, it does not have to be null terminated
+ * @param length length of the source code in bytes
+ * @param options the options, NULL uses the defaults
+ * @param result where the result is stored, has to be freed by ifj24ResultFree
+ * @return the error code, the same as result->error
+ */
+int ifj24CompileWithOptions(const char *source, size_t length, const Ifj24Options *options, Ifj24Result *result);
+
+/**
+ * Sets the default options
+ *
+ * @param options the options to fill
+ */
+void ifj24OptionsInit(Ifj24Options *options);
+
+/**
+ * Frees the generated code of the result, the result itself can be reused
+ *
+ * @param result the result of ifj24Compile
+ */
+void ifj24ResultFree(Ifj24Result *result);
+
+/**
+ * Returns a short description of an error code
+ *
+ * @param error the error code
+ * @return static string with the description
+ */
+const char *ifj24ErrorName(int error);
+
+/**
+ * Returns the version of the library
+ *
+ * @return IFJ24_VERSION of the compiled library
+ */
+const char *ifj24Version(void);
+
+/**
+ * Returns the identity of the generated code, the version with the build configuration, that changes the code
+ * (INLINE_STATEMENT_BUDGET), the caches key their entries by it
+ *
+ * @return static string, e.g. "1.2.0 inline=8"
+ */
+const char *ifj24BuildId(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // IFJ24_H
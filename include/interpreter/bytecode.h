@@ -0,0 +1,196 @@
+/** AUTHOR
+ *
+ * @author agent <agent@local>
+ * @file bytecode.h
+ * @date 19.10.2026
+ * @brief Header file for the fast engine of IFJcode24, the loaded code is decoded into a compact bytecode
+ *
+ * The variables are resolved to slots at load. The global ones get a slot of the global frame, the local
+ * and temporary ones a slot of the layout of the function they are used in, every created frame has the
+ * layout of the function that created it. A frame of another layout is resolved by its name on the first
+ * use, and the slot is cached in the operand. The LABELs are dropped and the jumps hold the index of their
+ * target. The sequences made by the code generator are fused into superinstructions, a PUSHS of an int
+ * constant followed by INT2FLOATS is decoded as a PUSHS of the float constant. The bytecode is run by
+ * computed gotos, or by a switch, where they are not supported.
+ */
+
+#ifndef BYTECODE_H
+#define BYTECODE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+
+#ifdef USE_CUSTOM_STRUCTURE
+#include "interpreter/ifjcode.h"
+#else
+#include "ifjcode.h"
+#endif
+
+// the dispatch by computed gotos is a GNU extension, -DBYTECODE_SWITCH forces the portable switch
+#if defined(__GNUC__) && !defined(BYTECODE_SWITCH)
+#define BYTECODE_THREADED 1
+#else
+#define BYTECODE_THREADED 0
+#endif
+
+// Enum for the instructions of the bytecode, the simple ones are followed by the superinstructions
+enum BYTECODE_OPCODE {
+    BC_MOVE,
+    BC_CREATEFRAME,
+    BC_PUSHFRAME,
+    BC_POPFRAME,
+    BC_DEFVAR,
+    BC_CALL,
+    BC_RETURN,
+    BC_PUSHS,
+    BC_POPS,
+    BC_CLEARS,
+    BC_BINARY, // ADD, SUB, MUL, DIV, IDIV, LT, GT, EQ, AND, OR, STRI2INT, CONCAT and GETCHAR, the operation is kept
+    BC_UNARY, // NOT, INT2FLOAT, FLOAT2INT, INT2CHAR and STRLEN
+    BC_ADDS,
+    BC_SUBS,
+    BC_MULS,
+    BC_LTS,
+    BC_GTS,
+    BC_EQS,
+    BC_BINARYS, // the other binary stack instructions
+    BC_UNARYS, // the unary stack instructions
+    BC_READ,
+    BC_WRITE,
+    BC_TYPE,
+    BC_SETCHAR,
+    BC_JUMP,
+    BC_JUMPIF, // JUMPIFEQ, or JUMPIFNEQ with the operation OP_JUMPIFNEQ
+    BC_JUMPIFS, // JUMPIFEQS, or JUMPIFNEQS with the operation OP_JUMPIFNEQS
+    BC_EXIT,
+    BC_BREAK,
+    BC_DPRINT,
+    BC_END, // the end of the program
+    BC_PUSHS_PUSHS_BINARY_POPS, // PUSHS a, PUSHS b, a binary stack instruction and POPS x, as its three address form
+    BC_PUSHS_PUSHS_BINARY, // PUSHS a, PUSHS b and a binary stack instruction, the result is pushed
+    BC_POPS_JUMPIF, // POPS x followed by JUMPIFEQ or JUMPIFNEQ, the condition of the generated ifs and whiles
+    BC_PUSHS_POPS, // PUSHS a and POPS x, as MOVE
+    BYTECODE_OPCODE_COUNT, // amount of the instructions
+};
+
+// Enum for the kinds of the operands of the bytecode
+enum BYTECODE_OPERAND {
+    BYTECODE_GLOBAL, // slot of the global frame
+    BYTECODE_LOCAL, // slot of the layout of the local frame
+    BYTECODE_TEMPORARY, // slot of the layout of the temporary frame
+    BYTECODE_CONSTANT, // index of the constant
+};
+
+// Struct for a single operand of the bytecode
+typedef struct BytecodeOperand {
+    unsigned int kind; // enum BYTECODE_OPERAND
+    unsigned int slot; // the slot of the variable, or the index of the constant
+    unsigned int layout; // layout the slot belongs to, updated, when a frame of another layout is used
+    unsigned int symbol; // index of the name of the variable
+} BytecodeOperand;
+
+// Struct for a single instruction of the bytecode
+typedef struct BytecodeInstruction {
+    const void *handler; // address of the code of the instruction, filled by the threaded dispatch
+    unsigned short opcode; // enum BYTECODE_OPCODE
+    unsigned short operation; // the IFJCODE_OPCODE of an operation, or the type of READ
+    unsigned int source; // index of the first loaded instruction, for the diagnostics
+    unsigned char offsets[4]; // offsets of the fused instructions from the source, for the diagnostics
+    size_t target; // index of the target of a jump or a CALL
+    BytecodeOperand operands[3]; // the variables and the constants
+} BytecodeInstruction;
+
+// Struct for the decoded program
+typedef struct Bytecode {
+    const IfjCode *code; // the loaded program, it has to outlive the bytecode
+    BytecodeInstruction *instructions; // the instructions, ended by BC_END
+    size_t size; // amount of the instructions, including the BC_END
+    IfjValue *constants; // the constants of the operands
+    size_t constantCount; // amount of the constants
+    size_t globalCount; // slots of the global frame
+    size_t layoutCount; // one layout for every label and one for the code outside the functions
+    size_t *layoutSizes; // slots of every layout
+    unsigned long long *slotKeys; // open addressed table of the layout and name + 1 of every slot, 0 is empty
+    unsigned int *slotValues; // the slots of the table
+    size_t slotCapacity; // size of the table, a power of two
+    size_t superinstructions; // amount of the fused sequences
+} Bytecode;
+
+// Struct for a local or temporary frame, the slots are followed by the flags of the defined variables
+typedef struct BytecodeFrame {
+    size_t layout; // layout of the slots
+    size_t size; // amount of the slots
+    unsigned char *defined; // true for every defined variable
+    size_t *extraSymbols; // names of the variables missing in the layout, defined by another function
+    IfjValue *extraValues; // values of those variables
+    size_t extraCount; // amount of those variables
+    size_t extraCapacity; // allocated variables
+    struct BytecodeFrame *next; // next unused frame of the same layout
+    IfjValue values[]; // the slots
+} BytecodeFrame;
+
+// Struct for the state of a run
+typedef struct BytecodeMachine {
+    Bytecode *bytecode; // the run program
+    FILE *input; // read by READ
+    FILE *output; // written by WRITE
+    IfjValue *globals; // slots of GF
+    unsigned char *globalDefined; // true for every defined global variable
+    BytecodeFrame *temporary; // TF, NULL if not created
+    BytecodeFrame **locals; // the frame stack, LF is the last one
+    size_t localCount; // frames on the frame stack
+    size_t localCapacity; // allocated frames of the frame stack
+    BytecodeFrame **unused; // freed frames of every layout, they are reused by CREATEFRAME
+    IfjValue *stack; // the data stack
+    size_t stackSize; // values on the data stack
+    size_t stackCapacity; // allocated values of the data stack
+    size_t *calls; // the call stack, the index of the instruction after every CALL
+    size_t callCount; // returns on the call stack
+    size_t callCapacity; // allocated returns of the call stack
+    char diagnostic[IFJCODE_DIAGNOSTIC_LENGTH]; // the description of a runtime error
+} BytecodeMachine;
+
+/**
+ * Decodes the loaded program into the bytecode
+ *
+ * @param code the loaded program, it has to outlive the bytecode
+ * @param bytecode where the bytecode is stored, has to be freed by bytecodeFree, also on error
+ * @return IFJCODE_SUCCESS or IFJCODE_E_INTERNAL
+ */
+int bytecodeLoad(const IfjCode *code, Bytecode *bytecode);
+
+/**
+ * Frees the bytecode
+ *
+ * @param bytecode the bytecode
+ */
+void bytecodeFree(Bytecode *bytecode);
+
+/**
+ * Prepares a run of the bytecode
+ *
+ * @param machine the state to fill
+ * @param bytecode the decoded program
+ * @param input read by READ
+ * @param output written by WRITE
+ * @return false on allocation failure, the state has to be freed anyway
+ */
+bool bytecodeMachineInit(BytecodeMachine *machine, Bytecode *bytecode, FILE *input, FILE *output);
+
+/**
+ * Runs the bytecode until its EXIT, its end or an error, with the same results as interpreterRun
+ *
+ * @param machine the state prepared by bytecodeMachineInit
+ * @return the value of EXIT, 0 at the end of the program, or the error code, the error is described in diagnostic
+ */
+int bytecodeMachineRun(BytecodeMachine *machine);
+
+/**
+ * Frees the frames and the stacks of the run
+ *
+ * @param machine the state
+ */
+void bytecodeMachineFree(BytecodeMachine *machine);
+
+#endif // BYTECODE_H
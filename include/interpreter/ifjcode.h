@@ -0,0 +1,259 @@
+/** AUTHOR
+ *
+ * @author agent <agent@local>
+ * @file ifjcode.h
+ * @date 19.10.2026
+ * @brief Header file for the loader of IFJcode24, the text is parsed into the instructions run by the interpreter
+ *
+ * The names of the variables are interned, every operand of a variable holds the index of its name.
+ * The labels are resolved at load, every jump holds the index of the instruction after its LABEL.
+ */
+
+#ifndef IFJCODE_H
+#define IFJCODE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+
+// the first line of every program
+#define IFJCODE_HEADER ".IFJcode24"
+
+// maximum length of the diagnostic message, including the null terminator
+#define IFJCODE_DIAGNOSTIC_LENGTH 256
+
+// the instructions before the first label, or the label of a block outside of any function
+#define IFJCODE_NO_LABEL ((size_t)-1)
+
+// Enum for the exit codes of the interpreter, the program itself exits with 0 - 9
+enum IFJCODE_ERROR {
+    IFJCODE_SUCCESS = 0,
+    IFJCODE_E_PARAM = 50, // wrong arguments of the interpreter
+    IFJCODE_E_SYNTAX = 51, // lexical or syntax error of the code
+    IFJCODE_E_SEMANTIC = 52, // undefined or redefined label, redefined variable
+    IFJCODE_E_OPERAND_TYPE = 53, // wrong types of the operands
+    IFJCODE_E_UNDEFINED_VAR = 54, // access to a variable not defined in its frame
+    IFJCODE_E_FRAME = 55, // the frame does not exist
+    IFJCODE_E_MISSING_VALUE = 56, // uninitialized variable, empty data or call stack
+    IFJCODE_E_OPERAND_VALUE = 57, // division by zero, wrong value of EXIT
+    IFJCODE_E_STRING = 58, // wrong work with a string
+    IFJCODE_E_INTERNAL = 99, // allocation failure
+};
+
+// Enum for the instructions, the order is the one of the specification
+enum IFJCODE_OPCODE {
+    OP_MOVE,
+    OP_CREATEFRAME,
+    OP_PUSHFRAME,
+    OP_POPFRAME,
+    OP_DEFVAR,
+    OP_CALL,
+    OP_RETURN,
+    OP_PUSHS,
+    OP_POPS,
+    OP_CLEARS,
+    OP_ADD,
+    OP_SUB,
+    OP_MUL,
+    OP_DIV,
+    OP_IDIV,
+    OP_ADDS,
+    OP_SUBS,
+    OP_MULS,
+    OP_DIVS,
+    OP_IDIVS,
+    OP_LT,
+    OP_GT,
+    OP_EQ,
+    OP_LTS,
+    OP_GTS,
+    OP_EQS,
+    OP_AND,
+    OP_OR,
+    OP_NOT,
+    OP_ANDS,
+    OP_ORS,
+    OP_NOTS,
+    OP_INT2FLOAT,
+    OP_FLOAT2INT,
+    OP_INT2CHAR,
+    OP_STRI2INT,
+    OP_INT2FLOATS,
+    OP_FLOAT2INTS,
+    OP_INT2CHARS,
+    OP_STRI2INTS,
+    OP_READ,
+    OP_WRITE,
+    OP_CONCAT,
+    OP_STRLEN,
+    OP_GETCHAR,
+    OP_SETCHAR,
+    OP_TYPE,
+    OP_LABEL,
+    OP_JUMP,
+    OP_JUMPIFEQ,
+    OP_JUMPIFNEQ,
+    OP_JUMPIFEQS,
+    OP_JUMPIFNEQS,
+    OP_EXIT,
+    OP_BREAK,
+    OP_DPRINT,
+    IFJCODE_OPCODE_COUNT, // amount of the instructions
+};
+
+// Enum for the types of the values, an undefined value is a declared, but not initialized variable
+enum IFJCODE_TYPE {
+    IFJ_TYPE_UNDEFINED,
+    IFJ_TYPE_NIL,
+    IFJ_TYPE_INT,
+    IFJ_TYPE_FLOAT,
+    IFJ_TYPE_BOOL,
+    IFJ_TYPE_STRING,
+};
+
+// Enum for the frames of the variables
+enum IFJCODE_FRAME {
+    FRAME_GLOBAL,
+    FRAME_LOCAL,
+    FRAME_TEMPORARY,
+};
+
+// Enum for the kinds of the operands
+enum IFJCODE_OPERAND {
+    OPERAND_NONE,
+    OPERAND_VARIABLE, // frame and the index of the name
+    OPERAND_CONSTANT, // the value
+    OPERAND_LABEL, // the index of the label and its target
+    OPERAND_TYPE, // the type of READ
+};
+
+// Struct for a string value, shared by the copies of the value, so a MOVE or PUSHS does not copy the bytes
+typedef struct IfjString {
+    size_t references; // values holding the string
+    size_t length; // bytes without the null terminator
+    char data[]; // the bytes, null terminated
+} IfjString;
+
+// Struct for a value of a variable, a constant or the data stack
+typedef struct IfjValue {
+    enum IFJCODE_TYPE type; // type of the value
+    union {
+        long long integer;
+        double real;
+        bool boolean;
+        IfjString *string;
+    } data; // the value of the type
+} IfjValue;
+
+// Struct for a single operand of an instruction
+typedef struct IfjOperand {
+    enum IFJCODE_OPERAND kind; // kind of the operand
+    enum IFJCODE_FRAME frame; // frame of a variable
+    size_t symbol; // index of the name of a variable, or of the label
+    size_t target; // index of the instruction after the label
+    IfjValue value; // the constant, or the type of READ in value.type
+} IfjOperand;
+
+// Struct for a single instruction
+typedef struct IfjInstruction {
+    enum IFJCODE_OPCODE opcode; // the instruction
+    unsigned int operandCount; // used operands
+    IfjOperand operands[3]; // the operands in the order of the source
+    size_t line; // line of the source, for the diagnostics
+    size_t label; // index of the last label before the instruction, IFJCODE_NO_LABEL before the first one
+    size_t function; // index of the called label, the instruction belongs to, IFJCODE_NO_LABEL outside of them
+} IfjInstruction;
+
+// Struct for a label
+typedef struct IfjLabel {
+    char *name; // name of the label
+    size_t target; // index of the instruction after the LABEL
+    bool function; // the label is the target of a CALL
+} IfjLabel;
+
+// Struct for the whole loaded program
+typedef struct IfjCode {
+    IfjInstruction *instructions; // the instructions in the order of the source
+    size_t size; // amount of the instructions
+    IfjLabel *labels; // the labels in the order of their first use
+    size_t labelCount; // amount of the labels
+    char **symbols; // interned names of the variables
+    size_t symbolCount; // amount of the names
+} IfjCode;
+
+/**
+ * Loads a program from its text
+ *
+ * @param text the IFJcode24 source, it does not have to be null terminated
+ * @param length length of the source in bytes
+ * @param code where the program is stored, has to be freed by ifjCodeFree, also on error
+ * @param diagnostic buffer of IFJCODE_DIAGNOSTIC_LENGTH bytes for the description of an error
+ * @return IFJCODE_SUCCESS, IFJCODE_E_SYNTAX, IFJCODE_E_SEMANTIC or IFJCODE_E_INTERNAL
+ */
+int ifjCodeLoad(const char *text, size_t length, IfjCode *code, char *diagnostic);
+
+/**
+ * Frees the loaded program
+ *
+ * @param code the program
+ */
+void ifjCodeFree(IfjCode *code);
+
+/**
+ * Returns the name of the instruction
+ *
+ * @param opcode the instruction
+ * @return static string with the name, as written in the source
+ */
+const char *ifjCodeOpcodeName(enum IFJCODE_OPCODE opcode);
+
+/**
+ * Returns the name of the type, as returned by TYPE
+ *
+ * @param type the type
+ * @return static string with the name, empty for an undefined value
+ */
+const char *ifjCodeTypeName(enum IFJCODE_TYPE type);
+
+/**
+ * Creates a string value with a single reference
+ *
+ * @param data the bytes of the string, NULL leaves them to be filled by the caller
+ * @param length amount of the bytes
+ * @return the string, NULL on allocation failure
+ */
+IfjString *ifjStringNew(const char *data, size_t length);
+
+/**
+ * Adds a reference to the string of the value, other values are not changed
+ *
+ * @param value the value
+ */
+void ifjValueRetain(IfjValue *value);
+
+/**
+ * Drops the reference of the value to its string, the value becomes undefined
+ *
+ * @param value the value
+ */
+void ifjValueRelease(IfjValue *value);
+
+/**
+ * Writes the value as WRITE does, the floats in the hexadecimal format
+ *
+ * @param value the value
+ * @param output where the value is written
+ */
+void ifjValueWrite(const IfjValue *value, FILE *output);
+
+/**
+ * Reads a line of the input as READ does, a wrong or missing value is read as nil
+ *
+ * @param type the read type, int, float, string or bool
+ * @param input where the line is read from
+ * @param value where the read value is stored
+ * @return false on allocation failure
+ */
+bool ifjValueRead(enum IFJCODE_TYPE type, FILE *input, IfjValue *value);
+
+#endif // IFJCODE_H
@@ -0,0 +1,117 @@
+/** AUTHOR
+ *
+ * @author agent <agent@local>
+ * @file interpreter.h
+ * @date 19.10.2026
+ * @brief Header file for the reference interpreter of IFJcode24, it counts the executed instructions
+ *
+ * The interpreter follows the specification closely and checks every operand, it is the reference
+ * the generated code is tested against. The counts tell the dynamic cost of the generated code,
+ * per instruction, per label and per function.
+ */
+
+#ifndef INTERPRETER_H
+#define INTERPRETER_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+
+#ifdef USE_CUSTOM_STRUCTURE
+#include "interpreter/ifjcode.h"
+#else
+#include "ifjcode.h"
+#endif
+
+// Struct for the counts of the executed instructions, the LABELs are not counted, they do nothing
+typedef struct InterpreterCounts {
+    size_t executed; // all the executed instructions
+    size_t opcodes[IFJCODE_OPCODE_COUNT]; // executed instructions of every opcode
+    size_t *instructions; // executions of every instruction of the program
+    size_t *calls; // CALLs of every label of the program
+    size_t maxStack; // the deepest data stack
+    size_t maxCalls; // the deepest call stack
+} InterpreterCounts;
+
+// Struct for a frame, an open addressed table of the variables by the index of their name
+typedef struct InterpreterFrame {
+    size_t *symbols; // index + 1 of the name of every slot, 0 is an empty slot
+    IfjValue *values; // the values of the slots
+    size_t count; // defined variables
+    size_t capacity; // slots of the table, a power of two
+} InterpreterFrame;
+
+// Struct for the state of a run
+typedef struct Interpreter {
+    const IfjCode *code; // the run program
+    FILE *input; // read by READ
+    FILE *output; // written by WRITE
+    InterpreterCounts *counts; // the counts, NULL does not count
+    InterpreterFrame global; // GF
+    InterpreterFrame *temporary; // TF, NULL if not created
+    InterpreterFrame **locals; // the frame stack, LF is the last one
+    size_t localCount; // frames on the frame stack
+    size_t localCapacity; // allocated frames of the frame stack
+    IfjValue *stack; // the data stack
+    size_t stackSize; // values on the data stack
+    size_t stackCapacity; // allocated values of the data stack
+    size_t *calls; // the call stack, the index of the instruction after every CALL
+    size_t callCount; // returns on the call stack
+    size_t callCapacity; // allocated returns of the call stack
+    size_t pc; // index of the current instruction
+    char diagnostic[IFJCODE_DIAGNOSTIC_LENGTH]; // the description of a runtime error
+} Interpreter;
+
+/**
+ * Prepares the counts for the program
+ *
+ * @param counts the counts to fill with zeros
+ * @param code the counted program
+ * @return false on allocation failure
+ */
+bool interpreterCountsInit(InterpreterCounts *counts, const IfjCode *code);
+
+/**
+ * Frees the counts
+ *
+ * @param counts the counts
+ */
+void interpreterCountsFree(InterpreterCounts *counts);
+
+/**
+ * Prints the counts per opcode, per function and per label, the most executed first
+ *
+ * @param counts the counts of a run
+ * @param code the run program
+ * @param output where the counts are printed
+ * @param json true prints a single JSON object, false a table
+ */
+void interpreterCountsPrint(const InterpreterCounts *counts, const IfjCode *code, FILE *output, bool json);
+
+/**
+ * Prepares a run of the program
+ *
+ * @param interpreter the state to fill
+ * @param code the loaded program
+ * @param input read by READ
+ * @param output written by WRITE
+ * @param counts the counts prepared by interpreterCountsInit, NULL does not count
+ */
+void interpreterInit(Interpreter *interpreter, const IfjCode *code, FILE *input, FILE *output, InterpreterCounts *counts);
+
+/**
+ * Runs the program until its EXIT, its end or an error
+ *
+ * @param interpreter the state prepared by interpreterInit
+ * @return the value of EXIT, 0 at the end of the program, or the error code, the error is described in diagnostic
+ */
+int interpreterRun(Interpreter *interpreter);
+
+/**
+ * Frees the frames and the stacks of the run
+ *
+ * @param interpreter the state
+ */
+void interpreterFree(Interpreter *interpreter);
+
+#endif // INTERPRETER_H
@@ -0,0 +1,80 @@
+/**
+ * @file chunk_lexer.h
+ * @date 19.10.2026
+ * @brief Header file for chunk_lexer.c, lexes a big source in memory in chunks on more threads
+ * @author agent <agent@local>
+ */
+
+#ifndef CHUNK_LEXER_H
+#define CHUNK_LEXER_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#ifdef USE_CUSTOM_STRUCTURE
+#include "utility/enumerations.h"
+#include "utility/linked_list.h"
+#else
+#include "enumerations.h"
+#include "linked_list.h"
+#endif
+
+// sources smaller than this are lexed by a single scanner, the threads would cost more
+#ifndef CHUNK_LEXER_MIN_SOURCE
+#define CHUNK_LEXER_MIN_SOURCE (1 << 20)
+#endif
+
+// the source is split into chunks of about this many bytes
+#ifndef CHUNK_LEXER_CHUNK_SIZE
+#define CHUNK_LEXER_CHUNK_SIZE (1 << 18)
+#endif
+
+// Struct for a single chunk of the source and its tokens
+typedef struct LexChunk {
+    const char *source; // the whole source
+    size_t start; // index of the first byte of the chunk, always the start of a line
+    size_t end; // index after the last byte of the chunk
+    bool last; // only the last chunk keeps its EOF token
+    struct TOKEN *tokens; // the tokens of the chunk, in order
+    size_t count; // amount of tokens
+    size_t capacity; // allocated amount of tokens
+    enum ERR_CODES err; // result of lexing the chunk
+    size_t errorPosition; // index in the source after the character, that caused the error
+} LexChunk;
+
+/**
+ * Function to find the start of the next chunk. It is the start of the first line after the position,
+ * where the scanner is surely in its start state, so the line cannot continue a `\\` multiline string,
+ * which also covers all the `//` looking text inside of such strings. Lines starting with `\\`, `;` or `)`,
+ * and empty lines, can belong to the multiline string on the line before them, so they are skipped.
+ *
+ * @param source - the source code
+ * @param length - the length of the source
+ * @param position - the chunk should start at or after this index
+ * @return size_t - index of the start of the next chunk, length if there is none
+ */
+size_t chunk_lexer_next_boundary(const char *source, size_t length, size_t position);
+
+/**
+ * Function to lex a source in memory in chunks on more threads, the tokens are appended to the buffer
+ * in the same order, as scanner_get_token would return them, including the token, that caused an error
+ *
+ * @param source - the source code
+ * @param length - the length of the source
+ * @param jobs - amount of worker threads
+ * @param chunkSize - the source is split into chunks of about this many bytes
+ * @param buffer - the token buffer to append the tokens to
+ * @param errorPosition - if not NULL, index in the source after the character, that caused an error
+ * @return enum ERR_CODES - the error of the first chunk, that failed, or SUCCESS
+ */
+enum ERR_CODES chunk_lexer_tokenize(const char *source, size_t length, unsigned int jobs, size_t chunkSize,
+                                    LinkedList *buffer, size_t *errorPosition);
+
+/**
+ * Function to lex a single chunk, the task of the work pool
+ *
+ * @param data - array of LexChunk
+ * @param index - index of the chunk
+ */
+void chunk_lexer_task(void *data, size_t index);
+
+#endif
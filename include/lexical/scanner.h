@@ -12,8 +12,10 @@
 #include <stdbool.h>
 #ifdef USE_CUSTOM_STRUCTURE
 #include "utility/enumerations.h"
+#include "utility/compiler_context.h"
 #else
 #include "enumerations.h"
+#include "compiler_context.h"
 #endif
 
 typedef enum
@@ -78,16 +80,36 @@ typedef enum
  * Function to initialize the scanner
  *
  * @param input - the input file to initialize the scanner with
+ * @param ctx - the compiler context, holds the scanner state
  * @return enum ERR_CODES - the error code resulting from the operation
  */
-enum ERR_CODES scanner_init(FILE *input);
+enum ERR_CODES scanner_init(FILE *input, CompilerContext *ctx);
+
+/**
+ * Function to initialize the scanner over a source code in memory
+ *
+ * @param source - the source code, it does not have to be null terminated
+ * @param length - the length of the source code in bytes
+ * @param ctx - the compiler context, holds the scanner state
+ * @return enum ERR_CODES - the error code resulting from the operation
+ */
+enum ERR_CODES scanner_init_buffer(const char *source, size_t length, CompilerContext *ctx);
+
+/**
+ * Function to read the next character of the source, from the memory or the file
+ *
+ * @param ctx - the compiler context, holds the scanner state
+ * @return int - the character as an unsigned char, EOF at the end of the source
+ */
+int scanner_read_char(CompilerContext *ctx);
 
 /**
  * Function to retrieve the next token
  *
  * @param tokenPointer - pointer to the token structure to populate
+ * @param ctx - the compiler context, holds the scanner state
  * @return enum ERR_CODES - the error code resulting from the operation
  */
-enum ERR_CODES scanner_get_token(struct TOKEN *tokenPointer);
+enum ERR_CODES scanner_get_token(struct TOKEN *tokenPointer, CompilerContext *ctx);
 
 #endif
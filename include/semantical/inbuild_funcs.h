@@ -43,23 +43,6 @@ pub fn ifj.ord(s: []u8, i: i32) i32;
 pub fn ifj.chr(i: i32) []u8;
 */
 
-enum ERR_CODES err;
-
-SymFunctionPtr readstr;
-SymFunctionPtr readi32;
-SymFunctionPtr readf64;
-SymFunctionPtr write;
-SymFunctionPtr i2f;
-SymFunctionPtr f2i;
-SymFunctionPtr string;
-SymFunctionPtr length;
-SymFunctionPtr concat;
-SymFunctionPtr substring;
-SymFunctionPtr Strcmp;
-SymFunctionPtr ord;
-SymFunctionPtr chr;
-SymFunctionPtr var;
-
 /**
  * Function to fill in the inbuild functions
  * 
@@ -14,9 +14,11 @@
 #ifdef USE_CUSTOM_STRUCTURE
 #include "syntaxical/ast.h"
 #include "utility/enumerations.h"
+#include "utility/compiler_context.h"
 #else 
 #include "ast.h"
 #include "enumerations.h"
+#include "compiler_context.h"
 #endif
 
 enum COVERSION_FLAGS {
@@ -26,14 +28,48 @@ enum COVERSION_FLAGS {
     CONV_TO_FLOAT,
 };
 
+// Struct for the analysis of a single function body, the bodies are analyzed in parallel
+typedef struct FunctionAnalysis {
+    Function *function; // the analyzed function
+    SymTable *view; // own scopes and variables, shared function definitions
+    enum ERR_CODES err; // result of the analysis
+    Timing *timing; // records the analysis, NULL if it is not timed
+} FunctionAnalysis;
+
 /**
  * Function to analyze the whole program
  * 
  * @param program - the program to analyze
+ * @param ctx - the compiler context, holds the symbol table
+ * @return enum ERR_CODES - the error code
+ */
+enum ERR_CODES analyzeProgram(Program *program, CompilerContext *ctx);
+
+/**
+ * Function to add the definition of a single function to the table
+ * 
+ * @param function - the function, whose name, parameters and return type are added
  * @param table - the symbol table
  * @return enum ERR_CODES - the error code
  */
-enum ERR_CODES analyzeProgram(Program *program, SymTable *table);
+enum ERR_CODES analyzeFunctionSignature(Function *function, SymTable *table);
+
+/**
+ * Function to analyze the body of a single function, its definition has to be in the table already
+ * 
+ * @param function - the function to analyze, function->symFunction has to be set
+ * @param table - the symbol table or a view of it, the function scope is created in it
+ * @return enum ERR_CODES - the error code
+ */
+enum ERR_CODES analyzeFunction(Function *function, SymTable *table);
+
+/**
+ * Function to analyze a single function body, the task of the work pool
+ * 
+ * @param data - array of FunctionAnalysis
+ * @param index - index of the analyzed function
+ */
+void analyzeFunctionTask(void *data, size_t index);
 
 
 /**
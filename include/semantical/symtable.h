@@ -36,6 +36,7 @@ typedef struct SymFunction {
     char *funcName;
     enum DATA_TYPES returnType;
     bool nullableReturn;
+    bool tailRecursive; // the function has a `return f(args)` call to itself
     LinkedList *paramaters; 
 } *SymFunctionPtr;
 
@@ -50,6 +51,7 @@ typedef struct SymTableNode {
     enum SYMTABLE_NODE_TYPES type;
     unsigned int key;
     struct SymTableNode *parent;
+    struct SymTableNode *outerScope; // nearest enclosing scope with a variable, the lookups skip the empty ones
     BST *variables;
     struct SymTableNode *innerScope;
 } SymTableNode;
@@ -210,6 +212,37 @@ bool symTableCanMutate(SymVariable *variable);
 */
 bool symTableFree(SymTable **table);
 
+/**
+ * Function to create a view of the symbol table, for analyzing a single function body on its own thread.
+ * The view has its own scope stack and variables, the function definitions and global variables
+ * are shared, so they must not be modified while any view is used.
+ * 
+ * @param table - pointer to the symbol table
+ * @return pointer to the view, NULL on allocation failure
+*/
+SymTable *symTableInitView(SymTable *table);
+
+/**
+ * Function to move the variables of a view to the symbol table and free the view. The ids
+ * of the variables are shifted after the ones in the table, so merging the views in the
+ * order of the functions gives the same ids, as declaring the variables in the table.
+ * 
+ * @param table - pointer to the symbol table
+ * @param view - double pointer to the view, set to NULL
+ * @return true, if all the variables were moved, false otherwise
+*/
+bool symTableMergeView(SymTable *table, SymTable **view);
+
+/**
+ * Function to free a view and its variables, once the function analyzed in it was generated.
+ * A view, whose varCount started at the one of the table, gives the variables the same ids
+ * as symTableMergeView, the table then continues after them.
+ * 
+ * @param table - pointer to the symbol table
+ * @param view - double pointer to the view, set to NULL
+*/
+void symTableDropView(SymTable *table, SymTable **view);
+
 /**
  * Function to free the symTableNode
  * 
@@ -0,0 +1,84 @@
+/** AUTHOR
+ *
+ * @author agent <agent@local>
+ * @file stream.h
+ * @date 19.10.2026
+ * @brief Header file for the streaming mode, every function is parsed, analyzed and generated, before the next one is read
+ */
+
+#ifndef STREAM_H
+#define STREAM_H
+
+#include <stddef.h>
+
+#include "cache.h"
+
+#ifdef USE_CUSTOM_STRUCTURE
+#include "semantical/symtable.h"
+#include "utility/compiler_context.h"
+#include "utility/enumerations.h"
+#include "utility/output_buffer.h"
+#include "utility/timing.h"
+#else
+#include "symtable.h"
+#include "compiler_context.h"
+#include "enumerations.h"
+#include "output_buffer.h"
+#include "timing.h"
+#endif
+
+// Struct for the tokens of a single function, found by the pre-scan
+typedef struct StreamFunction {
+    unsigned int start; // index of the pub token in the token buffer
+    unsigned int end; // index of the closing brace of the body
+    size_t position; // position just after the pub token in the source, for the errors
+} StreamFunction;
+
+// Struct for all the functions found by the pre-scan, in the order of the source
+typedef struct StreamFunctions {
+    StreamFunction *functions;
+    unsigned int count;
+    unsigned int capacity;
+} StreamFunctions;
+
+// longest name of a function or token kept for the error
+#define STREAM_NAME_LENGTH 64
+
+// Struct for the place of the first error of the streaming mode
+typedef struct StreamError {
+    size_t position; // just after the wrong character or token, or after the pub of the failing function, 0 if not known
+    char function[STREAM_NAME_LENGTH]; // name of the failing function, empty outside of the functions
+    char token[STREAM_NAME_LENGTH]; // the token, the parser failed at, empty for the other errors
+} StreamError;
+
+/**
+ * Compiles the source a function at a time. The tokens are lexed once by a pre-scan, which also collects the function headers,
+ * so the calls can be checked before the callee is read, only the AST of the current function is kept.
+ * The functions are not inlined into each other, otherwise the code is the same as of the whole program compilation.
+ * The first error stops the compilation, it is reported with the function it was found in.
+ * With a cache, the code of a function is stored under the hash of its tokens, together with the calls it makes.
+ * A function with the same tokens, whose called functions have the same definitions, is not parsed again,
+ * its code is taken from the cache and the ids of its variables are moved after the ones of the previous functions.
+ *
+ * @param source the source code
+ * @param length length of the source
+ * @param out buffer for the generated code
+ * @param cache the cache of the functions, NULL compiles all of them
+ * @param timing records the phases and the functions, NULL if they are not timed
+ * @param error filled with the place of the error, NULL if it is not needed
+ * @return SUCCESS, or the first error found
+ */
+enum ERR_CODES streamCompile(const char *source, size_t length, OutputBuffer *out, CompileCache *cache, Timing *timing, StreamError *error);
+
+/**
+ * Lexes the whole source into the token buffer of the context and adds the definitions of all the functions to the table,
+ * the tokens of every function are recorded, so they are hashed and parsed without lexing them again
+ *
+ * @param ctx the context, the source is set by scanner_init_buffer
+ * @param functions filled with the functions in the order of the source, the caller frees the array
+ * @param error filled with the place of the error, NULL if it is not needed
+ * @return SUCCESS, or the first error found
+ */
+enum ERR_CODES streamPrescan(CompilerContext *ctx, StreamFunctions *functions, StreamError *error);
+
+#endif // STREAM_H
@@ -41,6 +41,8 @@ typedef enum StatementType {
 typedef struct ReturnStatement {
     bool empty;
     struct Expression value;
+    struct FunctionCall *inline_call; // the inlined call site this return jumps out of (NULL for a real return)
+    bool tail_call; // the value is a call of the enclosing function, generated as a jump
 } ReturnStatement;
 
 typedef struct WhileStatement {
@@ -49,6 +51,7 @@ typedef struct WhileStatement {
 
     struct Identifier non_nullable;
     bool code_gen_defined; // if the identifier is defined in generated code
+    bool code_gen_pregenerated; // if the variables of the body are defined in generated code
 } WhileStatement;
 
 typedef struct IfStatement {
@@ -207,5 +210,12 @@ void freeReturnStatement(ReturnStatement *returnStatement);
  */
 void freeStatement(Statement *statement);
 
+/**
+ * Function to add the nodes of a parsed function to the statistics, by their type
+ *
+ * @param function - the parsed function
+ */
+void countFunctionNodes(Function *function);
+
 
 #endif // AST_H
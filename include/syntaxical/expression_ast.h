@@ -49,11 +49,18 @@ typedef struct FunctionCall {
 
     SymFunctionPtr func;
     DataType return_type;
+
+    struct Body *inlined_body; // copy of the callee body, if the call was inlined (NULL otherwise)
+    unsigned int inline_id; // id of the inlined call site, used for the end label
 } FunctionCall;
 
 typedef struct Literal {
     char *value;
     DataType data_type;
+    union {
+        long long integer;
+        double real;
+    } number; // binary value of an i32 or f64 literal, parsed once by the parser
 } Literal;
 
 typedef struct BinaryExpression {
@@ -102,6 +109,13 @@ void freeFunctionCall(FunctionCall *func_call);
  */
 void freeExpression(Expression *expr);
 
+/**
+ * Function to parse the binary value of a numeric literal, the data type has to be set already
+ *
+ * @param literal - the literal to parse
+ */
+void parseLiteralNumber(Literal *literal);
+
 /**
  * Function to free a literal structure
  *
@@ -15,24 +15,38 @@
 
 #ifdef USE_CUSTOM_STRUCTURE
 #include "lexical/scanner.h"
+#include "utility/compiler_context.h"
 #include "semantical/symtable.h"
 #include "utility/enumerations.h"
 #include "utility/linked_list.h"
 #include "syntaxical/ast.h"
 #else
 #include "scanner.h"
+#include "compiler_context.h"
 #include "symtable.h"
 #include "enumerations.h"
 #include "linked_list.h"
 #include "ast.h"
 #endif
 
+// Struct for a single function parsed on the work pool
+typedef struct FunctionParse {
+    Function *function; // the parsed function
+    TOKEN_PTR *tokens; // tokens of the whole program
+    unsigned int start; // index of the pub token of the function
+    unsigned int end; // index after the closing brace of the function
+    TOKEN_PTR eof; // the EOF token, it ends the token buffer of the function
+    CompilerContext ctx; // copy of the context, with its own token buffer of the function
+    bool success; // result of parse_function
+} FunctionParse;
+
 /** 
  * Function to do the first pass over the program
  * @param symtable - the symbol table
+ * @param ctx - the compiler context
  * @return the buffer of tokens
  */
-enum ERR_CODES firstPass(FILE *input, LinkedList *buffer);
+enum ERR_CODES firstPass(FILE *input, LinkedList *buffer, CompilerContext *ctx);
 
 /**
  * Function to save a new token to the buffer
@@ -47,220 +61,276 @@ bool saveNewToken(struct TOKEN token, LinkedList *buffer);
  * Function to init the parser
  * 
  * @param table - the symbol table
+ * @param ctx - the compiler context
  */
-void parser_init(SymTable *tbl);
+void parser_init(SymTable *tbl, CompilerContext *ctx);
 
 /**
  * Function to parse the program
  * 
- * @param input - the input file
+ * @param input - the input file, NULL if the source was set by scanner_init_buffer
  * @param program - the AST root
+ * @param ctx - the compiler context
  * @return enum ERR_CODES - the error code
 */
-enum ERR_CODES parser_parse(FILE *input, Program *program);
+enum ERR_CODES parser_parse(FILE *input, Program *program, CompilerContext *ctx);
 
 /**
  * Function to match a token
  * 
  * @param tokenType - the type of the token to match
+ * @param ctx - the compiler context
  * @return bool - if the token was matched
  */
-bool match(enum TOKEN_TYPE tokenType);
+bool match(enum TOKEN_TYPE tokenType, CompilerContext *ctx);
 
 /**
  * Function to get the current token
  * 
  * @param program - the AST root
+ * @param ctx - the compiler context
  * @return bool - if the token was matched
  */
-bool parse_program(Program *program);
+bool parse_program(Program *program, CompilerContext *ctx);
 
 /**
  * Function to parse the prolog
  * 
+ * @param ctx - the compiler context
  * @return bool - if the prolog was parsed
  */
-bool parse_prolog(void);
+bool parse_prolog(CompilerContext *ctx);
 
 /**
  * Function to parse the functions in the program
  *
  * @param functions - a linked list of functions to parse
+ * @param ctx - the compiler context
  * @return bool - if the functions were parsed successfully
  */
-bool parse_functions(LinkedList *functions);
+bool parse_functions(LinkedList *functions, CompilerContext *ctx);
+
+/**
+ * Function to parse the functions on the work pool. The token ranges of the functions are found
+ * by matching the braces, every range is parsed on its own and the functions are merged in order.
+ *
+ * @param functions - a linked list of functions to parse
+ * @param ctx - the compiler context
+ * @param parsed - if the functions were parsed successfully, set only when true is returned
+ * @return bool - false, if the functions have to be parsed sequentially
+ */
+bool parse_functions_parallel(LinkedList *functions, CompilerContext *ctx, bool *parsed);
+
+/**
+ * Function to parse a single function, the task of the work pool
+ *
+ * @param data - array of FunctionParse
+ * @param index - index of the parsed function
+ */
+void parse_function_task(void *data, size_t index);
 
 /**
  * Function to parse a single function
  *
  * @param function - the function to parse
+ * @param ctx - the compiler context
  * @return bool - if the function was parsed successfully
  */
-bool parse_function(Function *function);
+bool parse_function(Function *function, CompilerContext *ctx);
+
+/**
+ * Function to parse the header of a function, up to the opening brace of its body
+ *
+ * @param function - the function, its name, params and return type are set
+ * @param ctx - the compiler context
+ * @return bool - if the header was parsed successfully
+ */
+bool parse_function_header(Function *function, CompilerContext *ctx);
 
 /**
  * Function to parse the next function in the sequence
  *
+ * @param ctx - the compiler context
  * @return bool - if the next function was parsed successfully
  */
-bool parse_next_function(void);
+bool parse_next_function(CompilerContext *ctx);
 
 /**
  * Function to parse the parameters of a function
  *
  * @param params - a linked list of parameters to parse
+ * @param ctx - the compiler context
  * @return bool - if the parameters were parsed successfully
  */
-bool parse_params(LinkedList *params);
+bool parse_params(LinkedList *params, CompilerContext *ctx);
 
 /**
  * Function to parse a single parameter
  *
  * @param param - the parameter to parse
+ * @param ctx - the compiler context
  * @return bool - if the parameter was parsed successfully
  */
-bool parse_parameter(Param *param);
+bool parse_parameter(Param *param, CompilerContext *ctx);
 
 /**
  * Function to parse a data type
  *
  * @param data_type - the data type to parse
+ * @param ctx - the compiler context
  * @return bool - if the data type was parsed successfully
  */
-bool parse_data_type(DataType *data_type);
+bool parse_data_type(DataType *data_type, CompilerContext *ctx);
 
 /**
  * Function to parse the body of a function
  *
  * @param body - the body of the function to parse
+ * @param ctx - the compiler context
  * @return bool - if the body was parsed successfully
  */
-bool parse_func_body(Body *body);
+bool parse_func_body(Body *body, CompilerContext *ctx);
 
 /**
  * Function to parse a generic body block
  *
  * @param body - the body block to parse
+ * @param ctx - the compiler context
  * @return bool - if the body was parsed successfully
  */
-bool parse_body(Body *body);
+bool parse_body(Body *body, CompilerContext *ctx);
 
 /**
  * Function to parse the content of a body block
  *
  * @param statement - the statement contained in the body block to parse
+ * @param ctx - the compiler context
  * @return bool - if the body content was parsed successfully
  */
-bool parse_body_content(Statement *statement);
+bool parse_body_content(Statement *statement, CompilerContext *ctx);
 
 /**
  * Function to parse the next body content in sequence
  *
+ * @param ctx - the compiler context
  * @return bool - if the next body content was parsed successfully
  */
-bool parse_body_content_next(void);
+bool parse_body_content_next(CompilerContext *ctx);
 
 /**
  * Function to parse a variable definition
  *
  * @param variable_definition_statement - the variable definition to parse
+ * @param ctx - the compiler context
  * @return bool - if the variable definition was parsed successfully
  */
-bool parse_var_def(VariableDefinitionStatement *variable_definition_statement);
+bool parse_var_def(VariableDefinitionStatement *variable_definition_statement, CompilerContext *ctx);
 
 /**
  * Function to parse a non-truth expression
  *
  * @param expr - the expression to parse
+ * @param ctx - the compiler context
  * @return bool - if the non-truth expression was parsed successfully
  */
-bool parse_no_truth_expr(Expression *expr);
+bool parse_no_truth_expr(Expression *expr, CompilerContext *ctx);
 
 /**
  * Function to parse a truth expression
  *
  * @param expr - the expression to parse
+ * @param ctx - the compiler context
  * @return bool - if the truth expression was parsed successfully
  */
-bool parse_truth_expr(Expression *expr);
+bool parse_truth_expr(Expression *expr, CompilerContext *ctx);
 
 /**
  * Function to parse a function call statement
  *
  * @param function_call - the function call to parse
+ * @param ctx - the compiler context
  * @return bool - if the function call was parsed successfully
  */
-bool parse_func_call_statement(FunctionCall *function_call);
+bool parse_func_call_statement(FunctionCall *function_call, CompilerContext *ctx);
 
 /**
  * Function to parse a variable assignment
  *
  * @param assign_statement - the assignment statement to parse
+ * @param ctx - the compiler context
  * @return bool - if the variable assignment was parsed successfully
  */
-bool parse_var_assign(AssigmentStatement *assign_statement);
+bool parse_var_assign(AssigmentStatement *assign_statement, CompilerContext *ctx);
 
 /**
  * Function to parse an if statement
  *
  * @param if_statment - the if statement to parse
+ * @param ctx - the compiler context
  * @return bool - if the if statement was parsed successfully
  */
-bool parse_if(IfStatement *if_statment);
+bool parse_if(IfStatement *if_statment, CompilerContext *ctx);
 
 /**
  * Function to parse an else statement
  *
  * @param if_statment - the else statement to parse
+ * @param ctx - the compiler context
  * @return bool - if the else statement was parsed successfully
  */
-bool parse_else(IfStatement *if_statment);
+bool parse_else(IfStatement *if_statment, CompilerContext *ctx);
 
 /**
  * Function to parse a while statement
  *
  * @param while_statement - the while statement to parse
+ * @param ctx - the compiler context
  * @return bool - if the while statement was parsed successfully
  */
-bool parse_while(WhileStatement *while_statement);
+bool parse_while(WhileStatement *while_statement, CompilerContext *ctx);
 
 /**
  * Function to parse a return value
  *
  * @param return_statement - the return statement to parse
+ * @param ctx - the compiler context
  * @return bool - if the return value was parsed successfully
  */
-bool parse_ret_value(ReturnStatement *return_statement);
+bool parse_ret_value(ReturnStatement *return_statement, CompilerContext *ctx);
 
 /**
  * Function to parse a native function call
  *
  * @param function_call - the native function call to parse
+ * @param ctx - the compiler context
  * @return bool - if the native function call was parsed successfully
  */
-bool parse_native_func_call(FunctionCall *function_call);
+bool parse_native_func_call(FunctionCall *function_call, CompilerContext *ctx);
 
 /**
  * Function to parse a user-defined function call
  *
  * @param function_call - the user-defined function call to parse
+ * @param ctx - the compiler context
  * @return bool - if the user-defined function call was parsed successfully
  */
-bool parse_user_func_call(FunctionCall *function_call);
+bool parse_user_func_call(FunctionCall *function_call, CompilerContext *ctx);
 
 /**
  * Function to parse the parameters of a function call
  *
  * @param attributes - a linked list of attributes to parse
+ * @param ctx - the compiler context
  * @return bool - if the function call parameters were parsed successfully
  */
-bool parse_func_call_params(LinkedList *attributes);
+bool parse_func_call_params(LinkedList *attributes, CompilerContext *ctx);
 
 /**
  * Function to parse a single parameter in a function call
  *
  * @param expr - the expression representing the parameter to parse
+ * @param ctx - the compiler context
  * @return bool - if the function call parameter was parsed successfully
  */
-bool parse_func_call_param(Expression *expr);
+bool parse_func_call_param(Expression *expr, CompilerContext *ctx);
 
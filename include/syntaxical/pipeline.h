@@ -0,0 +1,92 @@
+/** AUTHOR
+ *
+ * @author agent <agent@local>
+ * @file pipeline.h
+ * @date 19.10.2026
+ * @brief Header file for the pipelined front end, the lexer, the parser and the collection of the function definitions run on their own threads
+ */
+
+#ifndef PIPELINE_H
+#define PIPELINE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef USE_CUSTOM_STRUCTURE
+#include "syntaxical/ast.h"
+#include "utility/compiler_context.h"
+#include "utility/enumerations.h"
+#include "utility/spsc_ring.h"
+#else
+#include "ast.h"
+#include "compiler_context.h"
+#include "enumerations.h"
+#include "spsc_ring.h"
+#endif
+
+// count of tokens, that the lexer thread can be ahead of the parser
+#ifndef PIPELINE_TOKEN_RING
+#define PIPELINE_TOKEN_RING 4096
+#endif
+
+// count of parsed functions, that wait for their definitions to be added
+#ifndef PIPELINE_FUNCTION_RING
+#define PIPELINE_FUNCTION_RING 256
+#endif
+
+// tokens pulled after the end of a function, the parser looks at most this far ahead
+#define PIPELINE_LOOK_AHEAD 2
+
+// Struct for a single token passed from the lexer thread
+typedef struct PipelineToken {
+    struct TOKEN token; // the token
+    enum ERR_CODES status; // result of scanner_get_token, the last token is EOF or has an error
+    size_t position; // index in the source after the token
+} PipelineToken;
+
+// Struct for the state shared by the threads of the pipeline
+typedef struct Pipeline {
+    const char *source; // the source, lexed by the lexer thread
+    size_t length; // length of the source
+    SpscRing *tokens; // PipelineToken from the lexer thread to the parser
+    SpscRing *functions; // Function pointers from the parser to the definitions thread, NULL ends it
+    SymTable *table; // the definitions are added here
+
+    // parser thread
+    bool lexed; // the last token was taken from the ring
+    enum ERR_CODES status; // error of the lexer, or of saving a token
+    size_t position; // index in the source after the last token
+
+    // definitions thread, read after it ends
+    unsigned int signatures; // count of the first functions, whose definitions were added
+} Pipeline;
+
+/**
+ * Function to parse the program, while the source is lexed on another thread, the definitions of the parsed
+ * functions are added to the table on a third thread. The result is the same as of parser_parse, the count
+ * of the added definitions is stored to ctx->signatures, so analyzeProgram skips them.
+ *
+ * @param program - the AST root
+ * @param ctx - the compiler context, the source has to be set by scanner_init_buffer
+ * @return enum ERR_CODES - the error code
+ */
+enum ERR_CODES pipelineParse(Program *program, CompilerContext *ctx);
+
+/**
+ * Function to wait for the tokens of the part of the program starting at the current token, it ends after the
+ * closing brace of a function, or before the next pub, plus PIPELINE_LOOK_AHEAD more tokens
+ *
+ * @param ctx - the compiler context
+ * @return bool - false if the lexer failed, the parser must not continue
+ */
+bool pipelinePullFunction(CompilerContext *ctx);
+
+/**
+ * Function to pass a parsed function to the definitions thread
+ *
+ * @param ctx - the compiler context
+ * @param function - the parsed function
+ */
+void pipelinePushFunction(CompilerContext *ctx, Function *function);
+
+#endif // PIPELINE_H
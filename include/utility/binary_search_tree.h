@@ -35,12 +35,14 @@ typedef struct BST {
  * @param data - pointer to the data, in each node
  * @param left - pointer to the left child
  * @param right - pointer to the right child
+ * @param height - height of the subtree of the node, 0 for a leaf
 */
 typedef struct TreeNode{
     unsigned int key;
     void *data;
     struct TreeNode *left;
     struct TreeNode *right;
+    int height;
 } TreeNode;
 
 /**
@@ -123,14 +125,22 @@ bool _bstFreeNode(TreeNode *node, void (*freeFunction)(void **data));
 int bstCalculateHeight(BST *tree);
 
 /**
- * Calculates the higtht of a node
+ * Calculates the higtht of a node, the height is kept in the node, so this takes a constant time
  * 
  * @param node - pointer to the tree node
  * @note this function is internal
- * @return height of the node, or 0 if the node is NULL
+ * @return height of the node, or -1 if the node is NULL
 */
 int _bstCalculateHeight(TreeNode *node);
 
+/**
+ * Updates the height of a node from the heights of its children
+ * 
+ * @param node - pointer to the tree node
+ * @note this function is internal
+*/
+void _bstUpdateHeight(TreeNode *node);
+
 /**
  * @brief Calculates the balance factor of a node.
  * 
@@ -140,10 +150,21 @@ int _bstCalculateHeight(TreeNode *node);
 int _bstGetBalanceFactor(TreeNode *node);
 
 /**
- * @brief Balances the tree rooted at the given node.
+ * @brief Balances a node, whose subtrees are balanced already.
  * 
  * This function checks the balance factor of the node and performs
  * necessary rotations to maintain balance (LL, LR, RL, RR cases).
+ * The inserts and the removals balance every node on their path,
+ * so the tree is an AVL tree and its height stays logarithmic.
+ * 
+ * @param node - pointer to the tree node
+ * @note this function is internal
+ * @return pointer to the new root of the subtree
+ */
+TreeNode *_bstBalanceNode(TreeNode *node);
+
+/**
+ * @brief Balances the tree at its root.
  * 
  * @param tree - pointer to the BST
  * @return true if the tree was balanced, false otherwise
@@ -0,0 +1,80 @@
+/** AUTHOR
+ *
+ * @author agent <agent@local>
+ * @file compiler_context.h
+ * @date 19.10.2026
+ * @brief Header file for the state of a single compilation, shared by all the phases
+ */
+
+#ifndef COMPILER_CONTEXT_H
+#define COMPILER_CONTEXT_H
+
+#include <stdio.h>
+
+#ifdef USE_CUSTOM_STRUCTURE
+#include "semantical/symtable.h"
+#include "utility/enumerations.h"
+#include "utility/linked_list.h"
+#include "utility/output_buffer.h"
+#include "utility/timing.h"
+#else
+#include "symtable.h"
+#include "enumerations.h"
+#include "linked_list.h"
+#include "output_buffer.h"
+#include "timing.h"
+#endif
+
+// worker threads of the parallel phases, 1 runs everything on the calling thread
+#ifndef COMPILER_JOBS
+#define COMPILER_JOBS 1
+#endif
+
+// programs with less functions run the parallel phases on one thread, starting the threads would cost more
+#ifndef PARALLEL_MIN_FUNCTIONS
+#define PARALLEL_MIN_FUNCTIONS 8
+#endif
+
+// Struct for the compiler context, every compilation has its own, so they can run in parallel
+typedef struct CompilerContext {
+    // scanner
+    FILE *file; // the source code, if it is not in memory
+    const char *source; // the source code in memory, NULL if it is read from the file
+    size_t sourceLength; // length of the source in memory
+    size_t sourcePosition; // index of the next character to read from the source in memory
+    int nextCharacter; // character read ahead, EOF if none
+    struct TOKEN nextToken; // token read ahead, TOKEN_NONE if none
+
+    // parser
+    unsigned int tokenIndex; // index of the current token in the buffer
+    LinkedList *buffer; // all the tokens of the program
+    SymTable *table; // the symbol table
+    struct TOKEN token; // last scanned token
+    enum ERR_CODES globalError; // error to report instead of a syntax error
+
+    // parallel phases
+    unsigned int jobs; // worker threads of the parallel phases
+    struct Pipeline *pipeline; // the tokens come from the lexer thread, NULL if the first pass lexed the whole source
+    unsigned int signatures; // count of the first functions, whose definitions are already in the table
+
+    // code generator
+    const char *labelScope; // name of the generated function, the if and while labels are numbered inside it
+    int ifCounter; // id of the next if statement
+    int whileCounter; // id of the next while statement
+    OutputBuffer *out; // the generated code
+    unsigned int indent; // depth of the generated C block, used by the C backend
+
+    // instrumentation
+    Timing *timing; // records the phases and the single functions, NULL if they are not timed
+} CompilerContext;
+
+/**
+ * Function to initialize the compiler context
+ *
+ * @param ctx - the context to initialize
+ * @param table - the symbol table of the compilation, its token buffer is used by the parser
+ * @param out - buffer for the generated code, can be NULL if no code is generated
+ */
+void compilerContextInit(CompilerContext *ctx, SymTable *table, OutputBuffer *out);
+
+#endif // COMPILER_CONTEXT_H
@@ -11,6 +11,7 @@
 
 #include <stdbool.h>
 #include <stdarg.h>
+#include <stddef.h>
 
 // ANSI color codes for console output
 #define COLOR_PASS "\033[0;32m" // Green
@@ -221,8 +222,38 @@ typedef struct TestInstance {
     unsigned int testNumber;
     unsigned int fails;
     unsigned int passes;
+    unsigned int benchNumber; // number of the next benchmark case
+    unsigned int benchWarmup; // runs before the measured ones
+    unsigned int benchRuns; // measured runs, less if they take longer than BENCH_TIME_BUDGET
+    bool benchmark; // the benchmarks are measured, only with IFJ24_BENCH set, otherwise they run once
 } *TestInstancePtr;
 
+// time of the measured runs of a single benchmark case, in nanoseconds, at least BENCH_MIN_RUNS are done
+#define BENCH_TIME_BUDGET 2000000000.0
+#define BENCH_MIN_RUNS 5
+
+// largest size of a benchmark, when it is not measured, so the tests stay fast
+#define BENCH_SMOKE_SIZE 100
+
+// Struct for a benchmark case, only the run is timed
+typedef struct BenchCase {
+    char *benchName; // name of the benchmark
+    size_t operations; // operations done by a single run, the time is printed per operation
+    void *data; // given to all the functions
+    void (*setup)(void *data); // before every run, NULL for none
+    void (*run)(void *data); // the timed run
+    void (*teardown)(void *data); // after every run, NULL for none
+} BenchCase;
+
+// Struct for a case of a benchmark sweep, it is run for every size of the sweep
+typedef struct BenchSweepCase {
+    char *benchName; // name of the case, the size is appended to it
+    size_t operations; // operations done by a single run, 0 for the size
+    void (*setup)(void *data); // before every run, NULL for none
+    void (*run)(void *data); // the timed run
+    void (*teardown)(void *data); // after every run, NULL for none
+} BenchSweepCase;
+
 /**
  *  Function to create a new test instance
  *
@@ -249,6 +280,37 @@ void finishTestInstance(TestInstancePtr testInstance);
  */
 void testCase(TestInstancePtr testInstance, bool testResult, char *testName, char *testResultPassMsg, char *testResultFailMsg);
 
+/**
+ * Function to run a benchmark case, after the warm-up runs it prints the min, median and p99 time per operation,
+ * without IFJ24_BENCH it only runs the case once
+ *
+ * @param testInstance The test instance, it has the amount of the runs
+ * @param bench The benchmark case
+ */
+void benchCase(TestInstancePtr testInstance, BenchCase *bench);
+
+/**
+ * Function to limit the size of the benchmarks, when they are not measured
+ *
+ * @param testInstance The test instance
+ * @param size The size of the measured benchmark
+ * @return The size, at most BENCH_SMOKE_SIZE without IFJ24_BENCH
+ */
+size_t benchSize(TestInstancePtr testInstance, size_t size);
+
+/**
+ * Function to run the benchmark cases for the sizes 10, 100, ... up to the max size, limited by benchSize,
+ * the size is written to the data before the cases of the size are run
+ *
+ * @param testInstance The test instance
+ * @param cases The cases run for every size
+ * @param count The amount of the cases
+ * @param data Given to all the functions of the cases
+ * @param size The size field in the data
+ * @param maxSize The largest measured size
+ */
+void benchSweep(TestInstancePtr testInstance, BenchSweepCase *cases, size_t count, void *data, unsigned int *size, size_t maxSize);
+
 /**
  * Function to print the error code
  *
@@ -123,6 +123,16 @@ unsigned int getSize(struct LinkedList *list);
  */
 void *getDataAtIndex(struct LinkedList *list, int index);
 
+/**
+ * Get the data at a specific index, without moving the active element, so more threads
+ * can read a list at once, as long as nobody modifies it
+ * 
+ * @param list The list to get the data from
+ * @param index The index of the data to get, negative indexes count from the end
+ * @return The data at the index, NULL if the list is NULL or the index is out of bounds
+ */
+void *peekDataAtIndex(struct LinkedList *list, int index);
+
 /**
  * Function to create a new node
  * 
@@ -0,0 +1,128 @@
+/** AUTHOR
+ *
+ * @author agent <agent@local>
+ * @file memory.h
+ * @date 19.10.2026
+ * @brief Header file for the tracking allocator, every allocation is counted under the subsystem, that made it
+ *
+ * The tracking exists only in the builds with MEMORY_TRACKING, they have to be linked with
+ * -Wl,--wrap=malloc,--wrap=calloc,--wrap=realloc,--wrap=free, so every allocation of the compiler goes through it.
+ * The subsystem is the innermost scope started on the thread, a few allocations name it directly.
+ */
+
+#ifndef MEMORY_H
+#define MEMORY_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+// Enum for the subsystems, the allocations are counted under
+enum MEMORY_TAG {
+    MEMORY_OTHER, // outside of any scope, the results, the buffers of the library and the tests
+    MEMORY_SCANNER, // the tokens, their values and the token buffer
+    MEMORY_PARSER, // the lists of the AST and anything else allocated while parsing
+    MEMORY_PRECEDENCE, // the stack of the precedence parser
+    MEMORY_AST, // the nodes of the AST, the copies made by the inliner too
+    MEMORY_SYMTABLE, // the scopes, the variables, the definitions and their trees
+    MEMORY_CODEGEN, // the generated code
+    MEMORY_TAG_COUNT, // amount of the tags
+};
+
+// Struct for the counters of a single tag
+typedef struct MemoryTagStats {
+    size_t current; // bytes allocated and not freed
+    size_t peak; // the most bytes allocated at once
+    size_t total; // all the bytes ever allocated
+    size_t blocks; // allocations not freed
+    size_t allocations; // all the allocations
+} MemoryTagStats;
+
+// Struct for all the counters, they are updated by more threads
+typedef struct MemoryStats {
+    MemoryTagStats tags[MEMORY_TAG_COUNT]; // the counters of the tags
+    MemoryTagStats all; // the counters of all the tags together
+    size_t mallocCalls; // calls of malloc
+    size_t callocCalls; // calls of calloc
+    size_t reallocCalls; // calls of realloc
+    size_t freeCalls; // calls of free with a pointer
+} MemoryStats;
+
+// the counters of the whole process, they stay zero without the tracking
+extern MemoryStats memoryStats;
+
+#ifdef MEMORY_TRACKING
+
+// counts the allocations of the thread under the tag, evaluates to the previous tag
+#define MEMORY_SCOPE_BEGIN(tag) memoryScopeEnter(tag)
+
+// counts the allocations of the thread under the previous tag again
+#define MEMORY_SCOPE_END(previous) memoryScopeLeave(previous)
+
+// allocates under the tag, regardless of the scope
+#define MEMORY_MALLOC(tag, size) memoryMalloc((tag), (size))
+
+#else
+
+// the tracking is compiled out, the allocations are not counted
+#define MEMORY_SCOPE_BEGIN(tag) MEMORY_OTHER
+#define MEMORY_SCOPE_END(previous) ((void)(previous))
+#define MEMORY_MALLOC(tag, size) malloc(size)
+
+#endif // MEMORY_TRACKING
+
+/**
+ * Starts counting the allocations of the thread under the tag, use MEMORY_SCOPE_BEGIN
+ *
+ * @param tag the subsystem
+ * @return the previous tag, to be given to memoryScopeLeave
+ */
+enum MEMORY_TAG memoryScopeEnter(enum MEMORY_TAG tag);
+
+/**
+ * Ends the scope started by memoryScopeEnter, use MEMORY_SCOPE_END
+ *
+ * @param previous the tag returned by memoryScopeEnter
+ */
+void memoryScopeLeave(enum MEMORY_TAG previous);
+
+/**
+ * Allocates the memory under the tag, use MEMORY_MALLOC, the memory is freed by free
+ *
+ * @param tag the subsystem
+ * @param size bytes to allocate
+ * @return the memory, NULL on failure
+ */
+void *memoryMalloc(enum MEMORY_TAG tag, size_t size);
+
+/**
+ * Tells, if the allocations are tracked
+ *
+ * @return true in the builds with MEMORY_TRACKING
+ */
+bool memoryTrackingEnabled(void);
+
+/**
+ * Returns the name of the tag
+ *
+ * @param tag the tag
+ * @return static string with the name
+ */
+const char *memoryTagName(enum MEMORY_TAG tag);
+
+/**
+ * Returns the peak resident set size of the process
+ *
+ * @return the peak RSS in KiB, 0 if it is not known
+ */
+size_t memoryPeakRss(void);
+
+/**
+ * Prints the current, peak and total bytes of every tag, the allocations not freed and the peak RSS
+ *
+ * @param output where the report is printed
+ */
+void memoryPrintReport(FILE *output);
+
+#endif // MEMORY_H
@@ -0,0 +1,143 @@
+/** AUTHOR
+ *
+ * @author agent <agent@local>
+ * @file output_buffer.h
+ * @date 19.10.2026
+ * @brief Header file for the in-memory output buffer of the generated code
+ */
+
+#ifndef OUTPUT_BUFFER_H
+#define OUTPUT_BUFFER_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+
+// starting capacity of the buffer, it grows by doubling
+#define OUTPUT_BUFFER_INIT_CAPACITY (1 << 16)
+
+// chunk size used by the compiler, 0 writes the whole code with a single fwrite at the end
+#ifndef OUTPUT_BUFFER_CHUNK_SIZE
+#define OUTPUT_BUFFER_CHUNK_SIZE 0
+#endif
+
+// Struct for the output buffer
+typedef struct OutputBuffer {
+    char *data; // the buffered output, not null terminated
+    size_t size; // amount of used bytes
+    size_t capacity; // amount of allocated bytes
+    FILE *stream; // where the buffer is flushed, NULL keeps everything in memory
+    size_t chunkSize; // flush to the stream every time this many bytes are buffered, 0 flushes only on request
+    bool error; // allocation or write failure, everything after it is dropped
+} OutputBuffer;
+
+/**
+ * Allocates a new output buffer
+ *
+ * @param stream where the buffer is flushed, NULL keeps the whole output in memory
+ * @param chunkSize flush every time this many bytes are buffered, 0 flushes only by outputBufferFlush
+ * @return pointer to the new buffer, NULL on allocation failure
+ */
+OutputBuffer *outputBufferInit(FILE *stream, size_t chunkSize);
+
+/**
+ * Frees the buffer and sets the pointer to NULL, nothing is flushed
+ *
+ * @param buffer pointer to the buffer pointer
+ */
+void outputBufferFree(OutputBuffer **buffer);
+
+/**
+ * Makes sure, there is space for more bytes, flushes a full chunk or grows the buffer
+ *
+ * @param buffer the output buffer
+ * @param length amount of bytes, that will be appended
+ * @return true if there is enough space, false on failure
+ */
+bool outputBufferReserve(OutputBuffer *buffer, size_t length);
+
+/**
+ * Appends bytes to the buffer
+ *
+ * @param buffer the output buffer
+ * @param data bytes to append
+ * @param length amount of bytes
+ */
+void outputBufferAppendN(OutputBuffer *buffer, const char *data, size_t length);
+
+/**
+ * Appends a null terminated literal to the buffer
+ *
+ * @param buffer the output buffer
+ * @param str the literal
+ */
+void outputBufferAppend(OutputBuffer *buffer, const char *str);
+
+/**
+ * Appends a null terminated literal followed by a new line
+ *
+ * @param buffer the output buffer
+ * @param str the literal
+ */
+void outputBufferAppendLine(OutputBuffer *buffer, const char *str);
+
+/**
+ * Appends a single character
+ *
+ * @param buffer the output buffer
+ * @param c the character
+ */
+void outputBufferAppendChar(OutputBuffer *buffer, char c);
+
+/**
+ * Appends a decimal integer
+ *
+ * @param buffer the output buffer
+ * @param value the integer
+ */
+void outputBufferAppendInt(OutputBuffer *buffer, long long value);
+
+/**
+ * Appends a double in the C99 hexadecimal notation, the same text as printf("%a")
+ *
+ * @param buffer the output buffer
+ * @param value the double
+ */
+void outputBufferAppendHexFloat(OutputBuffer *buffer, double value);
+
+/**
+ * Appends a string escaped for IFJcode24, white space, control characters, # and \ as \ddd
+ *
+ * @param buffer the output buffer
+ * @param str the null terminated string
+ */
+void outputBufferAppendEscaped(OutputBuffer *buffer, const char *str);
+
+/**
+ * Appends a numbered label, in the form <prefix><id><suffix>, eg. $while_3_end
+ *
+ * @param buffer the output buffer
+ * @param prefix part before the id
+ * @param id the number of the label
+ * @param suffix part after the id
+ */
+void outputBufferAppendLabel(OutputBuffer *buffer, const char *prefix, long long id, const char *suffix);
+
+/**
+ * Appends a local variable, in the form TF@<name>_<id>
+ *
+ * @param buffer the output buffer
+ * @param name name of the variable
+ * @param id unique id of the variable
+ */
+void outputBufferAppendVar(OutputBuffer *buffer, const char *name, long long id);
+
+/**
+ * Writes the buffered bytes to the stream with a single fwrite and empties the buffer
+ *
+ * @param buffer the output buffer
+ * @return true on success, false if an error happened at any point
+ */
+bool outputBufferFlush(OutputBuffer *buffer);
+
+#endif // OUTPUT_BUFFER_H
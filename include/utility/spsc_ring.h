@@ -0,0 +1,85 @@
+/** AUTHOR
+ *
+ * @author agent <agent@local>
+ * @file spsc_ring.h
+ * @date 19.10.2026
+ * @brief Header file for the bounded lock-free ring of a single producer and a single consumer thread
+ */
+
+#ifndef SPSC_RING_H
+#define SPSC_RING_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+// size of a cache line, the indexes of the two threads are kept on different lines
+#define SPSC_RING_CACHE_LINE 64
+
+// Struct for the ring, the elements are copied in and out
+typedef struct SpscRing {
+    unsigned char *slots; // the elements
+    size_t elementSize; // size of a single element in bytes
+    size_t mask; // capacity - 1, the capacity is a power of two
+
+    // producer
+    size_t tail; // count of pushed elements, written only by the producer
+    size_t cachedHead; // last head seen by the producer
+    char producerPad[SPSC_RING_CACHE_LINE];
+
+    // consumer
+    size_t head; // count of popped elements, written only by the consumer
+    size_t cachedTail; // last tail seen by the consumer
+    char consumerPad[SPSC_RING_CACHE_LINE];
+} SpscRing;
+
+/**
+ * Function to create a ring
+ *
+ * @param capacity - minimal count of elements, rounded up to a power of two
+ * @param elementSize - size of a single element in bytes
+ * @return SpscRing* - the ring, NULL on allocation error
+ */
+SpscRing *spscRingInit(size_t capacity, size_t elementSize);
+
+/**
+ * Function to free the ring
+ *
+ * @param ring - pointer to the ring, it is set to NULL
+ */
+void spscRingFree(SpscRing **ring);
+
+/**
+ * Function to push an element, if there is space, only the producer can call it
+ *
+ * @param ring - the ring
+ * @param element - the element to copy into the ring
+ * @return bool - false if the ring is full
+ */
+bool spscRingTryPush(SpscRing *ring, const void *element);
+
+/**
+ * Function to pop an element, if there is any, only the consumer can call it
+ *
+ * @param ring - the ring
+ * @param element - where the element is copied
+ * @return bool - false if the ring is empty
+ */
+bool spscRingTryPop(SpscRing *ring, void *element);
+
+/**
+ * Function to push an element, waits while the ring is full
+ *
+ * @param ring - the ring
+ * @param element - the element to copy into the ring
+ */
+void spscRingPush(SpscRing *ring, const void *element);
+
+/**
+ * Function to pop an element, waits while the ring is empty
+ *
+ * @param ring - the ring
+ * @param element - where the element is copied
+ */
+void spscRingPop(SpscRing *ring, void *element);
+
+#endif // SPSC_RING_H
@@ -0,0 +1,95 @@
+/** AUTHOR
+ *
+ * @author agent <agent@local>
+ * @file statistics.h
+ * @date 19.10.2026
+ * @brief Header file for the internal counters of the compiler, they exist only in the builds with COMPILER_STATS
+ */
+
+#ifndef STATISTICS_H
+#define STATISTICS_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+
+// amount of the statement types, in the order of enum StatementType
+#define STATS_STATEMENT_TYPES 6
+
+// amount of the expression types, in the order of enum ExpressionType
+#define STATS_EXPRESSION_TYPES 4
+
+// Struct for the counters, they are updated by more threads, so only by the macros below
+typedef struct CompilerStats {
+    // lexer
+    size_t sourceBytes; // bytes of the compiled sources
+    size_t tokens; // tokens returned by the scanner, the streaming mode lexes the source twice
+
+    // parser
+    size_t functions; // parsed functions
+    size_t params; // parsed parameters
+    size_t statements[STATS_STATEMENT_TYPES]; // parsed statements by their type, the nested ones too
+    size_t expressions[STATS_EXPRESSION_TYPES]; // parsed expressions by their type, the operands too
+    size_t precedenceMaxDepth; // most items on the stack of the precedence parser
+
+    // symbol table
+    size_t symtableLookups; // searched variables and functions
+    size_t symtableProbes; // searched scopes, a variable is looked for up to the global one
+    size_t bstSearches; // searches of the trees of the scopes and the definitions
+    size_t bstVisited; // nodes visited by the searches, divided by them it is the depth per lookup
+
+    // linked list
+    size_t listMoves; // moves of the active element to another index
+    size_t listSteps; // nodes walked by the moves
+} CompilerStats;
+
+#ifdef COMPILER_STATS
+
+// the counters of the whole process
+extern CompilerStats compilerStats;
+
+// adds to a counter
+#define STATS_ADD(counter, amount) __atomic_fetch_add(&compilerStats.counter, (size_t)(amount), __ATOMIC_RELAXED)
+
+// raises a counter to the value, if it is bigger
+#define STATS_MAX(counter, value) statsMax(&compilerStats.counter, (size_t)(value))
+
+#else
+
+// the counters are compiled out, the arguments are not evaluated
+#define STATS_ADD(counter, amount) ((void)0)
+#define STATS_MAX(counter, value) ((void)0)
+
+#endif // COMPILER_STATS
+
+/**
+ * Raises the counter to the value, if it is bigger, use STATS_MAX
+ *
+ * @param counter the counter
+ * @param value the new value
+ */
+void statsMax(size_t *counter, size_t value);
+
+/**
+ * Tells, if the counters were compiled in
+ *
+ * @return true in the builds with COMPILER_STATS
+ */
+bool statsEnabled(void);
+
+/**
+ * Sets all the counters to zero
+ */
+void statsReset(void);
+
+/**
+ * Prints the counters as a single JSON object, the instructions of the generated code are counted by their opcode,
+ * the allocations are taken from the tracking allocator
+ *
+ * @param output where the JSON is printed
+ * @param code the generated code, NULL if the compilation failed
+ * @param length length of the code
+ */
+void statsPrintJson(FILE *output, const char *code, size_t length);
+
+#endif // STATISTICS_H
@@ -0,0 +1,104 @@
+/** AUTHOR
+ *
+ * @author agent <agent@local>
+ * @file timing.h
+ * @date 19.10.2026
+ * @brief Header file for the timing of the compiler phases and of the single functions in them
+ */
+
+#ifndef TIMING_H
+#define TIMING_H
+
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stddef.h>
+
+// 0 compiles the timing out of the phases, otherwise it costs a single test of the pointer, when it is not used
+#ifndef TIMING_ENABLED
+#define TIMING_ENABLED 1
+#endif
+
+// returned by timingBegin, when the span cannot be recorded, ending it does nothing
+#define TIMING_NO_SPAN ((size_t)-1)
+
+// starts a span, if the timing is used, otherwise evaluates to TIMING_NO_SPAN without reading the clock
+#define TIMING_BEGIN(timing, name) ((TIMING_ENABLED && (timing)) ? timingBegin((timing), (name)) : TIMING_NO_SPAN)
+
+// ends a span started by TIMING_BEGIN, the detail is the name of the function, or NULL for a whole phase
+#define TIMING_END(timing, span, detail) do { if (TIMING_ENABLED && (timing)) timingEnd((timing), (span), (detail)); } while (0)
+
+// Struct for a single measured span
+typedef struct TimingSpan {
+    const char *name; // static name of the phase
+    char *detail; // copy of the name of the function, NULL for a whole phase
+    uint64_t start; // nanoseconds since the timing was initialized
+    uint64_t end; // the same, valid only if the span is done
+    unsigned int thread; // index of the thread, in the order the threads started their first span
+    bool done; // false if the span was not ended, because its phase failed
+} TimingSpan;
+
+// Struct for all the spans of a compilation, the spans can be recorded by more threads
+typedef struct Timing {
+    TimingSpan *spans; // the spans in the order they were started
+    size_t count; // amount of the spans
+    size_t capacity; // allocated spans
+    pthread_t *threads; // the threads, that recorded a span
+    unsigned int threadCount; // amount of the threads
+    uint64_t origin; // the monotonic clock at the initialization
+    bool error; // a span or a thread could not be recorded
+    pthread_mutex_t lock; // guards everything above
+} Timing;
+
+/**
+ * Initializes the timing, the spans are measured from now
+ *
+ * @param timing the timing to initialize
+ * @return true on success
+ */
+bool timingInit(Timing *timing);
+
+/**
+ * Frees the spans of the timing
+ *
+ * @param timing the timing
+ */
+void timingFree(Timing *timing);
+
+/**
+ * Starts a span on the calling thread, use TIMING_BEGIN, so nothing is done without the timing
+ *
+ * @param timing the timing
+ * @param name static name of the phase
+ * @return the span to end, TIMING_NO_SPAN if it cannot be recorded
+ */
+size_t timingBegin(Timing *timing, const char *name);
+
+/**
+ * Ends a span, use TIMING_END, so nothing is done without the timing
+ *
+ * @param timing the timing
+ * @param span the span returned by timingBegin
+ * @param detail name of the function, it is copied, NULL for a whole phase
+ */
+void timingEnd(Timing *timing, size_t span, const char *detail);
+
+/**
+ * Prints a table of the phases, the spans of the same name are summed, the slowest function of every phase is shown
+ *
+ * @param timing the timing
+ * @param output where the table is printed
+ */
+void timingPrintSummary(Timing *timing, FILE *output);
+
+/**
+ * Writes the spans in the trace event format, the file can be opened in chrome://tracing or Perfetto
+ *
+ * @param timing the timing
+ * @param path the file to write
+ * @return true on success
+ */
+bool timingWriteTrace(Timing *timing, const char *path);
+
+#endif // TIMING_H
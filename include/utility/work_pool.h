@@ -0,0 +1,68 @@
+/** AUTHOR
+ *
+ * @author agent <agent@local>
+ * @file work_pool.h
+ * @date 19.10.2026
+ * @brief Header file for the thread pool with work stealing deques
+ */
+
+#ifndef WORK_POOL_H
+#define WORK_POOL_H
+
+#include <pthread.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+// a task of the pool, called once for every index
+typedef void (*WorkTask)(void *data, size_t index);
+
+// Struct for the deque of a single worker, the owner works on the bottom, the thieves steal from the top
+typedef struct WorkDeque {
+    size_t *tasks; // indexes of the tasks
+    size_t top; // the next task to steal
+    size_t bottom; // one after the next task of the owner
+    pthread_mutex_t lock; // guards top and bottom
+} WorkDeque;
+
+// Struct for the pool of workers
+typedef struct WorkPool {
+    WorkDeque *deques; // one deque for every worker
+    unsigned int workerCount; // amount of the worker threads
+    WorkTask task; // the function called for every task
+    void *data; // passed to every task
+    size_t steals; // amount of tasks done by another worker, than the one it was given to
+    pthread_mutex_t statsLock; // guards steals
+} WorkPool;
+
+/**
+ * Runs tasks 0 .. taskCount - 1 on the worker threads and waits for all of them. The tasks are split
+ * into continuous blocks, one for every worker, a worker without tasks steals from the others.
+ *
+ * @param taskCount amount of the tasks
+ * @param workerCount amount of the worker threads, 0 or 1 runs everything on the calling thread
+ * @param task function called for every task, it has to be thread safe
+ * @param data passed to every task
+ * @param steals if not NULL, the amount of stolen tasks is stored here
+ * @return true on success, false if the threads could not be created, no task was run then
+ */
+bool workPoolRun(size_t taskCount, unsigned int workerCount, WorkTask task, void *data, size_t *steals);
+
+/**
+ * Takes the next task of the worker from the bottom of its deque
+ *
+ * @param deque the deque of the worker
+ * @param index where the index of the task is stored
+ * @return true if there was a task, false if the deque is empty
+ */
+bool workDequePop(WorkDeque *deque, size_t *index);
+
+/**
+ * Steals a task from the top of a deque of another worker
+ *
+ * @param deque the deque of the other worker
+ * @param index where the index of the task is stored
+ * @return true if there was a task, false if the deque is empty
+ */
+bool workDequeSteal(WorkDeque *deque, size_t *index);
+
+#endif // WORK_POOL_H
@@ -0,0 +1,116 @@
+#!/bin/bash
+# /** AUTHOR
+#  *
+#  * @author agent <agent@local>
+#  * @file interpreter_bench.sh
+#  * @date 19.10.2026
+#  * @brief This script compares the throughput of the reference interpreter, of the fast engine and of the native build of the
+#  *        C backend on the example programs.
+#  * @note this script is run by the Makefile (make bench_interpreter), all of them have to give the same output and exit code
+#  */
+
+# ANSI escape codes for colored output
+RESET="\033[0m"
+RED="\033[1;31m"
+GREEN="\033[1;32m"
+CYAN="\033[1;36m"
+
+# Settings, every one can be given by the environment
+COMPILER=${COMPILER:-./main}                      # compiler of the programs
+INTERPRETER=${INTERPRETER:-./build/ic24int}       # the measured interpreter, run with and without --fast
+PROGRAMS=${PROGRAMS:-"test_inputs/example_factorial_iter.zig test_inputs/example_factorial_rec.zig"}
+REPEAT=${REPEAT:-5}                               # runs of every engine, the fastest one counts
+ITER_INPUT=${ITER_INPUT:-2000000}                 # input of the iterative factorial, the iterations of its loop
+REC_INPUT=${REC_INPUT:-100000}                    # input of the recursive factorial, the depth of its recursion
+INPUT=${INPUT:-10}                                # input of the other programs
+CC=${CC:-cc}                                      # builds the sources of the C backend (main --emit-c), empty skips them
+CC_FLAGS=${CC_FLAGS:-"-std=c99 -O2"}              # flags of the C compiler
+
+for binary in "$COMPILER" "$INTERPRETER"; do
+    if [ ! -x "$binary" ]; then
+        echo -e "${RED}Error: $binary not found, run make bench_interpreter.${RESET}"
+        exit 1
+    fi
+done
+
+# Function to get the current time in nanoseconds
+now() {
+    date +%s%N
+}
+
+# Function to run the command the given times, prints the fastest run in nanoseconds
+fastest() {
+    local best=0
+    for ((run = 0; run < REPEAT; run++)); do
+        start=$(now)
+        "$@" < "$WORK_DIR/input" > /dev/null 2>&1
+        elapsed=$(($(now) - start))
+        if [ $best -eq 0 ] || [ $elapsed -lt $best ]; then best=$elapsed; fi
+    done
+    echo "$best"
+}
+
+WORK_DIR=$(mktemp -d)
+trap 'rm -rf "$WORK_DIR"' EXIT
+
+echo -e "${CYAN}Interpreter: $INTERPRETER, the fastest of $REPEAT runs${RESET}"
+printf "%-28s %9s %12s %6s %12s %12s %14s %14s %8s %12s %8s\n" "program" "input" "executed" "exit" "reference ms" "fast ms" \
+    "reference i/s" "fast i/s" "speedup" "native ms" "speedup"
+
+for program in $PROGRAMS; do
+    name=$(basename "$program" .zig)
+    case "$name" in
+        *iter*) input=$ITER_INPUT ;;
+        *rec*) input=$REC_INPUT ;;
+        *) input=$INPUT ;;
+    esac
+    echo "$input" > "$WORK_DIR/input"
+
+    if ! "$COMPILER" < "$program" > "$WORK_DIR/$name.code"; then
+        echo -e "${RED}Error: $program did not compile${RESET}"
+        exit 1
+    fi
+
+    # the instructions are counted by the reference interpreter, its output is the expected one
+    "$INTERPRETER" --counts=json "$WORK_DIR/$name.code" < "$WORK_DIR/input" > "$WORK_DIR/reference.out" 2> "$WORK_DIR/counts.json"
+    status=$?
+    "$INTERPRETER" --fast "$WORK_DIR/$name.code" < "$WORK_DIR/input" > "$WORK_DIR/fast.out" 2> /dev/null
+    fastStatus=$?
+    if [ $status -ne $fastStatus ] || ! cmp -s "$WORK_DIR/reference.out" "$WORK_DIR/fast.out"; then
+        echo -e "${RED}Error: the engines differ on $program, exit codes $status and $fastStatus${RESET}"
+        exit 1
+    fi
+    executed=$(grep -o '"executed": [0-9]*' "$WORK_DIR/counts.json" | sed 's/.*: //')
+
+    # the C backend is built by the system C compiler, the program does not run in any interpreter
+    native=""
+    if [ -n "$CC" ]; then
+        if ! "$COMPILER" --emit-c < "$program" > "$WORK_DIR/$name.c" || ! $CC $CC_FLAGS -o "$WORK_DIR/$name.native" "$WORK_DIR/$name.c"; then
+            echo -e "${RED}Error: the C source of $program did not build${RESET}"
+            exit 1
+        fi
+        "$WORK_DIR/$name.native" < "$WORK_DIR/input" > "$WORK_DIR/native.out" 2> /dev/null
+        nativeStatus=$?
+        if [ $status -ne $nativeStatus ] || ! cmp -s "$WORK_DIR/reference.out" "$WORK_DIR/native.out"; then
+            echo -e "${RED}Error: the native build differs on $program, exit codes $status and $nativeStatus${RESET}"
+            exit 1
+        fi
+        native=$(fastest "$WORK_DIR/$name.native")
+    fi
+
+    reference=$(fastest "$INTERPRETER" "$WORK_DIR/$name.code")
+    fast=$(fastest "$INTERPRETER" --fast "$WORK_DIR/$name.code")
+    printf "%-28s %9s %12s %6s %12.1f %12.1f %14.0f %14.0f %7.2fx" "$name" "$input" "$executed" "$status" \
+        "$(awk -v ns="$reference" 'BEGIN { print ns / 1e6 }')" "$(awk -v ns="$fast" 'BEGIN { print ns / 1e6 }')" \
+        "$(awk -v n="$executed" -v ns="$reference" 'BEGIN { print n * 1e9 / ns }')" \
+        "$(awk -v n="$executed" -v ns="$fast" 'BEGIN { print n * 1e9 / ns }')" \
+        "$(awk -v r="$reference" -v f="$fast" 'BEGIN { print r / f }')"
+    if [ -n "$native" ]; then
+        printf " %12.1f %7.2fx" "$(awk -v ns="$native" 'BEGIN { print ns / 1e6 }')" \
+            "$(awk -v r="$reference" -v n="$native" 'BEGIN { print r / n }')"
+    fi
+    printf "\n"
+done
+
+echo -e "${GREEN}All the engines gave the same output and exit code on every program${RESET}"
+exit 0
@@ -53,6 +53,8 @@ DEBUG_FLAG=$2    # Debug mode (true/false)
 USE_VALGRIND=$3  # Use valgrind (true/false)
 TESTCASE=$4      # Test case (optional)
 PRINT=$5         # Print output (optional)
+MEMORY=$6        # Count the allocations, fail on leak (optional)
+BENCH=$7         # Measure the benchmarks, optimized build (optional)
 
 # Set default values for optional parameters
 if [ -z "$TESTCASE" ]; then
@@ -64,6 +66,14 @@ if [ -z "$PRINT" ]; then
     PRINT=true
 fi
 
+if [ -z "$MEMORY" ]; then
+    MEMORY=false
+fi
+
+if [ -z "$BENCH" ]; then
+    BENCH=false
+fi
+
 # Check if the test is integration
 if [ "$TEST_NAME" = "integration" ]; then
     echo "Doing integration tests"
@@ -97,18 +107,21 @@ fi
 echo -e "${GREEN}Test Name: $TEST_NAME${RESET}"
 echo -e "${GREEN}Debug Mode: $DEBUG_FLAG${RESET}"
 echo -e "${GREEN}Use Valgrind: $USE_VALGRIND${RESET}"
+echo -e "${GREEN}Track Memory: $MEMORY${RESET}"
+echo -e "${GREEN}Benchmark: $BENCH${RESET}"
 
 # Compiler and flags
 CC="gcc"
-CFLAGS="-std=c99 -Wall -Wextra -pedantic -fcommon -DUSE_CUSTOM_STRUCTURE"
+CFLAGS="-std=c99 -Wall -Wextra -pedantic -fcommon -pthread -DUSE_CUSTOM_STRUCTURE"
 INCLUDES="-Iinclude"
+LDFLAGS=""
 
 # Directories
 SRC_DIR="src"
 TEST_DIR="tests"
 
-# Source files
-SRC_FILES=$(find $SRC_DIR -type f -name "*.c" | grep -v "/main.c$")
+# Source files, without the entry points of the compiler and of the interpreter
+SRC_FILES=$(find $SRC_DIR -type f -name "*.c" | grep -v -e "/main.c$" -e "/ic24int.c$")
 
 # Add the main.c file from the src directory for integration tests add the test.c file for other tests
 if [ "$TEST_NAME" == "integration" ]; then
@@ -122,11 +135,25 @@ if [ "$DEBUG_FLAG" == "true" ]; then
     CFLAGS+=" -DDEBUG"
 fi
 
+# Add the tracking allocator, the report is printed at the exit and a leak fails the program
+if [ "$MEMORY" == "true" ]; then
+    CFLAGS+=" -DMEMORY_TRACKING"
+    LDFLAGS+=" -Wl,--wrap=malloc,--wrap=calloc,--wrap=realloc,--wrap=free"
+    export IFJ24_MEMORY_REPORT=1
+    export IFJ24_MEMORY_STRICT=1
+fi
+
+# Measure the benchmarks of the tests, the build is optimized, so the times are the ones of the compiler
+if [ "$BENCH" == "true" ]; then
+    CFLAGS+=" -O2"
+    export IFJ24_BENCH=1
+fi
+
 # Compile the program
 OUTPUT_BIN="test_program"
 print_section "COMPILING TEST: @$TEST_NAME.c"
 echo -e "${YELLOW}Compiling with flags: $CFLAGS${RESET}"
-$CC $CFLAGS $INCLUDES $SRC_FILES -o $OUTPUT_BIN
+$CC $CFLAGS $INCLUDES $SRC_FILES -o $OUTPUT_BIN $LDFLAGS
 handle_exit_code $?
 
 # Run integration tests (passing testcase and print to integration_tests.sh)
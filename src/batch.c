@@ -0,0 +1,321 @@
+/** AUTHOR
+ *
+ * @author agent <agent@local>
+ * @file batch.c
+ * @date 19.10.2026
+ * @brief Implementation of the batch mode, compiles many files on a pool of worker threads
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <dirent.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+#ifdef USE_CUSTOM_STRUCTURE
+#include "batch.h"
+#include "utility/enumerations.h"
+#include "utility/work_pool.h"
+#else
+#include "batch.h"
+#include "enumerations.h"
+#include "work_pool.h"
+#endif
+
+// Function to get the monotonic time in seconds
+static double batchNow(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec + (double)now.tv_nsec / 1e9;
+}
+
+// Function to copy a string
+static char *batchCopyString(const char *str) {
+    char *copy = (char *)malloc(strlen(str) + 1);
+    if (copy) strcpy(copy, str);
+    return copy;
+}
+
+// Function to make the path of the generated code
+static char *batchOutputPath(const char *input, const char *outputDir) {
+    const char *name = input;
+    if (outputDir) {
+        const char *slash = strrchr(input, '/');
+        if (slash) name = slash + 1;
+    }
+
+    // cut the .zig extension
+    size_t nameLength = strlen(name);
+    if (nameLength > 4 && strcmp(name + nameLength - 4, ".zig") == 0) nameLength -= 4;
+
+    size_t dirLength = outputDir ? strlen(outputDir) + 1 : 0;
+    char *output = (char *)malloc(dirLength + nameLength + strlen(BATCH_OUTPUT_EXTENSION) + 1);
+    if (!output) return NULL;
+
+    output[0] = '\0';
+    if (outputDir) {
+        strcpy(output, outputDir);
+        strcat(output, "/");
+    }
+    strncat(output, name, nameLength);
+    strcat(output, BATCH_OUTPUT_EXTENSION);
+    return output;
+}
+
+// Function to add a single file to the batch
+static bool batchAddFile(Batch *batch, const char *path) {
+    if (batch->count == batch->capacity) {
+        size_t capacity = batch->capacity ? batch->capacity * 2 : 64;
+        BatchFile *files = (BatchFile *)realloc(batch->files, capacity * sizeof(BatchFile));
+        if (!files) return false;
+        batch->files = files;
+        batch->capacity = capacity;
+    }
+
+    BatchFile *file = &batch->files[batch->count];
+    file->input = batchCopyString(path);
+    file->output = batchOutputPath(path, batch->outputDir);
+    file->bytes = 0;
+    file->latency = 0;
+    file->error = SUCCESS;
+    file->diagnostic[0] = '\0';
+    batch->count++;
+    return file->input && file->output;
+}
+
+// Function to compare two names for qsort
+static int batchCompareNames(const void *a, const void *b) {
+    return strcmp(*(char *const *)a, *(char *const *)b);
+}
+
+// Function to add a file or a directory to the batch
+bool batchAddPath(Batch *batch, const char *path) {
+    struct stat info;
+    if (stat(path, &info) != 0) return false;
+    if (!S_ISDIR(info.st_mode)) return batchAddFile(batch, path);
+
+    DIR *dir = opendir(path);
+    if (!dir) return false;
+
+    // collect the names first, so the order does not depend on the file system
+    char **names = NULL;
+    size_t count = 0, capacity = 0;
+    bool success = true;
+    struct dirent *entry;
+    while (success && (entry = readdir(dir)) != NULL) {
+        size_t length = strlen(entry->d_name);
+        if (length <= 4 || strcmp(entry->d_name + length - 4, ".zig") != 0) continue;
+
+        if (count == capacity) {
+            capacity = capacity ? capacity * 2 : 64;
+            char **bigger = (char **)realloc(names, capacity * sizeof(char *));
+            if (!bigger) {
+                success = false;
+                break;
+            }
+            names = bigger;
+        }
+
+        names[count] = (char *)malloc(strlen(path) + length + 2);
+        if (!names[count]) {
+            success = false;
+            break;
+        }
+        sprintf(names[count++], "%s/%s", path, entry->d_name);
+    }
+    closedir(dir);
+
+    if (count) qsort(names, count, sizeof(char *), batchCompareNames);
+    for (size_t i = 0; i < count; i++) {
+        if (success) success = batchAddFile(batch, names[i]);
+        free(names[i]);
+    }
+    free(names);
+    return success;
+}
+
+// Function to read a whole file into memory
+static char *batchReadFile(const char *path, size_t *length) {
+    FILE *input = fopen(path, "rb");
+    if (!input) return NULL;
+
+    char *source = NULL;
+    if (fseek(input, 0, SEEK_END) == 0) {
+        long size = ftell(input);
+        if (size >= 0 && fseek(input, 0, SEEK_SET) == 0) {
+            source = (char *)malloc((size_t)size + 1);
+            if (source && fread(source, 1, (size_t)size, input) != (size_t)size) {
+                free(source);
+                source = NULL;
+            }
+            *length = (size_t)size;
+        }
+    }
+
+    fclose(input);
+    return source;
+}
+
+// Function to compile a single file of the batch, it is the task of the work pool
+static void batchCompileFile(void *data, size_t index) {
+    BatchFile *file = &((Batch *)data)->files[index];
+    double start = batchNow();
+
+    char *source = batchReadFile(file->input, &file->bytes);
+    if (!source) {
+        file->error = E_INTERNAL;
+        snprintf(file->diagnostic, IFJ24_DIAGNOSTIC_LENGTH, "cannot read the file");
+        file->latency = batchNow() - start;
+        return;
+    }
+
+    // an unchanged source is not compiled again
+    Batch *batch = (Batch *)data;
+    char key[COMPILE_CACHE_KEY_LENGTH + 1];
+    Ifj24Result result = {SUCCESS, NULL, 0, ""};
+    if (batch->cache) {
+        compileCacheKey(batch->cache, source, file->bytes, NULL, key);
+        result.code = compileCacheLoad(batch->cache, key, &result.codeLength);
+    }
+    bool cached = result.code != NULL;
+    if (!cached) file->error = ifj24Compile(source, file->bytes, &result);
+    free(source);
+
+    if (file->error != SUCCESS) {
+        strcpy(file->diagnostic, result.diagnostic);
+    } else {
+        FILE *output = fopen(file->output, "wb");
+        bool written = output && fwrite(result.code, 1, result.codeLength, output) == result.codeLength;
+        if (output && fclose(output) != 0) written = false;
+        if (!written) {
+            file->error = E_INTERNAL;
+            snprintf(file->diagnostic, IFJ24_DIAGNOSTIC_LENGTH, "cannot write %.200s", file->output);
+        } else if (batch->cache && !cached) {
+            compileCacheStore(batch->cache, key, result.code, result.codeLength);
+        }
+    }
+
+    ifj24ResultFree(&result);
+    file->latency = batchNow() - start;
+}
+
+// Function to run the batch on the work pool
+bool batchRun(Batch *batch, size_t *steals) {
+    return workPoolRun(batch->count, batch->jobs, batchCompileFile, batch, steals);
+}
+
+// Function to free the batch
+void batchFree(Batch *batch) {
+    for (size_t i = 0; i < batch->count; i++) {
+        free(batch->files[i].input);
+        free(batch->files[i].output);
+    }
+    free(batch->files);
+    batch->files = NULL;
+    batch->count = 0;
+    batch->capacity = 0;
+}
+
+// Function to compare two latencies for qsort
+static int batchCompareLatencies(const void *a, const void *b) {
+    double first = *(const double *)a, second = *(const double *)b;
+    return (first > second) - (first < second);
+}
+
+// Function to print the throughput and the latency percentiles
+static void batchPrintStats(Batch *batch, double seconds, size_t steals) {
+    size_t failed = 0, bytes = 0;
+    for (size_t i = 0; i < batch->count; i++) {
+        bytes += batch->files[i].bytes;
+        if (batch->files[i].error != SUCCESS) failed++;
+    }
+
+    printf("batch: %zu files, %zu compiled, %zu failed, %u workers, %zu stolen\n", batch->count,
+           batch->count - failed, failed, batch->jobs, steals);
+    printf("batch: %.3f s, %.1f files/s, %.2f MB/s\n", seconds, seconds > 0 ? batch->count / seconds : 0.0,
+           seconds > 0 ? bytes / seconds / 1e6 : 0.0);
+
+    double *latencies = (double *)malloc(batch->count * sizeof(double));
+    if (!latencies || !batch->count) {
+        free(latencies);
+        return;
+    }
+    for (size_t i = 0; i < batch->count; i++) latencies[i] = batch->files[i].latency;
+    qsort(latencies, batch->count, sizeof(double), batchCompareLatencies);
+
+    // nearest rank percentiles
+    int percentiles[] = {50, 90, 99};
+    printf("batch: latency");
+    for (int i = 0; i < 3; i++) {
+        size_t rank = (batch->count * percentiles[i] + 99) / 100;
+        printf(" p%d %.3f ms,", percentiles[i], latencies[rank ? rank - 1 : 0] * 1e3);
+    }
+    printf(" max %.3f ms\n", latencies[batch->count - 1] * 1e3);
+    free(latencies);
+}
+
+// Function to run the batch mode
+int batchMain(int argc, char **argv) {
+    Batch batch = {NULL, 0, 0, NULL, 0, NULL};
+    CompileCache cache;
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    batch.jobs = cpus > 0 ? (unsigned int)cpus : 1;
+
+    int status = SUCCESS;
+    int i = 0;
+    for (; i < argc && argv[i][0] == '-'; i++) {
+        if (strcmp(argv[i], "-j") == 0 && i + 1 < argc && atoi(argv[i + 1]) > 0) {
+            batch.jobs = (unsigned int)atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
+            batch.outputDir = argv[++i];
+        } else if (strcmp(argv[i], "-c") == 0 && i + 1 < argc) {
+            if (!compileCacheInit(&cache, argv[++i], COMPILE_CACHE_LIMIT)) {
+                fprintf(stderr, "batch: cannot open the cache %s\n", argv[i]);
+                return E_INTERNAL;
+            }
+            batch.cache = &cache;
+        } else {
+            fprintf(stderr, "batch: unknown option %s\n", argv[i]);
+            return E_INTERNAL;
+        }
+    }
+    if (i == argc) {
+        fprintf(stderr, "usage: main --batch [-j <jobs>] [-o <output dir>] [-c <cache dir>] <file or directory>...\n");
+        return E_INTERNAL;
+    }
+
+    for (; i < argc; i++) {
+        if (!batchAddPath(&batch, argv[i])) {
+            fprintf(stderr, "batch: cannot add %s\n", argv[i]);
+            batchFree(&batch);
+            return E_INTERNAL;
+        }
+    }
+
+    size_t steals = 0;
+    double start = batchNow();
+    bool success = batchRun(&batch, &steals);
+    double seconds = batchNow() - start;
+    if (!success) {
+        fprintf(stderr, "batch: cannot start the workers\n");
+        batchFree(&batch);
+        return E_INTERNAL;
+    }
+
+    // errors in the order of the inputs, the first one is the exit code
+    for (size_t f = 0; f < batch.count; f++) {
+        BatchFile *file = &batch.files[f];
+        if (file->error == SUCCESS) continue;
+        fprintf(stderr, "%s: %s (%d)\n", file->input, file->diagnostic, file->error);
+        if (status == SUCCESS) status = file->error;
+    }
+
+    batchPrintStats(&batch, seconds, steals);
+    if (batch.cache) compileCachePrintStats(batch.cache, stdout);
+    batchFree(&batch);
+    return status;
+}
@@ -0,0 +1,230 @@
+/** AUTHOR
+ *
+ * @author agent <agent@local>
+ * @file cache.c
+ * @date 19.10.2026
+ * @brief Implementation of the on-disk compile cache, the generated code is stored under the hash of the source
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <dirent.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "cache.h"
+
+// Struct for a single entry, when looking for the ones to evict
+typedef struct CacheEntry {
+    char *path; // path of the entry
+    size_t size; // size in bytes
+    double used; // last modification, a hit touches the entry
+} CacheEntry;
+
+// temporary files of the concurrent stores of a single process differ by this
+static unsigned long cacheTemporaryCounter = 0;
+
+// Function to start hashing a key
+void compileCacheHashInit(CompileCacheHash *hash) {
+    hash->fnv = 0xcbf29ce484222325ULL;
+    hash->mix = 0x9e3779b97f4a7c15ULL;
+}
+
+// Function to add bytes to the hashes
+void compileCacheHashAdd(CompileCacheHash *hash, const void *data, size_t length) {
+    const unsigned char *bytes = (const unsigned char *)data;
+    for (size_t i = 0; i < length; i++) {
+        hash->fnv = (hash->fnv ^ bytes[i]) * 0x100000001b3ULL;
+        hash->mix = (hash->mix ^ bytes[i]) * 0xff51afd7ed558ccdULL;
+        hash->mix ^= hash->mix >> 29;
+    }
+}
+
+// Function to make the path of a file in the cache directory
+static char *cachePath(CompileCache *cache, const char *name, const char *extension) {
+    char *path = (char *)malloc(strlen(cache->dir) + strlen(name) + strlen(extension) + 2);
+    if (path) sprintf(path, "%s/%s%s", cache->dir, name, extension);
+    return path;
+}
+
+// Function to open the cache
+bool compileCacheInit(CompileCache *cache, const char *dir, size_t limit) {
+    cache->dir = dir;
+    cache->build = ifj24BuildId();
+    cache->limit = limit;
+    cache->size = SIZE_MAX;
+    cache->hits = 0;
+    cache->misses = 0;
+    cache->stores = 0;
+    cache->evictions = 0;
+
+    if (mkdir(dir, 0777) != 0 && errno != EEXIST) return false;
+    struct stat info;
+    return stat(dir, &info) == 0 && S_ISDIR(info.st_mode);
+}
+
+// Function to write the hashed key
+void compileCacheHashKey(CompileCacheHash *hash, char *key) {
+    snprintf(key, COMPILE_CACHE_KEY_LENGTH + 1, "%016llx%016llx", (unsigned long long)hash->fnv, (unsigned long long)hash->mix);
+}
+
+// Function to make the key of a source
+void compileCacheKey(const CompileCache *cache, const char *source, size_t length, const Ifj24Options *options, char *key) {
+    CompileCacheHash hash;
+    compileCacheHashInit(&hash);
+
+    // the jobs and the pipeline do not change the code, the streaming and the incremental mode do not inline,
+    // the C backend ignores them, a build with another inlining budget has its own entries
+    const char *version = cache->build;
+    unsigned char mode = (options && (options->streaming || options->functionCache)) ? 1 : 0;
+    if (options && options->emitC) mode = 2;
+    uint64_t size = (uint64_t)length;
+    compileCacheHashAdd(&hash, version, strlen(version) + 1);
+    compileCacheHashAdd(&hash, &mode, 1);
+    compileCacheHashAdd(&hash, &size, sizeof(size));
+    compileCacheHashAdd(&hash, source, length);
+    compileCacheHashKey(&hash, key);
+}
+
+// Function to read the cached code
+char *compileCacheLoad(CompileCache *cache, const char *key, size_t *length) {
+    char *path = cachePath(cache, key, COMPILE_CACHE_EXTENSION);
+    FILE *input = path ? fopen(path, "rb") : NULL;
+
+    char *code = NULL;
+    long size = -1;
+    if (input && fseek(input, 0, SEEK_END) == 0 && (size = ftell(input)) >= 0 && fseek(input, 0, SEEK_SET) == 0) {
+        code = (char *)malloc((size_t)size + 1);
+        if (code && fread(code, 1, (size_t)size, input) != (size_t)size) {
+            free(code);
+            code = NULL;
+        }
+    }
+    if (input) fclose(input);
+
+    // the eviction removes the entries, that were not used for the longest time
+    if (code) {
+        code[size] = '\0';
+        *length = (size_t)size;
+        utimensat(AT_FDCWD, path, NULL, 0);
+    }
+    free(path);
+
+    __atomic_fetch_add(code ? &cache->hits : &cache->misses, 1, __ATOMIC_RELAXED);
+    return code;
+}
+
+// Function to count a stale entry as a miss
+void compileCacheReject(CompileCache *cache) {
+    __atomic_fetch_sub(&cache->hits, 1, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&cache->misses, 1, __ATOMIC_RELAXED);
+}
+
+// Function to copy the cached code to the stream
+bool compileCacheLookup(CompileCache *cache, const char *key, FILE *output) {
+    size_t length;
+    char *code = compileCacheLoad(cache, key, &length);
+    bool copied = code && fwrite(code, 1, length, output) == length;
+    free(code);
+    return copied;
+}
+
+// Function to compare two entries for qsort, the least recently used first
+static int cacheCompareEntries(const void *a, const void *b) {
+    double first = ((const CacheEntry *)a)->used, second = ((const CacheEntry *)b)->used;
+    return (first > second) - (first < second);
+}
+
+// Function to remove the least recently used entries, while the cache is over its limit
+static void cacheEvict(CompileCache *cache) {
+    DIR *dir = opendir(cache->dir);
+    if (!dir) return;
+
+    CacheEntry *entries = NULL;
+    size_t count = 0, capacity = 0, total = 0;
+    size_t extensionLength = strlen(COMPILE_CACHE_EXTENSION);
+    struct dirent *entry;
+    bool complete = true;
+    while ((entry = readdir(dir)) != NULL) {
+        size_t length = strlen(entry->d_name);
+        if (length <= extensionLength || strcmp(entry->d_name + length - extensionLength, COMPILE_CACHE_EXTENSION) != 0) continue;
+
+        if (count == capacity) {
+            capacity = capacity ? capacity * 2 : 64;
+            CacheEntry *bigger = (CacheEntry *)realloc(entries, capacity * sizeof(CacheEntry));
+            if (!bigger) {
+                complete = false;
+                break;
+            }
+            entries = bigger;
+        }
+
+        // another process could have removed it already
+        struct stat info;
+        char *path = cachePath(cache, entry->d_name, "");
+        if (!path || stat(path, &info) != 0) {
+            free(path);
+            continue;
+        }
+        entries[count].path = path;
+        entries[count].size = (size_t)info.st_size;
+        entries[count].used = (double)info.st_mtim.tv_sec + (double)info.st_mtim.tv_nsec / 1e9;
+        total += entries[count].size;
+        count++;
+    }
+    closedir(dir);
+
+    // the size is known again, only after the whole directory was read
+    if (complete) __atomic_store_n(&cache->size, total, __ATOMIC_RELAXED);
+
+    if (total > cache->limit) qsort(entries, count, sizeof(CacheEntry), cacheCompareEntries);
+    for (size_t i = 0; i < count; i++) {
+        if (total > cache->limit && unlink(entries[i].path) == 0) {
+            total -= entries[i].size;
+            __atomic_fetch_sub(&cache->size, entries[i].size, __ATOMIC_RELAXED);
+            __atomic_fetch_add(&cache->evictions, 1, __ATOMIC_RELAXED);
+        }
+        free(entries[i].path);
+    }
+    free(entries);
+}
+
+// Function to store the code under the key
+bool compileCacheStore(CompileCache *cache, const char *key, const char *code, size_t length) {
+    char *path = cachePath(cache, key, COMPILE_CACHE_EXTENSION);
+
+    // the temporary name is unique over the processes and the threads, and is not an entry
+    char name[COMPILE_CACHE_KEY_LENGTH + 64];
+    unsigned long counter = __atomic_fetch_add(&cacheTemporaryCounter, 1, __ATOMIC_RELAXED);
+    snprintf(name, sizeof(name), ".%s.%ld.%lu", key, (long)getpid(), counter);
+    char *temporary = cachePath(cache, name, ".tmp");
+
+    FILE *output = (path && temporary) ? fopen(temporary, "wb") : NULL;
+    bool stored = output && fwrite(code, 1, length, output) == length && fflush(output) == 0 && fsync(fileno(output)) == 0;
+    if (output && fclose(output) != 0) stored = false;
+    if (stored) stored = rename(temporary, path) == 0;
+    if (!stored && output) unlink(temporary);
+    free(temporary);
+    free(path);
+
+    if (!stored) return false;
+    __atomic_fetch_add(&cache->stores, 1, __ATOMIC_RELAXED);
+
+    // the directory is scanned only, when the entries could be over the limit, not after every store
+    size_t size = __atomic_load_n(&cache->size, __ATOMIC_RELAXED);
+    if (size != SIZE_MAX) size = __atomic_add_fetch(&cache->size, length, __ATOMIC_RELAXED);
+    if (cache->limit && size > cache->limit) cacheEvict(cache);
+    return true;
+}
+
+// Function to print the statistics of the cache
+void compileCachePrintStats(CompileCache *cache, FILE *output) {
+    size_t lookups = cache->hits + cache->misses;
+    fprintf(output, "cache: %zu hits, %zu misses (%.1f %% hit rate), %zu stored, %zu evicted\n", cache->hits, cache->misses,
+            lookups ? 100.0 * cache->hits / lookups : 0.0, cache->stores, cache->evictions);
+}
@@ -5,309 +5,303 @@
  * @date 21.10.2024
  * @brief Implementation of the builtin functions generator
  */
-#include <stdio.h>
-
 #ifdef USE_CUSTOM_STRUCTURE
 #include "code_generation/builtin_generator.h"
+#include "utility/output_buffer.h"
 #else
 #include "builtin_generator.h"
+#include "output_buffer.h"
 #endif
 
-#define PRINTLN(...)                                                                                                                                                                                   \
-    do {                                                                                                                                                                                               \
-        printf(__VA_ARGS__);                                                                                                                                                                           \
-        printf("\n");                                                                                                                                                                                  \
-    } while (0)
-
 // Function to generate the code for the ifj.write function
-void generateFuncWrite(void) {
-    PRINTLN("LABEL function_$ifj_write");
-    PRINTLN("PUSHFRAME");
-    PRINTLN("CREATEFRAME");
+void generateFuncWrite(OutputBuffer *out) {
+    outputBufferAppendLine(out, "LABEL function_$ifj_write");
+    outputBufferAppendLine(out, "PUSHFRAME");
+    outputBufferAppendLine(out, "CREATEFRAME");
 
-    PRINTLN("DEFVAR TF@to_print");
-    PRINTLN("POPS TF@to_print");
-    PRINTLN("WRITE TF@to_print");
+    outputBufferAppendLine(out, "DEFVAR TF@to_print");
+    outputBufferAppendLine(out, "POPS TF@to_print");
+    outputBufferAppendLine(out, "WRITE TF@to_print");
 
-    PRINTLN("POPFRAME");
-    PRINTLN("RETURN");
+    outputBufferAppendLine(out, "POPFRAME");
+    outputBufferAppendLine(out, "RETURN");
 }
 
 // Function to generate the code for the ifj.readstr function
-void generateFuncReadStr(void) {
-    PRINTLN("LABEL function_$ifj_readstr");
-    PRINTLN("PUSHFRAME");
-    PRINTLN("CREATEFRAME");
+void generateFuncReadStr(OutputBuffer *out) {
+    outputBufferAppendLine(out, "LABEL function_$ifj_readstr");
+    outputBufferAppendLine(out, "PUSHFRAME");
+    outputBufferAppendLine(out, "CREATEFRAME");
 
-    PRINTLN("DEFVAR TF@to_read");
-    PRINTLN("READ TF@to_read string");
-    PRINTLN("PUSHS TF@to_read");
+    outputBufferAppendLine(out, "DEFVAR TF@to_read");
+    outputBufferAppendLine(out, "READ TF@to_read string");
+    outputBufferAppendLine(out, "PUSHS TF@to_read");
 
-    PRINTLN("POPFRAME");
-    PRINTLN("RETURN");
+    outputBufferAppendLine(out, "POPFRAME");
+    outputBufferAppendLine(out, "RETURN");
 }
 
 // Function to generate the code for the ifj.readi32 function
-void generateFuncReadInt(void) {
-    PRINTLN("LABEL function_$ifj_readi32");
-    PRINTLN("PUSHFRAME");
-    PRINTLN("CREATEFRAME");
+void generateFuncReadInt(OutputBuffer *out) {
+    outputBufferAppendLine(out, "LABEL function_$ifj_readi32");
+    outputBufferAppendLine(out, "PUSHFRAME");
+    outputBufferAppendLine(out, "CREATEFRAME");
 
-    PRINTLN("DEFVAR TF@to_read");
-    PRINTLN("READ TF@to_read int");
-    PRINTLN("PUSHS TF@to_read");
+    outputBufferAppendLine(out, "DEFVAR TF@to_read");
+    outputBufferAppendLine(out, "READ TF@to_read int");
+    outputBufferAppendLine(out, "PUSHS TF@to_read");
 
-    PRINTLN("POPFRAME");
-    PRINTLN("RETURN");
+    outputBufferAppendLine(out, "POPFRAME");
+    outputBufferAppendLine(out, "RETURN");
 }
 
 // Function to generate the code for the ifj.readf64 function
-void generateFuncReadFloat(void) {
-    PRINTLN("LABEL function_$ifj_readf64");
-    PRINTLN("PUSHFRAME");
-    PRINTLN("CREATEFRAME");
+void generateFuncReadFloat(OutputBuffer *out) {
+    outputBufferAppendLine(out, "LABEL function_$ifj_readf64");
+    outputBufferAppendLine(out, "PUSHFRAME");
+    outputBufferAppendLine(out, "CREATEFRAME");
 
-    PRINTLN("DEFVAR TF@to_read");
-    PRINTLN("READ TF@to_read float");
-    PRINTLN("PUSHS TF@to_read");
+    outputBufferAppendLine(out, "DEFVAR TF@to_read");
+    outputBufferAppendLine(out, "READ TF@to_read float");
+    outputBufferAppendLine(out, "PUSHS TF@to_read");
 
-    PRINTLN("POPFRAME");
-    PRINTLN("RETURN");
+    outputBufferAppendLine(out, "POPFRAME");
+    outputBufferAppendLine(out, "RETURN");
 }
 
 // Function to generate the code for the ifj.i2f function
-void generateFuncInt2Float(void) {
-    PRINTLN("LABEL function_$ifj_i2f");
-    PRINTLN("INT2FLOATS");
-    PRINTLN("RETURN");
+void generateFuncInt2Float(OutputBuffer *out) {
+    outputBufferAppendLine(out, "LABEL function_$ifj_i2f");
+    outputBufferAppendLine(out, "INT2FLOATS");
+    outputBufferAppendLine(out, "RETURN");
 }
 
 // Function to generate the code for the ifj.f2i function
-void generateFuncFloat2Int(void) {
-    PRINTLN("LABEL function_$ifj_f2i");
-    PRINTLN("FLOAT2INTS");
-    PRINTLN("RETURN");
+void generateFuncFloat2Int(OutputBuffer *out) {
+    outputBufferAppendLine(out, "LABEL function_$ifj_f2i");
+    outputBufferAppendLine(out, "FLOAT2INTS");
+    outputBufferAppendLine(out, "RETURN");
 }
 
 // Function to generate the code for the ifj.string function
-void generateFuncString(void) {
-    PRINTLN("LABEL function_$ifj_string");
-    PRINTLN("RETURN");
+void generateFuncString(OutputBuffer *out) {
+    outputBufferAppendLine(out, "LABEL function_$ifj_string");
+    outputBufferAppendLine(out, "RETURN");
 }
 
 // Function to generate the code for the ifj.length function
-void generateFuncLength(void) {
-    PRINTLN("LABEL function_$ifj_length");
-    PRINTLN("PUSHFRAME");
-    PRINTLN("CREATEFRAME");
-
-    PRINTLN("DEFVAR TF@str");
-    PRINTLN("POPS TF@str");
-    PRINTLN("DEFVAR TF@len");
-    PRINTLN("STRLEN TF@len TF@str");
-    PRINTLN("PUSHS TF@len");
-
-    PRINTLN("POPFRAME");
-    PRINTLN("RETURN");
+void generateFuncLength(OutputBuffer *out) {
+    outputBufferAppendLine(out, "LABEL function_$ifj_length");
+    outputBufferAppendLine(out, "PUSHFRAME");
+    outputBufferAppendLine(out, "CREATEFRAME");
+
+    outputBufferAppendLine(out, "DEFVAR TF@str");
+    outputBufferAppendLine(out, "POPS TF@str");
+    outputBufferAppendLine(out, "DEFVAR TF@len");
+    outputBufferAppendLine(out, "STRLEN TF@len TF@str");
+    outputBufferAppendLine(out, "PUSHS TF@len");
+
+    outputBufferAppendLine(out, "POPFRAME");
+    outputBufferAppendLine(out, "RETURN");
 }
 
 // Function to generate the code for the ifj.concat function
-void generateFuncConcat(void) {
-    PRINTLN("LABEL function_$ifj_concat");
-    PRINTLN("PUSHFRAME");
-    PRINTLN("CREATEFRAME");
+void generateFuncConcat(OutputBuffer *out) {
+    outputBufferAppendLine(out, "LABEL function_$ifj_concat");
+    outputBufferAppendLine(out, "PUSHFRAME");
+    outputBufferAppendLine(out, "CREATEFRAME");
 
-    PRINTLN("DEFVAR TF@str1");
-    PRINTLN("DEFVAR TF@str2");
-    PRINTLN("DEFVAR TF@result");
+    outputBufferAppendLine(out, "DEFVAR TF@str1");
+    outputBufferAppendLine(out, "DEFVAR TF@str2");
+    outputBufferAppendLine(out, "DEFVAR TF@result");
 
-    PRINTLN("POPS TF@str2");
-    PRINTLN("POPS TF@str1");
+    outputBufferAppendLine(out, "POPS TF@str2");
+    outputBufferAppendLine(out, "POPS TF@str1");
 
-    PRINTLN("CONCAT TF@result TF@str1 TF@str2");
-    PRINTLN("PUSHS TF@result");
+    outputBufferAppendLine(out, "CONCAT TF@result TF@str1 TF@str2");
+    outputBufferAppendLine(out, "PUSHS TF@result");
 
-    PRINTLN("POPFRAME");
-    PRINTLN("RETURN");
+    outputBufferAppendLine(out, "POPFRAME");
+    outputBufferAppendLine(out, "RETURN");
 }
 
 // Function to generate the code for the ifj.substring function
-void generateFuncSubStr(void) {
-    PRINTLN("LABEL function_$ifj_substring");
-    PRINTLN("PUSHFRAME");
-    PRINTLN("CREATEFRAME");
+void generateFuncSubStr(OutputBuffer *out) {
+    outputBufferAppendLine(out, "LABEL function_$ifj_substring");
+    outputBufferAppendLine(out, "PUSHFRAME");
+    outputBufferAppendLine(out, "CREATEFRAME");
 
-    PRINTLN("DEFVAR TF@str");
-    PRINTLN("DEFVAR TF@start");
-    PRINTLN("DEFVAR TF@end");
+    outputBufferAppendLine(out, "DEFVAR TF@str");
+    outputBufferAppendLine(out, "DEFVAR TF@start");
+    outputBufferAppendLine(out, "DEFVAR TF@end");
 
-    PRINTLN("POPS TF@end");
-    PRINTLN("POPS TF@start");
-    PRINTLN("POPS TF@str");
+    outputBufferAppendLine(out, "POPS TF@end");
+    outputBufferAppendLine(out, "POPS TF@start");
+    outputBufferAppendLine(out, "POPS TF@str");
 
-    PRINTLN("DEFVAR TF@help");
+    outputBufferAppendLine(out, "DEFVAR TF@help");
 
-    PRINTLN("LT TF@help TF@start int@0");
-    PRINTLN("JUMPIFEQ function_$ifj_substring_end TF@help bool@true");
+    outputBufferAppendLine(out, "LT TF@help TF@start int@0");
+    outputBufferAppendLine(out, "JUMPIFEQ function_$ifj_substring_end TF@help bool@true");
 
-    PRINTLN("LT TF@help TF@end int@0");
-    PRINTLN("JUMPIFEQ function_$ifj_substring_end TF@help bool@true");
+    outputBufferAppendLine(out, "LT TF@help TF@end int@0");
+    outputBufferAppendLine(out, "JUMPIFEQ function_$ifj_substring_end TF@help bool@true");
 
-    PRINTLN("GT TF@help TF@start TF@end");
-    PRINTLN("JUMPIFEQ function_$ifj_substring_end TF@help bool@true");
+    outputBufferAppendLine(out, "GT TF@help TF@start TF@end");
+    outputBufferAppendLine(out, "JUMPIFEQ function_$ifj_substring_end TF@help bool@true");
 
-    PRINTLN("DEFVAR TF@len");
-    PRINTLN("STRLEN TF@len TF@str");
+    outputBufferAppendLine(out, "DEFVAR TF@len");
+    outputBufferAppendLine(out, "STRLEN TF@len TF@str");
 
-    PRINTLN("LT TF@help TF@start TF@len");
-    PRINTLN("JUMPIFEQ function_$ifj_substring_end TF@help bool@false");
+    outputBufferAppendLine(out, "LT TF@help TF@start TF@len");
+    outputBufferAppendLine(out, "JUMPIFEQ function_$ifj_substring_end TF@help bool@false");
 
-    PRINTLN("GT TF@help TF@end TF@len");
-    PRINTLN("JUMPIFEQ function_$ifj_substring_end TF@help bool@true");
+    outputBufferAppendLine(out, "GT TF@help TF@end TF@len");
+    outputBufferAppendLine(out, "JUMPIFEQ function_$ifj_substring_end TF@help bool@true");
 
-    PRINTLN("DEFVAR TF@substr");
-    PRINTLN("MOVE TF@substr string@");
+    outputBufferAppendLine(out, "DEFVAR TF@substr");
+    outputBufferAppendLine(out, "MOVE TF@substr string@");
 
-    PRINTLN("LABEL function_$ifj_substring_cycle");
-    PRINTLN("LT TF@help TF@start TF@end");
-    PRINTLN("JUMPIFNEQ function_$ifj_substring_return TF@help bool@true");
+    outputBufferAppendLine(out, "LABEL function_$ifj_substring_cycle");
+    outputBufferAppendLine(out, "LT TF@help TF@start TF@end");
+    outputBufferAppendLine(out, "JUMPIFNEQ function_$ifj_substring_return TF@help bool@true");
 
-    PRINTLN("GETCHAR TF@help TF@str TF@start");
-    PRINTLN("CONCAT TF@substr TF@substr TF@help");
-    PRINTLN("ADD TF@start TF@start int@1");
-    PRINTLN("JUMP function_$ifj_substring_cycle");
+    outputBufferAppendLine(out, "GETCHAR TF@help TF@str TF@start");
+    outputBufferAppendLine(out, "CONCAT TF@substr TF@substr TF@help");
+    outputBufferAppendLine(out, "ADD TF@start TF@start int@1");
+    outputBufferAppendLine(out, "JUMP function_$ifj_substring_cycle");
 
-    PRINTLN("LABEL function_$ifj_substring_return");
-    PRINTLN("PUSHS TF@substr");
-    PRINTLN("POPFRAME");
-    PRINTLN("RETURN");
+    outputBufferAppendLine(out, "LABEL function_$ifj_substring_return");
+    outputBufferAppendLine(out, "PUSHS TF@substr");
+    outputBufferAppendLine(out, "POPFRAME");
+    outputBufferAppendLine(out, "RETURN");
 
-    PRINTLN("LABEL function_$ifj_substring_end");
-    PRINTLN("PUSHS nil@nil");
-    PRINTLN("POPFRAME");
-    PRINTLN("RETURN");
+    outputBufferAppendLine(out, "LABEL function_$ifj_substring_end");
+    outputBufferAppendLine(out, "PUSHS nil@nil");
+    outputBufferAppendLine(out, "POPFRAME");
+    outputBufferAppendLine(out, "RETURN");
 }
 
 // Function to generate the code for the ifj.strcmp function
-void generateFuncStrCompare(void) {
-    PRINTLN("LABEL function_$ifj_strcmp");
-    PRINTLN("PUSHFRAME");
-    PRINTLN("CREATEFRAME");
+void generateFuncStrCompare(OutputBuffer *out) {
+    outputBufferAppendLine(out, "LABEL function_$ifj_strcmp");
+    outputBufferAppendLine(out, "PUSHFRAME");
+    outputBufferAppendLine(out, "CREATEFRAME");
 
-    PRINTLN("DEFVAR TF@str1");
-    PRINTLN("DEFVAR TF@str2");
+    outputBufferAppendLine(out, "DEFVAR TF@str1");
+    outputBufferAppendLine(out, "DEFVAR TF@str2");
 
-    PRINTLN("POPS TF@str2");
-    PRINTLN("POPS TF@str1");
+    outputBufferAppendLine(out, "POPS TF@str2");
+    outputBufferAppendLine(out, "POPS TF@str1");
 
-    PRINTLN("DEFVAR TF@index");
-    PRINTLN("MOVE TF@index int@0");
-    PRINTLN("DEFVAR TF@len1");
-    PRINTLN("DEFVAR TF@len2");
+    outputBufferAppendLine(out, "DEFVAR TF@index");
+    outputBufferAppendLine(out, "MOVE TF@index int@0");
+    outputBufferAppendLine(out, "DEFVAR TF@len1");
+    outputBufferAppendLine(out, "DEFVAR TF@len2");
 
-    PRINTLN("STRLEN TF@len1 TF@str1");
-    PRINTLN("STRLEN TF@len2 TF@str2");
+    outputBufferAppendLine(out, "STRLEN TF@len1 TF@str1");
+    outputBufferAppendLine(out, "STRLEN TF@len2 TF@str2");
 
-    PRINTLN("DEFVAR TF@help");
-    PRINTLN("DEFVAR TF@char1");
-    PRINTLN("DEFVAR TF@char2");
+    outputBufferAppendLine(out, "DEFVAR TF@help");
+    outputBufferAppendLine(out, "DEFVAR TF@char1");
+    outputBufferAppendLine(out, "DEFVAR TF@char2");
 
-    PRINTLN("LABEL function_$ifj_strcmp_cycle");
-    PRINTLN("LT TF@help TF@index TF@len1");
-    PRINTLN("JUMPIFEQ function_$ifj_strcmp_str1_end TF@help bool@false");
+    outputBufferAppendLine(out, "LABEL function_$ifj_strcmp_cycle");
+    outputBufferAppendLine(out, "LT TF@help TF@index TF@len1");
+    outputBufferAppendLine(out, "JUMPIFEQ function_$ifj_strcmp_str1_end TF@help bool@false");
 
-    PRINTLN("LT TF@help TF@index TF@len2");
-    PRINTLN("JUMPIFEQ function_$ifj_strcmp_str2_less TF@help bool@false");
+    outputBufferAppendLine(out, "LT TF@help TF@index TF@len2");
+    outputBufferAppendLine(out, "JUMPIFEQ function_$ifj_strcmp_str2_less TF@help bool@false");
 
-    PRINTLN("GETCHAR TF@char1 TF@str1 TF@index");
-    PRINTLN("GETCHAR TF@char2 TF@str2 TF@index");
+    outputBufferAppendLine(out, "GETCHAR TF@char1 TF@str1 TF@index");
+    outputBufferAppendLine(out, "GETCHAR TF@char2 TF@str2 TF@index");
 
-    PRINTLN("LT TF@help TF@char1 TF@char2");
-    PRINTLN("JUMPIFEQ function_$ifj_strcmp_str1_less TF@help bool@true");
+    outputBufferAppendLine(out, "LT TF@help TF@char1 TF@char2");
+    outputBufferAppendLine(out, "JUMPIFEQ function_$ifj_strcmp_str1_less TF@help bool@true");
 
-    PRINTLN("GT TF@help TF@char1 TF@char2");
-    PRINTLN("JUMPIFEQ function_$ifj_strcmp_str2_less TF@help bool@true");
+    outputBufferAppendLine(out, "GT TF@help TF@char1 TF@char2");
+    outputBufferAppendLine(out, "JUMPIFEQ function_$ifj_strcmp_str2_less TF@help bool@true");
 
-    PRINTLN("ADD TF@index TF@index int@1");
-    PRINTLN("JUMP function_$ifj_strcmp_cycle");
+    outputBufferAppendLine(out, "ADD TF@index TF@index int@1");
+    outputBufferAppendLine(out, "JUMP function_$ifj_strcmp_cycle");
 
-    PRINTLN("LABEL function_$ifj_strcmp_str1_end");
-    PRINTLN("LT TF@help TF@len1 TF@len2");
-    PRINTLN("JUMPIFEQ function_$ifj_strcmp_str1_less TF@help bool@true");
-    PRINTLN("JUMP function_$ifj_strcmp_equal");
+    outputBufferAppendLine(out, "LABEL function_$ifj_strcmp_str1_end");
+    outputBufferAppendLine(out, "LT TF@help TF@len1 TF@len2");
+    outputBufferAppendLine(out, "JUMPIFEQ function_$ifj_strcmp_str1_less TF@help bool@true");
+    outputBufferAppendLine(out, "JUMP function_$ifj_strcmp_equal");
 
-    PRINTLN("LABEL function_$ifj_strcmp_str1_less");
-    PRINTLN("PUSHS int@-1");
-    PRINTLN("POPFRAME");
-    PRINTLN("RETURN");
+    outputBufferAppendLine(out, "LABEL function_$ifj_strcmp_str1_less");
+    outputBufferAppendLine(out, "PUSHS int@-1");
+    outputBufferAppendLine(out, "POPFRAME");
+    outputBufferAppendLine(out, "RETURN");
 
-    PRINTLN("LABEL function_$ifj_strcmp_str2_less");
-    PRINTLN("PUSHS int@1");
-    PRINTLN("POPFRAME");
-    PRINTLN("RETURN");
+    outputBufferAppendLine(out, "LABEL function_$ifj_strcmp_str2_less");
+    outputBufferAppendLine(out, "PUSHS int@1");
+    outputBufferAppendLine(out, "POPFRAME");
+    outputBufferAppendLine(out, "RETURN");
 
-    PRINTLN("LABEL function_$ifj_strcmp_equal");
-    PRINTLN("PUSHS int@0");
-    PRINTLN("POPFRAME");
-    PRINTLN("RETURN");
+    outputBufferAppendLine(out, "LABEL function_$ifj_strcmp_equal");
+    outputBufferAppendLine(out, "PUSHS int@0");
+    outputBufferAppendLine(out, "POPFRAME");
+    outputBufferAppendLine(out, "RETURN");
 }
 
 // Function to generate the code for the ifj.ord function
-void generateFuncStrOrd(void) {
-    PRINTLN("LABEL function_$ifj_ord");
-    PRINTLN("PUSHFRAME");
-    PRINTLN("CREATEFRAME");
+void generateFuncStrOrd(OutputBuffer *out) {
+    outputBufferAppendLine(out, "LABEL function_$ifj_ord");
+    outputBufferAppendLine(out, "PUSHFRAME");
+    outputBufferAppendLine(out, "CREATEFRAME");
 
-    PRINTLN("DEFVAR TF@str");
-    PRINTLN("DEFVAR TF@index");
+    outputBufferAppendLine(out, "DEFVAR TF@str");
+    outputBufferAppendLine(out, "DEFVAR TF@index");
 
-    PRINTLN("POPS TF@index");
-    PRINTLN("POPS TF@str");
+    outputBufferAppendLine(out, "POPS TF@index");
+    outputBufferAppendLine(out, "POPS TF@str");
 
-    PRINTLN("DEFVAR TF@len");
-    PRINTLN("STRLEN TF@len TF@str");
+    outputBufferAppendLine(out, "DEFVAR TF@len");
+    outputBufferAppendLine(out, "STRLEN TF@len TF@str");
 
-    PRINTLN("DEFVAR TF@help");
-    PRINTLN("LT TF@help TF@index int@0");
-    PRINTLN("JUMPIFEQ function_$ifj_ord_end TF@help bool@true");
+    outputBufferAppendLine(out, "DEFVAR TF@help");
+    outputBufferAppendLine(out, "LT TF@help TF@index int@0");
+    outputBufferAppendLine(out, "JUMPIFEQ function_$ifj_ord_end TF@help bool@true");
 
-    PRINTLN("LT TF@help TF@index TF@len");
-    PRINTLN("JUMPIFEQ function_$ifj_ord_end TF@help bool@false");
+    outputBufferAppendLine(out, "LT TF@help TF@index TF@len");
+    outputBufferAppendLine(out, "JUMPIFEQ function_$ifj_ord_end TF@help bool@false");
 
-    PRINTLN("STRI2INT TF@help TF@str TF@index");
-    PRINTLN("PUSHS TF@help");
+    outputBufferAppendLine(out, "STRI2INT TF@help TF@str TF@index");
+    outputBufferAppendLine(out, "PUSHS TF@help");
 
-    PRINTLN("POPFRAME");
-    PRINTLN("RETURN");
+    outputBufferAppendLine(out, "POPFRAME");
+    outputBufferAppendLine(out, "RETURN");
 
-    PRINTLN("LABEL function_$ifj_ord_end");
-    PRINTLN("PUSHS int@0");
-    PRINTLN("POPFRAME");
-    PRINTLN("RETURN");
+    outputBufferAppendLine(out, "LABEL function_$ifj_ord_end");
+    outputBufferAppendLine(out, "PUSHS int@0");
+    outputBufferAppendLine(out, "POPFRAME");
+    outputBufferAppendLine(out, "RETURN");
 }
 
 // Function to generate the code for the ifj.chr function
-void generateFuncStrChr(void) {
-    PRINTLN("LABEL function_$ifj_chr");
-    PRINTLN("INT2CHARS");
-    PRINTLN("RETURN");
+void generateFuncStrChr(OutputBuffer *out) {
+    outputBufferAppendLine(out, "LABEL function_$ifj_chr");
+    outputBufferAppendLine(out, "INT2CHARS");
+    outputBufferAppendLine(out, "RETURN");
 }
 
 // Function to generate the builtin functions
-void generateBuiltins(void) {
-    PRINTLN("\n# Builtin functions\n");
-
-    generateFuncWrite();
-    generateFuncReadStr();
-    generateFuncReadInt();
-    generateFuncReadFloat();
-    generateFuncInt2Float();
-    generateFuncFloat2Int();
-    generateFuncString();
-    generateFuncLength();
-    generateFuncConcat();
-    generateFuncSubStr();
-    generateFuncStrCompare();
-    generateFuncStrOrd();
-    generateFuncStrChr();
+void generateBuiltins(OutputBuffer *out) {
+    outputBufferAppendLine(out, "\n# Builtin functions\n");
+
+    generateFuncWrite(out);
+    generateFuncReadStr(out);
+    generateFuncReadInt(out);
+    generateFuncReadFloat(out);
+    generateFuncInt2Float(out);
+    generateFuncFloat2Int(out);
+    generateFuncString(out);
+    generateFuncLength(out);
+    generateFuncConcat(out);
+    generateFuncSubStr(out);
+    generateFuncStrCompare(out);
+    generateFuncStrOrd(out);
+    generateFuncStrChr(out);
 }
@@ -0,0 +1,538 @@
+/** AUTHOR
+ *
+ * @author agent <agent@local>
+ * @file c_generator.c
+ * @date 19.10.2026
+ * @brief Implementation of the C backend, the analyzed program is generated as a portable C99 source
+ */
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef USE_CUSTOM_STRUCTURE
+#include "code_generation/c_generator.h"
+#include "code_generation/c_runtime.h"
+#include "utility/output_buffer.h"
+#else
+#include "c_generator.h"
+#include "c_runtime.h"
+#include "output_buffer.h"
+#endif
+
+// Function to get the suffix of the runtime functions and types for a data type
+static const char *cTypeSuffix(enum DATA_TYPES type) {
+    switch (type) {
+    case dTypeF64:
+        return "f64";
+    case dTypeU8:
+        return "u8";
+    case dTypeBool:
+        return "bool";
+    default:
+        return "i32";
+    }
+}
+
+// Function to append the C type of a value
+static void cAppendType(OutputBuffer *out, enum DATA_TYPES type, bool nullable) {
+    if (type == dTypeVoid) {
+        outputBufferAppend(out, "void");
+    } else if (type == dTypeBool) {
+        outputBufferAppend(out, "bool");
+    } else {
+        outputBufferAppend(out, nullable ? "ifj_opt_" : "ifj_");
+        outputBufferAppend(out, cTypeSuffix(type));
+    }
+}
+
+// Function to append the C name of a variable, the prefix keeps it apart from the C keywords and the runtime
+static void cAppendVar(OutputBuffer *out, const char *prefix, SymVariable *var) {
+    outputBufferAppend(out, prefix);
+    outputBufferAppend(out, var->name);
+    outputBufferAppendChar(out, '_');
+    outputBufferAppendInt(out, var->id);
+}
+
+// Function to indent a statement by the depth of its C block
+static void cIndent(CompilerContext *ctx) {
+    for (unsigned int i = 0; i <= ctx->indent; i++) outputBufferAppend(ctx->out, "    ");
+}
+
+// Function to determin, if an expression is the null literal
+static bool cIsNull(Expression *expression) {
+    return expression->expr_type == LiteralExpressionType && expression->data.literal.data_type.data_type == dTypeNone;
+}
+
+// Function to generate the C source of the whole program
+void generateCProgram(Program *program, CompilerContext *ctx) {
+    ctx->indent = 0;
+    generateCRuntime(ctx->out);
+    outputBufferAppendLine(ctx->out, "\n// Functions of the program");
+
+    // the functions can call each other in any order
+    unsigned int size = getSize(program->functions);
+    for (unsigned int i = 0; i < size; i++) {
+        outputBufferAppendChar(ctx->out, '\n');
+        generateCFunctionHead((Function *)getDataAtIndex(program->functions, i), ctx);
+        outputBufferAppendChar(ctx->out, ';');
+    }
+    for (unsigned int i = 0; i < size; i++) {
+        Function *function = (Function *)getDataAtIndex(program->functions, i);
+        size_t span = TIMING_BEGIN(ctx->timing, "generate function");
+        generateCFunction(function, ctx);
+        TIMING_END(ctx->timing, span, function->id.name);
+    }
+
+    outputBufferAppendLine(ctx->out, "\n\nint main(void) {");
+    outputBufferAppendLine(ctx->out, "    f_main();");
+    outputBufferAppendLine(ctx->out, "    return 0;");
+    outputBufferAppendLine(ctx->out, "}");
+}
+
+// Function to generate the declaration of a function
+void generateCFunctionHead(Function *function, CompilerContext *ctx) {
+    outputBufferAppend(ctx->out, "static ");
+    cAppendType(ctx->out, function->returnType.data_type, function->returnType.is_nullable);
+    outputBufferAppend(ctx->out, " f_");
+    outputBufferAppend(ctx->out, function->id.name);
+    outputBufferAppendChar(ctx->out, '(');
+
+    int size = getSize(function->params);
+    if (size == 0) outputBufferAppend(ctx->out, "void");
+    for (int i = 0; i < size; i++) {
+        Param *param = (Param *)getDataAtIndex(function->params, i);
+        if (i > 0) outputBufferAppend(ctx->out, ", ");
+        cAppendType(ctx->out, param->type.data_type, param->type.is_nullable);
+        cAppendVar(ctx->out, " v_", param->id.var);
+    }
+    outputBufferAppendChar(ctx->out, ')');
+}
+
+// Function to generate the definition of a function
+void generateCFunction(Function *function, CompilerContext *ctx) {
+    // the returns look up the type of the function by its name
+    ctx->labelScope = function->id.name;
+
+    outputBufferAppend(ctx->out, "\n\n");
+    generateCFunctionHead(function, ctx);
+    outputBufferAppendLine(ctx->out, " {");
+    generateCBody(&function->body, ctx);
+    if (function->returnType.data_type != dTypeVoid) outputBufferAppendLine(ctx->out, "    exit(6);");
+    outputBufferAppend(ctx->out, "}");
+}
+
+// Function to generate the statements of a body
+void generateCBody(Body *body, CompilerContext *ctx) {
+    int size = getSize(body->statements);
+    for (int i = 0; i < size; i++) {
+        Statement *statement = (Statement *)getDataAtIndex(body->statements, i);
+        generateCStatement(statement, ctx);
+    }
+}
+
+// Function to generate a single statement
+void generateCStatement(Statement *statement, CompilerContext *ctx) {
+    switch (statement->type) {
+    case FunctionCallStatementType:
+        cIndent(ctx);
+        if (statement->data.function_call_statement.return_type.data_type != dTypeVoid)
+            outputBufferAppend(ctx->out, "(void)");
+        generateCFunctionCall(&statement->data.function_call_statement, ctx);
+        outputBufferAppendLine(ctx->out, ";");
+        break;
+    case ReturnStatementType:
+        generateCReturnStatement(&statement->data.return_statement, ctx);
+        break;
+    case WhileStatementType:
+        generateCWhileStatement(&statement->data.while_statement, ctx);
+        break;
+    case IfStatementType:
+        generateCIfStatement(&statement->data.if_statement, ctx);
+        break;
+    case AssigmentStatementType:
+        generateCAssigmentStatement(&statement->data.assigment_statement, ctx);
+        break;
+    case VariableDefinitionStatementType:
+        generateCVariableDefinitionStatement(&statement->data.variable_definition_statement, ctx);
+        break;
+    }
+}
+
+// Function to generate a variable definition
+void generateCVariableDefinitionStatement(VariableDefinitionStatement *statement, CompilerContext *ctx) {
+    SymVariable *var = statement->id.var;
+
+    cIndent(ctx);
+    if (statement->isConst) outputBufferAppend(ctx->out, "const ");
+    cAppendType(ctx->out, var->type, var->nullable == 1);
+    cAppendVar(ctx->out, " v_", var);
+    outputBufferAppend(ctx->out, " = ");
+    generateCValue(&statement->value, var->type, var->nullable == 1, ctx);
+    outputBufferAppendLine(ctx->out, ";");
+}
+
+// Function to generate an assignment
+void generateCAssigmentStatement(AssigmentStatement *statement, CompilerContext *ctx) {
+    cIndent(ctx);
+    if (statement->discard) {
+        outputBufferAppend(ctx->out, "(void)");
+        generateCExpression(&statement->value, ctx);
+    } else {
+        cAppendVar(ctx->out, "v_", statement->var);
+        outputBufferAppend(ctx->out, " = ");
+        generateCValue(&statement->value, statement->var->type, statement->var->nullable == 1, ctx);
+    }
+    outputBufferAppendLine(ctx->out, ";");
+}
+
+// Function to generate the binding of the non nullable identifier to the value of the optional local
+static void generateCBinding(Identifier *non_nullable, CompilerContext *ctx) {
+    cIndent(ctx);
+    cAppendType(ctx->out, non_nullable->var->type, false);
+    cAppendVar(ctx->out, " v_", non_nullable->var);
+    cAppendVar(ctx->out, " = o_", non_nullable->var);
+    outputBufferAppendLine(ctx->out, ".value;");
+}
+
+// Function to generate the optional local holding the value of a nullable condition
+static void generateCOptional(Expression *condition, Identifier *non_nullable, CompilerContext *ctx) {
+    cIndent(ctx);
+    cAppendType(ctx->out, non_nullable->var->type, true);
+    cAppendVar(ctx->out, " o_", non_nullable->var);
+    outputBufferAppend(ctx->out, " = ");
+    generateCValue(condition, non_nullable->var->type, true, ctx);
+    outputBufferAppendLine(ctx->out, ";");
+}
+
+// Function to generate an if statement
+void generateCIfStatement(IfStatement *statement, CompilerContext *ctx) {
+    if (statement->non_nullable.name) {
+        // the ids are unique in the function, so the optional local does not need its own block
+        generateCOptional(&statement->condition, &statement->non_nullable, ctx);
+        cIndent(ctx);
+        cAppendVar(ctx->out, "if (o_", statement->non_nullable.var);
+        outputBufferAppendLine(ctx->out, ".present) {");
+        ctx->indent++;
+        generateCBinding(&statement->non_nullable, ctx);
+    } else {
+        cIndent(ctx);
+        outputBufferAppend(ctx->out, "if (");
+        generateCExpression(&statement->condition, ctx);
+        outputBufferAppendLine(ctx->out, ") {");
+        ctx->indent++;
+    }
+    generateCBody(&statement->if_body, ctx);
+    ctx->indent--;
+
+    if (getSize(statement->else_body.statements) > 0) {
+        cIndent(ctx);
+        outputBufferAppendLine(ctx->out, "} else {");
+        ctx->indent++;
+        generateCBody(&statement->else_body, ctx);
+        ctx->indent--;
+    }
+    cIndent(ctx);
+    outputBufferAppendLine(ctx->out, "}");
+}
+
+// Function to generate a while statement
+void generateCWhileStatement(WhileStatement *statement, CompilerContext *ctx) {
+    cIndent(ctx);
+    if (statement->non_nullable.name) {
+        // the condition is evaluated again at the start of every iteration
+        outputBufferAppendLine(ctx->out, "while (true) {");
+        ctx->indent++;
+        generateCOptional(&statement->condition, &statement->non_nullable, ctx);
+        cIndent(ctx);
+        cAppendVar(ctx->out, "if (!o_", statement->non_nullable.var);
+        outputBufferAppendLine(ctx->out, ".present) break;");
+        generateCBinding(&statement->non_nullable, ctx);
+    } else {
+        outputBufferAppend(ctx->out, "while (");
+        generateCExpression(&statement->condition, ctx);
+        outputBufferAppendLine(ctx->out, ") {");
+        ctx->indent++;
+    }
+    generateCBody(&statement->body, ctx);
+    ctx->indent--;
+    cIndent(ctx);
+    outputBufferAppendLine(ctx->out, "}");
+}
+
+// Function to generate a return statement, the tail calls are left to the C compiler
+void generateCReturnStatement(ReturnStatement *statement, CompilerContext *ctx) {
+    cIndent(ctx);
+    if (statement->empty) {
+        outputBufferAppendLine(ctx->out, "return;");
+        return;
+    }
+
+    outputBufferAppend(ctx->out, "return ");
+    SymFunctionPtr function = ctx->table && ctx->labelScope ? symTableFindFunction(ctx->table, (char *)ctx->labelScope) : NULL;
+    if (function)
+        generateCValue(&statement->value, function->returnType, function->nullableReturn, ctx);
+    else
+        generateCExpression(&statement->value, ctx);
+    outputBufferAppendLine(ctx->out, ";");
+}
+
+// Function to get the type of an expression after its conversion
+enum DATA_TYPES cExpressionType(Expression *expression) {
+    if (expression->conversion == IntToFloat) return dTypeF64;
+    if (expression->conversion == FloatToInt) return dTypeI32;
+
+    switch (expression->expr_type) {
+    case IdentifierExpressionType:
+        return expression->data.identifier.var ? expression->data.identifier.var->type : expression->data_type.data_type;
+    case FunctionCallExpressionType:
+        if (expression->data.function_call.func) return expression->data.function_call.func->returnType;
+        return expression->data.function_call.return_type.data_type;
+    case LiteralExpressionType:
+        return expression->data.literal.data_type.data_type;
+    case BinaryExpressionType:
+        switch (expression->data.binary_expr.operation) {
+        case TOKEN_PLUS:
+        case TOKEN_MINUS:
+        case TOKEN_MULTIPLY:
+        case TOKEN_DIVIDE:
+            if (cExpressionType(expression->data.binary_expr.left) == dTypeF64 ||
+                cExpressionType(expression->data.binary_expr.right) == dTypeF64)
+                return dTypeF64;
+            return dTypeI32;
+        default:
+            return dTypeBool;
+        }
+    }
+    return dTypeUndefined;
+}
+
+// Function to determin, if the generated C expression is an optional struct
+bool cExpressionNullable(Expression *expression) {
+    if (expression->conversion != NoConversion) return false;
+
+    switch (expression->expr_type) {
+    case IdentifierExpressionType:
+        if (expression->data.identifier.var) return expression->data.identifier.var->nullable == 1;
+        return expression->data_type.is_nullable;
+    case FunctionCallExpressionType:
+        if (expression->data.function_call.func) return expression->data.function_call.func->nullableReturn;
+        return expression->data.function_call.return_type.is_nullable;
+    default:
+        return false;
+    }
+}
+
+// Function to generate an expression with its conversion
+void generateCExpression(Expression *expression, CompilerContext *ctx) {
+    switch (expression->conversion) {
+    case IntToFloat:
+        outputBufferAppend(ctx->out, "((ifj_f64)");
+        break;
+    case FloatToInt:
+        outputBufferAppend(ctx->out, "ifj_f2i(");
+        break;
+    default:
+        break;
+    }
+
+    switch (expression->expr_type) {
+    case IdentifierExpressionType:
+        cAppendVar(ctx->out, "v_", expression->data.identifier.var);
+        break;
+    case FunctionCallExpressionType:
+        generateCFunctionCall(&expression->data.function_call, ctx);
+        break;
+    case LiteralExpressionType:
+        generateCLiteral(&expression->data.literal, ctx);
+        break;
+    case BinaryExpressionType:
+        generateCBinaryExpression(&expression->data.binary_expr, ctx);
+        break;
+    }
+
+    if (expression->conversion != NoConversion) outputBufferAppendChar(ctx->out, ')');
+}
+
+// Function to generate an expression converted to the given type
+void generateCValue(Expression *expression, enum DATA_TYPES type, bool nullable, CompilerContext *ctx) {
+    if (!nullable || cExpressionNullable(expression)) {
+        generateCExpression(expression, ctx);
+        return;
+    }
+
+    outputBufferAppend(ctx->out, cIsNull(expression) ? "ifj_null_" : "ifj_some_");
+    outputBufferAppend(ctx->out, cTypeSuffix(type));
+    outputBufferAppendChar(ctx->out, '(');
+    if (!cIsNull(expression)) generateCExpression(expression, ctx);
+    outputBufferAppendChar(ctx->out, ')');
+}
+
+// Function to generate the ifj.write of the type of its argument
+static void generateCWrite(Expression *term, CompilerContext *ctx) {
+    if (cIsNull(term)) {
+        outputBufferAppend(ctx->out, "((void)0)");
+        return;
+    }
+    outputBufferAppend(ctx->out, cExpressionNullable(term) ? "ifj_write_opt_" : "ifj_write_");
+    outputBufferAppend(ctx->out, cTypeSuffix(cExpressionType(term)));
+    outputBufferAppendChar(ctx->out, '(');
+    generateCExpression(term, ctx);
+    outputBufferAppendChar(ctx->out, ')');
+}
+
+// Function to generate a function call, the builtins are the functions of the runtime
+void generateCFunctionCall(FunctionCall *function_call, CompilerContext *ctx) {
+    char *name = function_call->func_id.name;
+    bool builtin = strncmp(name, "$ifj_", 5) == 0;
+
+    if (builtin && strcmp(name, "$ifj_write") == 0) {
+        generateCWrite((Expression *)getDataAtIndex(function_call->arguments, 0), ctx);
+        return;
+    }
+
+    outputBufferAppend(ctx->out, builtin ? "ifj_" : "f_");
+    outputBufferAppend(ctx->out, builtin ? name + 5 : name);
+    outputBufferAppendChar(ctx->out, '(');
+
+    // the arguments of the nullable parameters are wrapped into the optional struct
+    LinkedList *params = function_call->func ? function_call->func->paramaters : NULL;
+    int size = getSize(function_call->arguments);
+    for (int i = 0; i < size; i++) {
+        Expression *expr = (Expression *)getDataAtIndex(function_call->arguments, i);
+        SymFunctionParamPtr param = i < (int)getSize(params) ? (SymFunctionParamPtr)getDataAtIndex(params, i) : NULL;
+        if (i > 0) outputBufferAppend(ctx->out, ", ");
+        if (param)
+            generateCValue(expr, param->type, param->nullable, ctx);
+        else
+            generateCExpression(expr, ctx);
+    }
+    outputBufferAppendChar(ctx->out, ')');
+}
+
+// Function to generate a string literal, the special characters are written as octal escapes
+static void generateCString(const char *value, CompilerContext *ctx) {
+    outputBufferAppend(ctx->out, "((ifj_u8){\"");
+    size_t length = 0;
+    for (const char *c = value; *c; c++, length++) {
+        unsigned char byte = (unsigned char)*c;
+        if (byte >= 32 && byte < 127 && byte != '"' && byte != '\\' && byte != '?') {
+            outputBufferAppendChar(ctx->out, (char)byte);
+            continue;
+        }
+        char escape[4] = {'\\', (char)('0' + (byte >> 6)), (char)('0' + ((byte >> 3) & 7)), (char)('0' + (byte & 7))};
+        outputBufferAppendN(ctx->out, escape, 4);
+    }
+    outputBufferAppend(ctx->out, "\", ");
+    outputBufferAppendInt(ctx->out, (long long)length);
+    outputBufferAppend(ctx->out, "})");
+}
+
+// Function to generate a literal
+void generateCLiteral(Literal *literal, CompilerContext *ctx) {
+    switch (literal->data_type.data_type) {
+    case dTypeI32:
+        outputBufferAppendInt(ctx->out, literal->number.integer);
+        break;
+    case dTypeF64:
+        // a literal too big for a double is infinite, as in IFJcode24
+        if (isinf(literal->number.real))
+            outputBufferAppend(ctx->out, "HUGE_VAL");
+        else
+            outputBufferAppendHexFloat(ctx->out, literal->number.real);
+        break;
+    case dTypeU8:
+        generateCString(literal->value, ctx);
+        break;
+    case dTypeBool:
+        outputBufferAppend(ctx->out, literal->value);
+        break;
+    case dTypeNone:
+    case dTypeVoid:
+    case dTypeUndefined:
+        outputBufferAppendChar(ctx->out, '0');
+        break;
+    }
+}
+
+// Function to generate the comparison == or !=, the nullable values are compared as optional structs
+static void generateCEquality(BinaryExpression *binary_expression, CompilerContext *ctx) {
+    Expression *left = binary_expression->left, *right = binary_expression->right;
+    bool equals = binary_expression->operation == TOKEN_EQUALS;
+
+    if (cIsNull(left) && cIsNull(right)) {
+        outputBufferAppend(ctx->out, equals ? "true" : "false");
+        return;
+    }
+
+    enum DATA_TYPES type = cIsNull(left) ? cExpressionType(right) : cExpressionType(left);
+    bool optional = cIsNull(left) || cIsNull(right) || cExpressionNullable(left) || cExpressionNullable(right);
+    if (!optional && type != dTypeU8) {
+        outputBufferAppendChar(ctx->out, '(');
+        generateCExpression(left, ctx);
+        outputBufferAppend(ctx->out, equals ? " == " : " != ");
+        generateCExpression(right, ctx);
+        outputBufferAppendChar(ctx->out, ')');
+        return;
+    }
+
+    outputBufferAppend(ctx->out, equals ? "ifj_" : "!ifj_");
+    outputBufferAppend(ctx->out, optional ? "eq_" : "u8_equal");
+    if (optional) outputBufferAppend(ctx->out, cTypeSuffix(type));
+    outputBufferAppendChar(ctx->out, '(');
+    if (optional) generateCValue(left, type, true, ctx);
+    else generateCExpression(left, ctx);
+    outputBufferAppend(ctx->out, ", ");
+    if (optional) generateCValue(right, type, true, ctx);
+    else generateCExpression(right, ctx);
+    outputBufferAppendChar(ctx->out, ')');
+}
+
+// Function to generate a binary expression
+void generateCBinaryExpression(BinaryExpression *binary_expression, CompilerContext *ctx) {
+    const char *operation = NULL;
+    const char *function = NULL;
+    bool ints = cExpressionType(binary_expression->left) == dTypeI32 && cExpressionType(binary_expression->right) == dTypeI32;
+
+    switch (binary_expression->operation) {
+    case TOKEN_PLUS:
+        if (ints) function = "ifj_add_i32(";
+        else operation = " + ";
+        break;
+    case TOKEN_MINUS:
+        if (ints) function = "ifj_sub_i32(";
+        else operation = " - ";
+        break;
+    case TOKEN_MULTIPLY:
+        if (ints) function = "ifj_mul_i32(";
+        else operation = " * ";
+        break;
+    case TOKEN_DIVIDE:
+        function = ints ? "ifj_div_i32(" : "ifj_div_f64(";
+        break;
+    case TOKEN_EQUALS:
+    case TOKEN_NOTEQUAL:
+        generateCEquality(binary_expression, ctx);
+        return;
+    case TOKEN_LESSTHAN:
+        operation = " < ";
+        break;
+    case TOKEN_LESSOREQUAL:
+        operation = " <= ";
+        break;
+    case TOKEN_GREATERTHAN:
+        operation = " > ";
+        break;
+    case TOKEN_GREATEROREQUAL:
+        operation = " >= ";
+        break;
+    default:
+        return;
+    }
+
+    outputBufferAppend(ctx->out, function ? function : "(");
+    generateCExpression(binary_expression->left, ctx);
+    outputBufferAppend(ctx->out, function ? ", " : operation);
+    generateCExpression(binary_expression->right, ctx);
+    outputBufferAppendChar(ctx->out, ')');
+}
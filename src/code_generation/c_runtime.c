@@ -0,0 +1,236 @@
+/** AUTHOR
+ *
+ * @author agent <agent@local>
+ * @file c_runtime.c
+ * @date 19.10.2026
+ * @brief Implementation of the runtime of the C backend, the builtins are emitted as static inline functions
+ */
+#ifdef USE_CUSTOM_STRUCTURE
+#include "code_generation/c_runtime.h"
+#include "utility/output_buffer.h"
+#else
+#include "c_runtime.h"
+#include "output_buffer.h"
+#endif
+
+// Function to generate the includes and the types of the values
+void generateCRuntimeTypes(OutputBuffer *out) {
+    outputBufferAppendLine(out, "#include <ctype.h>");
+    outputBufferAppendLine(out, "#include <errno.h>");
+    outputBufferAppendLine(out, "#include <limits.h>");
+    outputBufferAppendLine(out, "#include <math.h>");
+    outputBufferAppendLine(out, "#include <stdbool.h>");
+    outputBufferAppendLine(out, "#include <stdio.h>");
+    outputBufferAppendLine(out, "#include <stdlib.h>");
+    outputBufferAppendLine(out, "#include <string.h>\n");
+
+    outputBufferAppendLine(out, "// the ints are 64 bit and wrap around, as the ints of IFJcode24");
+    outputBufferAppendLine(out, "typedef long long ifj_i32;");
+    outputBufferAppendLine(out, "typedef double ifj_f64;");
+    outputBufferAppendLine(out, "typedef struct { const char *data; ifj_i32 length; } ifj_u8;\n");
+
+    outputBufferAppendLine(out, "static inline void ifj_error(int code, const char *message) {");
+    outputBufferAppendLine(out, "    fflush(stdout);");
+    outputBufferAppendLine(out, "    fprintf(stderr, \"ifj24: %s\\n\", message);");
+    outputBufferAppendLine(out, "    exit(code);");
+    outputBufferAppendLine(out, "}\n");
+
+    outputBufferAppendLine(out, "static inline char *ifj_alloc(size_t size) {");
+    outputBufferAppendLine(out, "    char *data = (char *)malloc(size ? size : 1);");
+    outputBufferAppendLine(out, "    if (!data) ifj_error(99, \"out of memory\");");
+    outputBufferAppendLine(out, "    return data;");
+    outputBufferAppendLine(out, "}\n");
+}
+
+// Function to generate the optional values
+void generateCRuntimeOptionals(OutputBuffer *out) {
+    outputBufferAppendLine(out, "typedef struct { bool present; ifj_i32 value; } ifj_opt_i32;");
+    outputBufferAppendLine(out, "typedef struct { bool present; ifj_f64 value; } ifj_opt_f64;");
+    outputBufferAppendLine(out, "typedef struct { bool present; ifj_u8 value; } ifj_opt_u8;\n");
+
+    outputBufferAppendLine(out, "static inline ifj_opt_i32 ifj_some_i32(ifj_i32 value) { ifj_opt_i32 o = {true, value}; return o; }");
+    outputBufferAppendLine(out, "static inline ifj_opt_f64 ifj_some_f64(ifj_f64 value) { ifj_opt_f64 o = {true, value}; return o; }");
+    outputBufferAppendLine(out, "static inline ifj_opt_u8 ifj_some_u8(ifj_u8 value) { ifj_opt_u8 o = {true, value}; return o; }");
+    outputBufferAppendLine(out, "static inline ifj_opt_i32 ifj_null_i32(void) { ifj_opt_i32 o = {false, 0}; return o; }");
+    outputBufferAppendLine(out, "static inline ifj_opt_f64 ifj_null_f64(void) { ifj_opt_f64 o = {false, 0.0}; return o; }");
+    outputBufferAppendLine(out, "static inline ifj_opt_u8 ifj_null_u8(void) { ifj_opt_u8 o = {false, {\"\", 0}}; return o; }\n");
+
+    outputBufferAppendLine(out, "static inline bool ifj_u8_equal(ifj_u8 a, ifj_u8 b) {");
+    outputBufferAppendLine(out, "    return a.length == b.length && memcmp(a.data, b.data, (size_t)a.length) == 0;");
+    outputBufferAppendLine(out, "}\n");
+
+    outputBufferAppendLine(out, "// null is equal only to null");
+    outputBufferAppendLine(out, "static inline bool ifj_eq_i32(ifj_opt_i32 a, ifj_opt_i32 b) {");
+    outputBufferAppendLine(out, "    return a.present == b.present && (!a.present || a.value == b.value);");
+    outputBufferAppendLine(out, "}");
+    outputBufferAppendLine(out, "static inline bool ifj_eq_f64(ifj_opt_f64 a, ifj_opt_f64 b) {");
+    outputBufferAppendLine(out, "    return a.present == b.present && (!a.present || a.value == b.value);");
+    outputBufferAppendLine(out, "}");
+    outputBufferAppendLine(out, "static inline bool ifj_eq_u8(ifj_opt_u8 a, ifj_opt_u8 b) {");
+    outputBufferAppendLine(out, "    return a.present == b.present && (!a.present || ifj_u8_equal(a.value, b.value));");
+    outputBufferAppendLine(out, "}\n");
+}
+
+// Function to generate the arithmetic and the number conversions
+void generateCRuntimeNumbers(OutputBuffer *out) {
+    outputBufferAppendLine(out, "static inline ifj_i32 ifj_add_i32(ifj_i32 a, ifj_i32 b) { return (ifj_i32)((unsigned long long)a + (unsigned long long)b); }");
+    outputBufferAppendLine(out, "static inline ifj_i32 ifj_sub_i32(ifj_i32 a, ifj_i32 b) { return (ifj_i32)((unsigned long long)a - (unsigned long long)b); }");
+    outputBufferAppendLine(out, "static inline ifj_i32 ifj_mul_i32(ifj_i32 a, ifj_i32 b) { return (ifj_i32)((unsigned long long)a * (unsigned long long)b); }\n");
+
+    outputBufferAppendLine(out, "static inline ifj_i32 ifj_div_i32(ifj_i32 a, ifj_i32 b) {");
+    outputBufferAppendLine(out, "    if (b == 0) ifj_error(57, \"division by zero\");");
+    outputBufferAppendLine(out, "    if (a == LLONG_MIN && b == -1) return LLONG_MIN;");
+    outputBufferAppendLine(out, "    return a / b;");
+    outputBufferAppendLine(out, "}\n");
+
+    outputBufferAppendLine(out, "static inline ifj_f64 ifj_div_f64(ifj_f64 a, ifj_f64 b) {");
+    outputBufferAppendLine(out, "    if (b == 0.0) ifj_error(57, \"division by zero\");");
+    outputBufferAppendLine(out, "    return a / b;");
+    outputBufferAppendLine(out, "}\n");
+
+    outputBufferAppendLine(out, "static inline ifj_f64 ifj_i2f(ifj_i32 term) { return (ifj_f64)term; }\n");
+
+    outputBufferAppendLine(out, "static inline ifj_i32 ifj_f2i(ifj_f64 term) {");
+    outputBufferAppendLine(out, "    if (!isfinite(term) || term >= 9223372036854775808.0 || term < -9223372036854775808.0)");
+    outputBufferAppendLine(out, "        ifj_error(57, \"the float does not fit into an int\");");
+    outputBufferAppendLine(out, "    return (ifj_i32)term;");
+    outputBufferAppendLine(out, "}\n");
+}
+
+// Function to generate the string builtins
+void generateCRuntimeStrings(OutputBuffer *out) {
+    outputBufferAppendLine(out, "static inline ifj_u8 ifj_string(ifj_u8 term) { return term; }");
+    outputBufferAppendLine(out, "static inline ifj_i32 ifj_length(ifj_u8 s) { return s.length; }\n");
+
+    outputBufferAppendLine(out, "static inline ifj_u8 ifj_concat(ifj_u8 s1, ifj_u8 s2) {");
+    outputBufferAppendLine(out, "    char *data = ifj_alloc((size_t)(s1.length + s2.length));");
+    outputBufferAppendLine(out, "    memcpy(data, s1.data, (size_t)s1.length);");
+    outputBufferAppendLine(out, "    memcpy(data + s1.length, s2.data, (size_t)s2.length);");
+    outputBufferAppendLine(out, "    ifj_u8 result = {data, s1.length + s2.length};");
+    outputBufferAppendLine(out, "    return result;");
+    outputBufferAppendLine(out, "}\n");
+
+    outputBufferAppendLine(out, "// the substring shares the data of the string");
+    outputBufferAppendLine(out, "static inline ifj_opt_u8 ifj_substring(ifj_u8 s, ifj_i32 i, ifj_i32 j) {");
+    outputBufferAppendLine(out, "    if (i < 0 || j < 0 || i > j || i >= s.length || j > s.length) return ifj_null_u8();");
+    outputBufferAppendLine(out, "    ifj_u8 result = {s.data + i, j - i};");
+    outputBufferAppendLine(out, "    return ifj_some_u8(result);");
+    outputBufferAppendLine(out, "}\n");
+
+    outputBufferAppendLine(out, "static inline ifj_i32 ifj_strcmp(ifj_u8 s1, ifj_u8 s2) {");
+    outputBufferAppendLine(out, "    int order = memcmp(s1.data, s2.data, (size_t)(s1.length < s2.length ? s1.length : s2.length));");
+    outputBufferAppendLine(out, "    if (order) return order < 0 ? -1 : 1;");
+    outputBufferAppendLine(out, "    return (s1.length > s2.length) - (s1.length < s2.length);");
+    outputBufferAppendLine(out, "}\n");
+
+    outputBufferAppendLine(out, "static inline ifj_i32 ifj_ord(ifj_u8 s, ifj_i32 i) {");
+    outputBufferAppendLine(out, "    if (i < 0 || i >= s.length) return 0;");
+    outputBufferAppendLine(out, "    return (unsigned char)s.data[i];");
+    outputBufferAppendLine(out, "}\n");
+
+    outputBufferAppendLine(out, "static inline ifj_u8 ifj_chr(ifj_i32 i) {");
+    outputBufferAppendLine(out, "    static char characters[256];");
+    outputBufferAppendLine(out, "    if (i < 0 || i > 255) ifj_error(58, \"the int is not a character\");");
+    outputBufferAppendLine(out, "    characters[i] = (char)i;");
+    outputBufferAppendLine(out, "    ifj_u8 result = {&characters[i], 1};");
+    outputBufferAppendLine(out, "    return result;");
+    outputBufferAppendLine(out, "}\n");
+}
+
+// Function to generate the reading builtins, a line is read as READ of IFJcode24 does
+void generateCRuntimeInput(OutputBuffer *out) {
+    outputBufferAppendLine(out, "// NULL at the end of the input");
+    outputBufferAppendLine(out, "static inline char *ifj_read_line(ifj_i32 *length) {");
+    outputBufferAppendLine(out, "    size_t capacity = 64, size = 0;");
+    outputBufferAppendLine(out, "    char *line = ifj_alloc(capacity);");
+    outputBufferAppendLine(out, "    int c;");
+    outputBufferAppendLine(out, "    while ((c = getchar()) != EOF && c != '\\n') {");
+    outputBufferAppendLine(out, "        if (size + 1 == capacity) {");
+    outputBufferAppendLine(out, "            capacity *= 2;");
+    outputBufferAppendLine(out, "            line = (char *)realloc(line, capacity);");
+    outputBufferAppendLine(out, "            if (!line) ifj_error(99, \"out of memory\");");
+    outputBufferAppendLine(out, "        }");
+    outputBufferAppendLine(out, "        line[size++] = (char)c;");
+    outputBufferAppendLine(out, "    }");
+    outputBufferAppendLine(out, "    if (c == EOF && size == 0) {");
+    outputBufferAppendLine(out, "        free(line);");
+    outputBufferAppendLine(out, "        return NULL;");
+    outputBufferAppendLine(out, "    }");
+    outputBufferAppendLine(out, "    line[size] = '\\0';");
+    outputBufferAppendLine(out, "    *length = (ifj_i32)size;");
+    outputBufferAppendLine(out, "    return line;");
+    outputBufferAppendLine(out, "}\n");
+
+    outputBufferAppendLine(out, "// the numbers may be surrounded by white space");
+    outputBufferAppendLine(out, "static inline char *ifj_trim(char *line, ifj_i32 length) {");
+    outputBufferAppendLine(out, "    char *stop = line + length;");
+    outputBufferAppendLine(out, "    while (isspace((unsigned char)*line)) line++;");
+    outputBufferAppendLine(out, "    while (stop > line && isspace((unsigned char)stop[-1])) *--stop = '\\0';");
+    outputBufferAppendLine(out, "    return line;");
+    outputBufferAppendLine(out, "}\n");
+
+    outputBufferAppendLine(out, "static inline ifj_opt_u8 ifj_readstr(void) {");
+    outputBufferAppendLine(out, "    ifj_i32 length = 0;");
+    outputBufferAppendLine(out, "    char *line = ifj_read_line(&length);");
+    outputBufferAppendLine(out, "    if (!line) return ifj_null_u8();");
+    outputBufferAppendLine(out, "    ifj_u8 result = {line, length};");
+    outputBufferAppendLine(out, "    return ifj_some_u8(result);");
+    outputBufferAppendLine(out, "}\n");
+
+    outputBufferAppendLine(out, "static inline ifj_opt_i32 ifj_readi32(void) {");
+    outputBufferAppendLine(out, "    ifj_i32 length = 0;");
+    outputBufferAppendLine(out, "    char *line = ifj_read_line(&length);");
+    outputBufferAppendLine(out, "    ifj_opt_i32 result = ifj_null_i32();");
+    outputBufferAppendLine(out, "    if (!line) return result;");
+    outputBufferAppendLine(out, "    char *start = ifj_trim(line, length), *end = NULL;");
+    outputBufferAppendLine(out, "    errno = 0;");
+    outputBufferAppendLine(out, "    long long value = strtoll(start, &end, 10);");
+    outputBufferAppendLine(out, "    if (end != start && *end == '\\0' && errno != ERANGE) result = ifj_some_i32(value);");
+    outputBufferAppendLine(out, "    free(line);");
+    outputBufferAppendLine(out, "    return result;");
+    outputBufferAppendLine(out, "}\n");
+
+    outputBufferAppendLine(out, "static inline ifj_opt_f64 ifj_readf64(void) {");
+    outputBufferAppendLine(out, "    ifj_i32 length = 0;");
+    outputBufferAppendLine(out, "    char *line = ifj_read_line(&length);");
+    outputBufferAppendLine(out, "    ifj_opt_f64 result = ifj_null_f64();");
+    outputBufferAppendLine(out, "    if (!line) return result;");
+    outputBufferAppendLine(out, "    char *start = ifj_trim(line, length), *end = NULL;");
+    outputBufferAppendLine(out, "    double value = strtod(start, &end);");
+    outputBufferAppendLine(out, "    if (end != start && *end == '\\0') result = ifj_some_f64(value);");
+    outputBufferAppendLine(out, "    free(line);");
+    outputBufferAppendLine(out, "    return result;");
+    outputBufferAppendLine(out, "}\n");
+}
+
+// Function to generate the writing builtins, null is written as nothing
+void generateCRuntimeOutput(OutputBuffer *out) {
+    outputBufferAppendLine(out, "static inline void ifj_write_i32(ifj_i32 term) { printf(\"%lld\", term); }");
+    outputBufferAppendLine(out, "static inline void ifj_write_u8(ifj_u8 term) { fwrite(term.data, 1, (size_t)term.length, stdout); }");
+    outputBufferAppendLine(out, "static inline void ifj_write_bool(bool term) { fputs(term ? \"true\" : \"false\", stdout); }\n");
+
+    outputBufferAppendLine(out, "// the exponent is written without its plus sign, e.g. 0x1.5p5");
+    outputBufferAppendLine(out, "static inline void ifj_write_f64(ifj_f64 term) {");
+    outputBufferAppendLine(out, "    char buffer[64];");
+    outputBufferAppendLine(out, "    snprintf(buffer, sizeof(buffer), \"%a\", term);");
+    outputBufferAppendLine(out, "    for (char *c = buffer; *c; c++) {");
+    outputBufferAppendLine(out, "        if (*c != '+') putchar(*c);");
+    outputBufferAppendLine(out, "    }");
+    outputBufferAppendLine(out, "}\n");
+
+    outputBufferAppendLine(out, "static inline void ifj_write_opt_i32(ifj_opt_i32 term) { if (term.present) ifj_write_i32(term.value); }");
+    outputBufferAppendLine(out, "static inline void ifj_write_opt_f64(ifj_opt_f64 term) { if (term.present) ifj_write_f64(term.value); }");
+    outputBufferAppendLine(out, "static inline void ifj_write_opt_u8(ifj_opt_u8 term) { if (term.present) ifj_write_u8(term.value); }");
+}
+
+// Function to generate the whole runtime
+void generateCRuntime(OutputBuffer *out) {
+    outputBufferAppendLine(out, "// Runtime of the IFJ24 programs\n");
+
+    generateCRuntimeTypes(out);
+    generateCRuntimeOptionals(out);
+    generateCRuntimeNumbers(out);
+    generateCRuntimeStrings(out);
+    generateCRuntimeInput(out);
+    generateCRuntimeOutput(out);
+}
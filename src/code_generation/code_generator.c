@@ -7,202 +7,309 @@
  */
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 #ifdef USE_CUSTOM_STRUCTURE
 #include "code_generation/code_generator.h"
 #include "code_generation/builtin_generator.h"
+#include "utility/output_buffer.h"
+#include "utility/work_pool.h"
+#include "utility/memory.h"
 #else
 #include "code_generator.h"
 #include "builtin_generator.h"
+#include "output_buffer.h"
+#include "work_pool.h"
+#include "memory.h"
 #endif
 
-#define PRINTLN(...)                                                                               \
-    do {                                                                                           \
-        printf(__VA_ARGS__);                                                                       \
-        printf("\n");                                                                              \
-    } while (0)
-
 // Function to generate the code for the whole program
-void generateCodeProgram(Program *program) {
-    PRINTLN(".IFJcode24");
+void generateCodeProgram(Program *program, CompilerContext *ctx) {
+    generateCodeHeader(ctx);
+
+    unsigned int size = getSize(program->functions);
+    unsigned int jobs = (size >= PARALLEL_MIN_FUNCTIONS) ? ctx->jobs : 1;
+    if (jobs <= 1 || !generateCodeFunctionsParallel(program, jobs, ctx)) {
+        for (unsigned int i = 0; i < size; i++) {
+            Function *function = (Function *)getDataAtIndex(program->functions, i);
+            generateCodeFunction(function, ctx);
+        }
+    }
 
-    PRINTLN("DEFVAR GF@_");
-    PRINTLN("CREATEFRAME\n");
+    generateBuiltins(ctx->out);
+}
 
-    PRINTLN("CALL function_main");
-    PRINTLN("EXIT int@0\n");
+// Function to generate the code before the functions
+void generateCodeHeader(CompilerContext *ctx) {
+    outputBufferAppendLine(ctx->out, ".IFJcode24");
 
-    int size = getSize(program->functions);
-    for (int i = 0; i < size; i++) {
-        Function *function = (Function *)getDataAtIndex(program->functions, i);
-        generateCodeFunction(function);
+    outputBufferAppendLine(ctx->out, "DEFVAR GF@_");
+    outputBufferAppendLine(ctx->out, "DEFVAR GF@_op1");
+    outputBufferAppendLine(ctx->out, "DEFVAR GF@_op2");
+    outputBufferAppendLine(ctx->out, "CREATEFRAME\n");
+
+    outputBufferAppendLine(ctx->out, "CALL function_main");
+    outputBufferAppendLine(ctx->out, "EXIT int@0\n");
+}
+
+// Function to generate the functions on the work pool, every one into its own buffer
+bool generateCodeFunctionsParallel(Program *program, unsigned int jobs, CompilerContext *ctx) {
+    unsigned int size = getSize(program->functions);
+    FunctionGeneration *generations = (FunctionGeneration *)malloc(size * sizeof(FunctionGeneration));
+    if (!generations) return false;
+
+    bool success = true;
+    unsigned int created = 0;
+    for (; created < size && success; created++) {
+        generations[created].function = (Function *)getDataAtIndex(program->functions, created);
+        generations[created].ctx = *ctx;
+        generations[created].ctx.out = outputBufferInit(NULL, 0);
+        success = generations[created].ctx.out != NULL;
     }
 
-    generateBuiltins();
+    if (success) success = workPoolRun(size, jobs, generateCodeFunctionTask, generations, NULL);
+
+    // stitch the buffers in the source order
+    for (unsigned int i = 0; i < created; i++) {
+        OutputBuffer *out = generations[i].ctx.out;
+        if (success && out->error) ctx->out->error = true;
+        if (success) outputBufferAppendN(ctx->out, out->data, out->size);
+        outputBufferFree(&out);
+    }
+    free(generations);
+    return success;
+}
+
+// Function to generate a single function on the work pool
+void generateCodeFunctionTask(void *data, size_t index) {
+    FunctionGeneration *generation = &((FunctionGeneration *)data)[index];
+    enum MEMORY_TAG scope = MEMORY_SCOPE_BEGIN(MEMORY_CODEGEN);
+    generateCodeFunction(generation->function, &generation->ctx);
+    MEMORY_SCOPE_END(scope);
 }
 
 // Function to generate the code for a function
-void generateCodeFunction(Function *function) {
-    PRINTLN("\nLABEL function_%s", function->id.name);
-    PRINTLN("PUSHFRAME");
-    PRINTLN("CREATEFRAME");
+void generateCodeFunction(Function *function, CompilerContext *ctx) {
+    size_t span = TIMING_BEGIN(ctx->timing, "generate function");
+
+    // the labels are numbered inside the function, so it does not depend on the functions before it
+    ctx->labelScope = function->id.name;
+    ctx->ifCounter = 0;
+    ctx->whileCounter = 0;
+
+    outputBufferAppend(ctx->out, "\nLABEL function_");
+    outputBufferAppendLine(ctx->out, function->id.name);
+    outputBufferAppendLine(ctx->out, "PUSHFRAME");
+    outputBufferAppendLine(ctx->out, "CREATEFRAME");
+
+    if (function->symFunction && function->symFunction->tailRecursive) {
+        generateCodeTailEntry(function, ctx);
+    } else {
+        int size = getSize(function->params);
+        for (int i = size - 1; i >= 0; i--) {
+            Param *param = (Param *)getDataAtIndex(function->params, i);
+            generateCodeParam(param, ctx);
+        }
+    }
+
+    generateCodeBody(&function->body, ctx);
 
+    outputBufferAppendLine(ctx->out, "POPFRAME");
+    if (function->returnType.data_type == dTypeVoid)
+        outputBufferAppendLine(ctx->out, "RETURN");
+    else
+        outputBufferAppendLine(ctx->out, "EXIT int@6");
+    TIMING_END(ctx->timing, span, function->id.name);
+}
+
+// Function to generate the entry of a tail recursive function, tail calls jump back to its label
+void generateCodeTailEntry(Function *function, CompilerContext *ctx) {
     int size = getSize(function->params);
-    for (int i = size - 1; i >= 0; i--) {
+    for (int i = 0; i < size; i++) {
         Param *param = (Param *)getDataAtIndex(function->params, i);
-        generateCodeParam(param);
+        generateCodeVarInstruction("DEFVAR", param->id.name, param->id.var->id, ctx);
     }
 
-    generateCodeBody(&function->body);
+    // every variable has to be defined before the label, the body is run again after the jump
+    preGenerateBody(&function->body, ctx);
 
-    PRINTLN("POPFRAME");
-    if (function->returnType.data_type == dTypeVoid)
-        PRINTLN("RETURN");
-    else
-        PRINTLN("EXIT int@6");
+    outputBufferAppend(ctx->out, "LABEL $tail_");
+    outputBufferAppendLine(ctx->out, function->id.name);
+    for (int i = size - 1; i >= 0; i--) {
+        Param *param = (Param *)getDataAtIndex(function->params, i);
+        generateCodeVarInstruction("POPS", param->id.name, param->id.var->id, ctx);
+    }
 }
 
 // Function to generate the code for a body
-void generateCodeBody(Body *body) {
+void generateCodeBody(Body *body, CompilerContext *ctx) {
     int size = getSize(body->statements);
     for (int i = 0; i < size; i++) {
         Statement *statement = (Statement *)getDataAtIndex(body->statements, i);
-        generateCodeStatement(statement);
+        generateCodeStatement(statement, ctx);
     }
 }
 
 // Function to generate the code for a statement
-void generateCodeStatement(Statement *statement) {
+void generateCodeStatement(Statement *statement, CompilerContext *ctx) {
     switch (statement->type) {
     case FunctionCallStatementType:
-        generateCodeFunctionCall(&statement->data.function_call_statement);
+        generateCodeFunctionCall(&statement->data.function_call_statement, ctx);
         if (statement->data.function_call_statement.return_type.data_type != dTypeVoid)
-            PRINTLN("POPS GF@_");
+            outputBufferAppendLine(ctx->out, "POPS GF@_");
         break;
     case ReturnStatementType:
-        generateCodeReturnStatement(&statement->data.return_statement);
+        generateCodeReturnStatement(&statement->data.return_statement, ctx);
         break;
     case WhileStatementType:
-        generateCodeWhileStatement(&statement->data.while_statement);
+        generateCodeWhileStatement(&statement->data.while_statement, ctx);
         break;
     case IfStatementType:
-        generateCodeIfStatement(&statement->data.if_statement);
+        generateCodeIfStatement(&statement->data.if_statement, ctx);
         break;
     case AssigmentStatementType:
-        generateCodeAssigmentStatement(&statement->data.assigment_statement);
+        generateCodeAssigmentStatement(&statement->data.assigment_statement, ctx);
         break;
     case VariableDefinitionStatementType:
-        generateCodeVariableDefinitionStatement(&statement->data.variable_definition_statement);
+        generateCodeVariableDefinitionStatement(&statement->data.variable_definition_statement, ctx);
         break;
     }
 }
 
+// Function to generate a label numbered inside the current function
+void generateCodeScopedLabel(const char *prefix, int id, const char *suffix, CompilerContext *ctx) {
+    outputBufferAppend(ctx->out, prefix);
+    if (ctx->labelScope) {
+        outputBufferAppend(ctx->out, ctx->labelScope);
+        outputBufferAppendChar(ctx->out, '_');
+    }
+    outputBufferAppendLabel(ctx->out, "", id, suffix);
+}
+
+// Function to generate an instruction with a single local variable operand
+void generateCodeVarInstruction(const char *instruction, char *name, int id, CompilerContext *ctx) {
+    outputBufferAppend(ctx->out, instruction);
+    outputBufferAppendChar(ctx->out, ' ');
+    outputBufferAppendVar(ctx->out, name, id);
+    outputBufferAppendChar(ctx->out, '\n');
+}
+
 // Function to generate the code for a parameter
-void generateCodeParam(Param *param) {
-    PRINTLN("DEFVAR TF@%s_%d", param->id.name, param->id.var->id);
-    PRINTLN("POPS TF@%s_%d", param->id.name, param->id.var->id);
+void generateCodeParam(Param *param, CompilerContext *ctx) {
+    generateCodeVarInstruction("DEFVAR", param->id.name, param->id.var->id, ctx);
+    generateCodeVarInstruction("POPS", param->id.name, param->id.var->id, ctx);
 }
 
 // Function to pregenerate the code for a body
-void generateCodeVariableDefinitionStatement(VariableDefinitionStatement *statement) {
+void generateCodeVariableDefinitionStatement(VariableDefinitionStatement *statement, CompilerContext *ctx) {
     if (!statement->code_gen_defined) {
-        PRINTLN("DEFVAR TF@%s_%d", statement->id.name, statement->id.var->id);
+        generateCodeVarInstruction("DEFVAR", statement->id.name, statement->id.var->id, ctx);
         statement->code_gen_defined = true;
     }
 
-    generateCodeExpression(&statement->value);
-    PRINTLN("POPS TF@%s_%d", statement->id.name, statement->id.var->id);
+    generateCodeExpression(&statement->value, ctx);
+    generateCodeVarInstruction("POPS", statement->id.name, statement->id.var->id, ctx);
 }
 
 // Function to generate code for an assignment statement
-void generateCodeAssigmentStatement(AssigmentStatement *statement) {
-    generateCodeExpression(&statement->value);
+void generateCodeAssigmentStatement(AssigmentStatement *statement, CompilerContext *ctx) {
+    generateCodeExpression(&statement->value, ctx);
 
     if (statement->discard)
-        PRINTLN("POPS GF@_");
+        outputBufferAppendLine(ctx->out, "POPS GF@_");
     else
-        PRINTLN("POPS TF@%s_%d", statement->id.name, statement->var->id);
+        generateCodeVarInstruction("POPS", statement->id.name, statement->var->id, ctx);
 }
 
 // Function to generate code for an if statement
-void generateCodeIfStatement(IfStatement *statement) {
-    static int if_counter = 0;
-    int if_id = if_counter++;
+void generateCodeIfStatement(IfStatement *statement, CompilerContext *ctx) {
+    int if_id = ctx->ifCounter++;
 
-    generateCodeExpression(&statement->condition);
-    PRINTLN("POPS GF@_");
+    generateCodeExpression(&statement->condition, ctx);
+    outputBufferAppendLine(ctx->out, "POPS GF@_");
 
-    PRINTLN("JUMPIFEQ $if_%d_else GF@_ %s", if_id,
-            statement->non_nullable.name ? "nil@nil" : "bool@false");
+    generateCodeScopedLabel("JUMPIFEQ $if_", if_id, "_else GF@_ ", ctx);
+    outputBufferAppendLine(ctx->out, statement->non_nullable.name ? "nil@nil" : "bool@false");
     if (statement->non_nullable.name) {
         if (!statement->code_gen_defined) {
-            PRINTLN("DEFVAR TF@%s_%d", statement->non_nullable.name,
-                    statement->non_nullable.var->id);
+            generateCodeVarInstruction("DEFVAR", statement->non_nullable.name, statement->non_nullable.var->id, ctx);
             statement->code_gen_defined = true;
         }
-        PRINTLN("MOVE TF@%s_%d GF@_", statement->non_nullable.name,
-                statement->non_nullable.var->id);
+        outputBufferAppend(ctx->out, "MOVE ");
+        outputBufferAppendVar(ctx->out, statement->non_nullable.name, statement->non_nullable.var->id);
+        outputBufferAppendLine(ctx->out, " GF@_");
     }
-    generateCodeBody(&statement->if_body);
-    PRINTLN("JUMP $if_%d_end", if_id);
+    generateCodeBody(&statement->if_body, ctx);
+    generateCodeScopedLabel("JUMP $if_", if_id, "_end\n", ctx);
 
-    PRINTLN("LABEL $if_%d_else", if_id);
-    generateCodeBody(&statement->else_body);
-    PRINTLN("LABEL $if_%d_end", if_id);
+    generateCodeScopedLabel("LABEL $if_", if_id, "_else\n", ctx);
+    generateCodeBody(&statement->else_body, ctx);
+    generateCodeScopedLabel("LABEL $if_", if_id, "_end\n", ctx);
 }
 
 // Function to generate code for a while statement
-void generateCodeWhileStatement(WhileStatement *statement) {
-    static int while_counter = 0;
-    int while_id = while_counter++;
+void generateCodeWhileStatement(WhileStatement *statement, CompilerContext *ctx) {
+    int while_id = ctx->whileCounter++;
 
-    preGenerateBody(&statement->body);
+    // the variables have to be defined before the loop, an enclosing loop may have done it already
+    preGenerateWhileStatement(statement, ctx);
 
-    if (statement->non_nullable.name) {
-        if (!statement->code_gen_defined) {
-            PRINTLN("DEFVAR TF@%s_%d", statement->non_nullable.name,
-                    statement->non_nullable.var->id);
-            statement->code_gen_defined = true;
-        }
-    }
-    PRINTLN("LABEL $while_%d_start", while_id);
-    generateCodeExpression(&statement->condition);
-    PRINTLN("POPS GF@_");
+    generateCodeScopedLabel("LABEL $while_", while_id, "_start\n", ctx);
+    generateCodeExpression(&statement->condition, ctx);
+    outputBufferAppendLine(ctx->out, "POPS GF@_");
 
-    PRINTLN("JUMPIFEQ $while_%d_end GF@_ %s", while_id,
-            statement->non_nullable.name ? "nil@nil" : "bool@false");
+    generateCodeScopedLabel("JUMPIFEQ $while_", while_id, "_end GF@_ ", ctx);
+    outputBufferAppendLine(ctx->out, statement->non_nullable.name ? "nil@nil" : "bool@false");
     if (statement->non_nullable.name) {
-        PRINTLN("MOVE TF@%s_%d GF@_", statement->non_nullable.name,
-                statement->non_nullable.var->id);
+        outputBufferAppend(ctx->out, "MOVE ");
+        outputBufferAppendVar(ctx->out, statement->non_nullable.name, statement->non_nullable.var->id);
+        outputBufferAppendLine(ctx->out, " GF@_");
     }
 
-    generateCodeBody(&statement->body);
-    PRINTLN("JUMP $while_%d_start", while_id);
+    generateCodeBody(&statement->body, ctx);
+    generateCodeScopedLabel("JUMP $while_", while_id, "_start\n", ctx);
 
-    PRINTLN("LABEL $while_%d_end", while_id);
+    generateCodeScopedLabel("LABEL $while_", while_id, "_end\n", ctx);
 }
 
 // Function to generate code for a return statement
-void generateCodeReturnStatement(ReturnStatement *statement) {
-    if (!statement->empty) generateCodeExpression(&statement->value);
-    PRINTLN("POPFRAME");
-    PRINTLN("RETURN");
+void generateCodeReturnStatement(ReturnStatement *statement, CompilerContext *ctx) {
+    if (statement->tail_call) {
+        // the new arguments are popped into the params again, the frame stays the same
+        FunctionCall *function_call = &statement->value.data.function_call;
+        int size = getSize(function_call->arguments);
+        for (int i = 0; i < size; i++) {
+            Expression *expr = (Expression *)getDataAtIndex(function_call->arguments, i);
+            generateCodeExpression(expr, ctx);
+        }
+        outputBufferAppend(ctx->out, "JUMP $tail_");
+        outputBufferAppendLine(ctx->out, function_call->func_id.name);
+        return;
+    }
+    if (!statement->empty) generateCodeExpression(&statement->value, ctx);
+    if (statement->inline_call) {
+        // return out of an inlined body, the value stays on the stack
+        outputBufferAppendLabel(ctx->out, "JUMP $inline_", statement->inline_call->inline_id, "_end\n");
+        return;
+    }
+    outputBufferAppendLine(ctx->out, "POPFRAME");
+    outputBufferAppendLine(ctx->out, "RETURN");
 }
 
 // Function to generate code for an expression
-void generateCodeExpression(Expression *expression) {
+void generateCodeExpression(Expression *expression, CompilerContext *ctx) {
     switch (expression->expr_type) {
     case IdentifierExpressionType:
-        generateCodeIdentifier(&expression->data.identifier);
+        generateCodeIdentifier(&expression->data.identifier, ctx);
         break;
     case FunctionCallExpressionType:
-        generateCodeFunctionCall(&expression->data.function_call);
+        generateCodeFunctionCall(&expression->data.function_call, ctx);
         break;
     case LiteralExpressionType:
-        generateCodeLiteral(&expression->data.literal);
+        generateCodeLiteral(&expression->data.literal, ctx);
         break;
     case BinaryExpressionType:
-        generateCodeBinaryExpression(&expression->data.binary_expr);
+        generateCodeBinaryExpression(&expression->data.binary_expr, ctx);
         break;
     }
 
@@ -210,10 +317,10 @@ void generateCodeExpression(Expression *expression) {
     case NoConversion:
         break;
     case IntToFloat:
-        PRINTLN("INT2FLOATS");
+        outputBufferAppendLine(ctx->out, "INT2FLOATS");
         break;
     case FloatToInt:
-        PRINTLN("FLOAT2INTS");
+        outputBufferAppendLine(ctx->out, "FLOAT2INTS");
         break;
     default:
         break;
@@ -221,49 +328,88 @@ void generateCodeExpression(Expression *expression) {
 }
 
 // Function to generate code for a function call
-void generateCodeFunctionCall(FunctionCall *function_call) {
+void generateCodeFunctionCall(FunctionCall *function_call, CompilerContext *ctx) {
+    if (function_call->inlined_body) {
+        generateCodeInlinedCall(function_call, ctx);
+        return;
+    }
+
     int size = getSize(function_call->arguments);
     for (int i = 0; i < size; i++) {
         Expression *expr = (Expression *)getDataAtIndex(function_call->arguments, i);
-        generateCodeExpression(expr);
+        generateCodeExpression(expr, ctx);
     }
 
-    PRINTLN("CALL function_%s", function_call->func_id.name);
+    if (generateInlineBuiltin(function_call, ctx)) return;
+
+    outputBufferAppend(ctx->out, "CALL function_");
+    outputBufferAppendLine(ctx->out, function_call->func_id.name);
+}
+
+// Function to generate the inlined body of a user function in place of the call
+void generateCodeInlinedCall(FunctionCall *function_call, CompilerContext *ctx) {
+    // the params are bound by the constant definitions at the start of the body
+    generateCodeBody(function_call->inlined_body, ctx);
+    if (function_call->return_type.data_type != dTypeVoid) outputBufferAppendLine(ctx->out, "EXIT int@6");
+    outputBufferAppendLabel(ctx->out, "LABEL $inline_", function_call->inline_id, "_end\n");
+}
+
+// Function to generate a builtin directly at the call site, the arguments are already on the stack
+bool generateInlineBuiltin(FunctionCall *function_call, CompilerContext *ctx) {
+    char *name = function_call->func_id.name;
+
+    if (strcmp(name, "$ifj_i2f") == 0) {
+        outputBufferAppendLine(ctx->out, "INT2FLOATS");
+    } else if (strcmp(name, "$ifj_f2i") == 0) {
+        outputBufferAppendLine(ctx->out, "FLOAT2INTS");
+    } else if (strcmp(name, "$ifj_chr") == 0) {
+        outputBufferAppendLine(ctx->out, "INT2CHARS");
+    } else if (strcmp(name, "$ifj_string") == 0) {
+        // the argument already is the result
+    } else if (strcmp(name, "$ifj_length") == 0) {
+        outputBufferAppendLine(ctx->out, "POPS GF@_op1");
+        outputBufferAppendLine(ctx->out, "STRLEN GF@_op1 GF@_op1");
+        outputBufferAppendLine(ctx->out, "PUSHS GF@_op1");
+    } else if (strcmp(name, "$ifj_concat") == 0) {
+        outputBufferAppendLine(ctx->out, "POPS GF@_op2");
+        outputBufferAppendLine(ctx->out, "POPS GF@_op1");
+        outputBufferAppendLine(ctx->out, "CONCAT GF@_op1 GF@_op1 GF@_op2");
+        outputBufferAppendLine(ctx->out, "PUSHS GF@_op1");
+    } else {
+        return false;
+    }
+    return true;
 }
 
 // Function to generate code for an identifier
-void generateCodeIdentifier(Identifier *identifier) {
-    PRINTLN("PUSHS TF@%s_%d", identifier->name, identifier->var->id);
+void generateCodeIdentifier(Identifier *identifier, CompilerContext *ctx) {
+    generateCodeVarInstruction("PUSHS", identifier->name, identifier->var->id, ctx);
 }
 
 // Function to generate code for a literal
-void generateCodeLiteral(Literal *literal) {
+void generateCodeLiteral(Literal *literal, CompilerContext *ctx) {
     switch (literal->data_type.data_type) {
     case dTypeI32:
-        PRINTLN("PUSHS int@%s", literal->value);
+        outputBufferAppend(ctx->out, "PUSHS int@");
+        outputBufferAppendInt(ctx->out, literal->number.integer);
+        outputBufferAppendChar(ctx->out, '\n');
+        break;
+    case dTypeF64:
+        outputBufferAppend(ctx->out, "PUSHS float@");
+        outputBufferAppendHexFloat(ctx->out, literal->number.real);
+        outputBufferAppendChar(ctx->out, '\n');
         break;
-    case dTypeF64: {
-        double d = strtod(literal->value, NULL);
-        PRINTLN("PUSHS float@%a", d);
-    }
-
-    break;
     case dTypeU8:
-        printf("PUSHS string@");
-        for (char *c = literal->value; *c; c++) {
-            if (*c <= 32 || *c == 35 || *c == 92) {
-                printf("\\%03d", *c);
-            } else {
-                printf("%c", *c);
-            }
-        }
-        printf("\n");
+        outputBufferAppend(ctx->out, "PUSHS string@");
+        outputBufferAppendEscaped(ctx->out, literal->value);
+        outputBufferAppendChar(ctx->out, '\n');
         break;
     case dTypeBool:
-        PRINTLN("PUSHS bool@%s", literal->value);
+        outputBufferAppend(ctx->out, "PUSHS bool@");
+        outputBufferAppendLine(ctx->out, literal->value);
         break;
     case dTypeNone:
-        PRINTLN("PUSHS nil@nil");
+        outputBufferAppendLine(ctx->out, "PUSHS nil@nil");
         break;
     case dTypeVoid:
     case dTypeUndefined:
@@ -272,47 +418,47 @@ void generateCodeLiteral(Literal *literal) {
 }
 
 // Function to generate code for a binary expression
-void generateCodeBinaryExpression(BinaryExpression *binary_expression) {
-    generateCodeExpression(binary_expression->left);
-    generateCodeExpression(binary_expression->right);
+void generateCodeBinaryExpression(BinaryExpression *binary_expression, CompilerContext *ctx) {
+    generateCodeExpression(binary_expression->left, ctx);
+    generateCodeExpression(binary_expression->right, ctx);
 
     switch (binary_expression->operation) {
     case TOKEN_PLUS:
-        PRINTLN("ADDS");
+        outputBufferAppendLine(ctx->out, "ADDS");
         break;
     case TOKEN_MINUS:
-        PRINTLN("SUBS");
+        outputBufferAppendLine(ctx->out, "SUBS");
         break;
     case TOKEN_MULTIPLY:
-        PRINTLN("MULS");
+        outputBufferAppendLine(ctx->out, "MULS");
         break;
     case TOKEN_DIVIDE:
         if (binary_expression->left->data_type.data_type == dTypeI32 &&
             binary_expression->right->data_type.data_type == dTypeI32)
-            PRINTLN("IDIVS");
+            outputBufferAppendLine(ctx->out, "IDIVS");
         else
-            PRINTLN("DIVS");
+            outputBufferAppendLine(ctx->out, "DIVS");
         break;
     case TOKEN_EQUALS:
-        PRINTLN("EQS");
+        outputBufferAppendLine(ctx->out, "EQS");
         break;
     case TOKEN_NOTEQUAL:
-        PRINTLN("EQS");
-        PRINTLN("NOTS");
+        outputBufferAppendLine(ctx->out, "EQS");
+        outputBufferAppendLine(ctx->out, "NOTS");
         break;
     case TOKEN_LESSTHAN:
-        PRINTLN("LTS");
+        outputBufferAppendLine(ctx->out, "LTS");
         break;
     case TOKEN_LESSOREQUAL:
-        PRINTLN("GTS");
-        PRINTLN("NOTS");
+        outputBufferAppendLine(ctx->out, "GTS");
+        outputBufferAppendLine(ctx->out, "NOTS");
         break;
     case TOKEN_GREATERTHAN:
-        PRINTLN("GTS");
+        outputBufferAppendLine(ctx->out, "GTS");
         break;
     case TOKEN_GREATEROREQUAL:
-        PRINTLN("LTS");
-        PRINTLN("NOTS");
+        outputBufferAppendLine(ctx->out, "LTS");
+        outputBufferAppendLine(ctx->out, "NOTS");
         break;
     default:
         break;
@@ -320,55 +466,77 @@ void generateCodeBinaryExpression(BinaryExpression *binary_expression) {
 }
 
 // Function to pregenerate the code for a body
-void preGenerateBody(Body *body) {
+void preGenerateBody(Body *body, CompilerContext *ctx) {
     int size = getSize(body->statements);
     for (int i = 0; i < size; i++) {
         Statement *statement = (Statement *)getDataAtIndex(body->statements, i);
-        preGenerateStatement(statement);
+        preGenerateStatement(statement, ctx);
     }
 }
 
 // Function to pregenerate the code for a statement
-void preGenerateStatement(Statement *statement) {
+void preGenerateStatement(Statement *statement, CompilerContext *ctx) {
     switch (statement->type) {
     case IfStatementType:
-        preGenerateIfStatement(&statement->data.if_statement);
+        preGenerateIfStatement(&statement->data.if_statement, ctx);
         break;
     case WhileStatementType:
-        preGenerateWhileStatement(&statement->data.while_statement);
+        preGenerateWhileStatement(&statement->data.while_statement, ctx);
         break;
     case VariableDefinitionStatementType:
-        preGenerateVariableDefinitionStatement(&statement->data.variable_definition_statement);
+        preGenerateVariableDefinitionStatement(&statement->data.variable_definition_statement, ctx);
+        preGenerateExpression(&statement->data.variable_definition_statement.value, ctx);
         break;
-    default:
-        // no need to pregenerate anything
+    case AssigmentStatementType:
+        preGenerateExpression(&statement->data.assigment_statement.value, ctx);
+        break;
+    case FunctionCallStatementType:
+        preGenerateFunctionCall(&statement->data.function_call_statement, ctx);
+        break;
+    case ReturnStatementType:
+        if (!statement->data.return_statement.empty) preGenerateExpression(&statement->data.return_statement.value, ctx);
         break;
     }
 }
 
+// Function to pregenerate an expression
+void preGenerateExpression(Expression *expression, CompilerContext *ctx) {
+    if (expression->expr_type == FunctionCallExpressionType)
+        preGenerateFunctionCall(&expression->data.function_call, ctx);
+}
+
+// Function to pregenerate a function call, only inlined calls define variables
+void preGenerateFunctionCall(FunctionCall *function_call, CompilerContext *ctx) {
+    if (function_call->inlined_body)
+        preGenerateBody(function_call->inlined_body, ctx);
+}
+
 // Function to pregenerate variable definition statement
-void preGenerateVariableDefinitionStatement(VariableDefinitionStatement *statement) {
+void preGenerateVariableDefinitionStatement(VariableDefinitionStatement *statement, CompilerContext *ctx) {
     if (statement->code_gen_defined)
         return;
-    PRINTLN("DEFVAR TF@%s_%d", statement->id.name, statement->id.var->id);
+    generateCodeVarInstruction("DEFVAR", statement->id.name, statement->id.var->id, ctx);
     statement->code_gen_defined = true;
 }
 
 // Function to pregenerate if statement
-void preGenerateIfStatement(IfStatement *statement) {
+void preGenerateIfStatement(IfStatement *statement, CompilerContext *ctx) {
     if (statement->non_nullable.name && !statement->code_gen_defined) {
-        PRINTLN("DEFVAR TF@%s_%d", statement->non_nullable.name, statement->non_nullable.var->id);
+        generateCodeVarInstruction("DEFVAR", statement->non_nullable.name, statement->non_nullable.var->id, ctx);
         statement->code_gen_defined = true;
     }
-    preGenerateBody(&statement->if_body);
-    preGenerateBody(&statement->else_body);
+    preGenerateBody(&statement->if_body, ctx);
+    preGenerateBody(&statement->else_body, ctx);
 }
 
-// Function to pregenerate while statement
-void preGenerateWhileStatement(WhileStatement *statement) {
+// Function to pregenerate while statement, the body is walked only once, so nested loops stay linear
+void preGenerateWhileStatement(WhileStatement *statement, CompilerContext *ctx) {
     if (statement->non_nullable.name && !statement->code_gen_defined) {
-        PRINTLN("DEFVAR TF@%s_%d", statement->non_nullable.name, statement->non_nullable.var->id);
+        generateCodeVarInstruction("DEFVAR", statement->non_nullable.name, statement->non_nullable.var->id, ctx);
         statement->code_gen_defined = true;
     }
-    preGenerateBody(&statement->body);
+    if (statement->code_gen_pregenerated)
+        return;
+    preGenerateBody(&statement->body, ctx);
+    statement->code_gen_pregenerated = true;
 }
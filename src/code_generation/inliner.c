@@ -0,0 +1,508 @@
+/** AUTHOR
+ *
+ * @author agent <agent@local>
+ * @file inliner.c
+ * @date 19.10.2026
+ * @brief Implementation of the AST level inliner of small user functions
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef USE_CUSTOM_STRUCTURE
+#include "code_generation/inliner.h"
+#else
+#include "inliner.h"
+#endif
+
+// Function to get the call, that is the whole expression of a statement
+static FunctionCall *inlineStatementCall(Statement *statement) {
+    Expression *expr = NULL;
+
+    switch (statement->type) {
+    case FunctionCallStatementType:
+        return &statement->data.function_call_statement;
+    case VariableDefinitionStatementType:
+        expr = &statement->data.variable_definition_statement.value;
+        break;
+    case AssigmentStatementType:
+        expr = &statement->data.assigment_statement.value;
+        break;
+    case ReturnStatementType:
+        if (statement->data.return_statement.empty) return NULL;
+        expr = &statement->data.return_statement.value;
+        break;
+    default:
+        return NULL;
+    }
+
+    if (expr->expr_type != FunctionCallExpressionType) return NULL;
+    return &expr->data.function_call;
+}
+
+// Wrapper function to free a list of the functions with the same hash, the functions are kept
+static void inlineFreeNamesWrapper(void **data) {
+    removeList((LinkedList **)data);
+}
+
+// Function to inline small functions in the whole program
+enum ERR_CODES inlineProgram(Program *program, SymTable *table, FILE *report) {
+    if (!program || !table) return E_INTERNAL;
+    if (INLINE_STATEMENT_BUDGET == 0) return SUCCESS;
+
+    Inliner inliner;
+    enum ERR_CODES err = inlineInit(&inliner, program, table, report);
+    if (err != SUCCESS) return err;
+
+    // every function is visited once, a function is inlined into its callers only after its own call sites
+    for (unsigned int i = 0; i < inliner.functionCount && err == SUCCESS; i++) {
+        if (inliner.functions[i].index == 0) err = inlineVisitFunction(&inliner, &inliner.functions[i]);
+    }
+
+    if (err == SUCCESS && report) fprintf(report, "inline: %u call site(s) inlined\n", inliner.siteCount);
+    inlineFree(&inliner);
+    return err;
+}
+
+// Function to init the inliner
+enum ERR_CODES inlineInit(Inliner *inliner, Program *program, SymTable *table, FILE *report) {
+    memset(inliner, 0, sizeof(Inliner));
+    inliner->program = program;
+    inliner->table = table;
+    inliner->report = report;
+
+    unsigned int size = getSize(program->functions);
+    inliner->functions = (InlineFunctionInfo *)calloc(size + 1, sizeof(InlineFunctionInfo));
+    inliner->stack = (InlineFunctionInfo **)malloc((size + 1) * sizeof(InlineFunctionInfo *));
+    inliner->names = bstInit(inlineFreeNamesWrapper);
+    if (!inliner->functions || !inliner->stack || !inliner->names) {
+        inlineFree(inliner);
+        return E_INTERNAL;
+    }
+
+    for (unsigned int i = 0; i < size; i++) {
+        InlineFunctionInfo *info = &inliner->functions[i];
+        info->function = (Function *)getDataAtIndex(program->functions, i);
+        inliner->functionCount++;
+
+        // the functions with the same hash share a list, as in the symtable
+        unsigned int hash = hashString(info->function->id.name);
+        LinkedList *sameHash = (LinkedList *)bstSearchForNode(inliner->names, hash);
+        if (!sameHash) {
+            sameHash = initLinkedList(false);
+            if (sameHash && !bstInsertNode(inliner->names, hash, (void *)sameHash)) removeList(&sameHash);
+        }
+        if (!sameHash || !insertNodeAtIndex(sameHash, (void *)info, -1)) {
+            inlineFree(inliner);
+            return E_INTERNAL;
+        }
+    }
+    return SUCCESS;
+}
+
+// Function to free the inliner
+void inlineFree(Inliner *inliner) {
+    if (inliner->names) bstFree(&inliner->names);
+    free(inliner->functions);
+    free(inliner->stack);
+    inliner->functions = NULL;
+    inliner->stack = NULL;
+    inliner->functionCount = 0;
+    inliner->stackSize = 0;
+}
+
+// Function to search the call graph from a function
+enum ERR_CODES inlineVisitFunction(Inliner *inliner, InlineFunctionInfo *info) {
+    info->index = info->lowLink = ++inliner->searchIndex;
+    info->onStack = true;
+    inliner->stack[inliner->stackSize++] = info;
+
+    enum ERR_CODES err = inlineVisitBody(inliner, info, &info->function->body);
+    if (err != SUCCESS) return err;
+
+    // the function is the root of its component, if it cannot reach any function discovered before it
+    if (info->lowLink == info->index) return inlineFinishComponent(inliner, info);
+    return SUCCESS;
+}
+
+// Function to search the calls of a body of the visited function
+enum ERR_CODES inlineVisitBody(Inliner *inliner, InlineFunctionInfo *info, Body *body) {
+    enum ERR_CODES err;
+
+    unsigned int size = getSize(body->statements);
+    for (unsigned int i = 0; i < size; i++) {
+        Statement *statement = (Statement *)getDataAtIndex(body->statements, i);
+
+        if (statement->type == IfStatementType) {
+            err = inlineVisitBody(inliner, info, &statement->data.if_statement.if_body);
+            if (err != SUCCESS) return err;
+            err = inlineVisitBody(inliner, info, &statement->data.if_statement.else_body);
+            if (err != SUCCESS) return err;
+            continue;
+        }
+        if (statement->type == WhileStatementType) {
+            err = inlineVisitBody(inliner, info, &statement->data.while_statement.body);
+            if (err != SUCCESS) return err;
+            continue;
+        }
+
+        FunctionCall *call = inlineStatementCall(statement);
+        if (!call) continue;
+
+        InlineFunctionInfo *callee = inlineFindFunction(inliner, call->func_id.name);
+        if (!callee) continue; // builtin
+        if (callee == info) info->recursive = true;
+
+        if (callee->index == 0) {
+            err = inlineVisitFunction(inliner, callee);
+            if (err != SUCCESS) return err;
+            if (callee->lowLink < info->lowLink) info->lowLink = callee->lowLink;
+        } else if (callee->onStack && callee->index < info->lowLink) {
+            info->lowLink = callee->index;
+        }
+    }
+    return SUCCESS;
+}
+
+// Function to finish a strongly connected component of the call graph
+enum ERR_CODES inlineFinishComponent(Inliner *inliner, InlineFunctionInfo *root) {
+    // the functions of the component are on the top of the stack, the root is the lowest of them
+    unsigned int start = inliner->stackSize;
+    do {
+        start--;
+    } while (inliner->stack[start] != root);
+    bool cycle = inliner->stackSize - start > 1;
+
+    // everything the component calls outside of itself is finished already, so it is inlined first
+    enum ERR_CODES err = SUCCESS;
+    for (unsigned int i = start; i < inliner->stackSize && err == SUCCESS; i++) {
+        InlineFunctionInfo *info = inliner->stack[i];
+        info->onStack = false;
+        info->recursive = info->recursive || cycle;
+        err = inlineBody(inliner, info->function, &info->function->body);
+    }
+
+    // the size counts the inlined copies as well, so a chain of calls is not expanded beyond the budget
+    for (unsigned int i = start; i < inliner->stackSize; i++) {
+        InlineFunctionInfo *info = inliner->stack[i];
+        info->inlinable = !info->recursive && strcmp(info->function->id.name, "main") != 0 &&
+                          inlineCountStatements(&info->function->body) <= INLINE_STATEMENT_BUDGET;
+    }
+
+    inliner->stackSize = start;
+    return err;
+}
+
+// Function to inline the call sites in a body
+enum ERR_CODES inlineBody(Inliner *inliner, Function *caller, Body *body) {
+    enum ERR_CODES err;
+
+    unsigned int size = getSize(body->statements);
+    for (unsigned int i = 0; i < size; i++) {
+        Statement *statement = (Statement *)getDataAtIndex(body->statements, i);
+
+        switch (statement->type) {
+        case IfStatementType:
+            err = inlineBody(inliner, caller, &statement->data.if_statement.if_body);
+            if (err != SUCCESS) return err;
+            err = inlineBody(inliner, caller, &statement->data.if_statement.else_body);
+            if (err != SUCCESS) return err;
+            break;
+        case WhileStatementType:
+            err = inlineBody(inliner, caller, &statement->data.while_statement.body);
+            if (err != SUCCESS) return err;
+            break;
+        default: {
+            FunctionCall *call = inlineStatementCall(statement);
+            if (!call) break;
+            err = inlineFunctionCall(inliner, caller, call);
+            if (err != SUCCESS) return err;
+            break;
+        }
+        }
+    }
+    return SUCCESS;
+}
+
+// Function to inline a single call site
+enum ERR_CODES inlineFunctionCall(Inliner *inliner, Function *caller, FunctionCall *function_call) {
+    if (function_call->inlined_body) return SUCCESS;
+
+    InlineFunctionInfo *info = inlineFindFunction(inliner, function_call->func_id.name);
+    if (!info || !info->inlinable) return SUCCESS;
+    Function *callee = info->function;
+
+    LinkedList *mapping = initLinkedList(true);
+    Body *body = (Body *)malloc(sizeof(Body));
+    if (!mapping || !body) {
+        removeList(&mapping);
+        free(body);
+        return E_INTERNAL;
+    }
+    body->statements = initLinkedList(true);
+    if (!body->statements) {
+        removeList(&mapping);
+        free(body);
+        return E_INTERNAL;
+    }
+    function_call->inlined_body = body;
+    function_call->inline_id = ++inliner->siteCount;
+
+    // the params become constants, initialized with the arguments (only literals and identifiers)
+    unsigned int size = getSize(callee->params);
+    for (unsigned int i = 0; i < size; i++) {
+        Param *param = (Param *)getDataAtIndex(callee->params, i);
+        Expression *arg = (Expression *)getDataAtIndex(function_call->arguments, i);
+
+        Statement *statement = (Statement *)malloc(sizeof(Statement));
+        if (!statement) break;
+        memset(statement, 0, sizeof(Statement));
+        if (!insertNodeAtIndex(body->statements, (void *)statement, -1)) {
+            free(statement);
+            break;
+        }
+
+        statement->type = VariableDefinitionStatementType;
+        VariableDefinitionStatement *definition = &statement->data.variable_definition_statement;
+        definition->id = param->id;
+        definition->id.var = inlineRenameVariable(inliner, param->id.var, mapping);
+        definition->type = param->type;
+        definition->isConst = true;
+
+        // the arguments belong to the caller, so they keep their names
+        if (!definition->id.var || !inlineCopyExpression(inliner, arg, &definition->value, NULL)) break;
+    }
+
+    bool result = getSize(body->statements) == size && inlineCopyBody(inliner, &callee->body, body, mapping, function_call);
+    removeList(&mapping);
+    if (!result) return E_INTERNAL;
+
+    if (inliner->report) {
+        fprintf(inliner->report, "inline: site %u, %s inlined into %s (%u statements)\n",
+                function_call->inline_id, callee->id.name, caller->id.name, inlineCountStatements(&callee->body));
+    }
+
+    // calls inside of the copy can be inlined as well, there is no recursion so this ends
+    return inlineBody(inliner, caller, body);
+}
+
+// Function to find the inlining information of a user function
+InlineFunctionInfo *inlineFindFunction(Inliner *inliner, char *name) {
+    LinkedList *sameHash = (LinkedList *)bstSearchForNode(inliner->names, hashString(name));
+    if (!sameHash) return NULL;
+
+    unsigned int size = getSize(sameHash);
+    for (unsigned int i = 0; i < size; i++) {
+        InlineFunctionInfo *info = (InlineFunctionInfo *)getDataAtIndex(sameHash, i);
+        if (strcmp(info->function->id.name, name) == 0) return info;
+    }
+    return NULL;
+}
+
+// Function to count the statements of a body
+unsigned int inlineCountStatements(Body *body) {
+    unsigned int count = 0;
+
+    unsigned int size = getSize(body->statements);
+    for (unsigned int i = 0; i < size; i++) {
+        Statement *statement = (Statement *)getDataAtIndex(body->statements, i);
+        count++;
+
+        if (statement->type == IfStatementType) {
+            count += inlineCountStatements(&statement->data.if_statement.if_body);
+            count += inlineCountStatements(&statement->data.if_statement.else_body);
+        } else if (statement->type == WhileStatementType) {
+            count += inlineCountStatements(&statement->data.while_statement.body);
+        } else {
+            FunctionCall *call = inlineStatementCall(statement);
+            if (call && call->inlined_body) count += inlineCountStatements(call->inlined_body);
+        }
+    }
+    return count;
+}
+
+// Function to copy a body
+bool inlineCopyBody(Inliner *inliner, Body *body, Body *copy, LinkedList *mapping, FunctionCall *call) {
+    if (!copy->statements) {
+        copy->statements = initLinkedList(true);
+        if (!copy->statements) return false;
+    }
+
+    unsigned int size = getSize(body->statements);
+    for (unsigned int i = 0; i < size; i++) {
+        Statement *statement = (Statement *)getDataAtIndex(body->statements, i);
+
+        Statement *newStatement = (Statement *)malloc(sizeof(Statement));
+        if (!newStatement) return false;
+        memset(newStatement, 0, sizeof(Statement));
+        if (!insertNodeAtIndex(copy->statements, (void *)newStatement, -1)) {
+            free(newStatement);
+            return false;
+        }
+
+        if (!inlineCopyStatement(inliner, statement, newStatement, mapping, call)) return false;
+    }
+    return true;
+}
+
+// Function to copy a function call, the copy is never inlined
+static bool inlineCopyFunctionCall(Inliner *inliner, FunctionCall *function_call, FunctionCall *copy, LinkedList *mapping) {
+    *copy = *function_call;
+    copy->inlined_body = NULL;
+    copy->inline_id = 0;
+    copy->arguments = initLinkedList(true);
+    if (!copy->arguments) return false;
+
+    unsigned int size = getSize(function_call->arguments);
+    for (unsigned int i = 0; i < size; i++) {
+        Expression *arg = (Expression *)getDataAtIndex(function_call->arguments, i);
+
+        Expression *newArg = (Expression *)malloc(sizeof(Expression));
+        if (!newArg) return false;
+        memset(newArg, 0, sizeof(Expression));
+        if (!insertNodeAtIndex(copy->arguments, (void *)newArg, -1)) {
+            free(newArg);
+            return false;
+        }
+
+        if (!inlineCopyExpression(inliner, arg, newArg, mapping)) return false;
+    }
+    return true;
+}
+
+// Function to copy a statement
+bool inlineCopyStatement(Inliner *inliner, Statement *statement, Statement *copy, LinkedList *mapping, FunctionCall *call) {
+    copy->type = statement->type;
+
+    switch (statement->type) {
+    case FunctionCallStatementType:
+        return inlineCopyFunctionCall(inliner, &statement->data.function_call_statement, &copy->data.function_call_statement, mapping);
+
+    case ReturnStatementType: {
+        ReturnStatement *original = &statement->data.return_statement;
+        ReturnStatement *newReturn = &copy->data.return_statement;
+        newReturn->empty = original->empty;
+        newReturn->inline_call = call;
+        if (original->empty) return true;
+        return inlineCopyExpression(inliner, &original->value, &newReturn->value, mapping);
+    }
+
+    case WhileStatementType: {
+        WhileStatement *original = &statement->data.while_statement;
+        WhileStatement *newWhile = &copy->data.while_statement;
+        newWhile->non_nullable = original->non_nullable;
+        if (original->non_nullable.name) {
+            newWhile->non_nullable.var = inlineRenameVariable(inliner, original->non_nullable.var, mapping);
+            if (!newWhile->non_nullable.var) return false;
+        }
+        if (!inlineCopyExpression(inliner, &original->condition, &newWhile->condition, mapping)) return false;
+        return inlineCopyBody(inliner, &original->body, &newWhile->body, mapping, call);
+    }
+
+    case IfStatementType: {
+        IfStatement *original = &statement->data.if_statement;
+        IfStatement *newIf = &copy->data.if_statement;
+        newIf->non_nullable = original->non_nullable;
+        if (original->non_nullable.name) {
+            newIf->non_nullable.var = inlineRenameVariable(inliner, original->non_nullable.var, mapping);
+            if (!newIf->non_nullable.var) return false;
+        }
+        if (!inlineCopyExpression(inliner, &original->condition, &newIf->condition, mapping)) return false;
+        if (!inlineCopyBody(inliner, &original->if_body, &newIf->if_body, mapping, call)) return false;
+        return inlineCopyBody(inliner, &original->else_body, &newIf->else_body, mapping, call);
+    }
+
+    case AssigmentStatementType: {
+        AssigmentStatement *original = &statement->data.assigment_statement;
+        AssigmentStatement *newAssigment = &copy->data.assigment_statement;
+        newAssigment->id = original->id;
+        newAssigment->discard = original->discard;
+        newAssigment->var = inlineRenameVariable(inliner, original->var, mapping);
+        if (original->var && !newAssigment->var) return false;
+        return inlineCopyExpression(inliner, &original->value, &newAssigment->value, mapping);
+    }
+
+    case VariableDefinitionStatementType: {
+        VariableDefinitionStatement *original = &statement->data.variable_definition_statement;
+        VariableDefinitionStatement *newDefinition = &copy->data.variable_definition_statement;
+        newDefinition->id = original->id;
+        newDefinition->id.var = inlineRenameVariable(inliner, original->id.var, mapping);
+        if (!newDefinition->id.var) return false;
+        newDefinition->type = original->type;
+        newDefinition->isConst = original->isConst;
+        return inlineCopyExpression(inliner, &original->value, &newDefinition->value, mapping);
+    }
+    }
+    return false;
+}
+
+// Function to copy an expression
+bool inlineCopyExpression(Inliner *inliner, Expression *expr, Expression *copy, LinkedList *mapping) {
+    copy->data_type = expr->data_type;
+    copy->expr_type = expr->expr_type;
+    copy->conversion = expr->conversion;
+
+    switch (expr->expr_type) {
+    case IdentifierExpressionType:
+        copy->data.identifier = expr->data.identifier;
+        copy->data.identifier.var = inlineRenameVariable(inliner, expr->data.identifier.var, mapping);
+        return !expr->data.identifier.var || copy->data.identifier.var;
+
+    case FunctionCallExpressionType:
+        return inlineCopyFunctionCall(inliner, &expr->data.function_call, &copy->data.function_call, mapping);
+
+    case LiteralExpressionType:
+        copy->data.literal = expr->data.literal;
+        return true;
+
+    case BinaryExpressionType:
+        copy->data.binary_expr.operation = expr->data.binary_expr.operation;
+        copy->data.binary_expr.left = (Expression *)malloc(sizeof(Expression));
+        copy->data.binary_expr.right = (Expression *)malloc(sizeof(Expression));
+        if (!copy->data.binary_expr.left || !copy->data.binary_expr.right) return false;
+        memset(copy->data.binary_expr.left, 0, sizeof(Expression));
+        memset(copy->data.binary_expr.right, 0, sizeof(Expression));
+        if (!inlineCopyExpression(inliner, expr->data.binary_expr.left, copy->data.binary_expr.left, mapping)) return false;
+        return inlineCopyExpression(inliner, expr->data.binary_expr.right, copy->data.binary_expr.right, mapping);
+    }
+    return false;
+}
+
+// Function to get the renamed copy of a callee variable
+SymVariable *inlineRenameVariable(Inliner *inliner, SymVariable *var, LinkedList *mapping) {
+    // no mapping means the caller variables, the global _ is never renamed
+    if (!var || !mapping || var->id == 0) return var;
+
+    unsigned int size = getSize(mapping);
+    for (unsigned int i = 0; i < size; i++) {
+        InlineVarMapping *entry = (InlineVarMapping *)getDataAtIndex(mapping, i);
+        if (entry->original == var) return entry->copy;
+    }
+
+    // new variable, with a fresh id, so the name_id stays unique inside of the caller frame
+    InlineVarMapping *entry = (InlineVarMapping *)malloc(sizeof(InlineVarMapping));
+    SymVariable *copy = (SymVariable *)malloc(sizeof(SymVariable));
+    if (!entry || !copy) {
+        free(entry);
+        free(copy);
+        return NULL;
+    }
+
+    *copy = *var;
+    copy->id = ++inliner->table->varCount;
+
+    // the symtable owns the variable from now on
+    if (!insertNodeAtIndex(inliner->table->data, (void *)copy, -1)) {
+        free(entry);
+        free(copy);
+        return NULL;
+    }
+
+    entry->original = var;
+    entry->copy = copy;
+    if (!insertNodeAtIndex(mapping, (void *)entry, -1)) {
+        free(entry);
+        return NULL;
+    }
+    return copy;
+}
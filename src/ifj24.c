@@ -0,0 +1,253 @@
+/** AUTHOR
+ *
+ * @author agent <agent@local>
+ * @file ifj24.c
+ * @date 19.10.2026
+ * @brief Implementation of the public C API of the compiler library, runs all the phases over a source in memory
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#ifdef USE_CUSTOM_STRUCTURE
+#include "ifj24.h"
+#include "code_generation/code_generator.h"
+#include "code_generation/c_generator.h"
+#include "code_generation/inliner.h"
+#include "lexical/scanner.h"
+#include "syntaxical/parser.h"
+#include "syntaxical/pipeline.h"
+#include "stream.h"
+#include "semantical/sem_analyzer.h"
+#include "utility/compiler_context.h"
+#include "utility/enumerations.h"
+#include "utility/memory.h"
+#include "utility/output_buffer.h"
+#include "utility/statistics.h"
+#else
+#include "ifj24.h"
+#include "code_generator.h"
+#include "c_generator.h"
+#include "inliner.h"
+#include "scanner.h"
+#include "parser.h"
+#include "pipeline.h"
+#include "stream.h"
+#include "sem_analyzer.h"
+#include "compiler_context.h"
+#include "enumerations.h"
+#include "memory.h"
+#include "output_buffer.h"
+#include "statistics.h"
+#endif
+
+// Function to count the line of a position in the source
+static unsigned int ifj24SourceLine(const char *source, size_t position) {
+    unsigned int line = 1;
+    for (size_t i = 0; i < position; i++) {
+        if (source[i] == '\n') line++;
+    }
+    return line;
+}
+
+// Function to describe the error in the result
+static void ifj24Diagnose(Ifj24Result *result, CompilerContext *ctx, const char *source, enum ERR_CODES error, bool parsed) {
+    result->error = error;
+
+    if (error == E_LEXICAL) {
+        // the scanner stops right after the wrong character
+        size_t position = ctx->sourcePosition ? ctx->sourcePosition - 1 : 0;
+        snprintf(result->diagnostic, IFJ24_DIAGNOSTIC_LENGTH, "%s at line %u", ifj24ErrorName(error),
+                 ifj24SourceLine(source, position));
+        return;
+    }
+
+    if (!parsed && error == E_SYNTAX) {
+        TOKEN_PTR token = (TOKEN_PTR)getDataAtIndex(ctx->buffer, ctx->tokenIndex);
+        if (token && token->value && token->type != TOKEN_EOF) {
+            snprintf(result->diagnostic, IFJ24_DIAGNOSTIC_LENGTH, "%s near token %u '%.64s'", ifj24ErrorName(error),
+                     ctx->tokenIndex, token->value);
+            return;
+        }
+    }
+
+    snprintf(result->diagnostic, IFJ24_DIAGNOSTIC_LENGTH, "%s", ifj24ErrorName(error));
+}
+
+// Function to set the default options
+void ifj24OptionsInit(Ifj24Options *options) {
+    options->jobs = COMPILER_JOBS;
+    options->pipeline = 0;
+    options->streaming = 0;
+    options->functionCache = NULL;
+    options->timing = NULL;
+    options->emitC = 0;
+}
+
+// Function to compile a source in memory
+int ifj24Compile(const char *source, size_t length, Ifj24Result *result) {
+    return ifj24CompileWithOptions(source, length, NULL, result);
+}
+
+// Function to describe the error of the streaming mode in the result, with the function and the line it was found at
+static void ifj24DiagnoseStream(Ifj24Result *result, const char *source, enum ERR_CODES error, const StreamError *place) {
+    result->error = error;
+
+    size_t length = (size_t)snprintf(result->diagnostic, IFJ24_DIAGNOSTIC_LENGTH, "%s", ifj24ErrorName(error));
+    if (place->function[0] && length < IFJ24_DIAGNOSTIC_LENGTH) {
+        length += (size_t)snprintf(result->diagnostic + length, IFJ24_DIAGNOSTIC_LENGTH - length, " in function '%s'", place->function);
+    }
+    if (place->position && length < IFJ24_DIAGNOSTIC_LENGTH) {
+        length += (size_t)snprintf(result->diagnostic + length, IFJ24_DIAGNOSTIC_LENGTH - length, " at line %u",
+                                   ifj24SourceLine(source, place->position - 1));
+    }
+    if (place->token[0] && length < IFJ24_DIAGNOSTIC_LENGTH) {
+        snprintf(result->diagnostic + length, IFJ24_DIAGNOSTIC_LENGTH - length, " near '%s'", place->token);
+    }
+}
+
+// Function to compile a source a function at a time, the first error is reported by the streaming pass itself
+static int ifj24CompileStream(const char *source, size_t length, const Ifj24Options *options, Ifj24Result *result) {
+    OutputBuffer *out = outputBufferInit(NULL, 0);
+    if (!out) {
+        ifj24Diagnose(result, NULL, source, E_INTERNAL, true);
+        return result->error;
+    }
+
+    StreamError place;
+    enum ERR_CODES status = streamCompile(source, length, out, options->functionCache, options->timing, &place);
+    outputBufferAppendChar(out, '\0');
+    if (status == SUCCESS && out->error) status = E_INTERNAL;
+    if (status == SUCCESS) {
+        result->code = out->data;
+        result->codeLength = out->size - 1;
+        out->data = NULL;
+    } else {
+        ifj24DiagnoseStream(result, source, status, &place);
+    }
+    outputBufferFree(&out);
+    return result->error;
+}
+
+// Function to compile a source in memory with the given options
+int ifj24CompileWithOptions(const char *source, size_t length, const Ifj24Options *options, Ifj24Result *result) {
+    result->error = SUCCESS;
+    result->code = NULL;
+    result->codeLength = 0;
+    result->diagnostic[0] = '\0';
+    STATS_ADD(sourceBytes, length);
+
+    // the streaming mode stops at the first error and reports it, the rest of the program is not read
+    bool emitC = options && options->emitC;
+    if (options && !emitC && (options->streaming || options->functionCache)) return ifj24CompileStream(source, length, options, result);
+
+    enum MEMORY_TAG scope = MEMORY_SCOPE_BEGIN(MEMORY_SYMTABLE);
+    SymTable *table = symTableInit();
+    MEMORY_SCOPE_END(scope);
+    if (!table) {
+        ifj24Diagnose(result, NULL, source, E_INTERNAL, true);
+        return result->error;
+    }
+
+    // all the state of this compilation
+    CompilerContext ctx;
+    compilerContextInit(&ctx, table, NULL);
+    if (options) ctx.jobs = options->jobs ? options->jobs : 1;
+    if (options) ctx.timing = options->timing;
+    parser_init(table, &ctx);
+    scanner_init_buffer(source, length, &ctx);
+
+    // parse input
+    struct Program program;
+    program.functions = NULL; // important, for faild first pass
+    enum ERR_CODES status = (options && options->pipeline) ? pipelineParse(&program, &ctx) : parser_parse(NULL, &program, &ctx);
+    bool parsed = status == SUCCESS;
+
+    // analyze and inline small functions, the C backend leaves the inlining to the C compiler
+    size_t span;
+    if (status == SUCCESS) {
+        span = TIMING_BEGIN(ctx.timing, "analyze");
+        scope = MEMORY_SCOPE_BEGIN(MEMORY_SYMTABLE);
+        status = analyzeProgram(&program, &ctx);
+        MEMORY_SCOPE_END(scope);
+        TIMING_END(ctx.timing, span, NULL);
+    }
+    if (status == SUCCESS && !emitC) {
+        span = TIMING_BEGIN(ctx.timing, "inline");
+        scope = MEMORY_SCOPE_BEGIN(MEMORY_AST);
+        status = inlineProgram(&program, table, INLINE_REPORT_STREAM);
+        MEMORY_SCOPE_END(scope);
+        TIMING_END(ctx.timing, span, NULL);
+    }
+
+    // generate code
+    if (status == SUCCESS) {
+        span = TIMING_BEGIN(ctx.timing, "generate");
+        scope = MEMORY_SCOPE_BEGIN(MEMORY_CODEGEN);
+        ctx.out = outputBufferInit(NULL, 0);
+        if (ctx.out) {
+            if (emitC) generateCProgram(&program, &ctx);
+            else generateCodeProgram(&program, &ctx);
+            outputBufferAppendChar(ctx.out, '\0');
+        }
+        MEMORY_SCOPE_END(scope);
+        TIMING_END(ctx.timing, span, NULL);
+
+        if (!ctx.out || ctx.out->error) {
+            status = E_INTERNAL;
+        } else {
+            // the result takes over the data of the buffer
+            result->code = ctx.out->data;
+            result->codeLength = ctx.out->size - 1;
+            ctx.out->data = NULL;
+        }
+        outputBufferFree(&ctx.out);
+    }
+
+    if (status != SUCCESS) ifj24Diagnose(result, &ctx, source, status, parsed);
+
+    // clean up
+    symTableFree(&table);
+    freeProgram(&program);
+    return result->error;
+}
+
+// Function to free the result
+void ifj24ResultFree(Ifj24Result *result) {
+    free(result->code);
+    result->code = NULL;
+    result->codeLength = 0;
+}
+
+// Function to describe the error code
+const char *ifj24ErrorName(int error) {
+    switch (error) {
+        case SUCCESS: return "success";
+        case E_LEXICAL: return "lexical error";
+        case E_SYNTAX: return "syntax error";
+        case E_SEMANTIC_UND_FUNC_OR_VAR: return "undefined function or variable";
+        case E_SEMANTIC_INVALID_FUN_PARAM: return "wrong function parameters or discarded return value";
+        case E_SEMANTIC_REDIFINITION: return "redefinition or assignment to a constant";
+        case E_SEMANTIC_BAD_FUNC_RETURN: return "missing or superfluous return value";
+        case E_SEMANTIC_INCOMPATABLE_TYPES: return "incompatible types";
+        case E_SEMANTIC_UNKNOWN_TYPE: return "type cannot be deduced";
+        case E_SEMANTIC_UNUSED_VAR: return "unused variable or unmodified var";
+        case E_SEMANTIC_OTHER: return "semantic error";
+        case E_INTERNAL: return "internal compiler error";
+        default: return "unknown error";
+    }
+}
+
+// Function to get the version of the library
+const char *ifj24Version(void) {
+    return IFJ24_VERSION;
+}
+
+// the value of a macro as a string literal
+#define IFJ24_STRINGIFY(value) #value
+#define IFJ24_MACRO_STRING(macro) IFJ24_STRINGIFY(macro)
+
+// Function to get the identity of the generated code, every build option, that changes the code, has to be in it
+const char *ifj24BuildId(void) {
+    return IFJ24_VERSION " inline=" IFJ24_MACRO_STRING(INLINE_STATEMENT_BUDGET);
+}
@@ -0,0 +1,1272 @@
+/** AUTHOR
+ *
+ * @author agent <agent@local>
+ * @file bytecode.c
+ * @date 19.10.2026
+ * @brief Implementation of the fast engine of IFJcode24, the decoding into the bytecode and its run
+ */
+
+#include <limits.h>
+#include <math.h>
+#include <stdarg.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef USE_CUSTOM_STRUCTURE
+#include "interpreter/bytecode.h"
+#else
+#include "bytecode.h"
+#endif
+
+// slot of a global name, that is not used with GF
+#define BYTECODE_NO_SLOT UINT_MAX
+
+// Function to get the layout of the instruction, the code outside of the functions has the last one
+static size_t layoutOf(const IfjCode *code, const IfjInstruction *instruction) {
+    return instruction->function == IFJCODE_NO_LABEL ? code->labelCount : instruction->function;
+}
+
+// Function to make the key of a name in a layout, 0 is an empty slot of the table
+static unsigned long long slotKey(const Bytecode *bytecode, size_t layout, size_t symbol) {
+    return (unsigned long long)layout * bytecode->code->symbolCount + symbol + 1;
+}
+
+// Function to find the entry of the key, the empty one for a new key
+static size_t slotEntry(const Bytecode *bytecode, unsigned long long key) {
+    size_t entry = (size_t)((key * 0x9E3779B97F4A7C15ull) >> 20) & (bytecode->slotCapacity - 1);
+    while (bytecode->slotKeys[entry] && bytecode->slotKeys[entry] != key) entry = (entry + 1) & (bytecode->slotCapacity - 1);
+    return entry;
+}
+
+// Function to convert a loaded operand, a new local name gets the next slot of the layout
+static void convertOperand(Bytecode *bytecode, const IfjOperand *operand, size_t layout, unsigned int *globalSlots,
+                           BytecodeOperand *converted) {
+    converted->symbol = (unsigned int)operand->symbol;
+    converted->layout = (unsigned int)layout;
+
+    if (operand->kind == OPERAND_CONSTANT) {
+        converted->kind = BYTECODE_CONSTANT;
+        converted->slot = (unsigned int)bytecode->constantCount;
+        bytecode->constants[bytecode->constantCount] = operand->value;
+        ifjValueRetain(&bytecode->constants[bytecode->constantCount++]);
+        return;
+    }
+
+    if (operand->frame == FRAME_GLOBAL) {
+        converted->kind = BYTECODE_GLOBAL;
+        if (globalSlots[operand->symbol] == BYTECODE_NO_SLOT) globalSlots[operand->symbol] = (unsigned int)bytecode->globalCount++;
+        converted->slot = globalSlots[operand->symbol];
+        return;
+    }
+
+    converted->kind = operand->frame == FRAME_LOCAL ? BYTECODE_LOCAL : BYTECODE_TEMPORARY;
+    unsigned long long key = slotKey(bytecode, layout, operand->symbol);
+    size_t entry = slotEntry(bytecode, key);
+    if (!bytecode->slotKeys[entry]) {
+        bytecode->slotKeys[entry] = key;
+        bytecode->slotValues[entry] = (unsigned int)bytecode->layoutSizes[layout]++;
+    }
+    converted->slot = bytecode->slotValues[entry];
+}
+
+// Function to get the three address form of a binary stack instruction, OP_LABEL for the other instructions
+static enum IFJCODE_OPCODE binaryOf(enum IFJCODE_OPCODE opcode) {
+    switch (opcode) {
+    case OP_ADDS:
+        return OP_ADD;
+    case OP_SUBS:
+        return OP_SUB;
+    case OP_MULS:
+        return OP_MUL;
+    case OP_DIVS:
+        return OP_DIV;
+    case OP_IDIVS:
+        return OP_IDIV;
+    case OP_LTS:
+        return OP_LT;
+    case OP_GTS:
+        return OP_GT;
+    case OP_EQS:
+        return OP_EQ;
+    case OP_ANDS:
+        return OP_AND;
+    case OP_ORS:
+        return OP_OR;
+    case OP_STRI2INTS:
+        return OP_STRI2INT;
+    default:
+        return OP_LABEL;
+    }
+}
+
+// Function to get the three address form of a unary stack instruction, OP_LABEL for the other instructions
+static enum IFJCODE_OPCODE unaryOf(enum IFJCODE_OPCODE opcode) {
+    switch (opcode) {
+    case OP_NOTS:
+        return OP_NOT;
+    case OP_INT2FLOATS:
+        return OP_INT2FLOAT;
+    case OP_FLOAT2INTS:
+        return OP_FLOAT2INT;
+    case OP_INT2CHARS:
+        return OP_INT2CHAR;
+    default:
+        return OP_LABEL;
+    }
+}
+
+// Function to get the bytecode of a simple instruction
+static enum BYTECODE_OPCODE simpleOpcode(enum IFJCODE_OPCODE opcode) {
+    switch (opcode) {
+    case OP_MOVE:
+        return BC_MOVE;
+    case OP_CREATEFRAME:
+        return BC_CREATEFRAME;
+    case OP_PUSHFRAME:
+        return BC_PUSHFRAME;
+    case OP_POPFRAME:
+        return BC_POPFRAME;
+    case OP_DEFVAR:
+        return BC_DEFVAR;
+    case OP_CALL:
+        return BC_CALL;
+    case OP_RETURN:
+        return BC_RETURN;
+    case OP_PUSHS:
+        return BC_PUSHS;
+    case OP_POPS:
+        return BC_POPS;
+    case OP_CLEARS:
+        return BC_CLEARS;
+    case OP_ADDS:
+        return BC_ADDS;
+    case OP_SUBS:
+        return BC_SUBS;
+    case OP_MULS:
+        return BC_MULS;
+    case OP_LTS:
+        return BC_LTS;
+    case OP_GTS:
+        return BC_GTS;
+    case OP_EQS:
+        return BC_EQS;
+    case OP_NOT:
+    case OP_INT2FLOAT:
+    case OP_FLOAT2INT:
+    case OP_INT2CHAR:
+    case OP_STRLEN:
+        return BC_UNARY;
+    case OP_READ:
+        return BC_READ;
+    case OP_WRITE:
+        return BC_WRITE;
+    case OP_TYPE:
+        return BC_TYPE;
+    case OP_SETCHAR:
+        return BC_SETCHAR;
+    case OP_JUMP:
+        return BC_JUMP;
+    case OP_JUMPIFEQ:
+    case OP_JUMPIFNEQ:
+        return BC_JUMPIF;
+    case OP_JUMPIFEQS:
+    case OP_JUMPIFNEQS:
+        return BC_JUMPIFS;
+    case OP_EXIT:
+        return BC_EXIT;
+    case OP_BREAK:
+        return BC_BREAK;
+    case OP_DPRINT:
+        return BC_DPRINT;
+    default:
+        if (binaryOf(opcode) != OP_LABEL) return BC_BINARYS;
+        if (unaryOf(opcode) != OP_LABEL) return BC_UNARYS;
+        return BC_BINARY;
+    }
+}
+
+// Function to decode a single instruction
+static void decodeInstruction(Bytecode *bytecode, size_t index, unsigned int *globalSlots, BytecodeInstruction *decoded) {
+    const IfjCode *code = bytecode->code;
+    const IfjInstruction *instruction = &code->instructions[index];
+    size_t layout = layoutOf(code, instruction);
+
+    memset(decoded, 0, sizeof(BytecodeInstruction));
+    decoded->opcode = (unsigned short)simpleOpcode(instruction->opcode);
+    decoded->source = (unsigned int)index;
+    decoded->operation = (unsigned short)instruction->opcode;
+    if (decoded->opcode == BC_BINARYS) decoded->operation = (unsigned short)binaryOf(instruction->opcode);
+    if (decoded->opcode == BC_UNARYS) decoded->operation = (unsigned short)unaryOf(instruction->opcode);
+
+    switch (instruction->opcode) {
+    case OP_CREATEFRAME:
+        decoded->target = layout;
+        return;
+    case OP_CALL:
+    case OP_JUMP:
+    case OP_JUMPIFEQS:
+    case OP_JUMPIFNEQS:
+        decoded->target = instruction->operands[0].target;
+        return;
+    case OP_JUMPIFEQ:
+    case OP_JUMPIFNEQ:
+        decoded->target = instruction->operands[0].target;
+        convertOperand(bytecode, &instruction->operands[1], layout, globalSlots, &decoded->operands[1]);
+        convertOperand(bytecode, &instruction->operands[2], layout, globalSlots, &decoded->operands[2]);
+        return;
+    case OP_READ:
+        decoded->operation = (unsigned short)instruction->operands[1].value.type;
+        convertOperand(bytecode, &instruction->operands[0], layout, globalSlots, &decoded->operands[0]);
+        return;
+    default:
+        for (unsigned int i = 0; i < instruction->operandCount; i++)
+            convertOperand(bytecode, &instruction->operands[i], layout, globalSlots, &decoded->operands[i]);
+        return;
+    }
+}
+
+// Function to match a push at the instruction, a PUSHS of an int constant followed by INT2FLOATS pushes the float
+static size_t matchPush(const IfjCode *code, size_t index, IfjOperand *pushed) {
+    if (index >= code->size || code->instructions[index].opcode != OP_PUSHS) return 0;
+    *pushed = code->instructions[index].operands[0];
+    if (pushed->kind != OPERAND_CONSTANT || pushed->value.type != IFJ_TYPE_INT || index + 1 >= code->size ||
+        code->instructions[index + 1].opcode != OP_INT2FLOATS)
+        return 1;
+    pushed->value.type = IFJ_TYPE_FLOAT;
+    pushed->value.data.real = (double)code->instructions[index].operands[0].value.data.integer;
+    return 2;
+}
+
+// Function to fuse the sequence starting at the instruction, returns the amount of the fused instructions, 0 if none
+static size_t fuseInstructions(Bytecode *bytecode, size_t index, unsigned int *globalSlots, BytecodeInstruction *decoded) {
+    const IfjCode *code = bytecode->code;
+    const IfjInstruction *instructions = code->instructions;
+    size_t layout = layoutOf(code, &instructions[index]);
+    IfjOperand first, second;
+    size_t pushed = matchPush(code, index, &first);
+    size_t both = pushed ? pushed + matchPush(code, index + pushed, &second) : 0;
+
+    memset(decoded, 0, sizeof(BytecodeInstruction));
+    decoded->source = (unsigned int)index;
+
+    // PUSHS a, PUSHS b, a binary stack instruction and possibly POPS x
+    if (both > pushed && index + both < code->size && binaryOf(instructions[index + both].opcode) != OP_LABEL) {
+        bool popped = index + both + 1 < code->size && instructions[index + both + 1].opcode == OP_POPS;
+        decoded->opcode = popped ? BC_PUSHS_PUSHS_BINARY_POPS : BC_PUSHS_PUSHS_BINARY;
+        decoded->operation = (unsigned short)binaryOf(instructions[index + both].opcode);
+        decoded->offsets[1] = (unsigned char)pushed;
+        decoded->offsets[2] = (unsigned char)both;
+        decoded->offsets[3] = (unsigned char)(both + 1);
+        convertOperand(bytecode, &first, layout, globalSlots, &decoded->operands[0]);
+        convertOperand(bytecode, &second, layout, globalSlots, &decoded->operands[1]);
+        if (!popped) return both + 1;
+        convertOperand(bytecode, &instructions[index + both + 1].operands[0], layout, globalSlots, &decoded->operands[2]);
+        return both + 2;
+    }
+
+    // PUSHS a and POPS x
+    if (pushed && index + pushed < code->size && instructions[index + pushed].opcode == OP_POPS) {
+        decoded->opcode = BC_PUSHS_POPS;
+        decoded->offsets[1] = (unsigned char)pushed;
+        convertOperand(bytecode, &first, layout, globalSlots, &decoded->operands[0]);
+        convertOperand(bytecode, &instructions[index + pushed].operands[0], layout, globalSlots, &decoded->operands[1]);
+        return pushed + 1;
+    }
+
+    // the folded INT2FLOATS alone
+    if (pushed == 2) {
+        decoded->opcode = BC_PUSHS;
+        convertOperand(bytecode, &first, layout, globalSlots, &decoded->operands[0]);
+        return 2;
+    }
+
+    // POPS x followed by a conditional jump, the operands of the jump keep their place
+    if (index + 1 < code->size && instructions[index].opcode == OP_POPS &&
+        (instructions[index + 1].opcode == OP_JUMPIFEQ || instructions[index + 1].opcode == OP_JUMPIFNEQ)) {
+        decodeInstruction(bytecode, index + 1, globalSlots, decoded);
+        decoded->opcode = BC_POPS_JUMPIF;
+        decoded->source = (unsigned int)index;
+        decoded->offsets[1] = 1;
+        convertOperand(bytecode, &instructions[index].operands[0], layout, globalSlots, &decoded->operands[0]);
+        return 2;
+    }
+    return 0;
+}
+
+// Function to decode the loaded program into the bytecode
+int bytecodeLoad(const IfjCode *code, Bytecode *bytecode) {
+    memset(bytecode, 0, sizeof(Bytecode));
+    bytecode->code = code;
+    bytecode->layoutCount = code->labelCount + 1;
+
+    // the constants and the local variables are counted for the sizes of the tables
+    size_t constants = 0, locals = 0;
+    for (size_t i = 0; i < code->size; i++) {
+        for (unsigned int j = 0; j < code->instructions[i].operandCount; j++) {
+            const IfjOperand *operand = &code->instructions[i].operands[j];
+            if (operand->kind == OPERAND_CONSTANT) constants++;
+            else if (operand->kind == OPERAND_VARIABLE && operand->frame != FRAME_GLOBAL) locals++;
+        }
+    }
+    bytecode->slotCapacity = 16;
+    while (bytecode->slotCapacity < locals * 2) bytecode->slotCapacity *= 2;
+
+    bytecode->instructions = (BytecodeInstruction *)malloc((code->size + 1) * sizeof(BytecodeInstruction));
+    bytecode->constants = (IfjValue *)malloc((constants + 1) * sizeof(IfjValue));
+    bytecode->layoutSizes = (size_t *)calloc(bytecode->layoutCount, sizeof(size_t));
+    bytecode->slotKeys = (unsigned long long *)calloc(bytecode->slotCapacity, sizeof(unsigned long long));
+    bytecode->slotValues = (unsigned int *)malloc(bytecode->slotCapacity * sizeof(unsigned int));
+    unsigned int *globalSlots = (unsigned int *)malloc((code->symbolCount + 1) * sizeof(unsigned int));
+    size_t *starts = (size_t *)malloc((code->size + 1) * sizeof(size_t));
+    if (!bytecode->instructions || !bytecode->constants || !bytecode->layoutSizes || !bytecode->slotKeys || !bytecode->slotValues ||
+        !globalSlots || !starts) {
+        free(globalSlots);
+        free(starts);
+        return IFJCODE_E_INTERNAL;
+    }
+    for (size_t i = 0; i < code->symbolCount; i++) globalSlots[i] = BYTECODE_NO_SLOT;
+
+    // the LABELs are dropped, starts holds the bytecode index of every loaded instruction
+    size_t index = 0;
+    while (index < code->size) {
+        starts[index] = bytecode->size;
+        if (code->instructions[index].opcode == OP_LABEL) {
+            index++;
+            continue;
+        }
+
+        BytecodeInstruction *decoded = &bytecode->instructions[bytecode->size++];
+        size_t fused = fuseInstructions(bytecode, index, globalSlots, decoded);
+        if (fused) {
+            bytecode->superinstructions++;
+            for (size_t i = 1; i < fused; i++) starts[index + i] = bytecode->size - 1;
+            index += fused;
+            continue;
+        }
+        decodeInstruction(bytecode, index++, globalSlots, decoded);
+    }
+    starts[code->size] = bytecode->size;
+
+    BytecodeInstruction *end = &bytecode->instructions[bytecode->size++];
+    memset(end, 0, sizeof(BytecodeInstruction));
+    end->opcode = BC_END;
+    end->source = (unsigned int)code->size;
+
+    // a jump leads after its LABEL, so it never lands inside of a superinstruction
+    for (size_t i = 0; i < bytecode->size; i++) {
+        BytecodeInstruction *instruction = &bytecode->instructions[i];
+        if (instruction->opcode == BC_CALL || instruction->opcode == BC_JUMP || instruction->opcode == BC_JUMPIF ||
+            instruction->opcode == BC_JUMPIFS || instruction->opcode == BC_POPS_JUMPIF)
+            instruction->target = starts[instruction->target];
+    }
+
+    free(globalSlots);
+    free(starts);
+    return IFJCODE_SUCCESS;
+}
+
+// Function to free the bytecode
+void bytecodeFree(Bytecode *bytecode) {
+    for (size_t i = 0; i < bytecode->constantCount; i++) ifjValueRelease(&bytecode->constants[i]);
+    free(bytecode->instructions);
+    free(bytecode->constants);
+    free(bytecode->layoutSizes);
+    free(bytecode->slotKeys);
+    free(bytecode->slotValues);
+    memset(bytecode, 0, sizeof(Bytecode));
+}
+
+// Function to prepare a run of the bytecode
+bool bytecodeMachineInit(BytecodeMachine *machine, Bytecode *bytecode, FILE *input, FILE *output) {
+    memset(machine, 0, sizeof(BytecodeMachine));
+    machine->bytecode = bytecode;
+    machine->input = input;
+    machine->output = output;
+    machine->globals = (IfjValue *)calloc(bytecode->globalCount + 1, sizeof(IfjValue));
+    machine->globalDefined = (unsigned char *)calloc(bytecode->globalCount + 1, sizeof(unsigned char));
+    machine->unused = (BytecodeFrame **)calloc(bytecode->layoutCount, sizeof(BytecodeFrame *));
+    return machine->globals && machine->globalDefined && machine->unused;
+}
+
+// Function to add the values of the frame to the free ones of its layout, the values are released
+static void frameRelease(BytecodeMachine *machine, BytecodeFrame *frame) {
+    if (!frame) return;
+    for (size_t i = 0; i < frame->size; i++) {
+        if (frame->defined[i]) ifjValueRelease(&frame->values[i]);
+    }
+    for (size_t i = 0; i < frame->extraCount; i++) ifjValueRelease(&frame->extraValues[i]);
+    frame->extraCount = 0;
+    frame->next = machine->unused[frame->layout];
+    machine->unused[frame->layout] = frame;
+}
+
+// Function to free a released frame
+static void frameFree(BytecodeFrame *frame) {
+    free(frame->extraSymbols);
+    free(frame->extraValues);
+    free(frame);
+}
+
+// Function to free the frames and the stacks of the run
+void bytecodeMachineFree(BytecodeMachine *machine) {
+    for (size_t i = 0; machine->globals && i < machine->bytecode->globalCount; i++) {
+        if (machine->globalDefined[i]) ifjValueRelease(&machine->globals[i]);
+    }
+    free(machine->globals);
+    free(machine->globalDefined);
+
+    if (machine->unused) {
+        frameRelease(machine, machine->temporary);
+        for (size_t i = 0; i < machine->localCount; i++) frameRelease(machine, machine->locals[i]);
+        for (size_t i = 0; i < machine->bytecode->layoutCount; i++) {
+            while (machine->unused[i]) {
+                BytecodeFrame *next = machine->unused[i]->next;
+                frameFree(machine->unused[i]);
+                machine->unused[i] = next;
+            }
+        }
+    }
+    free(machine->unused);
+    free(machine->locals);
+
+    for (size_t i = 0; i < machine->stackSize; i++) ifjValueRelease(&machine->stack[i]);
+    free(machine->stack);
+    free(machine->calls);
+    memset(machine, 0, sizeof(BytecodeMachine));
+}
+
+// Function to describe a runtime error, the line of the loaded instruction at the offset of the superinstruction is added
+static int runtimeError(BytecodeMachine *machine, const BytecodeInstruction *ip, unsigned int offset, int error, const char *format, ...) {
+    const IfjInstruction *instruction = &machine->bytecode->code->instructions[ip->source + offset];
+    int written = snprintf(machine->diagnostic, IFJCODE_DIAGNOSTIC_LENGTH, "line %zu, %s: ", instruction->line,
+                           ifjCodeOpcodeName(instruction->opcode));
+    if (written < 0 || written >= IFJCODE_DIAGNOSTIC_LENGTH) return error;
+
+    va_list args;
+    va_start(args, format);
+    vsnprintf(machine->diagnostic + written, IFJCODE_DIAGNOSTIC_LENGTH - written, format, args);
+    va_end(args);
+    return error;
+}
+
+// Function to describe the error of a variable operand
+static int operandError(BytecodeMachine *machine, const BytecodeInstruction *ip, unsigned int offset, int error, const BytecodeOperand *operand) {
+    if (error == IFJCODE_E_FRAME)
+        return runtimeError(machine, ip, offset, error, "the %s frame does not exist", operand->kind == BYTECODE_LOCAL ? "local" : "temporary");
+    return runtimeError(machine, ip, offset, error, "undefined variable %s", machine->bytecode->code->symbols[operand->symbol]);
+}
+
+// Function to get the frame of a local or temporary operand, NULL if it does not exist
+static inline BytecodeFrame *frameOf(BytecodeMachine *machine, const BytecodeOperand *operand) {
+    if (operand->kind == BYTECODE_TEMPORARY) return machine->temporary;
+    return machine->localCount ? machine->locals[machine->localCount - 1] : NULL;
+}
+
+// Function to find the variable in a frame of another layout, the slot is cached in the operand, -1 is an extra variable
+static long long frameResolve(BytecodeMachine *machine, BytecodeFrame *frame, BytecodeOperand *operand) {
+    const Bytecode *bytecode = machine->bytecode;
+    size_t entry = slotEntry(bytecode, slotKey(bytecode, frame->layout, operand->symbol));
+    if (bytecode->slotKeys[entry]) {
+        operand->layout = (unsigned int)frame->layout;
+        operand->slot = bytecode->slotValues[entry];
+        return operand->slot;
+    }
+    return -1;
+}
+
+// Function to find an extra variable of the frame, NULL if it is not defined
+static IfjValue *frameExtra(BytecodeFrame *frame, size_t symbol) {
+    for (size_t i = 0; i < frame->extraCount; i++) {
+        if (frame->extraSymbols[i] == symbol) return &frame->extraValues[i];
+    }
+    return NULL;
+}
+
+// Function to find a defined variable, NULL with the error, if it or its frame does not exist
+static inline IfjValue *variableOf(BytecodeMachine *machine, BytecodeOperand *operand, int *error) {
+    if (operand->kind == BYTECODE_GLOBAL) {
+        if (machine->globalDefined[operand->slot]) return &machine->globals[operand->slot];
+        *error = IFJCODE_E_UNDEFINED_VAR;
+        return NULL;
+    }
+
+    BytecodeFrame *frame = frameOf(machine, operand);
+    if (!frame) {
+        *error = IFJCODE_E_FRAME;
+        return NULL;
+    }
+    if (frame->layout == operand->layout || frameResolve(machine, frame, operand) >= 0) {
+        if (frame->defined[operand->slot]) return &frame->values[operand->slot];
+        *error = IFJCODE_E_UNDEFINED_VAR;
+        return NULL;
+    }
+
+    IfjValue *value = frameExtra(frame, operand->symbol);
+    if (!value) *error = IFJCODE_E_UNDEFINED_VAR;
+    return value;
+}
+
+// Function to define a new variable, a name missing in the layout of the frame is added to its extra variables
+static int defineVariable(BytecodeMachine *machine, BytecodeOperand *operand) {
+    if (operand->kind == BYTECODE_GLOBAL) {
+        if (machine->globalDefined[operand->slot]) return IFJCODE_E_SEMANTIC;
+        machine->globalDefined[operand->slot] = true;
+        machine->globals[operand->slot].type = IFJ_TYPE_UNDEFINED;
+        return IFJCODE_SUCCESS;
+    }
+
+    BytecodeFrame *frame = frameOf(machine, operand);
+    if (!frame) return IFJCODE_E_FRAME;
+    if (frame->layout == operand->layout || frameResolve(machine, frame, operand) >= 0) {
+        if (frame->defined[operand->slot]) return IFJCODE_E_SEMANTIC;
+        frame->defined[operand->slot] = true;
+        frame->values[operand->slot].type = IFJ_TYPE_UNDEFINED;
+        return IFJCODE_SUCCESS;
+    }
+
+    if (frameExtra(frame, operand->symbol)) return IFJCODE_E_SEMANTIC;
+    if (frame->extraCount == frame->extraCapacity) {
+        size_t capacity = frame->extraCapacity ? frame->extraCapacity * 2 : 4;
+        size_t *symbols = (size_t *)realloc(frame->extraSymbols, capacity * sizeof(size_t));
+        if (symbols) frame->extraSymbols = symbols;
+        IfjValue *values = (IfjValue *)realloc(frame->extraValues, capacity * sizeof(IfjValue));
+        if (values) frame->extraValues = values;
+        if (!symbols || !values) return IFJCODE_E_INTERNAL;
+        frame->extraCapacity = capacity;
+    }
+    frame->extraSymbols[frame->extraCount] = operand->symbol;
+    frame->extraValues[frame->extraCount++].type = IFJ_TYPE_UNDEFINED;
+    return IFJCODE_SUCCESS;
+}
+
+// Function to create a frame of the layout, a released one is reused
+static BytecodeFrame *frameNew(BytecodeMachine *machine, size_t layout) {
+    BytecodeFrame *frame = machine->unused[layout];
+    if (frame) {
+        machine->unused[layout] = frame->next;
+    } else {
+        size_t size = machine->bytecode->layoutSizes[layout];
+        frame = (BytecodeFrame *)malloc(sizeof(BytecodeFrame) + size * (sizeof(IfjValue) + 1));
+        if (!frame) return NULL;
+        frame->layout = layout;
+        frame->size = size;
+        frame->defined = (unsigned char *)(frame->values + size);
+        frame->extraSymbols = NULL;
+        frame->extraValues = NULL;
+        frame->extraCount = frame->extraCapacity = 0;
+    }
+    memset(frame->defined, 0, frame->size);
+    return frame;
+}
+
+// Function to make room for more values on the data stack
+static bool stackReserve(BytecodeMachine *machine, size_t count) {
+    if (machine->stackSize + count <= machine->stackCapacity) return true;
+    size_t capacity = machine->stackCapacity ? machine->stackCapacity * 2 : 64;
+    while (capacity < machine->stackSize + count) capacity *= 2;
+    IfjValue *stack = (IfjValue *)realloc(machine->stack, capacity * sizeof(IfjValue));
+    if (!stack) return false;
+    machine->stack = stack;
+    machine->stackCapacity = capacity;
+    return true;
+}
+
+// Function to add a reference to a string value, the other values are copied as they are
+static inline void retainValue(IfjValue *value) {
+    if (value->type == IFJ_TYPE_STRING) ifjValueRetain(value);
+}
+
+// Function to drop the reference of a string value
+static inline void releaseValue(IfjValue *value) {
+    if (value->type == IFJ_TYPE_STRING) ifjValueRelease(value);
+}
+
+// Function to make a string value
+static int makeString(BytecodeMachine *machine, const BytecodeInstruction *ip, unsigned int offset, const char *data, size_t length,
+                      IfjValue *result) {
+    IfjString *string = ifjStringNew(data, length);
+    if (!string) return runtimeError(machine, ip, offset, IFJCODE_E_INTERNAL, "out of memory");
+    result->type = IFJ_TYPE_STRING;
+    result->data.string = string;
+    return IFJCODE_SUCCESS;
+}
+
+// Function to compute the operations of two ints or two floats without a call, false leaves the others to binaryOperation
+static inline bool numberOperation(unsigned int operation, const IfjValue *a, const IfjValue *b, IfjValue *result) {
+    if (a->type == IFJ_TYPE_FLOAT && b->type == IFJ_TYPE_FLOAT) {
+        double x = a->data.real, y = b->data.real;
+        switch (operation) {
+        case OP_ADD:
+            result->data.real = x + y;
+            break;
+        case OP_SUB:
+            result->data.real = x - y;
+            break;
+        case OP_MUL:
+            result->data.real = x * y;
+            break;
+        case OP_DIV:
+            if (y == 0.0) return false;
+            result->data.real = x / y;
+            break;
+        case OP_LT:
+            result->type = IFJ_TYPE_BOOL;
+            result->data.boolean = x < y;
+            return true;
+        case OP_GT:
+            result->type = IFJ_TYPE_BOOL;
+            result->data.boolean = x > y;
+            return true;
+        default:
+            return false;
+        }
+        result->type = IFJ_TYPE_FLOAT;
+        return true;
+    }
+
+    if (a->type != IFJ_TYPE_INT || b->type != IFJ_TYPE_INT) return false;
+    unsigned long long x = (unsigned long long)a->data.integer, y = (unsigned long long)b->data.integer;
+    long long first = a->data.integer, second = b->data.integer;
+    switch (operation) {
+    case OP_ADD:
+        result->data.integer = (long long)(x + y);
+        break;
+    case OP_SUB:
+        result->data.integer = (long long)(x - y);
+        break;
+    case OP_MUL:
+        result->data.integer = (long long)(x * y);
+        break;
+    case OP_LT:
+        result->type = IFJ_TYPE_BOOL;
+        result->data.boolean = first < second;
+        return true;
+    case OP_GT:
+        result->type = IFJ_TYPE_BOOL;
+        result->data.boolean = first > second;
+        return true;
+    case OP_EQ:
+        result->type = IFJ_TYPE_BOOL;
+        result->data.boolean = first == second;
+        return true;
+    default:
+        return false;
+    }
+    result->type = IFJ_TYPE_INT;
+    return true;
+}
+
+// Function to compare the values of the same type, returns -1, 0 or 1
+static int compareValues(const IfjValue *a, const IfjValue *b) {
+    switch (a->type) {
+    case IFJ_TYPE_INT:
+        return (a->data.integer > b->data.integer) - (a->data.integer < b->data.integer);
+    case IFJ_TYPE_FLOAT:
+        return (a->data.real > b->data.real) - (a->data.real < b->data.real);
+    case IFJ_TYPE_BOOL:
+        return (int)a->data.boolean - (int)b->data.boolean;
+    case IFJ_TYPE_STRING: {
+        IfjString *x = a->data.string, *y = b->data.string;
+        int order = memcmp(x->data, y->data, x->length < y->length ? x->length : y->length);
+        if (order) return order < 0 ? -1 : 1;
+        return (x->length > y->length) - (x->length < y->length);
+    }
+    default:
+        return 0;
+    }
+}
+
+// Function to test the equality of EQ and the conditional jumps, nil can be compared with anything
+static int equality(BytecodeMachine *machine, const BytecodeInstruction *ip, unsigned int offset, const IfjValue *a, const IfjValue *b,
+                    bool *equal) {
+    if (a->type == IFJ_TYPE_NIL || b->type == IFJ_TYPE_NIL) {
+        *equal = a->type == b->type;
+        return IFJCODE_SUCCESS;
+    }
+    if (a->type != b->type)
+        return runtimeError(machine, ip, offset, IFJCODE_E_OPERAND_TYPE, "comparing %s with %s", ifjCodeTypeName(a->type), ifjCodeTypeName(b->type));
+    *equal = compareValues(a, b) == 0;
+    return IFJCODE_SUCCESS;
+}
+
+// Function to compute the binary operations, the operation is the three address form
+static int binaryOperation(BytecodeMachine *machine, const BytecodeInstruction *ip, unsigned int offset, unsigned int operation,
+                           const IfjValue *a, const IfjValue *b, IfjValue *result) {
+    bool ints = a->type == IFJ_TYPE_INT && b->type == IFJ_TYPE_INT;
+    bool floats = a->type == IFJ_TYPE_FLOAT && b->type == IFJ_TYPE_FLOAT;
+    bool strings = a->type == IFJ_TYPE_STRING && (operation == OP_CONCAT ? b->type == IFJ_TYPE_STRING : b->type == IFJ_TYPE_INT);
+    bool wrong;
+    switch (operation) {
+    case OP_ADD:
+    case OP_SUB:
+    case OP_MUL:
+        wrong = !ints && !floats;
+        break;
+    case OP_DIV:
+        wrong = !floats;
+        break;
+    case OP_IDIV:
+        wrong = !ints;
+        break;
+    case OP_LT:
+    case OP_GT:
+        wrong = a->type != b->type || a->type == IFJ_TYPE_NIL;
+        break;
+    case OP_EQ:
+        result->type = IFJ_TYPE_BOOL;
+        return equality(machine, ip, offset, a, b, &result->data.boolean);
+    case OP_AND:
+    case OP_OR:
+        wrong = a->type != IFJ_TYPE_BOOL || b->type != IFJ_TYPE_BOOL;
+        break;
+    default:
+        wrong = !strings;
+        break;
+    }
+    if (wrong) {
+        const char *format = operation == OP_LT || operation == OP_GT ? "comparing %s with %s" : "wrong operands %s and %s";
+        return runtimeError(machine, ip, offset, IFJCODE_E_OPERAND_TYPE, format, ifjCodeTypeName(a->type), ifjCodeTypeName(b->type));
+    }
+
+    switch (operation) {
+    case OP_ADD:
+    case OP_SUB:
+    case OP_MUL:
+        if (numberOperation(operation, a, b, result)) return IFJCODE_SUCCESS;
+        result->type = IFJ_TYPE_FLOAT;
+        result->data.real = operation == OP_ADD ? a->data.real + b->data.real : operation == OP_SUB ? a->data.real - b->data.real : a->data.real * b->data.real;
+        return IFJCODE_SUCCESS;
+    case OP_DIV:
+        if (b->data.real == 0.0) return runtimeError(machine, ip, offset, IFJCODE_E_OPERAND_VALUE, "division by zero");
+        result->type = IFJ_TYPE_FLOAT;
+        result->data.real = a->data.real / b->data.real;
+        return IFJCODE_SUCCESS;
+    case OP_IDIV:
+        if (b->data.integer == 0) return runtimeError(machine, ip, offset, IFJCODE_E_OPERAND_VALUE, "division by zero");
+        result->type = IFJ_TYPE_INT;
+        result->data.integer = a->data.integer == LLONG_MIN && b->data.integer == -1 ? LLONG_MIN : a->data.integer / b->data.integer;
+        return IFJCODE_SUCCESS;
+    case OP_LT:
+    case OP_GT: {
+        int order = compareValues(a, b);
+        result->type = IFJ_TYPE_BOOL;
+        result->data.boolean = operation == OP_LT ? order < 0 : order > 0;
+        return IFJCODE_SUCCESS;
+    }
+    case OP_AND:
+    case OP_OR:
+        result->type = IFJ_TYPE_BOOL;
+        result->data.boolean = operation == OP_AND ? a->data.boolean && b->data.boolean : a->data.boolean || b->data.boolean;
+        return IFJCODE_SUCCESS;
+    case OP_CONCAT: {
+        IfjString *x = a->data.string, *y = b->data.string;
+        int error = makeString(machine, ip, offset, NULL, x->length + y->length, result);
+        if (error) return error;
+        memcpy(result->data.string->data, x->data, x->length);
+        memcpy(result->data.string->data + x->length, y->data, y->length);
+        return IFJCODE_SUCCESS;
+    }
+    default:
+        // STRI2INT and GETCHAR
+        if (b->data.integer < 0 || (unsigned long long)b->data.integer >= a->data.string->length)
+            return runtimeError(machine, ip, offset, IFJCODE_E_STRING, "index %lld out of the string", b->data.integer);
+        if (operation == OP_GETCHAR) return makeString(machine, ip, offset, a->data.string->data + b->data.integer, 1, result);
+        result->type = IFJ_TYPE_INT;
+        result->data.integer = (unsigned char)a->data.string->data[b->data.integer];
+        return IFJCODE_SUCCESS;
+    }
+}
+
+// Function to compute the unary operations NOT, INT2FLOAT, FLOAT2INT, INT2CHAR and STRLEN
+static int unaryOperation(BytecodeMachine *machine, const BytecodeInstruction *ip, unsigned int operation, const IfjValue *a, IfjValue *result) {
+    enum IFJCODE_TYPE expected = operation == OP_NOT ? IFJ_TYPE_BOOL : operation == OP_FLOAT2INT ? IFJ_TYPE_FLOAT : operation == OP_STRLEN ? IFJ_TYPE_STRING : IFJ_TYPE_INT;
+    if (a->type != expected)
+        return runtimeError(machine, ip, 0, IFJCODE_E_OPERAND_TYPE, "wrong operand %s, expected %s", ifjCodeTypeName(a->type), ifjCodeTypeName(expected));
+
+    switch (operation) {
+    case OP_NOT:
+        result->type = IFJ_TYPE_BOOL;
+        result->data.boolean = !a->data.boolean;
+        return IFJCODE_SUCCESS;
+    case OP_INT2FLOAT:
+        result->type = IFJ_TYPE_FLOAT;
+        result->data.real = (double)a->data.integer;
+        return IFJCODE_SUCCESS;
+    case OP_FLOAT2INT:
+        if (!isfinite(a->data.real) || a->data.real >= 9223372036854775808.0 || a->data.real < -9223372036854775808.0)
+            return runtimeError(machine, ip, 0, IFJCODE_E_OPERAND_VALUE, "%a does not fit into an int", a->data.real);
+        result->type = IFJ_TYPE_INT;
+        result->data.integer = (long long)a->data.real;
+        return IFJCODE_SUCCESS;
+    case OP_INT2CHAR: {
+        if (a->data.integer < 0 || a->data.integer > 255)
+            return runtimeError(machine, ip, 0, IFJCODE_E_STRING, "%lld is not a character", a->data.integer);
+        char character = (char)a->data.integer;
+        return makeString(machine, ip, 0, &character, 1, result);
+    }
+    default:
+        // STRLEN
+        result->type = IFJ_TYPE_INT;
+        result->data.integer = (long long)a->data.string->length;
+        return IFJCODE_SUCCESS;
+    }
+}
+
+// Function to run a binary stack instruction, the result replaces its operands
+static int stackBinary(BytecodeMachine *machine, const BytecodeInstruction *ip, unsigned int operation) {
+    if (machine->stackSize < 2) return runtimeError(machine, ip, 0, IFJCODE_E_MISSING_VALUE, "the data stack is empty");
+    IfjValue *a = &machine->stack[machine->stackSize - 2], *b = a + 1;
+    IfjValue result = {.type = IFJ_TYPE_UNDEFINED};
+    int error = binaryOperation(machine, ip, 0, operation, a, b, &result);
+    if (error) return error;
+    releaseValue(a);
+    releaseValue(b);
+    *a = result;
+    machine->stackSize--;
+    return IFJCODE_SUCCESS;
+}
+
+// Function to run SETCHAR, the character is replaced in a copy, if the string is shared
+static int runSetChar(BytecodeMachine *machine, const BytecodeInstruction *ip, IfjValue *variable, const IfjValue *index, const IfjValue *character) {
+    if (variable->type == IFJ_TYPE_UNDEFINED) return runtimeError(machine, ip, 0, IFJCODE_E_MISSING_VALUE, "uninitialized variable");
+    if (variable->type != IFJ_TYPE_STRING || index->type != IFJ_TYPE_INT || character->type != IFJ_TYPE_STRING)
+        return runtimeError(machine, ip, 0, IFJCODE_E_OPERAND_TYPE, "wrong operands");
+    IfjString *string = variable->data.string;
+    if (index->data.integer < 0 || (unsigned long long)index->data.integer >= string->length || character->data.string->length == 0)
+        return runtimeError(machine, ip, 0, IFJCODE_E_STRING, "index %lld out of the string", index->data.integer);
+
+    if (string->references > 1) {
+        IfjValue copy;
+        int error = makeString(machine, ip, 0, string->data, string->length, &copy);
+        if (error) return error;
+        ifjValueRelease(variable);
+        *variable = copy;
+        string = copy.data.string;
+    }
+    string->data[index->data.integer] = character->data.string->data[0];
+    return IFJCODE_SUCCESS;
+}
+
+// the dispatch, the threaded one jumps straight to the code of the next instruction
+#if BYTECODE_THREADED
+#define TARGET(opcode) handler_##opcode:
+#define DISPATCH() goto *ip->handler
+#else
+#define TARGET(opcode) case opcode:
+#define DISPATCH() goto dispatch
+#endif
+#define NEXT()                                                                                                                             \
+    {                                                                                                                                      \
+        ip++;                                                                                                                              \
+        DISPATCH();                                                                                                                        \
+    }
+
+// a runtime error of the loaded instruction at the offset
+#define FAIL(offset, error, ...)                                                                                                           \
+    do {                                                                                                                                   \
+        status = runtimeError(machine, ip, offset, error, __VA_ARGS__);                                                                    \
+        goto failed;                                                                                                                       \
+    } while (0)
+
+// checks the result of a helper, that describes its error itself
+#define CHECK(call)                                                                                                                        \
+    do {                                                                                                                                   \
+        if ((status = (call))) goto failed;                                                                                                \
+    } while (0)
+
+// the defined variable of the operand
+#define VARIABLE(value, operand, offset)                                                                                                   \
+    do {                                                                                                                                   \
+        if (!((value) = variableOf(machine, (operand), &status))) {                                                                        \
+            status = operandError(machine, ip, offset, status, (operand));                                                                 \
+            goto failed;                                                                                                                   \
+        }                                                                                                                                  \
+    } while (0)
+
+// the value of a constant or of an initialized variable
+#define SYMBOL(value, operand, offset)                                                                                                     \
+    do {                                                                                                                                   \
+        if ((operand)->kind == BYTECODE_CONSTANT) {                                                                                        \
+            (value) = &constants[(operand)->slot];                                                                                         \
+        } else {                                                                                                                           \
+            VARIABLE(variable, operand, offset);                                                                                           \
+            if (variable->type == IFJ_TYPE_UNDEFINED)                                                                                      \
+                FAIL(offset, IFJCODE_E_MISSING_VALUE, "uninitialized variable %s", symbols[(operand)->symbol]);                            \
+            (value) = variable;                                                                                                            \
+        }                                                                                                                                  \
+    } while (0)
+
+// moves the result into the variable, the result is released, if the variable is not defined
+#define STORE(operand, offset, result)                                                                                                     \
+    do {                                                                                                                                   \
+        if (!(variable = variableOf(machine, (operand), &status))) {                                                                       \
+            releaseValue(&(result));                                                                                                       \
+            status = operandError(machine, ip, offset, status, (operand));                                                                 \
+            goto failed;                                                                                                                   \
+        }                                                                                                                                  \
+        releaseValue(variable);                                                                                                            \
+        *variable = (result);                                                                                                              \
+    } while (0)
+
+// the taken addresses of the labels and goto * are GNU extensions
+#if BYTECODE_THREADED
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpedantic"
+#endif
+
+// Function to run the bytecode until its EXIT, its end or an error
+int bytecodeMachineRun(BytecodeMachine *machine) {
+    Bytecode *bytecode = machine->bytecode;
+    BytecodeInstruction *instructions = bytecode->instructions;
+    BytecodeInstruction *ip = instructions;
+    const IfjValue *constants = bytecode->constants;
+    char **symbols = bytecode->code->symbols;
+    const IfjValue *a, *b;
+    IfjValue *variable;
+    IfjValue result;
+    bool equal;
+    int status = IFJCODE_SUCCESS;
+
+#if BYTECODE_THREADED
+    static const void *handlers[BYTECODE_OPCODE_COUNT] = {
+        [BC_MOVE] = &&handler_BC_MOVE,
+        [BC_CREATEFRAME] = &&handler_BC_CREATEFRAME,
+        [BC_PUSHFRAME] = &&handler_BC_PUSHFRAME,
+        [BC_POPFRAME] = &&handler_BC_POPFRAME,
+        [BC_DEFVAR] = &&handler_BC_DEFVAR,
+        [BC_CALL] = &&handler_BC_CALL,
+        [BC_RETURN] = &&handler_BC_RETURN,
+        [BC_PUSHS] = &&handler_BC_PUSHS,
+        [BC_POPS] = &&handler_BC_POPS,
+        [BC_CLEARS] = &&handler_BC_CLEARS,
+        [BC_BINARY] = &&handler_BC_BINARY,
+        [BC_UNARY] = &&handler_BC_UNARY,
+        [BC_ADDS] = &&handler_BC_ADDS,
+        [BC_SUBS] = &&handler_BC_SUBS,
+        [BC_MULS] = &&handler_BC_MULS,
+        [BC_LTS] = &&handler_BC_LTS,
+        [BC_GTS] = &&handler_BC_GTS,
+        [BC_EQS] = &&handler_BC_EQS,
+        [BC_BINARYS] = &&handler_BC_BINARYS,
+        [BC_UNARYS] = &&handler_BC_UNARYS,
+        [BC_READ] = &&handler_BC_READ,
+        [BC_WRITE] = &&handler_BC_WRITE,
+        [BC_TYPE] = &&handler_BC_TYPE,
+        [BC_SETCHAR] = &&handler_BC_SETCHAR,
+        [BC_JUMP] = &&handler_BC_JUMP,
+        [BC_JUMPIF] = &&handler_BC_JUMPIF,
+        [BC_JUMPIFS] = &&handler_BC_JUMPIFS,
+        [BC_EXIT] = &&handler_BC_EXIT,
+        [BC_BREAK] = &&handler_BC_BREAK,
+        [BC_DPRINT] = &&handler_BC_DPRINT,
+        [BC_END] = &&handler_BC_END,
+        [BC_PUSHS_PUSHS_BINARY_POPS] = &&handler_BC_PUSHS_PUSHS_BINARY_POPS,
+        [BC_PUSHS_PUSHS_BINARY] = &&handler_BC_PUSHS_PUSHS_BINARY,
+        [BC_POPS_JUMPIF] = &&handler_BC_POPS_JUMPIF,
+        [BC_PUSHS_POPS] = &&handler_BC_PUSHS_POPS,
+    };
+    for (size_t i = 0; i < bytecode->size; i++) instructions[i].handler = handlers[instructions[i].opcode];
+    DISPATCH();
+#else
+dispatch:
+    switch (ip->opcode) {
+#endif
+
+    TARGET(BC_MOVE) {
+        SYMBOL(a, &ip->operands[1], 0);
+        result = *a;
+        retainValue(&result);
+        STORE(&ip->operands[0], 0, result);
+        NEXT();
+    }
+
+    TARGET(BC_CREATEFRAME) {
+        BytecodeFrame *frame = frameNew(machine, ip->target);
+        if (!frame) FAIL(0, IFJCODE_E_INTERNAL, "out of memory");
+        frameRelease(machine, machine->temporary);
+        machine->temporary = frame;
+        NEXT();
+    }
+
+    TARGET(BC_PUSHFRAME) {
+        if (!machine->temporary) FAIL(0, IFJCODE_E_FRAME, "the temporary frame does not exist");
+        if (machine->localCount == machine->localCapacity) {
+            size_t capacity = machine->localCapacity ? machine->localCapacity * 2 : 16;
+            BytecodeFrame **locals = (BytecodeFrame **)realloc(machine->locals, capacity * sizeof(BytecodeFrame *));
+            if (!locals) FAIL(0, IFJCODE_E_INTERNAL, "out of memory");
+            machine->locals = locals;
+            machine->localCapacity = capacity;
+        }
+        machine->locals[machine->localCount++] = machine->temporary;
+        machine->temporary = NULL;
+        NEXT();
+    }
+
+    TARGET(BC_POPFRAME) {
+        if (machine->localCount == 0) FAIL(0, IFJCODE_E_FRAME, "the local frame does not exist");
+        frameRelease(machine, machine->temporary);
+        machine->temporary = machine->locals[--machine->localCount];
+        NEXT();
+    }
+
+    TARGET(BC_DEFVAR) {
+        status = defineVariable(machine, &ip->operands[0]);
+        if (status == IFJCODE_E_SEMANTIC) FAIL(0, status, "redefinition of %s", symbols[ip->operands[0].symbol]);
+        if (status == IFJCODE_E_INTERNAL) FAIL(0, status, "out of memory");
+        if (status) {
+            status = operandError(machine, ip, 0, status, &ip->operands[0]);
+            goto failed;
+        }
+        NEXT();
+    }
+
+    TARGET(BC_CALL) {
+        if (machine->callCount == machine->callCapacity) {
+            size_t capacity = machine->callCapacity ? machine->callCapacity * 2 : 64;
+            size_t *calls = (size_t *)realloc(machine->calls, capacity * sizeof(size_t));
+            if (!calls) FAIL(0, IFJCODE_E_INTERNAL, "out of memory");
+            machine->calls = calls;
+            machine->callCapacity = capacity;
+        }
+        machine->calls[machine->callCount++] = (size_t)(ip - instructions) + 1;
+        ip = instructions + ip->target;
+        DISPATCH();
+    }
+
+    TARGET(BC_RETURN) {
+        if (machine->callCount == 0) FAIL(0, IFJCODE_E_MISSING_VALUE, "the call stack is empty");
+        ip = instructions + machine->calls[--machine->callCount];
+        DISPATCH();
+    }
+
+    TARGET(BC_PUSHS) {
+        SYMBOL(a, &ip->operands[0], 0);
+        if (!stackReserve(machine, 1)) FAIL(0, IFJCODE_E_INTERNAL, "out of memory");
+        machine->stack[machine->stackSize] = *a;
+        retainValue(&machine->stack[machine->stackSize++]);
+        NEXT();
+    }
+
+    TARGET(BC_POPS) {
+        if (machine->stackSize == 0) FAIL(0, IFJCODE_E_MISSING_VALUE, "the data stack is empty");
+        VARIABLE(variable, &ip->operands[0], 0);
+        releaseValue(variable);
+        *variable = machine->stack[--machine->stackSize];
+        NEXT();
+    }
+
+    TARGET(BC_CLEARS) {
+        while (machine->stackSize) releaseValue(&machine->stack[--machine->stackSize]);
+        NEXT();
+    }
+
+    TARGET(BC_BINARY) {
+        SYMBOL(a, &ip->operands[1], 0);
+        SYMBOL(b, &ip->operands[2], 0);
+        if (!numberOperation(ip->operation, a, b, &result)) CHECK(binaryOperation(machine, ip, 0, ip->operation, a, b, &result));
+        STORE(&ip->operands[0], 0, result);
+        NEXT();
+    }
+
+    TARGET(BC_UNARY) {
+        SYMBOL(a, &ip->operands[1], 0);
+        CHECK(unaryOperation(machine, ip, ip->operation, a, &result));
+        STORE(&ip->operands[0], 0, result);
+        NEXT();
+    }
+
+    TARGET(BC_ADDS) {
+        if (machine->stackSize >= 2 && numberOperation(OP_ADD, &machine->stack[machine->stackSize - 2], &machine->stack[machine->stackSize - 1],
+                                                        &machine->stack[machine->stackSize - 2]))
+            machine->stackSize--;
+        else CHECK(stackBinary(machine, ip, OP_ADD));
+        NEXT();
+    }
+
+    TARGET(BC_SUBS) {
+        if (machine->stackSize >= 2 && numberOperation(OP_SUB, &machine->stack[machine->stackSize - 2], &machine->stack[machine->stackSize - 1],
+                                                        &machine->stack[machine->stackSize - 2]))
+            machine->stackSize--;
+        else CHECK(stackBinary(machine, ip, OP_SUB));
+        NEXT();
+    }
+
+    TARGET(BC_MULS) {
+        if (machine->stackSize >= 2 && numberOperation(OP_MUL, &machine->stack[machine->stackSize - 2], &machine->stack[machine->stackSize - 1],
+                                                        &machine->stack[machine->stackSize - 2]))
+            machine->stackSize--;
+        else CHECK(stackBinary(machine, ip, OP_MUL));
+        NEXT();
+    }
+
+    TARGET(BC_LTS) {
+        if (machine->stackSize >= 2 && numberOperation(OP_LT, &machine->stack[machine->stackSize - 2], &machine->stack[machine->stackSize - 1],
+                                                        &machine->stack[machine->stackSize - 2]))
+            machine->stackSize--;
+        else CHECK(stackBinary(machine, ip, OP_LT));
+        NEXT();
+    }
+
+    TARGET(BC_GTS) {
+        if (machine->stackSize >= 2 && numberOperation(OP_GT, &machine->stack[machine->stackSize - 2], &machine->stack[machine->stackSize - 1],
+                                                        &machine->stack[machine->stackSize - 2]))
+            machine->stackSize--;
+        else CHECK(stackBinary(machine, ip, OP_GT));
+        NEXT();
+    }
+
+    TARGET(BC_EQS) {
+        if (machine->stackSize >= 2 && numberOperation(OP_EQ, &machine->stack[machine->stackSize - 2], &machine->stack[machine->stackSize - 1],
+                                                        &machine->stack[machine->stackSize - 2]))
+            machine->stackSize--;
+        else CHECK(stackBinary(machine, ip, OP_EQ));
+        NEXT();
+    }
+
+    TARGET(BC_BINARYS) {
+        CHECK(stackBinary(machine, ip, ip->operation));
+        NEXT();
+    }
+
+    TARGET(BC_UNARYS) {
+        if (machine->stackSize == 0) FAIL(0, IFJCODE_E_MISSING_VALUE, "the data stack is empty");
+        variable = &machine->stack[machine->stackSize - 1];
+        CHECK(unaryOperation(machine, ip, ip->operation, variable, &result));
+        releaseValue(variable);
+        *variable = result;
+        NEXT();
+    }
+
+    TARGET(BC_READ) {
+        if (!ifjValueRead((enum IFJCODE_TYPE)ip->operation, machine->input, &result)) FAIL(0, IFJCODE_E_INTERNAL, "out of memory");
+        STORE(&ip->operands[0], 0, result);
+        NEXT();
+    }
+
+    TARGET(BC_WRITE) {
+        SYMBOL(a, &ip->operands[0], 0);
+        ifjValueWrite(a, machine->output);
+        NEXT();
+    }
+
+    TARGET(BC_TYPE) {
+        // the type of an uninitialized variable is an empty string
+        if (ip->operands[1].kind == BYTECODE_CONSTANT) a = &constants[ip->operands[1].slot];
+        else VARIABLE(a, &ip->operands[1], 0);
+        const char *name = ifjCodeTypeName(a->type);
+        CHECK(makeString(machine, ip, 0, name, strlen(name), &result));
+        STORE(&ip->operands[0], 0, result);
+        NEXT();
+    }
+
+    TARGET(BC_SETCHAR) {
+        IfjValue *string;
+        VARIABLE(string, &ip->operands[0], 0);
+        SYMBOL(a, &ip->operands[1], 0);
+        SYMBOL(b, &ip->operands[2], 0);
+        CHECK(runSetChar(machine, ip, string, a, b));
+        NEXT();
+    }
+
+    TARGET(BC_JUMP) {
+        ip = instructions + ip->target;
+        DISPATCH();
+    }
+
+    TARGET(BC_JUMPIF) {
+        SYMBOL(a, &ip->operands[1], 0);
+        SYMBOL(b, &ip->operands[2], 0);
+        CHECK(equality(machine, ip, 0, a, b, &equal));
+        if (equal == (ip->operation == OP_JUMPIFEQ)) ip = instructions + ip->target;
+        else ip++;
+        DISPATCH();
+    }
+
+    TARGET(BC_JUMPIFS) {
+        if (machine->stackSize < 2) FAIL(0, IFJCODE_E_MISSING_VALUE, "the data stack is empty");
+        CHECK(equality(machine, ip, 0, &machine->stack[machine->stackSize - 2], &machine->stack[machine->stackSize - 1], &equal));
+        releaseValue(&machine->stack[--machine->stackSize]);
+        releaseValue(&machine->stack[--machine->stackSize]);
+        if (equal == (ip->operation == OP_JUMPIFEQS)) ip = instructions + ip->target;
+        else ip++;
+        DISPATCH();
+    }
+
+    TARGET(BC_EXIT) {
+        SYMBOL(a, &ip->operands[0], 0);
+        if (a->type != IFJ_TYPE_INT) FAIL(0, IFJCODE_E_OPERAND_TYPE, "the exit code is not an int");
+        if (a->data.integer < 0 || a->data.integer > 9) FAIL(0, IFJCODE_E_OPERAND_VALUE, "the exit code %lld is not 0 - 9", a->data.integer);
+        return (int)a->data.integer;
+    }
+
+    TARGET(BC_BREAK) {
+        fprintf(stderr, "BREAK at line %zu: instruction %zu, temporary frame %s, frame stack %zu, data stack %zu, call stack %zu\n",
+                bytecode->code->instructions[ip->source].line, (size_t)(ip - instructions), machine->temporary ? "defined" : "undefined",
+                machine->localCount, machine->stackSize, machine->callCount);
+        NEXT();
+    }
+
+    TARGET(BC_DPRINT) {
+        SYMBOL(a, &ip->operands[0], 0);
+        ifjValueWrite(a, stderr);
+        NEXT();
+    }
+
+    TARGET(BC_END) {
+        return IFJCODE_SUCCESS;
+    }
+
+    TARGET(BC_PUSHS_PUSHS_BINARY_POPS) {
+        SYMBOL(a, &ip->operands[0], 0);
+        SYMBOL(b, &ip->operands[1], ip->offsets[1]);
+        if (!numberOperation(ip->operation, a, b, &result)) CHECK(binaryOperation(machine, ip, ip->offsets[2], ip->operation, a, b, &result));
+        STORE(&ip->operands[2], ip->offsets[3], result);
+        NEXT();
+    }
+
+    TARGET(BC_PUSHS_PUSHS_BINARY) {
+        SYMBOL(a, &ip->operands[0], 0);
+        SYMBOL(b, &ip->operands[1], ip->offsets[1]);
+        if (!numberOperation(ip->operation, a, b, &result)) CHECK(binaryOperation(machine, ip, ip->offsets[2], ip->operation, a, b, &result));
+        if (!stackReserve(machine, 1)) {
+            releaseValue(&result);
+            FAIL(ip->offsets[2], IFJCODE_E_INTERNAL, "out of memory");
+        }
+        machine->stack[machine->stackSize++] = result;
+        NEXT();
+    }
+
+    TARGET(BC_POPS_JUMPIF) {
+        if (machine->stackSize == 0) FAIL(0, IFJCODE_E_MISSING_VALUE, "the data stack is empty");
+        VARIABLE(variable, &ip->operands[0], 0);
+        releaseValue(variable);
+        *variable = machine->stack[--machine->stackSize];
+        SYMBOL(a, &ip->operands[1], ip->offsets[1]);
+        SYMBOL(b, &ip->operands[2], ip->offsets[1]);
+        CHECK(equality(machine, ip, ip->offsets[1], a, b, &equal));
+        if (equal == (ip->operation == OP_JUMPIFEQ)) ip = instructions + ip->target;
+        else ip++;
+        DISPATCH();
+    }
+
+    TARGET(BC_PUSHS_POPS) {
+        SYMBOL(a, &ip->operands[0], 0);
+        result = *a;
+        retainValue(&result);
+        STORE(&ip->operands[1], ip->offsets[1], result);
+        NEXT();
+    }
+
+#if !BYTECODE_THREADED
+    default:
+        return IFJCODE_E_INTERNAL;
+    }
+#endif
+
+failed:
+    return status;
+}
+
+#if BYTECODE_THREADED
+#pragma GCC diagnostic pop
+#endif
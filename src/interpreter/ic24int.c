@@ -0,0 +1,140 @@
+/** AUTHOR
+ *
+ * @author agent <agent@local>
+ * @file ic24int.c
+ * @date 19.10.2026
+ * @brief The interpreter of IFJcode24 (ic24int), runs the generated code and counts the executed instructions
+ *
+ * Usage: ic24int [--counts | --counts=json | --fast] program.code < input
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef USE_CUSTOM_STRUCTURE
+#include "interpreter/bytecode.h"
+#include "interpreter/ifjcode.h"
+#include "interpreter/interpreter.h"
+#else
+#include "bytecode.h"
+#include "ifjcode.h"
+#include "interpreter.h"
+#endif
+
+// Function to read the whole file into memory
+char *readProgram(const char *path, size_t *length) {
+    FILE *file = fopen(path, "rb");
+    if (!file) return NULL;
+
+    size_t capacity = 1 << 16;
+    char *text = (char *)malloc(capacity);
+    *length = 0;
+    size_t read;
+    while (text && (read = fread(text + *length, 1, capacity - *length, file)) > 0) {
+        *length += read;
+        if (*length < capacity) continue;
+
+        char *bigger = (char *)realloc(text, capacity * 2);
+        if (!bigger) {
+            free(text);
+            text = NULL;
+            break;
+        }
+        text = bigger;
+        capacity *= 2;
+    }
+
+    if (text && ferror(file)) {
+        free(text);
+        text = NULL;
+    }
+    fclose(file);
+    return text;
+}
+
+// Function to run the program by the fast engine, it does not count the instructions
+int runFast(const IfjCode *code) {
+    Bytecode bytecode;
+    BytecodeMachine machine;
+    int status = bytecodeLoad(code, &bytecode);
+    if (status == IFJCODE_SUCCESS && !bytecodeMachineInit(&machine, &bytecode, stdin, stdout)) {
+        bytecodeMachineFree(&machine);
+        status = IFJCODE_E_INTERNAL;
+    }
+    if (status != IFJCODE_SUCCESS) {
+        fprintf(stderr, "ic24int: out of memory\n");
+        bytecodeFree(&bytecode);
+        return status;
+    }
+
+    status = bytecodeMachineRun(&machine);
+    fflush(stdout);
+    if (status >= IFJCODE_E_PARAM) fprintf(stderr, "ic24int: %s\n", machine.diagnostic);
+    bytecodeMachineFree(&machine);
+    bytecodeFree(&bytecode);
+    return status;
+}
+
+int main(int argc, char **argv) {
+    const char *path = NULL;
+    bool counting = false;
+    bool json = false;
+    bool fast = false;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--counts") == 0) counting = true;
+        else if (strcmp(argv[i], "--counts=json") == 0) counting = json = true;
+        else if (strcmp(argv[i], "--fast") == 0) fast = true;
+        else if (!path && argv[i][0] != '-') path = argv[i];
+        else path = NULL, i = argc;
+    }
+    // the fast engine does not count, the counts are taken by the reference one
+    if (!path || (fast && counting)) {
+        fprintf(stderr, "usage: %s [--counts | --counts=json | --fast] program.code < input\n", argv[0]);
+        return IFJCODE_E_PARAM;
+    }
+
+    size_t length;
+    char *text = readProgram(path, &length);
+    if (!text) {
+        fprintf(stderr, "ic24int: cannot read %s\n", path);
+        return IFJCODE_E_PARAM;
+    }
+
+    IfjCode code;
+    char diagnostic[IFJCODE_DIAGNOSTIC_LENGTH];
+    int status = ifjCodeLoad(text, length, &code, diagnostic);
+    free(text);
+    if (status != IFJCODE_SUCCESS) {
+        fprintf(stderr, "ic24int: %s\n", diagnostic);
+        ifjCodeFree(&code);
+        return status;
+    }
+    if (fast) {
+        status = runFast(&code);
+        ifjCodeFree(&code);
+        return status;
+    }
+
+    InterpreterCounts counts;
+    if (counting && !interpreterCountsInit(&counts, &code)) {
+        fprintf(stderr, "ic24int: out of memory\n");
+        ifjCodeFree(&code);
+        return IFJCODE_E_INTERNAL;
+    }
+
+    Interpreter interpreter;
+    interpreterInit(&interpreter, &code, stdin, stdout, counting ? &counts : NULL);
+    status = interpreterRun(&interpreter);
+    fflush(stdout);
+    if (status >= IFJCODE_E_PARAM) fprintf(stderr, "ic24int: %s\n", interpreter.diagnostic);
+
+    // the counts go to stderr, the output of the program stays on stdout
+    if (counting) {
+        interpreterCountsPrint(&counts, &code, stderr, json);
+        interpreterCountsFree(&counts);
+    }
+    interpreterFree(&interpreter);
+    ifjCodeFree(&code);
+    return status;
+}
@@ -0,0 +1,659 @@
+/** AUTHOR
+ *
+ * @author agent <agent@local>
+ * @file ifjcode.c
+ * @date 19.10.2026
+ * @brief Implementation of the loader of IFJcode24 and of the values shared by the interpreters
+ */
+
+#include <ctype.h>
+#include <errno.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef USE_CUSTOM_STRUCTURE
+#include "interpreter/ifjcode.h"
+#else
+#include "ifjcode.h"
+#endif
+
+// Struct for the name and the operands of an instruction, v - variable, s - symbol, l - label, t - type
+typedef struct IfjCodeSignature {
+    const char *name; // name of the instruction
+    const char *operands; // kinds of the operands
+} IfjCodeSignature;
+
+static const IfjCodeSignature ifjCodeSignatures[IFJCODE_OPCODE_COUNT] = {
+    [OP_MOVE] = {"MOVE", "vs"},
+    [OP_CREATEFRAME] = {"CREATEFRAME", ""},
+    [OP_PUSHFRAME] = {"PUSHFRAME", ""},
+    [OP_POPFRAME] = {"POPFRAME", ""},
+    [OP_DEFVAR] = {"DEFVAR", "v"},
+    [OP_CALL] = {"CALL", "l"},
+    [OP_RETURN] = {"RETURN", ""},
+    [OP_PUSHS] = {"PUSHS", "s"},
+    [OP_POPS] = {"POPS", "v"},
+    [OP_CLEARS] = {"CLEARS", ""},
+    [OP_ADD] = {"ADD", "vss"},
+    [OP_SUB] = {"SUB", "vss"},
+    [OP_MUL] = {"MUL", "vss"},
+    [OP_DIV] = {"DIV", "vss"},
+    [OP_IDIV] = {"IDIV", "vss"},
+    [OP_ADDS] = {"ADDS", ""},
+    [OP_SUBS] = {"SUBS", ""},
+    [OP_MULS] = {"MULS", ""},
+    [OP_DIVS] = {"DIVS", ""},
+    [OP_IDIVS] = {"IDIVS", ""},
+    [OP_LT] = {"LT", "vss"},
+    [OP_GT] = {"GT", "vss"},
+    [OP_EQ] = {"EQ", "vss"},
+    [OP_LTS] = {"LTS", ""},
+    [OP_GTS] = {"GTS", ""},
+    [OP_EQS] = {"EQS", ""},
+    [OP_AND] = {"AND", "vss"},
+    [OP_OR] = {"OR", "vss"},
+    [OP_NOT] = {"NOT", "vs"},
+    [OP_ANDS] = {"ANDS", ""},
+    [OP_ORS] = {"ORS", ""},
+    [OP_NOTS] = {"NOTS", ""},
+    [OP_INT2FLOAT] = {"INT2FLOAT", "vs"},
+    [OP_FLOAT2INT] = {"FLOAT2INT", "vs"},
+    [OP_INT2CHAR] = {"INT2CHAR", "vs"},
+    [OP_STRI2INT] = {"STRI2INT", "vss"},
+    [OP_INT2FLOATS] = {"INT2FLOATS", ""},
+    [OP_FLOAT2INTS] = {"FLOAT2INTS", ""},
+    [OP_INT2CHARS] = {"INT2CHARS", ""},
+    [OP_STRI2INTS] = {"STRI2INTS", ""},
+    [OP_READ] = {"READ", "vt"},
+    [OP_WRITE] = {"WRITE", "s"},
+    [OP_CONCAT] = {"CONCAT", "vss"},
+    [OP_STRLEN] = {"STRLEN", "vs"},
+    [OP_GETCHAR] = {"GETCHAR", "vss"},
+    [OP_SETCHAR] = {"SETCHAR", "vss"},
+    [OP_TYPE] = {"TYPE", "vs"},
+    [OP_LABEL] = {"LABEL", "l"},
+    [OP_JUMP] = {"JUMP", "l"},
+    [OP_JUMPIFEQ] = {"JUMPIFEQ", "lss"},
+    [OP_JUMPIFNEQ] = {"JUMPIFNEQ", "lss"},
+    [OP_JUMPIFEQS] = {"JUMPIFEQS", "l"},
+    [OP_JUMPIFNEQS] = {"JUMPIFNEQS", "l"},
+    [OP_EXIT] = {"EXIT", "s"},
+    [OP_BREAK] = {"BREAK", ""},
+    [OP_DPRINT] = {"DPRINT", "s"},
+};
+
+// Struct for interned names, an open addressed table of the indexes into the names
+typedef struct IfjCodeNames {
+    char **names; // the names in the order of their first use
+    size_t count; // amount of the names
+    size_t *slots; // index + 1 of the name, 0 is an empty slot
+    size_t capacity; // slots of the table, a power of two
+} IfjCodeNames;
+
+// Struct for the state of the loader
+typedef struct IfjCodeLoader {
+    IfjCode *code; // the loaded program
+    size_t capacity; // allocated instructions
+    IfjCodeNames symbols; // names of the variables
+    IfjCodeNames labels; // names of the labels
+    size_t *labelTargets; // index of the instruction after the LABEL of every name, IFJCODE_NO_LABEL if not defined
+    size_t labelCapacity; // allocated targets
+    size_t line; // the current line
+    char *diagnostic; // the description of an error
+} IfjCodeLoader;
+
+// Function to describe an error of the loader
+static int loaderError(IfjCodeLoader *loader, int error, const char *format, ...) {
+    int written = snprintf(loader->diagnostic, IFJCODE_DIAGNOSTIC_LENGTH, "line %zu: ", loader->line);
+    if (written < 0 || written >= IFJCODE_DIAGNOSTIC_LENGTH) return error;
+
+    va_list args;
+    va_start(args, format);
+    vsnprintf(loader->diagnostic + written, IFJCODE_DIAGNOSTIC_LENGTH - written, format, args);
+    va_end(args);
+    return error;
+}
+
+// Function to hash a name, FNV-1a
+static size_t namesHash(const char *name, size_t length) {
+    uint64_t hash = 14695981039346656037ULL;
+    for (size_t i = 0; i < length; i++) {
+        hash ^= (unsigned char)name[i];
+        hash *= 1099511628211ULL;
+    }
+    return (size_t)hash;
+}
+
+// Function to double the slots of the names, every name is placed again
+static bool namesGrow(IfjCodeNames *names) {
+    size_t capacity = names->capacity ? names->capacity * 2 : 64;
+    size_t *slots = (size_t *)calloc(capacity, sizeof(size_t));
+    if (!slots) return false;
+
+    for (size_t i = 0; i < names->count; i++) {
+        size_t slot = namesHash(names->names[i], strlen(names->names[i])) & (capacity - 1);
+        while (slots[slot]) slot = (slot + 1) & (capacity - 1);
+        slots[slot] = i + 1;
+    }
+    free(names->slots);
+    names->slots = slots;
+    names->capacity = capacity;
+
+    char **grown = (char **)realloc(names->names, capacity * sizeof(char *));
+    if (!grown) return false;
+    names->names = grown;
+    return true;
+}
+
+// Function to get the index of a name, a new name is added
+static bool namesIntern(IfjCodeNames *names, const char *name, size_t length, size_t *index) {
+    if ((names->count + 1) * 2 > names->capacity && !namesGrow(names)) return false;
+
+    size_t slot = namesHash(name, length) & (names->capacity - 1);
+    while (names->slots[slot]) {
+        char *existing = names->names[names->slots[slot] - 1];
+        if (strncmp(existing, name, length) == 0 && existing[length] == '\0') {
+            *index = names->slots[slot] - 1;
+            return true;
+        }
+        slot = (slot + 1) & (names->capacity - 1);
+    }
+
+    char *copy = (char *)malloc(length + 1);
+    if (!copy) return false;
+    memcpy(copy, name, length);
+    copy[length] = '\0';
+
+    names->names[names->count] = copy;
+    names->slots[slot] = ++names->count;
+    *index = names->count - 1;
+    return true;
+}
+
+// Function to check the characters of a name of a variable or a label
+static bool isIdentifier(const char *name, size_t length) {
+    if (length == 0 || isdigit((unsigned char)name[0])) return false;
+    for (size_t i = 0; i < length; i++) {
+        if (!isalnum((unsigned char)name[i]) && !strchr("_-$&%*!?", name[i])) return false;
+    }
+    return true;
+}
+
+// Function to compare a token with a word, without the case
+static bool tokenIs(const char *token, size_t length, const char *word) {
+    for (size_t i = 0; i < length; i++) {
+        if (word[i] == '\0' || toupper((unsigned char)token[i]) != toupper((unsigned char)word[i])) return false;
+    }
+    return word[length] == '\0';
+}
+
+// Function to parse the value of a string constant, the escapes \ddd are decoded
+static int parseString(IfjCodeLoader *loader, const char *text, size_t length, IfjValue *value) {
+    IfjString *string = ifjStringNew(text, length);
+    if (!string) return loaderError(loader, IFJCODE_E_INTERNAL, "out of memory");
+
+    size_t size = 0;
+    for (size_t i = 0; i < length; i++) {
+        if (text[i] != '\\') {
+            string->data[size++] = text[i];
+            continue;
+        }
+        int byte = 0;
+        for (int digit = 1; digit <= 3; digit++) {
+            if (i + digit >= length || !isdigit((unsigned char)text[i + digit])) {
+                free(string);
+                return loaderError(loader, IFJCODE_E_SYNTAX, "wrong escape sequence in %.*s", (int)length, text);
+            }
+            byte = byte * 10 + (text[i + digit] - '0');
+        }
+        if (byte > 255) {
+            free(string);
+            return loaderError(loader, IFJCODE_E_SYNTAX, "wrong escape sequence in %.*s", (int)length, text);
+        }
+        string->data[size++] = (char)byte;
+        i += 3;
+    }
+    string->data[size] = '\0';
+    string->length = size;
+
+    value->type = IFJ_TYPE_STRING;
+    value->data.string = string;
+    return IFJCODE_SUCCESS;
+}
+
+// Function to parse the value of an int constant, decimal, 0x hexadecimal or 0o octal
+static bool parseInt(const char *text, size_t length, long long *result) {
+    char buffer[72];
+    if (length == 0 || length >= sizeof(buffer)) return false;
+    memcpy(buffer, text, length);
+    buffer[length] = '\0';
+
+    char *digits = buffer;
+    bool negative = *digits == '-';
+    if (*digits == '-' || *digits == '+') digits++;
+
+    int base = 10;
+    if (digits[0] == '0' && (digits[1] == 'x' || digits[1] == 'X')) base = 16;
+    else if (digits[0] == '0' && (digits[1] == 'o' || digits[1] == 'O')) base = 8;
+    if (base != 10) digits += 2;
+    if (!isalnum((unsigned char)*digits)) return false;
+
+    char *end;
+    errno = 0;
+    unsigned long long magnitude = strtoull(digits, &end, base);
+    if (*end != '\0' || errno == ERANGE) return false;
+    *result = negative ? (long long)(0ULL - magnitude) : (long long)magnitude;
+    return true;
+}
+
+// Function to parse a constant, type@value
+static int parseConstant(IfjCodeLoader *loader, const char *token, size_t length, IfjOperand *operand) {
+    const char *at = memchr(token, '@', length);
+    if (!at) return loaderError(loader, IFJCODE_E_SYNTAX, "expected a symbol, got %.*s", (int)length, token);
+    size_t typeLength = at - token;
+    const char *text = at + 1;
+    size_t textLength = length - typeLength - 1;
+
+    operand->kind = OPERAND_CONSTANT;
+    IfjValue *value = &operand->value;
+    if (tokenIs(token, typeLength, "string")) return parseString(loader, text, textLength, value);
+
+    if (tokenIs(token, typeLength, "int")) {
+        value->type = IFJ_TYPE_INT;
+        if (parseInt(text, textLength, &value->data.integer)) return IFJCODE_SUCCESS;
+    } else if (tokenIs(token, typeLength, "float")) {
+        char buffer[128];
+        if (textLength > 0 && textLength < sizeof(buffer)) {
+            memcpy(buffer, text, textLength);
+            buffer[textLength] = '\0';
+            char *end;
+            value->type = IFJ_TYPE_FLOAT;
+            value->data.real = strtod(buffer, &end);
+            if (*end == '\0') return IFJCODE_SUCCESS;
+        }
+    } else if (tokenIs(token, typeLength, "bool")) {
+        value->type = IFJ_TYPE_BOOL;
+        value->data.boolean = textLength == 4 && strncmp(text, "true", 4) == 0;
+        if (value->data.boolean || (textLength == 5 && strncmp(text, "false", 5) == 0)) return IFJCODE_SUCCESS;
+    } else if (tokenIs(token, typeLength, "nil")) {
+        value->type = IFJ_TYPE_NIL;
+        if (textLength == 3 && strncmp(text, "nil", 3) == 0) return IFJCODE_SUCCESS;
+    }
+    value->type = IFJ_TYPE_UNDEFINED;
+    return loaderError(loader, IFJCODE_E_SYNTAX, "wrong constant %.*s", (int)length, token);
+}
+
+// Function to parse a variable, frame@name
+static int parseVariable(IfjCodeLoader *loader, const char *token, size_t length, IfjOperand *operand) {
+    if (length < 3 || token[2] != '@') return loaderError(loader, IFJCODE_E_SYNTAX, "expected a variable, got %.*s", (int)length, token);
+
+    if (strncmp(token, "GF", 2) == 0) operand->frame = FRAME_GLOBAL;
+    else if (strncmp(token, "LF", 2) == 0) operand->frame = FRAME_LOCAL;
+    else if (strncmp(token, "TF", 2) == 0) operand->frame = FRAME_TEMPORARY;
+    else return loaderError(loader, IFJCODE_E_SYNTAX, "wrong frame of %.*s", (int)length, token);
+
+    if (!isIdentifier(token + 3, length - 3))
+        return loaderError(loader, IFJCODE_E_SYNTAX, "wrong name of the variable %.*s", (int)length, token);
+    if (!namesIntern(&loader->symbols, token + 3, length - 3, &operand->symbol))
+        return loaderError(loader, IFJCODE_E_INTERNAL, "out of memory");
+    operand->kind = OPERAND_VARIABLE;
+    return IFJCODE_SUCCESS;
+}
+
+// Function to parse a label, it does not have to be defined yet
+static int parseLabel(IfjCodeLoader *loader, const char *token, size_t length, IfjOperand *operand) {
+    if (!isIdentifier(token, length)) return loaderError(loader, IFJCODE_E_SYNTAX, "wrong label %.*s", (int)length, token);
+    if (!namesIntern(&loader->labels, token, length, &operand->symbol)) return loaderError(loader, IFJCODE_E_INTERNAL, "out of memory");
+
+    // a new label is not defined, until its LABEL is found
+    if (operand->symbol >= loader->labelCapacity) {
+        size_t capacity = loader->labelCapacity ? loader->labelCapacity * 2 : 64;
+        size_t *targets = (size_t *)realloc(loader->labelTargets, capacity * sizeof(size_t));
+        if (!targets) return loaderError(loader, IFJCODE_E_INTERNAL, "out of memory");
+        for (size_t i = loader->labelCapacity; i < capacity; i++) targets[i] = IFJCODE_NO_LABEL;
+        loader->labelTargets = targets;
+        loader->labelCapacity = capacity;
+    }
+    operand->kind = OPERAND_LABEL;
+    operand->target = IFJCODE_NO_LABEL;
+    return IFJCODE_SUCCESS;
+}
+
+// Function to parse a single operand of the given kind
+static int parseOperand(IfjCodeLoader *loader, char kind, const char *token, size_t length, IfjOperand *operand) {
+    switch (kind) {
+    case 'v':
+        return parseVariable(loader, token, length, operand);
+    case 's':
+        if (length >= 3 && token[2] == '@' && (strncmp(token, "GF", 2) == 0 || strncmp(token, "LF", 2) == 0 || strncmp(token, "TF", 2) == 0))
+            return parseVariable(loader, token, length, operand);
+        return parseConstant(loader, token, length, operand);
+    case 'l':
+        return parseLabel(loader, token, length, operand);
+    default:
+        operand->kind = OPERAND_TYPE;
+        if (tokenIs(token, length, "int")) operand->value.type = IFJ_TYPE_INT;
+        else if (tokenIs(token, length, "float")) operand->value.type = IFJ_TYPE_FLOAT;
+        else if (tokenIs(token, length, "string")) operand->value.type = IFJ_TYPE_STRING;
+        else if (tokenIs(token, length, "bool")) operand->value.type = IFJ_TYPE_BOOL;
+        else return loaderError(loader, IFJCODE_E_SYNTAX, "wrong type %.*s", (int)length, token);
+        return IFJCODE_SUCCESS;
+    }
+}
+
+// Function to split the next token of the line, returns its length, 0 at the end of the line
+static size_t nextToken(const char **cursor, const char *end) {
+    while (*cursor < end && isspace((unsigned char)**cursor)) (*cursor)++;
+    size_t length = 0;
+    while (*cursor + length < end && !isspace((unsigned char)(*cursor)[length])) length++;
+    return length;
+}
+
+// Function to parse a single line without its comment
+static int parseLine(IfjCodeLoader *loader, const char *cursor, const char *end) {
+    size_t length = nextToken(&cursor, end);
+    if (length == 0) return IFJCODE_SUCCESS;
+
+    int opcode = 0;
+    while (opcode < IFJCODE_OPCODE_COUNT && !tokenIs(cursor, length, ifjCodeSignatures[opcode].name)) opcode++;
+    if (opcode == IFJCODE_OPCODE_COUNT) return loaderError(loader, IFJCODE_E_SYNTAX, "unknown instruction %.*s", (int)length, cursor);
+    cursor += length;
+
+    IfjCode *code = loader->code;
+    if (code->size == loader->capacity) {
+        size_t capacity = loader->capacity ? loader->capacity * 2 : 256;
+        IfjInstruction *instructions = (IfjInstruction *)realloc(code->instructions, capacity * sizeof(IfjInstruction));
+        if (!instructions) return loaderError(loader, IFJCODE_E_INTERNAL, "out of memory");
+        code->instructions = instructions;
+        loader->capacity = capacity;
+    }
+
+    IfjInstruction *instruction = &code->instructions[code->size++];
+    memset(instruction, 0, sizeof(IfjInstruction));
+    instruction->opcode = (enum IFJCODE_OPCODE)opcode;
+    instruction->line = loader->line;
+
+    const char *operands = ifjCodeSignatures[opcode].operands;
+    for (; operands[instruction->operandCount]; instruction->operandCount++) {
+        length = nextToken(&cursor, end);
+        if (length == 0) return loaderError(loader, IFJCODE_E_SYNTAX, "missing operand of %s", ifjCodeSignatures[opcode].name);
+        IfjOperand *operand = &instruction->operands[instruction->operandCount];
+        int error = parseOperand(loader, operands[instruction->operandCount], cursor, length, operand);
+        if (error) return error;
+        cursor += length;
+    }
+    if (nextToken(&cursor, end)) return loaderError(loader, IFJCODE_E_SYNTAX, "too many operands of %s", ifjCodeSignatures[opcode].name);
+
+    if (opcode == OP_LABEL) {
+        size_t label = instruction->operands[0].symbol;
+        if (loader->labelTargets[label] != IFJCODE_NO_LABEL)
+            return loaderError(loader, IFJCODE_E_SEMANTIC, "redefinition of the label %s", loader->labels.names[label]);
+        loader->labelTargets[label] = code->size;
+    }
+    return IFJCODE_SUCCESS;
+}
+
+// Function to resolve the jumps and to find the label and the function of every instruction
+static int resolveLabels(IfjCodeLoader *loader) {
+    IfjCode *code = loader->code;
+    code->labelCount = loader->labels.count;
+    if (code->labelCount) {
+        code->labels = (IfjLabel *)calloc(code->labelCount, sizeof(IfjLabel));
+        if (!code->labels) return loaderError(loader, IFJCODE_E_INTERNAL, "out of memory");
+    }
+    for (size_t i = 0; i < code->labelCount; i++) {
+        code->labels[i].name = loader->labels.names[i];
+        code->labels[i].target = loader->labelTargets[i];
+        loader->labels.names[i] = NULL;
+    }
+
+    for (size_t i = 0; i < code->size; i++) {
+        IfjInstruction *instruction = &code->instructions[i];
+        for (unsigned int j = 0; j < instruction->operandCount; j++) {
+            IfjOperand *operand = &instruction->operands[j];
+            if (operand->kind != OPERAND_LABEL) continue;
+
+            IfjLabel *label = &code->labels[operand->symbol];
+            if (label->target == IFJCODE_NO_LABEL) {
+                loader->line = instruction->line;
+                return loaderError(loader, IFJCODE_E_SEMANTIC, "undefined label %s", label->name);
+            }
+            operand->target = label->target;
+            if (instruction->opcode == OP_CALL) label->function = true;
+        }
+    }
+
+    // a function lasts until the label of the next one
+    size_t label = IFJCODE_NO_LABEL;
+    size_t function = IFJCODE_NO_LABEL;
+    for (size_t i = 0; i < code->size; i++) {
+        IfjInstruction *instruction = &code->instructions[i];
+        if (instruction->opcode == OP_LABEL) {
+            label = instruction->operands[0].symbol;
+            if (code->labels[label].function) function = label;
+        }
+        instruction->label = label;
+        instruction->function = function;
+    }
+    return IFJCODE_SUCCESS;
+}
+
+// Function to free the interned names
+static void namesFree(IfjCodeNames *names) {
+    for (size_t i = 0; i < names->count; i++) free(names->names[i]);
+    free(names->names);
+    free(names->slots);
+}
+
+// Function to load a program from its text
+int ifjCodeLoad(const char *text, size_t length, IfjCode *code, char *diagnostic) {
+    memset(code, 0, sizeof(IfjCode));
+    diagnostic[0] = '\0';
+    IfjCodeLoader loader = {.code = code, .diagnostic = diagnostic};
+
+    int error = IFJCODE_SUCCESS;
+    bool header = false;
+    const char *end = text + length;
+    for (const char *line = text; line < end && !error;) {
+        const char *lineEnd = memchr(line, '\n', end - line);
+        if (!lineEnd) lineEnd = end;
+        loader.line++;
+
+        // the comment lasts until the end of the line, a # in a string is always escaped
+        const char *comment = memchr(line, '#', lineEnd - line);
+        const char *contentEnd = comment ? comment : lineEnd;
+
+        if (header) {
+            error = parseLine(&loader, line, contentEnd);
+        } else {
+            const char *cursor = line;
+            size_t tokenLength = nextToken(&cursor, contentEnd);
+            if (tokenLength) {
+                header = tokenIs(cursor, tokenLength, IFJCODE_HEADER);
+                cursor += tokenLength;
+                if (!header || nextToken(&cursor, contentEnd)) error = loaderError(&loader, IFJCODE_E_SYNTAX, "missing header %s", IFJCODE_HEADER);
+            }
+        }
+        line = lineEnd + 1;
+    }
+    if (!error && !header) error = loaderError(&loader, IFJCODE_E_SYNTAX, "missing header %s", IFJCODE_HEADER);
+    if (!error) error = resolveLabels(&loader);
+
+    // the names of the variables stay with the program, the ones of the labels are moved into the labels
+    code->symbols = loader.symbols.names;
+    code->symbolCount = loader.symbols.count;
+    free(loader.symbols.slots);
+    for (size_t i = 0; i < loader.labels.count; i++) free(loader.labels.names[i]);
+    free(loader.labels.names);
+    free(loader.labels.slots);
+    free(loader.labelTargets);
+    return error;
+}
+
+// Function to free the loaded program
+void ifjCodeFree(IfjCode *code) {
+    for (size_t i = 0; i < code->size; i++) {
+        IfjInstruction *instruction = &code->instructions[i];
+        for (unsigned int j = 0; j < instruction->operandCount; j++) {
+            if (instruction->operands[j].kind == OPERAND_CONSTANT) ifjValueRelease(&instruction->operands[j].value);
+        }
+    }
+    free(code->instructions);
+
+    for (size_t i = 0; i < code->labelCount; i++) free(code->labels[i].name);
+    free(code->labels);
+
+    IfjCodeNames symbols = {.names = code->symbols, .count = code->symbolCount};
+    namesFree(&symbols);
+    memset(code, 0, sizeof(IfjCode));
+}
+
+// Function to get the name of the instruction
+const char *ifjCodeOpcodeName(enum IFJCODE_OPCODE opcode) {
+    if (opcode >= IFJCODE_OPCODE_COUNT) return "unknown";
+    return ifjCodeSignatures[opcode].name;
+}
+
+// Function to get the name of the type
+const char *ifjCodeTypeName(enum IFJCODE_TYPE type) {
+    switch (type) {
+    case IFJ_TYPE_NIL:
+        return "nil";
+    case IFJ_TYPE_INT:
+        return "int";
+    case IFJ_TYPE_FLOAT:
+        return "float";
+    case IFJ_TYPE_BOOL:
+        return "bool";
+    case IFJ_TYPE_STRING:
+        return "string";
+    default:
+        return "";
+    }
+}
+
+// Function to create a string value with a single reference
+IfjString *ifjStringNew(const char *data, size_t length) {
+    IfjString *string = (IfjString *)malloc(sizeof(IfjString) + length + 1);
+    if (!string) return NULL;
+    string->references = 1;
+    string->length = length;
+    if (length && data) memcpy(string->data, data, length);
+    string->data[length] = '\0';
+    return string;
+}
+
+// Function to add a reference to the string of the value
+void ifjValueRetain(IfjValue *value) {
+    if (value->type == IFJ_TYPE_STRING) value->data.string->references++;
+}
+
+// Function to drop the reference of the value to its string
+void ifjValueRelease(IfjValue *value) {
+    if (value->type == IFJ_TYPE_STRING && --value->data.string->references == 0) free(value->data.string);
+    value->type = IFJ_TYPE_UNDEFINED;
+}
+
+// Function to write the value as WRITE does
+void ifjValueWrite(const IfjValue *value, FILE *output) {
+    switch (value->type) {
+    case IFJ_TYPE_INT:
+        fprintf(output, "%lld", value->data.integer);
+        break;
+    case IFJ_TYPE_FLOAT: {
+        // the exponent is written without its plus sign, e.g. 0x1.5p5
+        char buffer[64];
+        snprintf(buffer, sizeof(buffer), "%a", value->data.real);
+        for (char *c = buffer; *c; c++) {
+            if (*c != '+') fputc(*c, output);
+        }
+        break;
+    }
+    case IFJ_TYPE_BOOL:
+        fputs(value->data.boolean ? "true" : "false", output);
+        break;
+    case IFJ_TYPE_STRING:
+        fwrite(value->data.string->data, 1, value->data.string->length, output);
+        break;
+    default:
+        // nil is written as an empty string
+        break;
+    }
+}
+
+// Function to read a single line without its new line, NULL at the end of the input
+static char *readLine(FILE *input, size_t *length, bool *failed) {
+    size_t capacity = 64;
+    char *line = (char *)malloc(capacity);
+    *failed = line == NULL;
+    if (!line) return NULL;
+
+    int c;
+    *length = 0;
+    while ((c = fgetc(input)) != EOF && c != '\n') {
+        if (*length + 1 == capacity) {
+            char *bigger = (char *)realloc(line, capacity * 2);
+            if (!bigger) {
+                free(line);
+                *failed = true;
+                return NULL;
+            }
+            line = bigger;
+            capacity *= 2;
+        }
+        line[(*length)++] = (char)c;
+    }
+    if (c == EOF && *length == 0) {
+        free(line);
+        return NULL;
+    }
+    line[*length] = '\0';
+    return line;
+}
+
+// Function to read a line of the input as READ does
+bool ifjValueRead(enum IFJCODE_TYPE type, FILE *input, IfjValue *value) {
+    size_t length;
+    bool failed;
+    char *line = readLine(input, &length, &failed);
+    value->type = IFJ_TYPE_NIL;
+    if (!line) return !failed;
+
+    if (type == IFJ_TYPE_STRING) {
+        IfjString *string = ifjStringNew(line, length);
+        free(line);
+        if (!string) return false;
+        value->type = IFJ_TYPE_STRING;
+        value->data.string = string;
+        return true;
+    }
+
+    // the numbers may be surrounded by white space
+    char *start = line;
+    while (isspace((unsigned char)*start)) start++;
+    char *stop = line + length;
+    while (stop > start && isspace((unsigned char)stop[-1])) *--stop = '\0';
+
+    char *end = NULL;
+    errno = 0;
+    if (type == IFJ_TYPE_INT) {
+        long long integer = strtoll(start, &end, 10);
+        if (end != start && *end == '\0' && errno != ERANGE) {
+            value->type = IFJ_TYPE_INT;
+            value->data.integer = integer;
+        }
+    } else if (type == IFJ_TYPE_FLOAT) {
+        double real = strtod(start, &end);
+        if (end != start && *end == '\0') {
+            value->type = IFJ_TYPE_FLOAT;
+            value->data.real = real;
+        }
+    } else if (type == IFJ_TYPE_BOOL) {
+        value->type = IFJ_TYPE_BOOL;
+        value->data.boolean = tokenIs(start, strlen(start), "true");
+    }
+    free(line);
+    return true;
+}
@@ -0,0 +1,801 @@
+/** AUTHOR
+ *
+ * @author agent <agent@local>
+ * @file interpreter.c
+ * @date 19.10.2026
+ * @brief Implementation of the reference interpreter of IFJcode24
+ */
+
+#include <limits.h>
+#include <math.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef USE_CUSTOM_STRUCTURE
+#include "interpreter/interpreter.h"
+#else
+#include "interpreter.h"
+#endif
+
+// Function to prepare the counts for the program
+bool interpreterCountsInit(InterpreterCounts *counts, const IfjCode *code) {
+    memset(counts, 0, sizeof(InterpreterCounts));
+    counts->instructions = (size_t *)calloc(code->size + 1, sizeof(size_t));
+    counts->calls = (size_t *)calloc(code->labelCount + 1, sizeof(size_t));
+    if (counts->instructions && counts->calls) return true;
+    interpreterCountsFree(counts);
+    return false;
+}
+
+// Function to free the counts
+void interpreterCountsFree(InterpreterCounts *counts) {
+    free(counts->instructions);
+    free(counts->calls);
+    counts->instructions = NULL;
+    counts->calls = NULL;
+}
+
+// Struct for a single row of the printed counts
+typedef struct InterpreterCountsRow {
+    const char *name; // name of the opcode, the function or the label
+    size_t count; // executed instructions
+    size_t calls; // CALLs of a function
+} InterpreterCountsRow;
+
+// Function to order the rows by their count, the most executed first
+static int compareRows(const void *a, const void *b) {
+    const InterpreterCountsRow *first = (const InterpreterCountsRow *)a;
+    const InterpreterCountsRow *second = (const InterpreterCountsRow *)b;
+    if (first->count != second->count) return first->count < second->count ? 1 : -1;
+    return strcmp(first->name, second->name);
+}
+
+// Function to print a section of the rows, only the executed ones
+static void printRows(FILE *output, const char *title, InterpreterCountsRow *rows, size_t count, size_t executed, bool json,
+                      bool calls, bool last) {
+    qsort(rows, count, sizeof(InterpreterCountsRow), compareRows);
+    if (json) fprintf(output, "  \"%s\": [", title);
+    else fprintf(output, "\n%-40s %14s %8s%s\n", title, "instructions", "share", calls ? "      calls" : "");
+
+    bool first = true;
+    for (size_t i = 0; i < count; i++) {
+        if (rows[i].count == 0 && rows[i].calls == 0) continue;
+        if (json) {
+            fprintf(output, "%s{\"name\": \"%s\", \"instructions\": %zu", first ? "" : ", ", rows[i].name, rows[i].count);
+            if (calls) fprintf(output, ", \"calls\": %zu", rows[i].calls);
+            fputc('}', output);
+        } else {
+            fprintf(output, "%-40s %14zu %7.2f%%", rows[i].name, rows[i].count, executed ? 100.0 * rows[i].count / executed : 0.0);
+            if (calls) fprintf(output, " %10zu", rows[i].calls);
+            fputc('\n', output);
+        }
+        first = false;
+    }
+    if (json) fprintf(output, "]%s\n", last ? "" : ",");
+}
+
+// Function to print the counts per opcode, per function and per label
+void interpreterCountsPrint(const InterpreterCounts *counts, const IfjCode *code, FILE *output, bool json) {
+    size_t size = code->labelCount + 1 > IFJCODE_OPCODE_COUNT ? code->labelCount + 1 : IFJCODE_OPCODE_COUNT;
+    InterpreterCountsRow *rows = (InterpreterCountsRow *)calloc(size, sizeof(InterpreterCountsRow));
+    if (!rows) return;
+
+    if (json) fprintf(output, "{\n  \"executed\": %zu, \"max_stack\": %zu, \"max_calls\": %zu,\n", counts->executed,
+                      counts->maxStack, counts->maxCalls);
+    else fprintf(output, "executed instructions: %zu, deepest data stack: %zu, deepest call stack: %zu\n", counts->executed,
+                 counts->maxStack, counts->maxCalls);
+
+    for (int i = 0; i < IFJCODE_OPCODE_COUNT; i++) {
+        rows[i] = (InterpreterCountsRow){ifjCodeOpcodeName((enum IFJCODE_OPCODE)i), counts->opcodes[i], 0};
+    }
+    printRows(output, "opcodes", rows, IFJCODE_OPCODE_COUNT, counts->executed, json, false, false);
+
+    // the last row holds the instructions outside of any function or before the first label
+    for (int pass = 0; pass < 2; pass++) {
+        bool functions = pass == 0;
+        for (size_t i = 0; i <= code->labelCount; i++) {
+            rows[i] = (InterpreterCountsRow){i < code->labelCount ? code->labels[i].name : "(top)", 0, 0};
+            if (functions && i < code->labelCount) rows[i].calls = counts->calls[i];
+        }
+        for (size_t i = 0; i < code->size; i++) {
+            size_t owner = functions ? code->instructions[i].function : code->instructions[i].label;
+            rows[owner == IFJCODE_NO_LABEL ? code->labelCount : owner].count += counts->instructions[i];
+        }
+        printRows(output, functions ? "functions" : "labels", rows, code->labelCount + 1, counts->executed, json, functions, !functions);
+    }
+    if (json) fprintf(output, "}\n");
+    free(rows);
+}
+
+// Function to prepare a run of the program
+void interpreterInit(Interpreter *interpreter, const IfjCode *code, FILE *input, FILE *output, InterpreterCounts *counts) {
+    memset(interpreter, 0, sizeof(Interpreter));
+    interpreter->code = code;
+    interpreter->input = input;
+    interpreter->output = output;
+    interpreter->counts = counts;
+}
+
+// Function to free the variables of a frame
+static void frameFree(InterpreterFrame *frame) {
+    if (!frame) return;
+    for (size_t i = 0; i < frame->capacity; i++) {
+        if (frame->symbols[i]) ifjValueRelease(&frame->values[i]);
+    }
+    free(frame->symbols);
+    free(frame->values);
+    memset(frame, 0, sizeof(InterpreterFrame));
+}
+
+// Function to free the frames and the stacks of the run
+void interpreterFree(Interpreter *interpreter) {
+    frameFree(&interpreter->global);
+    frameFree(interpreter->temporary);
+    free(interpreter->temporary);
+    for (size_t i = 0; i < interpreter->localCount; i++) {
+        frameFree(interpreter->locals[i]);
+        free(interpreter->locals[i]);
+    }
+    free(interpreter->locals);
+    for (size_t i = 0; i < interpreter->stackSize; i++) ifjValueRelease(&interpreter->stack[i]);
+    free(interpreter->stack);
+    free(interpreter->calls);
+    interpreter->temporary = NULL;
+    interpreter->locals = NULL;
+    interpreter->stack = NULL;
+    interpreter->calls = NULL;
+    interpreter->localCount = interpreter->stackSize = interpreter->callCount = 0;
+}
+
+// Function to describe a runtime error, the line of the current instruction is added
+static int runtimeError(Interpreter *interpreter, int error, const char *format, ...) {
+    const IfjInstruction *instruction = &interpreter->code->instructions[interpreter->pc];
+    int written = snprintf(interpreter->diagnostic, IFJCODE_DIAGNOSTIC_LENGTH, "line %zu, %s: ", instruction->line,
+                           ifjCodeOpcodeName(instruction->opcode));
+    if (written < 0 || written >= IFJCODE_DIAGNOSTIC_LENGTH) return error;
+
+    va_list args;
+    va_start(args, format);
+    vsnprintf(interpreter->diagnostic + written, IFJCODE_DIAGNOSTIC_LENGTH - written, format, args);
+    va_end(args);
+    return error;
+}
+
+// Function to find the slot of a variable, the empty slot for a new one
+static size_t frameSlot(const InterpreterFrame *frame, size_t symbol) {
+    size_t slot = (symbol * 2654435761u) & (frame->capacity - 1);
+    while (frame->symbols[slot] && frame->symbols[slot] != symbol + 1) slot = (slot + 1) & (frame->capacity - 1);
+    return slot;
+}
+
+// Function to find a defined variable of the frame, NULL if it is not defined
+static IfjValue *frameFind(const InterpreterFrame *frame, size_t symbol) {
+    if (frame->capacity == 0) return NULL;
+    size_t slot = frameSlot(frame, symbol);
+    return frame->symbols[slot] ? &frame->values[slot] : NULL;
+}
+
+// Function to double the slots of the frame, every variable is placed again
+static bool frameGrow(InterpreterFrame *frame) {
+    InterpreterFrame grown = {.capacity = frame->capacity ? frame->capacity * 2 : 16, .count = frame->count};
+    grown.symbols = (size_t *)calloc(grown.capacity, sizeof(size_t));
+    grown.values = (IfjValue *)malloc(grown.capacity * sizeof(IfjValue));
+    if (!grown.symbols || !grown.values) {
+        free(grown.symbols);
+        free(grown.values);
+        return false;
+    }
+
+    for (size_t i = 0; i < frame->capacity; i++) {
+        if (!frame->symbols[i]) continue;
+        size_t slot = frameSlot(&grown, frame->symbols[i] - 1);
+        grown.symbols[slot] = frame->symbols[i];
+        grown.values[slot] = frame->values[i];
+    }
+    free(frame->symbols);
+    free(frame->values);
+    *frame = grown;
+    return true;
+}
+
+// Function to get the frame of a variable operand
+static int getFrame(Interpreter *interpreter, const IfjOperand *operand, InterpreterFrame **frame) {
+    switch (operand->frame) {
+    case FRAME_GLOBAL:
+        *frame = &interpreter->global;
+        return IFJCODE_SUCCESS;
+    case FRAME_LOCAL:
+        if (interpreter->localCount == 0) return runtimeError(interpreter, IFJCODE_E_FRAME, "the local frame does not exist");
+        *frame = interpreter->locals[interpreter->localCount - 1];
+        return IFJCODE_SUCCESS;
+    default:
+        if (!interpreter->temporary) return runtimeError(interpreter, IFJCODE_E_FRAME, "the temporary frame does not exist");
+        *frame = interpreter->temporary;
+        return IFJCODE_SUCCESS;
+    }
+}
+
+// Function to define a new variable
+static int defineVariable(Interpreter *interpreter, const IfjOperand *operand) {
+    InterpreterFrame *frame;
+    int error = getFrame(interpreter, operand, &frame);
+    if (error) return error;
+
+    if (frameFind(frame, operand->symbol))
+        return runtimeError(interpreter, IFJCODE_E_SEMANTIC, "redefinition of %s", interpreter->code->symbols[operand->symbol]);
+    if ((frame->count + 1) * 2 > frame->capacity && !frameGrow(frame)) return runtimeError(interpreter, IFJCODE_E_INTERNAL, "out of memory");
+
+    size_t slot = frameSlot(frame, operand->symbol);
+    frame->symbols[slot] = operand->symbol + 1;
+    frame->values[slot].type = IFJ_TYPE_UNDEFINED;
+    frame->count++;
+    return IFJCODE_SUCCESS;
+}
+
+// Function to get a defined variable, it may be uninitialized
+static int getVariable(Interpreter *interpreter, const IfjOperand *operand, IfjValue **value) {
+    InterpreterFrame *frame;
+    int error = getFrame(interpreter, operand, &frame);
+    if (error) return error;
+
+    *value = frameFind(frame, operand->symbol);
+    if (!*value) return runtimeError(interpreter, IFJCODE_E_UNDEFINED_VAR, "undefined variable %s", interpreter->code->symbols[operand->symbol]);
+    return IFJCODE_SUCCESS;
+}
+
+// Function to get the value of a symbol, a variable has to be initialized
+static int getSymbol(Interpreter *interpreter, const IfjOperand *operand, const IfjValue **value) {
+    if (operand->kind == OPERAND_CONSTANT) {
+        *value = &operand->value;
+        return IFJCODE_SUCCESS;
+    }
+
+    IfjValue *variable;
+    int error = getVariable(interpreter, operand, &variable);
+    if (error) return error;
+    if (variable->type == IFJ_TYPE_UNDEFINED)
+        return runtimeError(interpreter, IFJCODE_E_MISSING_VALUE, "uninitialized variable %s", interpreter->code->symbols[operand->symbol]);
+    *value = variable;
+    return IFJCODE_SUCCESS;
+}
+
+// Function to store a new value into a variable, the value is moved into it
+static int setVariable(Interpreter *interpreter, const IfjOperand *operand, IfjValue *value) {
+    IfjValue *variable;
+    int error = getVariable(interpreter, operand, &variable);
+    if (error) {
+        ifjValueRelease(value);
+        return error;
+    }
+    ifjValueRelease(variable);
+    *variable = *value;
+    return IFJCODE_SUCCESS;
+}
+
+// Function to push a value onto the data stack, the value is moved onto it
+static int pushValue(Interpreter *interpreter, IfjValue *value) {
+    if (interpreter->stackSize == interpreter->stackCapacity) {
+        size_t capacity = interpreter->stackCapacity ? interpreter->stackCapacity * 2 : 64;
+        IfjValue *stack = (IfjValue *)realloc(interpreter->stack, capacity * sizeof(IfjValue));
+        if (!stack) {
+            ifjValueRelease(value);
+            return runtimeError(interpreter, IFJCODE_E_INTERNAL, "out of memory");
+        }
+        interpreter->stack = stack;
+        interpreter->stackCapacity = capacity;
+    }
+    interpreter->stack[interpreter->stackSize++] = *value;
+    if (interpreter->counts && interpreter->stackSize > interpreter->counts->maxStack) interpreter->counts->maxStack = interpreter->stackSize;
+    return IFJCODE_SUCCESS;
+}
+
+// Function to pop a value from the data stack, the caller owns it
+static int popValue(Interpreter *interpreter, IfjValue *value) {
+    if (interpreter->stackSize == 0) return runtimeError(interpreter, IFJCODE_E_MISSING_VALUE, "the data stack is empty");
+    *value = interpreter->stack[--interpreter->stackSize];
+    return IFJCODE_SUCCESS;
+}
+
+// Function to make a string value
+static int makeString(Interpreter *interpreter, const char *data, size_t length, IfjValue *result) {
+    IfjString *string = ifjStringNew(data, length);
+    if (!string) return runtimeError(interpreter, IFJCODE_E_INTERNAL, "out of memory");
+    result->type = IFJ_TYPE_STRING;
+    result->data.string = string;
+    return IFJCODE_SUCCESS;
+}
+
+// Function to compute the arithmetic of ADD, SUB, MUL, DIV and IDIV, the ints wrap around
+static int arithmetic(Interpreter *interpreter, enum IFJCODE_OPCODE opcode, const IfjValue *a, const IfjValue *b, IfjValue *result) {
+    bool ints = a->type == IFJ_TYPE_INT && b->type == IFJ_TYPE_INT;
+    bool floats = a->type == IFJ_TYPE_FLOAT && b->type == IFJ_TYPE_FLOAT;
+    if ((opcode == OP_IDIV && !ints) || (opcode == OP_DIV && !floats) || (!ints && !floats))
+        return runtimeError(interpreter, IFJCODE_E_OPERAND_TYPE, "wrong operands %s and %s", ifjCodeTypeName(a->type), ifjCodeTypeName(b->type));
+
+    result->type = a->type;
+    if (floats) {
+        double x = a->data.real, y = b->data.real;
+        if (opcode == OP_DIV && y == 0.0) return runtimeError(interpreter, IFJCODE_E_OPERAND_VALUE, "division by zero");
+        result->data.real = opcode == OP_ADD ? x + y : opcode == OP_SUB ? x - y : opcode == OP_MUL ? x * y : x / y;
+        return IFJCODE_SUCCESS;
+    }
+
+    unsigned long long x = (unsigned long long)a->data.integer, y = (unsigned long long)b->data.integer;
+    switch (opcode) {
+    case OP_ADD:
+        result->data.integer = (long long)(x + y);
+        break;
+    case OP_SUB:
+        result->data.integer = (long long)(x - y);
+        break;
+    case OP_MUL:
+        result->data.integer = (long long)(x * y);
+        break;
+    default:
+        if (b->data.integer == 0) return runtimeError(interpreter, IFJCODE_E_OPERAND_VALUE, "division by zero");
+        if (a->data.integer == LLONG_MIN && b->data.integer == -1) result->data.integer = LLONG_MIN;
+        else result->data.integer = a->data.integer / b->data.integer;
+        break;
+    }
+    return IFJCODE_SUCCESS;
+}
+
+// Function to compare the values of the same type, returns -1, 0 or 1
+static int compareValues(const IfjValue *a, const IfjValue *b) {
+    switch (a->type) {
+    case IFJ_TYPE_INT:
+        return (a->data.integer > b->data.integer) - (a->data.integer < b->data.integer);
+    case IFJ_TYPE_FLOAT:
+        return (a->data.real > b->data.real) - (a->data.real < b->data.real);
+    case IFJ_TYPE_BOOL:
+        return (int)a->data.boolean - (int)b->data.boolean;
+    case IFJ_TYPE_STRING: {
+        IfjString *x = a->data.string, *y = b->data.string;
+        int order = memcmp(x->data, y->data, x->length < y->length ? x->length : y->length);
+        if (order) return order < 0 ? -1 : 1;
+        return (x->length > y->length) - (x->length < y->length);
+    }
+    default:
+        return 0;
+    }
+}
+
+// Function to test the equality of EQ and the conditional jumps, nil can be compared with anything
+static int equality(Interpreter *interpreter, const IfjValue *a, const IfjValue *b, bool *equal) {
+    if (a->type == IFJ_TYPE_NIL || b->type == IFJ_TYPE_NIL) {
+        *equal = a->type == b->type;
+        return IFJCODE_SUCCESS;
+    }
+    if (a->type != b->type)
+        return runtimeError(interpreter, IFJCODE_E_OPERAND_TYPE, "comparing %s with %s", ifjCodeTypeName(a->type), ifjCodeTypeName(b->type));
+    *equal = compareValues(a, b) == 0;
+    return IFJCODE_SUCCESS;
+}
+
+// Function to compute the relations of LT, GT and EQ
+static int relation(Interpreter *interpreter, enum IFJCODE_OPCODE opcode, const IfjValue *a, const IfjValue *b, IfjValue *result) {
+    result->type = IFJ_TYPE_BOOL;
+    if (opcode == OP_EQ) return equality(interpreter, a, b, &result->data.boolean);
+
+    if (a->type != b->type || a->type == IFJ_TYPE_NIL)
+        return runtimeError(interpreter, IFJCODE_E_OPERAND_TYPE, "comparing %s with %s", ifjCodeTypeName(a->type), ifjCodeTypeName(b->type));
+    int order = compareValues(a, b);
+    result->data.boolean = opcode == OP_LT ? order < 0 : order > 0;
+    return IFJCODE_SUCCESS;
+}
+
+// Function to compute the logic of AND and OR
+static int logic(Interpreter *interpreter, enum IFJCODE_OPCODE opcode, const IfjValue *a, const IfjValue *b, IfjValue *result) {
+    if (a->type != IFJ_TYPE_BOOL || b->type != IFJ_TYPE_BOOL)
+        return runtimeError(interpreter, IFJCODE_E_OPERAND_TYPE, "wrong operands %s and %s", ifjCodeTypeName(a->type), ifjCodeTypeName(b->type));
+    result->type = IFJ_TYPE_BOOL;
+    result->data.boolean = opcode == OP_AND ? a->data.boolean && b->data.boolean : a->data.boolean || b->data.boolean;
+    return IFJCODE_SUCCESS;
+}
+
+// Function to compute the binary operations, the opcode is the one of the three address form
+static int binary(Interpreter *interpreter, enum IFJCODE_OPCODE opcode, const IfjValue *a, const IfjValue *b, IfjValue *result) {
+    switch (opcode) {
+    case OP_ADD:
+    case OP_SUB:
+    case OP_MUL:
+    case OP_DIV:
+    case OP_IDIV:
+        return arithmetic(interpreter, opcode, a, b, result);
+    case OP_LT:
+    case OP_GT:
+    case OP_EQ:
+        return relation(interpreter, opcode, a, b, result);
+    case OP_AND:
+    case OP_OR:
+        return logic(interpreter, opcode, a, b, result);
+    case OP_STRI2INT:
+        if (a->type != IFJ_TYPE_STRING || b->type != IFJ_TYPE_INT)
+            return runtimeError(interpreter, IFJCODE_E_OPERAND_TYPE, "wrong operands %s and %s", ifjCodeTypeName(a->type), ifjCodeTypeName(b->type));
+        if (b->data.integer < 0 || (unsigned long long)b->data.integer >= a->data.string->length)
+            return runtimeError(interpreter, IFJCODE_E_STRING, "index %lld out of the string", b->data.integer);
+        result->type = IFJ_TYPE_INT;
+        result->data.integer = (unsigned char)a->data.string->data[b->data.integer];
+        return IFJCODE_SUCCESS;
+    case OP_CONCAT: {
+        if (a->type != IFJ_TYPE_STRING || b->type != IFJ_TYPE_STRING)
+            return runtimeError(interpreter, IFJCODE_E_OPERAND_TYPE, "wrong operands %s and %s", ifjCodeTypeName(a->type), ifjCodeTypeName(b->type));
+        IfjString *x = a->data.string, *y = b->data.string;
+        int error = makeString(interpreter, NULL, x->length + y->length, result);
+        if (error) return error;
+        memcpy(result->data.string->data, x->data, x->length);
+        memcpy(result->data.string->data + x->length, y->data, y->length);
+        result->data.string->data[x->length + y->length] = '\0';
+        return IFJCODE_SUCCESS;
+    }
+    default:
+        // GETCHAR
+        if (a->type != IFJ_TYPE_STRING || b->type != IFJ_TYPE_INT)
+            return runtimeError(interpreter, IFJCODE_E_OPERAND_TYPE, "wrong operands %s and %s", ifjCodeTypeName(a->type), ifjCodeTypeName(b->type));
+        if (b->data.integer < 0 || (unsigned long long)b->data.integer >= a->data.string->length)
+            return runtimeError(interpreter, IFJCODE_E_STRING, "index %lld out of the string", b->data.integer);
+        return makeString(interpreter, a->data.string->data + b->data.integer, 1, result);
+    }
+}
+
+// Function to compute the unary operations NOT, INT2FLOAT, FLOAT2INT, INT2CHAR, STRLEN and TYPE
+static int unary(Interpreter *interpreter, enum IFJCODE_OPCODE opcode, const IfjValue *a, IfjValue *result) {
+    enum IFJCODE_TYPE expected = opcode == OP_NOT ? IFJ_TYPE_BOOL : opcode == OP_FLOAT2INT ? IFJ_TYPE_FLOAT : opcode == OP_STRLEN ? IFJ_TYPE_STRING : IFJ_TYPE_INT;
+    if (opcode != OP_TYPE && a->type != expected)
+        return runtimeError(interpreter, IFJCODE_E_OPERAND_TYPE, "wrong operand %s, expected %s", ifjCodeTypeName(a->type), ifjCodeTypeName(expected));
+
+    switch (opcode) {
+    case OP_NOT:
+        result->type = IFJ_TYPE_BOOL;
+        result->data.boolean = !a->data.boolean;
+        return IFJCODE_SUCCESS;
+    case OP_INT2FLOAT:
+        result->type = IFJ_TYPE_FLOAT;
+        result->data.real = (double)a->data.integer;
+        return IFJCODE_SUCCESS;
+    case OP_FLOAT2INT:
+        if (!isfinite(a->data.real) || a->data.real >= 9223372036854775808.0 || a->data.real < -9223372036854775808.0)
+            return runtimeError(interpreter, IFJCODE_E_OPERAND_VALUE, "%a does not fit into an int", a->data.real);
+        result->type = IFJ_TYPE_INT;
+        result->data.integer = (long long)a->data.real;
+        return IFJCODE_SUCCESS;
+    case OP_INT2CHAR: {
+        if (a->data.integer < 0 || a->data.integer > 255)
+            return runtimeError(interpreter, IFJCODE_E_STRING, "%lld is not a character", a->data.integer);
+        char character = (char)a->data.integer;
+        return makeString(interpreter, &character, 1, result);
+    }
+    case OP_STRLEN:
+        result->type = IFJ_TYPE_INT;
+        result->data.integer = (long long)a->data.string->length;
+        return IFJCODE_SUCCESS;
+    default: {
+        // TYPE, an uninitialized variable is an empty string
+        const char *name = ifjCodeTypeName(a->type);
+        return makeString(interpreter, name, strlen(name), result);
+    }
+    }
+}
+
+// Function to get the three address form of a stack instruction
+static enum IFJCODE_OPCODE stackOpcode(enum IFJCODE_OPCODE opcode) {
+    switch (opcode) {
+    case OP_ADDS:
+        return OP_ADD;
+    case OP_SUBS:
+        return OP_SUB;
+    case OP_MULS:
+        return OP_MUL;
+    case OP_DIVS:
+        return OP_DIV;
+    case OP_IDIVS:
+        return OP_IDIV;
+    case OP_LTS:
+        return OP_LT;
+    case OP_GTS:
+        return OP_GT;
+    case OP_EQS:
+        return OP_EQ;
+    case OP_ANDS:
+        return OP_AND;
+    case OP_ORS:
+        return OP_OR;
+    case OP_NOTS:
+        return OP_NOT;
+    case OP_INT2FLOATS:
+        return OP_INT2FLOAT;
+    case OP_FLOAT2INTS:
+        return OP_FLOAT2INT;
+    case OP_INT2CHARS:
+        return OP_INT2CHAR;
+    case OP_STRI2INTS:
+        return OP_STRI2INT;
+    default:
+        return opcode;
+    }
+}
+
+// Function to run a stack instruction, the operands are popped and the result is pushed
+static int runStackInstruction(Interpreter *interpreter, enum IFJCODE_OPCODE opcode) {
+    enum IFJCODE_OPCODE base = stackOpcode(opcode);
+    bool single = base == OP_NOT || base == OP_INT2FLOAT || base == OP_FLOAT2INT || base == OP_INT2CHAR;
+
+    IfjValue a = {.type = IFJ_TYPE_UNDEFINED}, b = {.type = IFJ_TYPE_UNDEFINED}, result = {.type = IFJ_TYPE_UNDEFINED};
+    int error = popValue(interpreter, &b);
+    if (!error && !single) error = popValue(interpreter, &a);
+    if (!error) error = single ? unary(interpreter, base, &b, &result) : binary(interpreter, base, &a, &b, &result);
+    ifjValueRelease(&a);
+    ifjValueRelease(&b);
+    if (error) return error;
+    return pushValue(interpreter, &result);
+}
+
+// Function to run SETCHAR, the character is replaced in a copy, if the string is shared
+static int runSetChar(Interpreter *interpreter, const IfjInstruction *instruction) {
+    IfjValue *variable;
+    const IfjValue *index, *character;
+    int error = getVariable(interpreter, &instruction->operands[0], &variable);
+    if (!error) error = getSymbol(interpreter, &instruction->operands[1], &index);
+    if (!error) error = getSymbol(interpreter, &instruction->operands[2], &character);
+    if (error) return error;
+
+    if (variable->type == IFJ_TYPE_UNDEFINED) return runtimeError(interpreter, IFJCODE_E_MISSING_VALUE, "uninitialized variable");
+    if (variable->type != IFJ_TYPE_STRING || index->type != IFJ_TYPE_INT || character->type != IFJ_TYPE_STRING)
+        return runtimeError(interpreter, IFJCODE_E_OPERAND_TYPE, "wrong operands");
+    IfjString *string = variable->data.string;
+    if (index->data.integer < 0 || (unsigned long long)index->data.integer >= string->length || character->data.string->length == 0)
+        return runtimeError(interpreter, IFJCODE_E_STRING, "index %lld out of the string", index->data.integer);
+
+    if (string->references > 1) {
+        IfjValue copy;
+        error = makeString(interpreter, string->data, string->length, &copy);
+        if (error) return error;
+        ifjValueRelease(variable);
+        *variable = copy;
+        string = copy.data.string;
+    }
+    string->data[index->data.integer] = character->data.string->data[0];
+    return IFJCODE_SUCCESS;
+}
+
+// Function to print the state of the run for BREAK
+static void printState(Interpreter *interpreter) {
+    fprintf(stderr, "BREAK at line %zu: instruction %zu, global variables %zu, temporary frame %s, frame stack %zu, "
+            "data stack %zu, call stack %zu", interpreter->code->instructions[interpreter->pc].line, interpreter->pc,
+            interpreter->global.count, interpreter->temporary ? "defined" : "undefined", interpreter->localCount,
+            interpreter->stackSize, interpreter->callCount);
+    if (interpreter->counts) fprintf(stderr, ", executed %zu", interpreter->counts->executed);
+    fputc('\n', stderr);
+}
+
+// Function to run the frame instructions
+static int runFrameInstruction(Interpreter *interpreter, enum IFJCODE_OPCODE opcode) {
+    switch (opcode) {
+    case OP_CREATEFRAME: {
+        InterpreterFrame *frame = (InterpreterFrame *)calloc(1, sizeof(InterpreterFrame));
+        if (!frame) return runtimeError(interpreter, IFJCODE_E_INTERNAL, "out of memory");
+        frameFree(interpreter->temporary);
+        free(interpreter->temporary);
+        interpreter->temporary = frame;
+        return IFJCODE_SUCCESS;
+    }
+    case OP_PUSHFRAME:
+        if (!interpreter->temporary) return runtimeError(interpreter, IFJCODE_E_FRAME, "the temporary frame does not exist");
+        if (interpreter->localCount == interpreter->localCapacity) {
+            size_t capacity = interpreter->localCapacity ? interpreter->localCapacity * 2 : 16;
+            InterpreterFrame **locals = (InterpreterFrame **)realloc(interpreter->locals, capacity * sizeof(InterpreterFrame *));
+            if (!locals) return runtimeError(interpreter, IFJCODE_E_INTERNAL, "out of memory");
+            interpreter->locals = locals;
+            interpreter->localCapacity = capacity;
+        }
+        interpreter->locals[interpreter->localCount++] = interpreter->temporary;
+        interpreter->temporary = NULL;
+        return IFJCODE_SUCCESS;
+    default:
+        // POPFRAME
+        if (interpreter->localCount == 0) return runtimeError(interpreter, IFJCODE_E_FRAME, "the local frame does not exist");
+        frameFree(interpreter->temporary);
+        free(interpreter->temporary);
+        interpreter->temporary = interpreter->locals[--interpreter->localCount];
+        return IFJCODE_SUCCESS;
+    }
+}
+
+// Function to run CALL and RETURN
+static int runCallInstruction(Interpreter *interpreter, const IfjInstruction *instruction) {
+    if (instruction->opcode == OP_RETURN) {
+        if (interpreter->callCount == 0) return runtimeError(interpreter, IFJCODE_E_MISSING_VALUE, "the call stack is empty");
+        interpreter->pc = interpreter->calls[--interpreter->callCount];
+        return IFJCODE_SUCCESS;
+    }
+
+    if (interpreter->callCount == interpreter->callCapacity) {
+        size_t capacity = interpreter->callCapacity ? interpreter->callCapacity * 2 : 64;
+        size_t *calls = (size_t *)realloc(interpreter->calls, capacity * sizeof(size_t));
+        if (!calls) return runtimeError(interpreter, IFJCODE_E_INTERNAL, "out of memory");
+        interpreter->calls = calls;
+        interpreter->callCapacity = capacity;
+    }
+    interpreter->calls[interpreter->callCount++] = interpreter->pc + 1;
+    interpreter->pc = instruction->operands[0].target;
+
+    InterpreterCounts *counts = interpreter->counts;
+    if (counts) {
+        counts->calls[instruction->operands[0].symbol]++;
+        if (interpreter->callCount > counts->maxCalls) counts->maxCalls = interpreter->callCount;
+    }
+    return IFJCODE_SUCCESS;
+}
+
+// Function to run the conditional jumps, the stack forms compare the two values on the stack
+static int runJump(Interpreter *interpreter, const IfjInstruction *instruction, bool *jumped) {
+    enum IFJCODE_OPCODE opcode = instruction->opcode;
+    IfjValue first = {.type = IFJ_TYPE_UNDEFINED}, second = {.type = IFJ_TYPE_UNDEFINED};
+    const IfjValue *a = &first, *b = &second;
+    int error;
+
+    if (opcode == OP_JUMPIFEQS || opcode == OP_JUMPIFNEQS) {
+        error = popValue(interpreter, &second);
+        if (!error) error = popValue(interpreter, &first);
+    } else {
+        error = getSymbol(interpreter, &instruction->operands[1], &a);
+        if (!error) error = getSymbol(interpreter, &instruction->operands[2], &b);
+    }
+
+    bool equal = false;
+    if (!error) error = equality(interpreter, a, b, &equal);
+    ifjValueRelease(&first);
+    ifjValueRelease(&second);
+
+    *jumped = (opcode == OP_JUMPIFEQ || opcode == OP_JUMPIFEQS) ? equal : !equal;
+    if (!error && *jumped) interpreter->pc = instruction->operands[0].target;
+    return error;
+}
+
+// Function to run a single instruction, the pc is moved by the caller, unless the instruction jumps
+static int runInstruction(Interpreter *interpreter, const IfjInstruction *instruction, bool *jumped) {
+    const IfjOperand *operands = instruction->operands;
+    enum IFJCODE_OPCODE opcode = instruction->opcode;
+    const IfjValue *a, *b;
+    IfjValue result = {.type = IFJ_TYPE_UNDEFINED};
+    int error;
+
+    *jumped = false;
+    switch (opcode) {
+    case OP_MOVE:
+        error = getSymbol(interpreter, &operands[1], &a);
+        if (error) return error;
+        result = *a;
+        ifjValueRetain(&result);
+        return setVariable(interpreter, &operands[0], &result);
+    case OP_CREATEFRAME:
+    case OP_PUSHFRAME:
+    case OP_POPFRAME:
+        return runFrameInstruction(interpreter, opcode);
+    case OP_DEFVAR:
+        return defineVariable(interpreter, &operands[0]);
+    case OP_CALL:
+    case OP_RETURN:
+        *jumped = true;
+        return runCallInstruction(interpreter, instruction);
+    case OP_PUSHS:
+        error = getSymbol(interpreter, &operands[0], &a);
+        if (error) return error;
+        result = *a;
+        ifjValueRetain(&result);
+        return pushValue(interpreter, &result);
+    case OP_POPS:
+        error = popValue(interpreter, &result);
+        if (error) return error;
+        return setVariable(interpreter, &operands[0], &result);
+    case OP_CLEARS:
+        while (interpreter->stackSize) ifjValueRelease(&interpreter->stack[--interpreter->stackSize]);
+        return IFJCODE_SUCCESS;
+    case OP_ADD:
+    case OP_SUB:
+    case OP_MUL:
+    case OP_DIV:
+    case OP_IDIV:
+    case OP_LT:
+    case OP_GT:
+    case OP_EQ:
+    case OP_AND:
+    case OP_OR:
+    case OP_STRI2INT:
+    case OP_CONCAT:
+    case OP_GETCHAR:
+        error = getSymbol(interpreter, &operands[1], &a);
+        if (!error) error = getSymbol(interpreter, &operands[2], &b);
+        if (!error) error = binary(interpreter, opcode, a, b, &result);
+        if (error) return error;
+        return setVariable(interpreter, &operands[0], &result);
+    case OP_NOT:
+    case OP_INT2FLOAT:
+    case OP_FLOAT2INT:
+    case OP_INT2CHAR:
+    case OP_STRLEN:
+        error = getSymbol(interpreter, &operands[1], &a);
+        if (!error) error = unary(interpreter, opcode, a, &result);
+        if (error) return error;
+        return setVariable(interpreter, &operands[0], &result);
+    case OP_TYPE: {
+        // the type of an uninitialized variable is an empty string
+        IfjValue *variable = NULL;
+        if (operands[1].kind == OPERAND_CONSTANT) a = &operands[1].value;
+        else if ((error = getVariable(interpreter, &operands[1], &variable))) return error;
+        else a = variable;
+        error = unary(interpreter, opcode, a, &result);
+        if (error) return error;
+        return setVariable(interpreter, &operands[0], &result);
+    }
+    case OP_READ:
+        if (!ifjValueRead(operands[1].value.type, interpreter->input, &result)) return runtimeError(interpreter, IFJCODE_E_INTERNAL, "out of memory");
+        return setVariable(interpreter, &operands[0], &result);
+    case OP_WRITE:
+    case OP_DPRINT:
+        error = getSymbol(interpreter, &operands[0], &a);
+        if (error) return error;
+        ifjValueWrite(a, opcode == OP_WRITE ? interpreter->output : stderr);
+        return IFJCODE_SUCCESS;
+    case OP_SETCHAR:
+        return runSetChar(interpreter, instruction);
+    case OP_LABEL:
+        return IFJCODE_SUCCESS;
+    case OP_JUMP:
+        *jumped = true;
+        interpreter->pc = operands[0].target;
+        return IFJCODE_SUCCESS;
+    case OP_JUMPIFEQ:
+    case OP_JUMPIFNEQ:
+    case OP_JUMPIFEQS:
+    case OP_JUMPIFNEQS:
+        return runJump(interpreter, instruction, jumped);
+    case OP_BREAK:
+        printState(interpreter);
+        return IFJCODE_SUCCESS;
+    case OP_EXIT:
+        // handled by interpreterRun
+        return IFJCODE_SUCCESS;
+    default:
+        return runStackInstruction(interpreter, opcode);
+    }
+}
+
+// Function to run the program until its EXIT, its end or an error
+int interpreterRun(Interpreter *interpreter) {
+    const IfjCode *code = interpreter->code;
+    InterpreterCounts *counts = interpreter->counts;
+
+    while (interpreter->pc < code->size) {
+        const IfjInstruction *instruction = &code->instructions[interpreter->pc];
+
+        // a LABEL does nothing, it is not counted
+        if (instruction->opcode == OP_LABEL) {
+            interpreter->pc++;
+            continue;
+        }
+        if (counts) {
+            counts->executed++;
+            counts->opcodes[instruction->opcode]++;
+            counts->instructions[interpreter->pc]++;
+        }
+
+        if (instruction->opcode == OP_EXIT) {
+            const IfjValue *value;
+            int error = getSymbol(interpreter, &instruction->operands[0], &value);
+            if (error) return error;
+            if (value->type != IFJ_TYPE_INT) return runtimeError(interpreter, IFJCODE_E_OPERAND_TYPE, "the exit code is not an int");
+            if (value->data.integer < 0 || value->data.integer > 9)
+                return runtimeError(interpreter, IFJCODE_E_OPERAND_VALUE, "the exit code %lld is not 0 - 9", value->data.integer);
+            return (int)value->data.integer;
+        }
+
+        bool jumped;
+        int error = runInstruction(interpreter, instruction, &jumped);
+        if (error) return error;
+        if (!jumped) interpreter->pc++;
+    }
+    return IFJCODE_SUCCESS;
+}
@@ -0,0 +1,152 @@
+/**
+ * @file chunk_lexer.c
+ *
+ * @author agent <agent@local>
+ * @brief Lexes a big source in memory in chunks on more threads, the chunks start only where the scanner is in its start state
+ */
+
+#include <stdlib.h>
+
+#ifdef USE_CUSTOM_STRUCTURE
+#include "lexical/chunk_lexer.h"
+#include "lexical/scanner.h"
+#include "syntaxical/parser.h"
+#include "utility/compiler_context.h"
+#include "utility/work_pool.h"
+#else
+#include "chunk_lexer.h"
+#include "scanner.h"
+#include "parser.h"
+#include "compiler_context.h"
+#include "work_pool.h"
+#endif
+
+// Function to check, if the scanner is surely in its start state at the start of the line
+static bool chunk_lexer_safe_line(const char *source, size_t length, size_t position) {
+    // the multiline string skips spaces on the next line, tabs are skipped too, to be sure
+    while (position < length && (source[position] == ' ' || source[position] == '\t' || source[position] == '\r')) position++;
+    if (position >= length) return false;
+
+    // empty lines and lines, that can continue or end a multiline string
+    char c = source[position];
+    return c != '\n' && c != '\\' && c != ';' && c != ')';
+}
+
+// Function to find the start of the next chunk
+size_t chunk_lexer_next_boundary(const char *source, size_t length, size_t position) {
+    while (position < length) {
+        // start of the next line
+        while (position < length && source[position] != '\n') position++;
+        if (position >= length) return length;
+        position++;
+
+        if (chunk_lexer_safe_line(source, length, position)) return position;
+    }
+    return length;
+}
+
+// Function to add a token to the chunk
+static bool chunk_lexer_push(LexChunk *chunk, struct TOKEN token) {
+    if (chunk->count == chunk->capacity) {
+        size_t capacity = chunk->capacity ? chunk->capacity * 2 : 1024;
+        struct TOKEN *tokens = (struct TOKEN *)realloc(chunk->tokens, capacity * sizeof(struct TOKEN));
+        if (tokens == NULL) return false;
+        chunk->tokens = tokens;
+        chunk->capacity = capacity;
+    }
+    chunk->tokens[chunk->count++] = token;
+    return true;
+}
+
+// Function to lex a single chunk
+void chunk_lexer_task(void *data, size_t index) {
+    LexChunk *chunk = &((LexChunk *)data)[index];
+
+    // every chunk has its own scanner
+    CompilerContext ctx;
+    compilerContextInit(&ctx, NULL, NULL);
+    scanner_init_buffer(chunk->source + chunk->start, chunk->end - chunk->start, &ctx);
+
+    struct TOKEN token;
+    while (true) {
+        enum ERR_CODES status = scanner_get_token(&token, &ctx);
+
+        // the EOF of a chunk in the middle is not the end of the source
+        if (status == SUCCESS && token.type == TOKEN_EOF && !chunk->last) {
+            free(token.value);
+            break;
+        }
+
+        // the token is kept even on error, the same as the first pass does
+        if (!chunk_lexer_push(chunk, token)) {
+            free(token.value);
+            chunk->err = E_INTERNAL;
+            break;
+        }
+        if (status != SUCCESS) {
+            chunk->err = status;
+            chunk->errorPosition = chunk->start + ctx.sourcePosition;
+            break;
+        }
+        if (token.type == TOKEN_EOF) break;
+    }
+}
+
+// Function to lex the source in chunks
+enum ERR_CODES chunk_lexer_tokenize(const char *source, size_t length, unsigned int jobs, size_t chunkSize,
+                                    LinkedList *buffer, size_t *errorPosition) {
+    if (chunkSize == 0) chunkSize = 1;
+
+    // split the source, the boundaries are moved to the lines, where no token can continue
+    size_t count = 0, capacity = length / chunkSize + 1;
+    LexChunk *chunks = (LexChunk *)malloc(capacity * sizeof(LexChunk));
+    if (chunks == NULL) return E_INTERNAL;
+
+    size_t start = 0;
+    while (count == 0 || start < length) {
+        size_t end = (length - start > chunkSize) ? chunk_lexer_next_boundary(source, length, start + chunkSize) : length;
+
+        LexChunk *chunk = &chunks[count++];
+        chunk->source = source;
+        chunk->start = start;
+        chunk->end = end;
+        chunk->last = end == length;
+        chunk->tokens = NULL;
+        chunk->count = 0;
+        chunk->capacity = 0;
+        chunk->err = SUCCESS;
+        chunk->errorPosition = 0;
+        start = end;
+    }
+
+    if (!workPoolRun(count, jobs, chunk_lexer_task, chunks, NULL)) {
+        workPoolRun(count, 1, chunk_lexer_task, chunks, NULL);
+    }
+
+    // append the tokens in order, until the first chunk, that failed
+    enum ERR_CODES err = SUCCESS;
+    for (size_t i = 0; i < count; i++) {
+        // the end of the chunk could be the cause, lex again until the end of the source to get the same error
+        if (err == SUCCESS && chunks[i].err != SUCCESS && !chunks[i].last) {
+            for (size_t j = 0; j < chunks[i].count; j++) free(chunks[i].tokens[j].value);
+            chunks[i].count = 0;
+            chunks[i].err = SUCCESS;
+            chunks[i].end = length;
+            chunks[i].last = true;
+            chunk_lexer_task(chunks, i);
+        }
+
+        for (size_t j = 0; j < chunks[i].count; j++) {
+            if (err == SUCCESS && !saveNewToken(chunks[i].tokens[j], buffer)) err = E_INTERNAL;
+            if (err != SUCCESS) free(chunks[i].tokens[j].value);
+        }
+        if (err == SUCCESS && chunks[i].err != SUCCESS) {
+            err = chunks[i].err;
+            if (errorPosition) *errorPosition = chunks[i].errorPosition;
+        }
+        free(chunks[i].tokens);
+    }
+
+    free(chunks);
+    return err;
+}
@@ -12,27 +12,48 @@
 #include "lexical/scanner.h"
 #include "utility/enumerations.h"
 #include "utility/my_utils.h"
+#include "utility/memory.h"
+#include "utility/statistics.h"
 #else
 #include "scanner.h"
 #include "enumerations.h"
 #include "my_utils.h"
+#include "memory.h"
+#include "statistics.h"
 #endif
 
 #define ALLOC_SIZE 64
 
-static FILE *file;
-static int nextCharacter;
-static struct TOKEN nextToken;
+// Function to scan the next token, defined below scanner_get_token
+static enum ERR_CODES scanner_next_token(struct TOKEN *tokenPointer, CompilerContext *ctx);
 
 // Function to init the scanner
-enum ERR_CODES scanner_init(FILE *input) {
-    file = input;
-    nextCharacter = EOF;
-    nextToken.value = NULL;
-    nextToken.type = TOKEN_NONE;
+enum ERR_CODES scanner_init(FILE *input, CompilerContext *ctx) {
+    ctx->file = input;
+    ctx->source = NULL;
+    ctx->sourceLength = 0;
+    ctx->sourcePosition = 0;
+    ctx->nextCharacter = EOF;
+    ctx->nextToken.value = NULL;
+    ctx->nextToken.type = TOKEN_NONE;
     return SUCCESS;
 }
 
+// Function to init the scanner over a source in memory
+enum ERR_CODES scanner_init_buffer(const char *source, size_t length, CompilerContext *ctx) {
+    scanner_init(NULL, ctx);
+    ctx->source = source;
+    ctx->sourceLength = length;
+    return SUCCESS;
+}
+
+// Function to read the next character of the source
+int scanner_read_char(CompilerContext *ctx) {
+    if (!ctx->source) return getc(ctx->file);
+    if (ctx->sourcePosition >= ctx->sourceLength) return EOF;
+    return (unsigned char)ctx->source[ctx->sourcePosition++];
+}
+
 // Function to end the scanner
 enum ERR_CODES scanner_end(char input, int *nextCharacter, struct TOKEN *tokenPointer, int string_index) {
     tokenPointer->value[string_index] = '\0';
@@ -40,8 +61,17 @@ enum ERR_CODES scanner_end(char input, int *nextCharacter, struct TOKEN *tokenPo
     return SUCCESS;
 }
 
-// Function to get the next token
-enum ERR_CODES scanner_get_token(struct TOKEN *tokenPointer) {
+// Function to get the next token, the values are allocated by the scanner, whoever calls it
+enum ERR_CODES scanner_get_token(struct TOKEN *tokenPointer, CompilerContext *ctx) {
+    STATS_ADD(tokens, 1);
+    enum MEMORY_TAG scope = MEMORY_SCOPE_BEGIN(MEMORY_SCANNER);
+    enum ERR_CODES status = scanner_next_token(tokenPointer, ctx);
+    MEMORY_SCOPE_END(scope);
+    return status;
+}
+
+// Function to scan the next token
+static enum ERR_CODES scanner_next_token(struct TOKEN *tokenPointer, CompilerContext *ctx) {
     SCANNER_STATUS state = SCANNER_START;
     unsigned string_index = 0;
     unsigned allocated_length = ALLOC_SIZE;
@@ -53,18 +83,18 @@ enum ERR_CODES scanner_get_token(struct TOKEN *tokenPointer) {
         return E_INTERNAL; // memory allocation failed
     }
 
-    if (nextToken.type != TOKEN_NONE) {
-        *tokenPointer = nextToken;
-        nextToken.type = TOKEN_NONE;
+    if (ctx->nextToken.type != TOKEN_NONE) {
+        *tokenPointer = ctx->nextToken;
+        ctx->nextToken.type = TOKEN_NONE;
         return SUCCESS;
     }
 
     while (true) {
-        if (nextCharacter == EOF)
-            input = getc(file);
+        if (ctx->nextCharacter == EOF)
+            input = scanner_read_char(ctx);
         else {
-            input = nextCharacter;
-            nextCharacter = EOF;
+            input = ctx->nextCharacter;
+            ctx->nextCharacter = EOF;
         }
         assign_value = true;
         char lookahead; 
@@ -193,7 +223,7 @@ enum ERR_CODES scanner_get_token(struct TOKEN *tokenPointer) {
             break;
 
 		case SCANNER_MULTILINE_STRING: 
-            input = getc(file);
+            input = scanner_read_char(ctx);
             DEBUG_PRINT("Multiline string\n");
             string_index = 0;
 
@@ -212,9 +242,9 @@ enum ERR_CODES scanner_get_token(struct TOKEN *tokenPointer) {
                 if (input == '\n') {
                     is_newline = true;
                     tokenPointer->value[string_index++] = input;
-                    input = getc(file); // Fetch next character after newline
+                    input = scanner_read_char(ctx); // Fetch next character after newline
                     while (input == ' ') { // Skip leading spaces
-                        input = getc(file);
+                        input = scanner_read_char(ctx);
                     }
                     DEBUG_PRINT("New line detected: '%c'\n", input);
                     continue;
@@ -230,7 +260,7 @@ enum ERR_CODES scanner_get_token(struct TOKEN *tokenPointer) {
                         break;
                     }
 
-                    lookahead = getc(file);
+                    lookahead = scanner_read_char(ctx);
 
                     if (input != '\\' || lookahead != '\\') {
                         DEBUG_PRINT("Invalid multiline string format\n");
@@ -239,7 +269,7 @@ enum ERR_CODES scanner_get_token(struct TOKEN *tokenPointer) {
                     }
                     // Skip valid double backslashes after a newline
                     is_newline = false;
-                    input = getc(file); // Fetch next character after backslashes
+                    input = scanner_read_char(ctx); // Fetch next character after backslashes
                     continue;
                 }
 
@@ -247,7 +277,7 @@ enum ERR_CODES scanner_get_token(struct TOKEN *tokenPointer) {
                 tokenPointer->value[string_index++] = input;
 
                 // Get the next character
-                input = getc(file);
+                input = scanner_read_char(ctx);
             }
 
             if (input == EOF) {
@@ -255,7 +285,7 @@ enum ERR_CODES scanner_get_token(struct TOKEN *tokenPointer) {
             }
             
             tokenPointer->type = TOKEN_STRING_LITERAL;
-            return scanner_end(input, &nextCharacter, tokenPointer, string_index); 
+            return scanner_end(input, &ctx->nextCharacter, tokenPointer, string_index); 
 
 
         case SCANNER_STRING_VALUE:
@@ -271,7 +301,7 @@ enum ERR_CODES scanner_get_token(struct TOKEN *tokenPointer) {
 
         case SCANNER_STRING_END:
             tokenPointer->type = TOKEN_STRING_LITERAL;
-            return scanner_end(input, &nextCharacter, tokenPointer, string_index);
+            return scanner_end(input, &ctx->nextCharacter, tokenPointer, string_index);
 
         case SCANNER_ESCAPE_SEQ: {
             int hex1, hex2;
@@ -303,9 +333,9 @@ enum ERR_CODES scanner_get_token(struct TOKEN *tokenPointer) {
                 state = SCANNER_STRING_VALUE;
                 break;
             case 'x':
-                hex1 = getc(file);
+                hex1 = scanner_read_char(ctx);
                 if (isxdigit(hex1)) {
-                    hex2 = getc(file);
+                    hex2 = scanner_read_char(ctx);
                     if (isxdigit(hex2)) {
                         assign_value = false;
                         tokenPointer->value[string_index++] =
@@ -327,21 +357,21 @@ enum ERR_CODES scanner_get_token(struct TOKEN *tokenPointer) {
             if (input == '-') {
                 return E_LEXICAL;
             } else {
-                return scanner_end(input, &nextCharacter, tokenPointer, string_index);
+                return scanner_end(input, &ctx->nextCharacter, tokenPointer, string_index);
             }
             break;
 
         case SCANNER_PLUS:
-            return scanner_end(input, &nextCharacter, tokenPointer, string_index);
+            return scanner_end(input, &ctx->nextCharacter, tokenPointer, string_index);
 
         case SCANNER_MULTIPLY:
-            return scanner_end(input, &nextCharacter, tokenPointer, string_index);
+            return scanner_end(input, &ctx->nextCharacter, tokenPointer, string_index);
 
         case SCANNER_DIVIDE:
             if (input == '/') {
                 state = SCANNER_COMMENT;
             } else {
-                return scanner_end(input, &nextCharacter, tokenPointer, string_index);
+                return scanner_end(input, &ctx->nextCharacter, tokenPointer, string_index);
             }
             break;
 
@@ -351,12 +381,12 @@ enum ERR_CODES scanner_get_token(struct TOKEN *tokenPointer) {
                 tokenPointer->type = TOKEN_EQUALS;
             } else {
                 tokenPointer->type = TOKEN_ASSIGN;
-                return scanner_end(input, &nextCharacter, tokenPointer, string_index);
+                return scanner_end(input, &ctx->nextCharacter, tokenPointer, string_index);
             }
             break;
 
         case SCANNER_EQUAL:
-            return scanner_end(input, &nextCharacter, tokenPointer, string_index);
+            return scanner_end(input, &ctx->nextCharacter, tokenPointer, string_index);
 
         case SCANNER_GREATER:
             if (input == '=') {
@@ -364,12 +394,12 @@ enum ERR_CODES scanner_get_token(struct TOKEN *tokenPointer) {
                 tokenPointer->type = TOKEN_GREATEROREQUAL;
             } else {
                 tokenPointer->type = TOKEN_GREATERTHAN;
-                return scanner_end(input, &nextCharacter, tokenPointer, string_index);
+                return scanner_end(input, &ctx->nextCharacter, tokenPointer, string_index);
             }
             break;
 
         case SCANNER_GREATEROREQUAL:
-            return scanner_end(input, &nextCharacter, tokenPointer, string_index);
+            return scanner_end(input, &ctx->nextCharacter, tokenPointer, string_index);
 
         case SCANNER_LESS:
             if (input == '=') {
@@ -377,12 +407,12 @@ enum ERR_CODES scanner_get_token(struct TOKEN *tokenPointer) {
                 tokenPointer->type = TOKEN_LESSOREQUAL;
             } else {
                 tokenPointer->type = TOKEN_LESSTHAN;
-                return scanner_end(input, &nextCharacter, tokenPointer, string_index);
+                return scanner_end(input, &ctx->nextCharacter, tokenPointer, string_index);
             }
             break;
 
         case SCANNER_LESSOREQUAL:
-            return scanner_end(input, &nextCharacter, tokenPointer, string_index);
+            return scanner_end(input, &ctx->nextCharacter, tokenPointer, string_index);
 
         case SCANNER_EXCLAMATION:
             if (input == '=') {
@@ -409,7 +439,7 @@ enum ERR_CODES scanner_get_token(struct TOKEN *tokenPointer) {
                     state = SCANNER_EXP_BASE;
                 } else {
                     tokenPointer->type = TOKEN_INTEGER_LITERAL;
-                    return scanner_end(input, &nextCharacter, tokenPointer, string_index);
+                    return scanner_end(input, &ctx->nextCharacter, tokenPointer, string_index);
                 }
             }
             break;
@@ -427,7 +457,7 @@ enum ERR_CODES scanner_get_token(struct TOKEN *tokenPointer) {
                     state = SCANNER_EXP_BASE;
                 } else {
                     tokenPointer->type = TOKEN_FLOAT_LITERAL;
-                    return scanner_end(input, &nextCharacter, tokenPointer, string_index);
+                    return scanner_end(input, &ctx->nextCharacter, tokenPointer, string_index);
                 }
             }
             break;
@@ -453,7 +483,7 @@ enum ERR_CODES scanner_get_token(struct TOKEN *tokenPointer) {
         case SCANNER_EXP:
             if (!(isDigit(input))) {
                 tokenPointer->type = TOKEN_FLOAT_LITERAL;
-                return scanner_end(input, &nextCharacter, tokenPointer, string_index);
+                return scanner_end(input, &ctx->nextCharacter, tokenPointer, string_index);
             }
             break;
 
@@ -480,7 +510,7 @@ enum ERR_CODES scanner_get_token(struct TOKEN *tokenPointer) {
             break;
 
         case SCANNER_8:
-            return scanner_end(input, &nextCharacter, tokenPointer, string_index);
+            return scanner_end(input, &ctx->nextCharacter, tokenPointer, string_index);
 
         case SCANNER_IDENTIFIER:
             if (!((input >= 'A' && input <= 'Z') || (input >= 'a' && input <= 'z') ||
@@ -490,7 +520,7 @@ enum ERR_CODES scanner_get_token(struct TOKEN *tokenPointer) {
                  * while
                  */
                 tokenPointer->value[string_index] = '\0';
-                nextCharacter = input;
+                ctx->nextCharacter = input;
                 if (!strcmp(tokenPointer->value, "const")) {
                     tokenPointer->type = TOKEN_CONST;
                 } else if (!strcmp(tokenPointer->value, "else")) {
@@ -543,7 +573,7 @@ enum ERR_CODES scanner_get_token(struct TOKEN *tokenPointer) {
         case SCANNER_PIPE:
         case SCANNER_AT:
         case SCANNER_QUESTION_MARK:
-            return scanner_end(input, &nextCharacter, tokenPointer, string_index);
+            return scanner_end(input, &ctx->nextCharacter, tokenPointer, string_index);
 
         default:
             return E_LEXICAL;
@@ -7,64 +7,139 @@
  * @author <253171> Vanesa Zimmermannová
  */
 
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
 #ifdef USE_CUSTOM_STRUCTURE
-#include "code_generation/code_generator.h"
-#include "syntaxical/parser.h"
+#include "ifj24.h"
+#include "batch.h"
+#include "cache.h"
 #include "utility/enumerations.h"
-#include "semantical/sem_analyzer.h"
+#include "utility/statistics.h"
+#include "utility/timing.h"
 #else 
-#include "code_generator.h"
-#include "parser.h"
+#include "ifj24.h"
+#include "batch.h"
+#include "cache.h"
 #include "enumerations.h"
-#include "sem_analyzer.h"
+#include "statistics.h"
+#include "timing.h"
 #endif
 
-int main(void) {
-    enum ERR_CODES status;
-    
-    SymTable *table = symTableInit();
+// Function to read the whole stream into memory
+char *readSource(FILE *input, size_t *length) {
+    size_t capacity = 1 << 16;
+    char *source = (char *)malloc(capacity);
+    if (!source) return NULL;
 
-    DEBUG_PRINT_IF(!table, "Table not created");
-    DEBUG_PRINT("Table created");
+    *length = 0;
+    size_t read;
+    while ((read = fread(source + *length, 1, capacity - *length, input)) > 0) {
+        *length += read;
+        if (*length < capacity) continue;
 
-    if (!table) return E_INTERNAL;
+        char *bigger = (char *)realloc(source, capacity * 2);
+        if (!bigger) {
+            free(source);
+            return NULL;
+        }
+        source = bigger;
+        capacity *= 2;
+    }
 
-    // init parser
-    parser_init(table);
+    if (ferror(input)) {
+        free(source);
+        return NULL;
+    }
+    return source;
+}
 
-    // parse input
-    struct Program program;
-    program.functions = NULL; // important, for faild first pass
-    status = parser_parse(stdin, &program);
+int main(int argc, char **argv) {
+    // many files on the worker threads
+    if (argc > 1 && strcmp(argv[1], "--batch") == 0) return batchMain(argc - 2, argv + 2);
 
-    DEBUG_PRINT("parser parse status: %d", status); 
-    if (status != SUCCESS) {
-        DEBUG_PRINT("cleaning up");
-        symTableFree(&table);
-        freeProgram(&program);
-        return status;
+    // worker threads of the parallel phases, the pipelined front end and the streaming mode
+    Ifj24Options options;
+    ifj24OptionsInit(&options);
+    const char *cacheDir = NULL;
+    size_t cacheLimit = COMPILE_CACHE_LIMIT;
+    bool cacheStats = false;
+    bool incremental = false;
+    bool timePasses = false;
+    const char *tracePath = NULL;
+    bool stats = false;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-j") == 0 && i + 1 < argc && atoi(argv[i + 1]) > 0) options.jobs = (unsigned int)atoi(argv[++i]);
+        else if (strcmp(argv[i], "--pipeline") == 0) options.pipeline = 1;
+        else if (strcmp(argv[i], "--stream") == 0) options.streaming = 1;
+        else if (strcmp(argv[i], "--emit-c") == 0) options.emitC = 1;
+        else if (strcmp(argv[i], "--cache") == 0 && i + 1 < argc) cacheDir = argv[++i];
+        else if (strcmp(argv[i], "--cache-limit") == 0 && i + 1 < argc) cacheLimit = (size_t)strtoull(argv[++i], NULL, 10);
+        else if (strcmp(argv[i], "--cache-stats") == 0) cacheStats = true;
+        else if (strcmp(argv[i], "--incremental") == 0) incremental = true;
+        else if (strcmp(argv[i], "--time-passes") == 0) timePasses = true;
+        else if (strcmp(argv[i], "--time-trace") == 0 && i + 1 < argc) tracePath = argv[++i];
+        else if (strcmp(argv[i], "--stats=json") == 0) stats = true;
     }
 
-    DEBUG_PRINT("Analyzing program");
+    size_t length;
+    char *source = readSource(stdin, &length);
+    if (!source) return E_INTERNAL;
+    if (stats && !statsEnabled()) fprintf(stderr, "ifj24: the statistics are compiled out, build ./main_stats by make stats\n");
 
-    // analyze program
-    status = analyzeProgram(&program, table);
+    // the code of an unchanged source is taken from the cache, without compiling
+    CompileCache cache;
+    char key[COMPILE_CACHE_KEY_LENGTH + 1];
+    bool caching = cacheDir && compileCacheInit(&cache, cacheDir, cacheLimit);
+    if (cacheDir && !caching) fprintf(stderr, "ifj24: cannot open the cache %s\n", cacheDir);
+    if (incremental && !caching) fprintf(stderr, "ifj24: --incremental needs a cache, set by --cache <dir>\n");
+
+    // the unchanged functions of a changed source are taken from the same cache
+    if (incremental && caching) options.functionCache = &cache;
+    if (caching) {
+        compileCacheKey(&cache, source, length, &options, key);
+        if (compileCacheLookup(&cache, key, stdout)) {
+            free(source);
+            if (cacheStats) compileCachePrintStats(&cache, stderr);
+            if (stats && statsEnabled()) statsPrintJson(stderr, NULL, 0);
+            return SUCCESS;
+        }
+    }
+
+    // the phases are timed only on request, otherwise the compiler does not read the clock
+    Timing timing;
+    if ((timePasses || tracePath) && timingInit(&timing)) options.timing = &timing;
+
+    // the whole compilation runs in the library
+    Ifj24Result result;
+    int status = ifj24CompileWithOptions(source, length, &options, &result);
+    free(source);
+
+    if (options.timing) {
+        if (timePasses) timingPrintSummary(&timing, stderr);
+        if (tracePath && !timingWriteTrace(&timing, tracePath)) fprintf(stderr, "ifj24: cannot write the trace %s\n", tracePath);
+        timingFree(&timing);
+    }
+
+    DEBUG_PRINT("compile status: %d, %s", status, result.diagnostic);
+    // the counters go to stderr, the code stays on stdout
+    if (stats && statsEnabled()) statsPrintJson(stderr, result.code, result.codeLength);
     if (status != SUCCESS) {
-        DEBUG_PRINT("cleaning up");
-        symTableFree(&table);
-        freeProgram(&program);
+        fprintf(stderr, "ifj24: %s\n", result.diagnostic);
+        if (caching && cacheStats) compileCachePrintStats(&cache, stderr);
         return status;
     }
 
-    // generate code
-    DEBUG_PRINT("Generating code");
-
-    generateCodeProgram(&program);
+    // write the whole code at once, only the code of a successful compilation is cached
+    if (fwrite(result.code, 1, result.codeLength, stdout) != result.codeLength) status = E_INTERNAL;
+    if (caching) {
+        compileCacheStore(&cache, key, result.code, result.codeLength);
+        if (cacheStats) compileCachePrintStats(&cache, stderr);
+    }
 
-    // clean up
-    symTableFree(&table);
-    freeProgram(&program);
-    return SUCCESS;
+    ifj24ResultFree(&result);
+    return status;
 }
 
 // todo realloc muze delat na lexikalce memory leak
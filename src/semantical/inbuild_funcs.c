@@ -72,6 +72,7 @@ char *chr_name = "$ifj_chr";
 
 // Function to fill in the inbuild functions
 void fillInBuildInFuncions(SymTable* table) {
+    SymFunctionPtr readstr, readi32, readf64, write, i2f, f2i, string, length, concat, substring, Strcmp, ord, chr;
 
     //pub fn ifj.readstr() ?[]u8;
     readstr = symInitFuncDefinition();
@@ -15,42 +15,31 @@
 #include "semantical/sem_analyzer.h"
 #include "syntaxical/ast.h"
 #include "utility/enumerations.h"
+#include "utility/work_pool.h"
+#include "utility/memory.h"
 #else
 #include "sem_analyzer.h"
 #include "ast.h"
 #include "enumerations.h"
+#include "work_pool.h"
+#include "memory.h"
 #endif
 
 // Function to analyze the whole program
-enum ERR_CODES analyzeProgram(Program *program, SymTable *table) {
+enum ERR_CODES analyzeProgram(Program *program, CompilerContext *ctx) {
     DEBUG_PRINT("\n\n=== %sAnalyzing program%s ===\n\n", COLOR_WARN, COLOR_RESET);
-    if (!program) return E_INTERNAL;
+    if (!program || !ctx || !ctx->table) return E_INTERNAL;
+
+    // all the state of the analysis is in the symbol table of the compilation
+    SymTable *table = ctx->table;
 
     enum ERR_CODES err;
     DEBUG_PRINT("Gettinf function definitions");
-    // go function by function, add the definitions
+    // go function by function, add the definitions, the pipelined parser could have added some already
     unsigned int size = getSize(program->functions);
-    for (unsigned int i = 0; i < size; i++) {
+    for (unsigned int i = ctx->signatures; i < size; i++) {
         Function *function = (Function *)getDataAtIndex(program->functions, i);
-        SymFunctionPtr funDef = symInitFuncDefinition();
-        if (!funDef) return E_INTERNAL;
-        if (strcmp(function->id.name, "main") == 0 && (function->returnType.data_type != dTypeVoid || getSize(function->params) != 0)) return E_SEMANTIC_INVALID_FUN_PARAM;
-        DEBUG_PRINT("Function name: %s\nFunction return type: %d\nFunftion return nullable: %d", function->id.name, function->returnType.data_type, function->returnType.is_nullable);
-        bool result = symEditFuncDef(funDef, function->id.name, function->returnType.data_type, (function->returnType.is_nullable) ? 1 : 0);
-        if (!result) return E_INTERNAL;
-        DEBUG_PRINT_IF(!result, "Function edit failed");
-        DEBUG_PRINT("Function edit error: %d", err);
-
-        // go thorougt the params, and add them to the function
-        unsigned int size1 = getSize(function->params);
-        for (unsigned int j = 0; j < size1; j++) {
-            Param *param = (Param *)getDataAtIndex(function->params, j);
-            bool result = symAddParamToFunc(funDef, param->type.data_type, param->type.is_nullable);
-            if (!result) return E_INTERNAL;
-        }
-       
-        // add the function to the symbol table
-        err = symTableAddFunction(table, funDef);
+        err = analyzeFunctionSignature(function, table);
         if (err != SUCCESS) return err;
     }
 
@@ -63,40 +52,97 @@ enum ERR_CODES analyzeProgram(Program *program, SymTable *table) {
 
     DEBUG_PRINT("Analyzing function bodies");
 
-    // go througt the function bodies
+    // from now on the function definitions are only read, so every body gets its own view of the table
+    FunctionAnalysis *analyses = (FunctionAnalysis *)malloc((size ? size : 1) * sizeof(FunctionAnalysis));
+    if (!analyses) return E_INTERNAL;
     for (unsigned int i = 0; i < size; i++) {
-
         Function *function = (Function *)getDataAtIndex(program->functions, i);
-        DEBUG_PRINT("analyzing body of function %s", function->id.name);
-        SymFunctionPtr funDef = symTableFindFunction(table, function->id.name);
-
-        // enter the function scope
-        if (!symTableMoveScopeDown(table, SYM_FUNCTION)) return E_INTERNAL;
-
-        unsigned int size1 = getSize(function->params);
-        DEBUG_PRINT("Adding args to symtable: %s", function->id.name);
-        for (unsigned int j = 0; j < size1; j++) {
-            // add the params to the function scope
-            Param *param = (Param *)getDataAtIndex(function->params, j);
-            err = analyzeParam(param, table);
-            if (err != SUCCESS) return err;
-        }
+        function->symFunction = symTableFindFunction(table, function->id.name);
+        analyses[i].function = function;
+        analyses[i].view = symTableInitView(table);
+        analyses[i].err = analyses[i].view ? SUCCESS : E_INTERNAL;
+        analyses[i].timing = ctx->timing;
+    }
 
-        int retCount = 0;   
-        err = analyzeBody(&function->body, table, funDef, &retCount);
-        if (err != SUCCESS) return err;
+    // go througt the function bodies, on more threads for bigger programs
+    unsigned int jobs = (size >= PARALLEL_MIN_FUNCTIONS) ? ctx->jobs : 1;
+    if (!workPoolRun(size, jobs, analyzeFunctionTask, analyses, NULL)) {
+        workPoolRun(size, 1, analyzeFunctionTask, analyses, NULL);
+    }
 
-        // invalid amount of returns
-        if (strcmp(funDef->funcName, "main") != 0) {
-            if (funDef->returnType != dTypeVoid && retCount == 0) return E_SEMANTIC_BAD_FUNC_RETURN;
-            if (funDef->returnType == dTypeVoid && retCount > 0) return E_SEMANTIC_BAD_FUNC_RETURN;
-        }
+    // merge the views in the source order, so the variable ids and the reported error do not depend on the threads
+    err = SUCCESS;
+    for (unsigned int i = 0; i < size; i++) {
+        if (analyses[i].view && !symTableMergeView(table, &analyses[i].view) && err == SUCCESS) err = E_INTERNAL;
+        if (err == SUCCESS) err = analyses[i].err;
+    }
+    free(analyses);
+    return err;
+}
+
+// Function to analyze a single function body on the work pool
+void analyzeFunctionTask(void *data, size_t index) {
+    FunctionAnalysis *analysis = &((FunctionAnalysis *)data)[index];
+    if (analysis->err != SUCCESS) return;
+    size_t span = TIMING_BEGIN(analysis->timing, "analyze function");
+    enum MEMORY_TAG scope = MEMORY_SCOPE_BEGIN(MEMORY_SYMTABLE);
+    analysis->err = analyzeFunction(analysis->function, analysis->view);
+    MEMORY_SCOPE_END(scope);
+    TIMING_END(analysis->timing, span, analysis->function->id.name);
+}
+
+// Function to add the definition of a single function
+enum ERR_CODES analyzeFunctionSignature(Function *function, SymTable *table) {
+    if (strcmp(function->id.name, "main") == 0 && (function->returnType.data_type != dTypeVoid || getSize(function->params) != 0)) return E_SEMANTIC_INVALID_FUN_PARAM;
+    SymFunctionPtr funDef = symInitFuncDefinition();
+    if (!funDef) return E_INTERNAL;
+    DEBUG_PRINT("Function name: %s\nFunction return type: %d\nFunftion return nullable: %d", function->id.name, function->returnType.data_type, function->returnType.is_nullable);
+    bool result = symEditFuncDef(funDef, function->id.name, function->returnType.data_type, (function->returnType.is_nullable) ? 1 : 0);
+    DEBUG_PRINT_IF(!result, "Function edit failed");
+
+    // go thorougt the params, and add them to the function
+    unsigned int size = getSize(function->params);
+    for (unsigned int j = 0; result && j < size; j++) {
+        Param *param = (Param *)peekDataAtIndex(function->params, j);
+        result = symAddParamToFunc(funDef, param->type.data_type, param->type.is_nullable);
+    }
 
-        // exit the function scope
-        err = symTableExitScope(table);
+    // add the function to the symbol table, the table owns it only after that
+    enum ERR_CODES err = result ? symTableAddFunction(table, funDef) : E_INTERNAL;
+    if (err != SUCCESS) symFreeFuncDefinition(&funDef);
+    return err;
+}
+
+// Function to analyze the body of a single function
+enum ERR_CODES analyzeFunction(Function *function, SymTable *table) {
+    DEBUG_PRINT("analyzing body of function %s", function->id.name);
+    SymFunctionPtr funDef = function->symFunction;
+    enum ERR_CODES err;
+
+    // enter the function scope
+    if (!symTableMoveScopeDown(table, SYM_FUNCTION)) return E_INTERNAL;
+
+    unsigned int size = getSize(function->params);
+    DEBUG_PRINT("Adding args to symtable: %s", function->id.name);
+    for (unsigned int j = 0; j < size; j++) {
+        // add the params to the function scope
+        Param *param = (Param *)getDataAtIndex(function->params, j);
+        err = analyzeParam(param, table);
         if (err != SUCCESS) return err;
     }
-    return SUCCESS;
+
+    int retCount = 0;   
+    err = analyzeBody(&function->body, table, funDef, &retCount);
+    if (err != SUCCESS) return err;
+
+    // invalid amount of returns
+    if (strcmp(funDef->funcName, "main") != 0) {
+        if (funDef->returnType != dTypeVoid && retCount == 0) return E_SEMANTIC_BAD_FUNC_RETURN;
+        if (funDef->returnType == dTypeVoid && retCount > 0) return E_SEMANTIC_BAD_FUNC_RETURN;
+    }
+
+    // exit the function scope
+    return symTableExitScope(table);
 }
 
 // function to analyze a paramater
@@ -199,7 +245,7 @@ enum ERR_CODES analyzeFunctionCall(FunctionCall *function_call, SymTable *table)
     // check if the types of the arguments is correct
     for (unsigned int i = 0; i < size; i++) {
         Expression *param = (Expression *)getDataAtIndex(function_call->arguments, i);
-        SymFunctionParamPtr defParam = (SymFunctionParamPtr)getDataAtIndex(SymFunction->paramaters, i);
+        SymFunctionParamPtr defParam = (SymFunctionParamPtr)peekDataAtIndex(SymFunction->paramaters, i);
         if (!param || !defParam) return E_INTERNAL;
 
         // if it is a literal, it can be converted
@@ -299,6 +345,16 @@ enum ERR_CODES analyzeReturnStatement(ReturnStatement *return_statement, SymTabl
     if (currentFunc->returnType != returnType) return E_SEMANTIC_INVALID_FUN_PARAM;
     if (!currentFunc->nullableReturn && nullable) return E_SEMANTIC_INVALID_FUN_PARAM;
 
+    // return f(args); inside of f can reuse the frame of the current call
+    if (
+        return_statement->value.expr_type == FunctionCallExpressionType &&
+        return_statement->value.conversion == NoConversion &&
+        strcmp(return_statement->value.data.function_call.func_id.name, currentFunc->funcName) == 0
+    ) {
+        return_statement->tail_call = true;
+        currentFunc->tailRecursive = true;
+    }
+
     (*retCount)++;
 
     return SUCCESS;
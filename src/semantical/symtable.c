@@ -15,10 +15,12 @@
 #include "semantical/symtable.h"
 #include "semantical/inbuild_funcs.h"
 #include "utility/binary_search_tree.h"
+#include "utility/statistics.h"
 #else
 #include "symtable.h"
 #include "inbuild_funcs.h"
 #include "binary_search_tree.h"
+#include "statistics.h"
 #endif
 
 // ####################### SYMTABLE #######################
@@ -53,6 +55,7 @@ SymFunctionPtr symInitFuncDefinition(void) {
     func->funcName = NULL;
     func->returnType = dTypeUndefined;
     func->nullableReturn = false;
+    func->tailRecursive = false;
     func->paramaters = NULL;
 
     return func;
@@ -160,6 +163,8 @@ enum ERR_CODES symTableAddFunction(SymTable *table, SymFunctionPtr function) {
 SymFunctionPtr symTableFindFunction(SymTable *table, char *name) {
 
     if (table == NULL || name == NULL) return NULL;
+    STATS_ADD(symtableLookups, 1);
+    STATS_ADD(symtableProbes, 1);
 
     unsigned int hash = hashString(name);
     LinkedList *sameHashFuncs = (LinkedList *)bstSearchForNode(table->functionDefinitions, hash);
@@ -167,7 +172,8 @@ SymFunctionPtr symTableFindFunction(SymTable *table, char *name) {
 
     unsigned int size = getSize(sameHashFuncs);
     for (unsigned int i = 0; i < size; i++) {
-        SymFunctionPtr func = (SymFunctionPtr)getDataAtIndex(sameHashFuncs, i);
+        // the definitions are shared by the analysis threads, so the list must not be modified
+        SymFunctionPtr func = (SymFunctionPtr)peekDataAtIndex(sameHashFuncs, i);
         if (func != NULL && strcmp(func->funcName, name) == 0) {
             DEBUG_PRINT("Function found: %s\nreturnType: %d\nReturn Nullable: %d\namount of args: %d", name, func->returnType, func->nullableReturn, getSize(func->paramaters));
             return func;
@@ -210,6 +216,7 @@ SymTable *symTableInit(void) {
     globalScope->type = SYM_GLOBAL;
     globalScope->key = 0;                              // key for the global scope
     globalScope->parent = NULL;                        // no parent
+    globalScope->outerScope = NULL;                    // no enclosing scope
     globalScope->variables = bstInit(freeListWrapper); // link to variables, in global scope disabled
     globalScope->innerScope = NULL;                    // link to other scopes
 
@@ -317,6 +324,8 @@ bool symTableMoveScopeDown(SymTable *table, enum SYMTABLE_NODE_TYPES type) {
     newScope->type = type;
     newScope->key = table->scopeCount;      // key for the new scope
     newScope->parent = table->currentScope; // parent is the current scope
+    // only the current scope gets new variables, so an empty parent stays empty, while the new scope exists
+    newScope->outerScope = (table->currentScope->variables->size > 0) ? table->currentScope : table->currentScope->outerScope;
     newScope->variables = variables;        // link to variables
     newScope->innerScope = NULL;            // link to other scopes
 
@@ -478,36 +487,39 @@ SymVariable *symTableFindVariable(SymTable *table, char *name) {
 
     // Hash the name to find the corresponding variables
     unsigned int hash = hashString(name);
+    STATS_ADD(symtableLookups, 1);
 
     // Traverse the current and parent scopes
     SymTableNode *currentScope = table->currentScope;
     while (currentScope != NULL) {
+        STATS_ADD(symtableProbes, 1);
         BST *variables = currentScope->variables;
         void *sameHashVariables = bstSearchForNode(variables, hash);
 
-        // If no variables with the same hash, go to the parent scope
+        // If no variables with the same hash, go to the enclosing scope
         if (sameHashVariables == NULL) {
-            currentScope = currentScope->parent;
+            currentScope = currentScope->outerScope;
             continue;
         }
 
         // Go through the variables with the same hash
         unsigned int size = getSize((LinkedList *)sameHashVariables);
         for (unsigned int i = 0; i < size; i++) {
-            SymVariable *variable = (SymVariable *)getDataAtIndex((LinkedList *)sameHashVariables, i);
+            // the global scope is shared by the analysis threads, so the list must not be modified
+            SymVariable *variable = (SymVariable *)peekDataAtIndex((LinkedList *)sameHashVariables, i);
 
             // Skip null or mismatched variables
             if (variable == NULL || strcmp(variable->name, name) != 0) continue;
 
-            // Mark the variable as accessed if found
-            variable->accesed = true;
+            // Mark the variable as accessed if found, the global _ already is, so it is never written
+            if (!variable->accesed) variable->accesed = true;
 
             DEBUG_PRINT("Variable %s found in scope %d\nVariable ID: %d\nVariable name: %s\nVariable type: %d\nVariable mutable: %d\nVariable nullable: %d\n", name, currentScope->key, variable->id, variable->name, variable->type, variable->mutable, variable->nullable);
             return variable;
         }
 
-        // Move up to the parent scope if not found
-        currentScope = currentScope->parent;
+        // Move up to the enclosing scope if not found
+        currentScope = currentScope->outerScope;
     }
     return NULL; // Variable not found
 }
@@ -518,6 +530,77 @@ bool symTableCanMutate(SymVariable *variable) {
     return variable->mutable;
 }
 
+// Function to create a view of the table for analyzing a single function
+SymTable *symTableInitView(SymTable *table) {
+    if (table == NULL) return NULL;
+
+    SymTable *view = (SymTable *)malloc(sizeof(SymTable));
+    SymTableNode *globalScope = (SymTableNode *)malloc(sizeof(SymTableNode));
+    LinkedList *data = initLinkedList(false);
+    if (view == NULL || globalScope == NULL || data == NULL) {
+        free(view);
+        free(globalScope);
+        removeList(&data);
+        return NULL;
+    }
+
+    // own copy of the global scope node, so entering a scope does not touch the shared one
+    *globalScope = *table->root;
+    globalScope->innerScope = NULL;
+
+    view->root = globalScope;
+    view->currentScope = globalScope;
+    view->varCount = 0;
+    view->scopeCount = table->scopeCount;
+    view->functionDefinitions = table->functionDefinitions;
+    view->data = data;
+    view->tokenBuffer = NULL;
+    return view;
+}
+
+// Function to move the variables of the view to the table and free the view
+bool symTableMergeView(SymTable *table, SymTable **view) {
+    if (table == NULL || view == NULL || *view == NULL) return false;
+    SymTable *tView = *view;
+
+    // the ids continue after the variables already in the table, same as if they were declared there
+    bool result = true;
+    unsigned int size = getSize(tView->data);
+    for (unsigned int i = 0; i < size; i++) {
+        SymVariable *variable = (SymVariable *)getDataAtIndex(tView->data, i);
+        variable->id += table->varCount;
+        if (!insertNodeAtIndex(table->data, (void *)variable, -1)) {
+            free(variable);
+            result = false;
+        }
+    }
+    table->varCount += tView->varCount;
+
+    // scopes left after an error, the global variables belong to the table
+    _symTableFreeNode(tView->root->innerScope);
+    free(tView->root);
+    removeList(&tView->data);
+    free(tView);
+    *view = NULL;
+    return result;
+}
+
+// Function to free the view and its variables, the table keeps counting the ids after them
+void symTableDropView(SymTable *table, SymTable **view) {
+    if (table == NULL || view == NULL || *view == NULL) return;
+    SymTable *tView = *view;
+
+    unsigned int size = getSize(tView->data);
+    for (unsigned int i = 0; i < size; i++) free(getDataAtIndex(tView->data, i));
+    if (tView->varCount > table->varCount) table->varCount = tView->varCount;
+
+    _symTableFreeNode(tView->root->innerScope);
+    free(tView->root);
+    removeList(&tView->data);
+    free(tView);
+    *view = NULL;
+}
+
 void _symTableFreeNode(SymTableNode *node) {
     if (node == NULL) return;
 
@@ -0,0 +1,427 @@
+/** AUTHOR
+ *
+ * @author agent <agent@local>
+ * @file stream.c
+ * @date 19.10.2026
+ * @brief Implementation of the streaming mode, the memory is bounded by the biggest function, not by the program
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef USE_CUSTOM_STRUCTURE
+#include "stream.h"
+#include "code_generation/builtin_generator.h"
+#include "code_generation/code_generator.h"
+#include "lexical/scanner.h"
+#include "syntaxical/parser.h"
+#include "semantical/sem_analyzer.h"
+#include "utility/compiler_context.h"
+#include "utility/memory.h"
+#else
+#include "stream.h"
+#include "builtin_generator.h"
+#include "code_generator.h"
+#include "scanner.h"
+#include "parser.h"
+#include "sem_analyzer.h"
+#include "compiler_context.h"
+#include "memory.h"
+#endif
+
+// Function to add the definition of a function, its header starts at the given token
+static enum ERR_CODES streamAddDefinition(CompilerContext *ctx, unsigned int start) {
+    Function function;
+    memset(&function, 0, sizeof(Function));
+    function.params = initLinkedList(true);
+    if (!function.params) return E_INTERNAL;
+
+    ctx->tokenIndex = start;
+    enum MEMORY_TAG scope = MEMORY_SCOPE_BEGIN(MEMORY_SYMTABLE);
+    enum ERR_CODES err = parse_function_header(&function, ctx) ? analyzeFunctionSignature(&function, ctx->table) : E_SYNTAX;
+    MEMORY_SCOPE_END(scope);
+    freeFunction(&function);
+    return err;
+}
+
+// Function to describe a syntax error at the current token, the parser stopped at it
+static void streamSetToken(StreamError *error, CompilerContext *ctx) {
+    TOKEN_PTR token = (TOKEN_PTR)getDataAtIndex(ctx->buffer, ctx->tokenIndex);
+    if (error && token && token->value && token->type != TOKEN_EOF) snprintf(error->token, STREAM_NAME_LENGTH, "%s", token->value);
+}
+
+// Function to describe an error found in the function starting at the given token
+static void streamSetError(StreamError *error, CompilerContext *ctx, unsigned int start, size_t position, enum ERR_CODES err) {
+    if (!error) return;
+    error->position = position;
+
+    // pub fn identifier, the name is not there, if the header is wrong
+    TOKEN_PTR name = (TOKEN_PTR)getDataAtIndex(ctx->buffer, start + 2);
+    if (name && name->type == TOKEN_IDENTIFIER && name->value) snprintf(error->function, STREAM_NAME_LENGTH, "%s", name->value);
+    if (err == E_SYNTAX) streamSetToken(error, ctx);
+}
+
+// Function to record the tokens of a function, the array grows twice
+static bool streamAddFunction(StreamFunctions *functions, unsigned int start, unsigned int end, size_t position) {
+    if (functions->count == functions->capacity) {
+        unsigned int capacity = functions->capacity ? functions->capacity * 2 : 16;
+        StreamFunction *grown = (StreamFunction *)realloc(functions->functions, capacity * sizeof(StreamFunction));
+        if (!grown) return false;
+        functions->functions = grown;
+        functions->capacity = capacity;
+    }
+    functions->functions[functions->count++] = (StreamFunction){start, end, position};
+    return true;
+}
+
+// Function to lex the source and to add the definitions of all the functions
+enum ERR_CODES streamPrescan(CompilerContext *ctx, StreamFunctions *functions, StreamError *error) {
+    int depth = 0;
+    bool header = false;
+    bool opened = false; // the block at the top level belongs to a function
+    unsigned int start = 0;
+    size_t position = 0;
+    size_t unmatched = 0;
+    enum ERR_CODES err = SUCCESS;
+    while (err == SUCCESS) {
+        err = scanner_get_token(&ctx->token, ctx);
+        if (!saveNewToken(ctx->token, ctx->buffer)) return E_INTERNAL;
+        if (err != SUCCESS || ctx->token.type == TOKEN_EOF) break;
+
+        // every token is kept, the parser and the keys of the functions read them from the buffer
+        unsigned int index = getSize(ctx->buffer) - 1;
+        if (depth == 0 && ctx->token.type == TOKEN_PUB) {
+            header = true;
+            start = index;
+            // the scanner has read the character after the token
+            position = ctx->sourcePosition - (ctx->nextCharacter != EOF);
+        }
+
+        // the whole source is lexed first, a lexical error is reported before the others, the same as without streaming
+        if (ctx->token.type == TOKEN_LBRACE) {
+            if (depth++ == 0) opened = header;
+            header = false;
+        } else if (ctx->token.type == TOKEN_RBRACE && --depth < 0) {
+            if (!unmatched) unmatched = ctx->sourcePosition - (ctx->nextCharacter != EOF);
+        } else if (ctx->token.type == TOKEN_RBRACE && depth == 0 && opened && !unmatched) {
+            if (!streamAddFunction(functions, start, index, position)) err = E_INTERNAL;
+        }
+    }
+
+    // the lexical error is at the wrong character
+    if (err == E_LEXICAL && error) error->position = ctx->sourcePosition;
+    if (err != SUCCESS) return err;
+    if (unmatched) {
+        if (error) error->position = unmatched;
+        return E_SYNTAX;
+    }
+    if (depth != 0 || header) {
+        streamSetError(error, ctx, start, position, SUCCESS);
+        return E_SYNTAX;
+    }
+
+    for (unsigned int i = 0; i < functions->count && err == SUCCESS; i++) {
+        err = streamAddDefinition(ctx, functions->functions[i].start);
+        if (err != SUCCESS) streamSetError(error, ctx, functions->functions[i].start, functions->functions[i].position, err);
+    }
+    return err;
+}
+
+// Function to check the main function, the same checks as analyzeProgram does
+static enum ERR_CODES streamCheckMain(CompilerContext *ctx, StreamFunctions *functions, StreamError *error) {
+    SymFunctionPtr mainFunc = symTableFindFunction(ctx->table, "main");
+    if (!mainFunc) return E_SEMANTIC_UND_FUNC_OR_VAR;
+    if (getSize(mainFunc->paramaters) == 0 && mainFunc->returnType == dTypeVoid) return SUCCESS;
+
+    for (unsigned int i = 0; i < functions->count; i++) {
+        TOKEN_PTR name = (TOKEN_PTR)getDataAtIndex(ctx->buffer, functions->functions[i].start + 2);
+        if (name && name->value && strcmp(name->value, "main") == 0) {
+            streamSetError(error, ctx, functions->functions[i].start, functions->functions[i].position, E_SEMANTIC_BAD_FUNC_RETURN);
+            break;
+        }
+    }
+    return E_SEMANTIC_BAD_FUNC_RETURN;
+}
+
+// Function to parse, analyze and generate a single function, then free it
+static enum ERR_CODES streamFunction(CompilerContext *ctx) {
+    Function *function = (Function *)MEMORY_MALLOC(MEMORY_AST, sizeof(struct Function));
+    if (!function) return E_INTERNAL;
+    memset(function, 0, sizeof(struct Function));
+    enum MEMORY_TAG scope = MEMORY_SCOPE_BEGIN(MEMORY_PARSER);
+    function->params = initLinkedList(true);
+
+    enum ERR_CODES err = function->params ? SUCCESS : E_INTERNAL;
+    if (err == SUCCESS && !parse_function(function, ctx)) err = (ctx->globalError == SUCCESS) ? E_SYNTAX : ctx->globalError;
+    MEMORY_SCOPE_END(scope);
+
+    // the variables get the ids following the ones of the previous functions, the same as after merging the views
+    SymTable *view = NULL;
+    scope = MEMORY_SCOPE_BEGIN(MEMORY_SYMTABLE);
+    if (err == SUCCESS) {
+        function->symFunction = symTableFindFunction(ctx->table, function->id.name);
+        view = symTableInitView(ctx->table);
+        if (!function->symFunction || !view) err = E_INTERNAL;
+    }
+    if (err == SUCCESS) {
+        view->varCount = ctx->table->varCount;
+        size_t span = TIMING_BEGIN(ctx->timing, "analyze function");
+        err = analyzeFunction(function, view);
+        TIMING_END(ctx->timing, span, function->id.name);
+    }
+    MEMORY_SCOPE_END(scope);
+    scope = MEMORY_SCOPE_BEGIN(MEMORY_CODEGEN);
+    if (err == SUCCESS) generateCodeFunction(function, ctx);
+    MEMORY_SCOPE_END(scope);
+
+    symTableDropView(ctx->table, &view);
+    freeFunction(function);
+    free(function);
+    return err;
+}
+
+// Function to make the key of the function, from its tokens up to the closing brace
+static void streamFunctionKey(CompileCache *cache, CompilerContext *ctx, unsigned int end, char *key) {
+    CompileCacheHash hash;
+    compileCacheHashInit(&hash);
+
+    const char *version = cache->build;
+    compileCacheHashAdd(&hash, version, strlen(version) + 1);
+    for (unsigned int i = ctx->tokenIndex; i <= end; i++) {
+        TOKEN_PTR token = (TOKEN_PTR)getDataAtIndex(ctx->buffer, i);
+        int type = (int)token->type;
+        compileCacheHashAdd(&hash, &type, sizeof(type));
+        if (token->value) compileCacheHashAdd(&hash, token->value, strlen(token->value));
+        compileCacheHashAdd(&hash, "", 1);
+    }
+    compileCacheHashKey(&hash, key);
+}
+
+// Function to make the key of the definition of a function, every function, that is not defined, has the same one
+static void streamSignatureKey(SymTable *table, const char *name, char *key) {
+    CompileCacheHash hash;
+    compileCacheHashInit(&hash);
+
+    SymFunctionPtr function = symTableFindFunction(table, (char *)name);
+    if (function) {
+        int returnType = (int)function->returnType;
+        compileCacheHashAdd(&hash, &returnType, sizeof(returnType));
+        compileCacheHashAdd(&hash, &function->nullableReturn, sizeof(function->nullableReturn));
+
+        unsigned int size = getSize(function->paramaters);
+        for (unsigned int i = 0; i < size; i++) {
+            SymFunctionParamPtr param = (SymFunctionParamPtr)peekDataAtIndex(function->paramaters, i);
+            int type = (int)param->type;
+            compileCacheHashAdd(&hash, &type, sizeof(type));
+            compileCacheHashAdd(&hash, &param->nullable, sizeof(param->nullable));
+        }
+    }
+    compileCacheHashKey(&hash, key);
+}
+
+// Function to write the called functions, user and builtin, with the keys of their definitions, a line for each
+static void streamDependencies(CompilerContext *ctx, unsigned int end, OutputBuffer *dependencies, unsigned int *count) {
+    *count = 0;
+    for (unsigned int i = ctx->tokenIndex + 1; i < end; i++) {
+        TOKEN_PTR token = (TOKEN_PTR)getDataAtIndex(ctx->buffer, i);
+        TOKEN_PTR next = (TOKEN_PTR)getDataAtIndex(ctx->buffer, i + 1);
+        if (token->type != TOKEN_IDENTIFIER || next->type != TOKEN_LPAR || !token->value) continue;
+
+        // ifj.name( calls a builtin, it is in the table under the same name as the parser gives it
+        char name[256];
+        TOKEN_PTR dot = (TOKEN_PTR)getDataAtIndex(ctx->buffer, i - 1);
+        TOKEN_PTR ifj = (i >= 2) ? (TOKEN_PTR)getDataAtIndex(ctx->buffer, i - 2) : NULL;
+        bool builtin = dot->type == TOKEN_CONCATENATE && ifj && ifj->type == TOKEN_IFJ;
+        if (snprintf(name, sizeof(name), "%s%s", builtin ? "$ifj_" : "", token->value) >= (int)sizeof(name)) continue;
+
+        // every function once, the calls are few, so the lines are searched
+        size_t nameLength = strlen(name);
+        bool listed = false;
+        for (size_t line = 0; line < dependencies->size && !listed; line++) {
+            listed = strncmp(dependencies->data + line, name, nameLength) == 0 && dependencies->data[line + nameLength] == ' ';
+            while (line < dependencies->size && dependencies->data[line] != '\n') line++;
+        }
+        if (listed) continue;
+
+        char key[COMPILE_CACHE_KEY_LENGTH + 1];
+        streamSignatureKey(ctx->table, name, key);
+        outputBufferAppend(dependencies, name);
+        outputBufferAppendChar(dependencies, ' ');
+        outputBufferAppend(dependencies, key);
+        outputBufferAppendChar(dependencies, '\n');
+        (*count)++;
+    }
+}
+
+// Function to append the cached code, the ids of the variables are moved by the difference of the bases
+static void streamRelocate(const char *code, size_t length, long long delta, OutputBuffer *out) {
+    size_t start = 0;
+    while (start < length) {
+        size_t end = start;
+        while (end < length && code[end] != ' ' && code[end] != '\n') end++;
+
+        // a variable is a whole operand TF@name_id, the spaces of the string literals are escaped
+        size_t underscore = end;
+        if (delta != 0 && end - start > 3 && strncmp(code + start, "TF@", 3) == 0) {
+            while (underscore > start + 3 && code[underscore - 1] >= '0' && code[underscore - 1] <= '9') underscore--;
+            if (underscore == end || code[underscore - 1] != '_') underscore = end;
+        }
+
+        if (underscore < end) {
+            outputBufferAppendN(out, code + start, underscore - start);
+            outputBufferAppendInt(out, strtoll(code + underscore, NULL, 10) + delta);
+        } else {
+            outputBufferAppendN(out, code + start, end - start);
+        }
+        if (end < length) outputBufferAppendChar(out, code[end]);
+        start = end + 1;
+    }
+}
+
+// Function to use a cached function, if the definitions of all the functions it calls are still the same
+static bool streamReuse(CompilerContext *ctx, char *entry, size_t length) {
+    unsigned int base, vars, count;
+    int header = 0;
+    if (sscanf(entry, "base %u vars %u calls %u\n%n", &base, &vars, &count, &header) != 3 || header == 0) return false;
+
+    size_t position = (size_t)header;
+    for (unsigned int i = 0; i < count; i++) {
+        char *line = entry + position;
+        char *newline = memchr(line, '\n', length - position);
+        char *space = newline ? memchr(line, ' ', (size_t)(newline - line)) : NULL;
+        if (!space || newline - space != COMPILE_CACHE_KEY_LENGTH + 1) return false;
+
+        char key[COMPILE_CACHE_KEY_LENGTH + 1];
+        *space = '\0';
+        streamSignatureKey(ctx->table, line, key);
+        if (strncmp(space + 1, key, COMPILE_CACHE_KEY_LENGTH) != 0) return false;
+        position = (size_t)(newline - entry) + 1;
+    }
+
+    // the variables get the same ids, as if the function was analyzed after the previous ones
+    unsigned int current = ctx->table->varCount;
+    streamRelocate(entry + position, length - position, (long long)current - (long long)base, ctx->out);
+    ctx->table->varCount = current + vars;
+    return true;
+}
+
+// Function to compile a single function ending at the given token, or to take its code from the cache
+static enum ERR_CODES streamCachedFunction(CompilerContext *ctx, CompileCache *cache, unsigned int end) {
+    // pub fn identifier, the header was checked by the pre-scan
+    TOKEN_PTR name = (TOKEN_PTR)getDataAtIndex(ctx->buffer, ctx->tokenIndex + 2);
+    size_t span = TIMING_BEGIN(ctx->timing, "reuse function");
+    char key[COMPILE_CACHE_KEY_LENGTH + 1];
+    streamFunctionKey(cache, ctx, end, key);
+    size_t length;
+    char *entry = compileCacheLoad(cache, key, &length);
+    bool reused = entry && streamReuse(ctx, entry, length);
+    if (entry && !reused) compileCacheReject(cache);
+    free(entry);
+    if (reused) {
+        TIMING_END(ctx->timing, span, name->value);
+        ctx->tokenIndex = end + 1;
+        return SUCCESS;
+    }
+
+    // the calls are collected before the parser renames the builtins in the tokens
+    OutputBuffer *dependencies = outputBufferInit(NULL, 0);
+    OutputBuffer *code = outputBufferInit(NULL, 0);
+    OutputBuffer *out = ctx->out;
+    if (!dependencies || !code) {
+        outputBufferFree(&dependencies);
+        outputBufferFree(&code);
+        return E_INTERNAL;
+    }
+    unsigned int count;
+    streamDependencies(ctx, end, dependencies, &count);
+
+    unsigned int base = ctx->table->varCount;
+    ctx->out = code;
+    enum ERR_CODES err = streamFunction(ctx);
+    ctx->out = out;
+
+    if (err == SUCCESS) {
+        outputBufferAppendN(out, code->data, code->size);
+
+        // the entry is the header, the calls with the keys of their definitions and the code
+        OutputBuffer *stored = outputBufferInit(NULL, 0);
+        if (stored) {
+            char header[96];
+            snprintf(header, sizeof(header), "base %u vars %u calls %u\n", base, ctx->table->varCount - base, count);
+            outputBufferAppend(stored, header);
+            outputBufferAppendN(stored, dependencies->data, dependencies->size);
+            outputBufferAppendN(stored, code->data, code->size);
+            if (!stored->error && !dependencies->error && !code->error) compileCacheStore(cache, key, stored->data, stored->size);
+        }
+        outputBufferFree(&stored);
+        if (code->error) err = E_INTERNAL;
+    }
+    outputBufferFree(&dependencies);
+    outputBufferFree(&code);
+    return err;
+}
+
+// Function to compile the functions one by one, the tokens of every function are known from the pre-scan
+static enum ERR_CODES streamFunctions(CompilerContext *ctx, StreamFunctions *functions, CompileCache *cache, StreamError *error) {
+    generateCodeHeader(ctx);
+
+    ctx->tokenIndex = 0;
+    if (!parse_prolog(ctx)) {
+        streamSetToken(error, ctx);
+        return E_SYNTAX;
+    }
+    enum ERR_CODES err = streamCheckMain(ctx, functions, error);
+    if (err != SUCCESS) return err;
+
+    for (unsigned int i = 0; i < functions->count && parse_next_function(ctx); i++) {
+        // only the tokens between the functions are not in a function, the check of the end fails on them
+        StreamFunction *function = &functions->functions[i];
+        if (ctx->tokenIndex != function->start) break;
+        err = cache ? streamCachedFunction(ctx, cache, function->end) : streamFunction(ctx);
+        if (err != SUCCESS) {
+            streamSetError(error, ctx, function->start, function->position, err);
+            return err;
+        }
+    }
+    if (!match(TOKEN_EOF, ctx)) {
+        streamSetToken(error, ctx);
+        return E_SYNTAX;
+    }
+
+    generateBuiltins(ctx->out);
+    return ctx->out->error ? E_INTERNAL : SUCCESS;
+}
+
+// Function to compile the source a function at a time
+enum ERR_CODES streamCompile(const char *source, size_t length, OutputBuffer *out, CompileCache *cache, Timing *timing, StreamError *error) {
+    if (error) {
+        error->position = 0;
+        error->function[0] = '\0';
+        error->token[0] = '\0';
+    }
+    enum MEMORY_TAG scope = MEMORY_SCOPE_BEGIN(MEMORY_SYMTABLE);
+    SymTable *table = symTableInit();
+    MEMORY_SCOPE_END(scope);
+    if (!table) return E_INTERNAL;
+
+    // the table keeps all the tokens, the names of the definitions point to them
+    CompilerContext ctx;
+    compilerContextInit(&ctx, table, out);
+    ctx.timing = timing;
+    scanner_init_buffer(source, length, &ctx);
+    StreamFunctions functions = {NULL, 0, 0};
+    size_t span = TIMING_BEGIN(timing, "prescan");
+    enum ERR_CODES err = streamPrescan(&ctx, &functions, error);
+    TIMING_END(timing, span, NULL);
+
+    if (err == SUCCESS) {
+        span = TIMING_BEGIN(timing, "stream");
+        err = streamFunctions(&ctx, &functions, cache, error);
+        TIMING_END(timing, span, NULL);
+    }
+
+    free(functions.functions);
+    symTableFree(&table);
+    return err;
+}
@@ -11,8 +11,10 @@
 
 #ifdef USE_CUSTOM_STRUCTURE
 #include "syntaxical/ast.h"
+#include "utility/statistics.h"
 #else 
 #include "ast.h"
+#include "statistics.h"
 #endif
 
 // Function to free the program
@@ -136,3 +138,64 @@ void freeStatement(Statement *statement) {
         break;
     }
 }
+
+// Function to count the expression and its operands and arguments
+static void countExpressionNodes(Expression *expr) {
+    if (!expr || expr->expr_type >= STATS_EXPRESSION_TYPES) return;
+    STATS_ADD(expressions[expr->expr_type], 1);
+
+    if (expr->expr_type == BinaryExpressionType) {
+        countExpressionNodes(expr->data.binary_expr.left);
+        countExpressionNodes(expr->data.binary_expr.right);
+    } else if (expr->expr_type == FunctionCallExpressionType) {
+        unsigned int size = getSize(expr->data.function_call.arguments);
+        for (unsigned int i = 0; i < size; i++) countExpressionNodes((Expression *)peekDataAtIndex(expr->data.function_call.arguments, i));
+    }
+}
+
+// Function to count the statements of the body and their expressions
+static void countBodyNodes(Body *body) {
+    unsigned int size = getSize(body->statements);
+    for (unsigned int i = 0; i < size; i++) {
+        Statement *statement = (Statement *)peekDataAtIndex(body->statements, i);
+        if (!statement || statement->type >= STATS_STATEMENT_TYPES) continue;
+        STATS_ADD(statements[statement->type], 1);
+
+        switch (statement->type) {
+        case FunctionCallStatementType: {
+            FunctionCall *call = &statement->data.function_call_statement;
+            unsigned int count = getSize(call->arguments);
+            for (unsigned int j = 0; j < count; j++) countExpressionNodes((Expression *)peekDataAtIndex(call->arguments, j));
+            break;
+        }
+        case VariableDefinitionStatementType:
+            countExpressionNodes(&statement->data.variable_definition_statement.value);
+            break;
+        case AssigmentStatementType:
+            countExpressionNodes(&statement->data.assigment_statement.value);
+            break;
+        case IfStatementType:
+            countExpressionNodes(&statement->data.if_statement.condition);
+            countBodyNodes(&statement->data.if_statement.if_body);
+            countBodyNodes(&statement->data.if_statement.else_body);
+            break;
+        case WhileStatementType:
+            countExpressionNodes(&statement->data.while_statement.condition);
+            countBodyNodes(&statement->data.while_statement.body);
+            break;
+        case ReturnStatementType:
+            if (!statement->data.return_statement.empty) countExpressionNodes(&statement->data.return_statement.value);
+            break;
+        default:
+            break;
+        }
+    }
+}
+
+// Function to count the nodes of the parsed function
+void countFunctionNodes(Function *function) {
+    if (!function) return;
+    STATS_ADD(functions, 1);
+    STATS_ADD(params, getSize(function->params));
+    countBodyNodes(&function->body);
+}
@@ -10,9 +10,9 @@
 #include <stdlib.h>
 
 #ifdef USE_CUSTOM_STRUCTURE
-#include "syntaxical/expression_ast.h"
+#include "syntaxical/ast.h"
 #else
-#include "expression_ast.h"
+#include "ast.h"
 #endif
 
 // Function to free the data type
@@ -40,6 +40,12 @@ void freeFunctionCall(FunctionCall *func_call) {
     }
 
     removeList(&func_call->arguments);
+
+    if (func_call->inlined_body) {
+        freeBody(func_call->inlined_body);
+        free(func_call->inlined_body);
+        func_call->inlined_body = NULL;
+    }
 }
 
 // Function to free Expression
@@ -71,6 +77,16 @@ void freeExpression(Expression *expr) {
     }
 }
 
+// Function to parse the binary value of a numeric literal
+void parseLiteralNumber(Literal *literal) {
+    if (!literal->value) return;
+
+    if (literal->data_type.data_type == dTypeI32)
+        literal->number.integer = strtoll(literal->value, NULL, 10);
+    else if (literal->data_type.data_type == dTypeF64)
+        literal->number.real = strtod(literal->value, NULL);
+}
+
 // Function to free a literal
 void freeLiteral(Literal *literal) {
     DEBUG_PRINT("Freeing literal");
@@ -11,58 +11,62 @@
 #ifdef USE_CUSTOM_STRUCTURE
 #include "syntaxical/parser.h"
 #include "syntaxical/precedent.h"
+#include "syntaxical/pipeline.h"
+#include "lexical/chunk_lexer.h"
 #include "utility/my_utils.h"
+#include "utility/work_pool.h"
+#include "utility/memory.h"
 #else
 #include "parser.h"
 #include "precedent.h"
+#include "pipeline.h"
+#include "chunk_lexer.h"
 #include "my_utils.h"
+#include "work_pool.h"
+#include "memory.h"
 #endif
 
-static unsigned int tokenIndex = 0;
-static LinkedList *buffer = NULL;
-static SymTable *table = NULL;
-static struct TOKEN token;
-enum ERR_CODES globalError = SUCCESS;
-
 // Function to get the current token
-TOKEN_PTR currentToken(void) {
-    return (TOKEN_PTR)getDataAtIndex(buffer, tokenIndex);
+TOKEN_PTR currentToken(CompilerContext *ctx) {
+    return (TOKEN_PTR)getDataAtIndex(ctx->buffer, ctx->tokenIndex);
 }
 
 // Function to get the next token
-TOKEN_PTR getNextToken(void) {
-    tokenIndex++;
-    return (TOKEN_PTR)getDataAtIndex(buffer, tokenIndex);
+TOKEN_PTR getNextToken(CompilerContext *ctx) {
+    ctx->tokenIndex++;
+    return (TOKEN_PTR)getDataAtIndex(ctx->buffer, ctx->tokenIndex);
 }
 
 // Function to match the token
-bool match(enum TOKEN_TYPE tokenType) {
-    TOKEN_PTR token = currentToken();
+bool match(enum TOKEN_TYPE tokenType, CompilerContext *ctx) {
+    TOKEN_PTR token = currentToken(ctx);
 
     if (!token || token->type != tokenType) {
+#ifdef DEBUG
         DEBUG_PRINT("Expected token type: ");
         printTokenType(tokenType);
         DEBUG_PRINT(" but got: ");
 
         if (token) {
-            printTokenType(currentToken()->type);
+            printTokenType(currentToken(ctx)->type);
         } else {
             DEBUG_PRINT("No token");
         }
+#endif
 
         return false;
     }
 
     DEBUG_PRINT("Matched token: \t%s\n", token->value);
-    getNextToken();
+    getNextToken(ctx);
     return true;
 }
 
 // Function to save a new token to the buffer
 bool saveNewToken(struct TOKEN token, LinkedList *buffer) {
     
-    // create a new token
-    TOKEN_PTR newToken = (TOKEN_PTR)malloc(sizeof(struct TOKEN));
+    // create a new token, it belongs to the scanner, the same as its value
+    TOKEN_PTR newToken = (TOKEN_PTR)MEMORY_MALLOC(MEMORY_SCANNER, sizeof(struct TOKEN));
     if (newToken == NULL) return false;
 
     newToken->type = token.type;    
@@ -71,28 +75,43 @@ bool saveNewToken(struct TOKEN token, LinkedList *buffer) {
     DEBUG_PRINT("SAVING TOKEN: %s\n", newToken->value);
     
     // save the token to the buffer
-    if (!insertNodeAtIndex(buffer, (void *)newToken, -1)) return false;
-    return true;
+    enum MEMORY_TAG scope = MEMORY_SCOPE_BEGIN(MEMORY_SCANNER);
+    bool inserted = insertNodeAtIndex(buffer, (void *)newToken, -1);
+    MEMORY_SCOPE_END(scope);
+    return inserted;
 }
 
 // Function to initialize the parser
-void parser_init(SymTable *tbl) {
-    buffer = tbl->tokenBuffer;
-    table = tbl;
+void parser_init(SymTable *tbl, CompilerContext *ctx) {
+    ctx->buffer = tbl->tokenBuffer;
+    ctx->table = tbl;
+    ctx->tokenIndex = 0;
+    ctx->globalError = SUCCESS;
 }
 
 // Functio to do the first pass over the program
-enum ERR_CODES firstPass(FILE *input, LinkedList *buffer) {
+enum ERR_CODES firstPass(FILE *input, LinkedList *buffer, CompilerContext *ctx) {
 
-    scanner_init(input);
+    // NULL keeps the source set by scanner_init_buffer
+    if (input) scanner_init(input, ctx);
     enum ERR_CODES status = SUCCESS;
+
+    // a big source in memory is lexed in chunks on more threads
+    if (!input && ctx->source && ctx->jobs > 1 && ctx->sourceLength >= CHUNK_LEXER_MIN_SOURCE) {
+        size_t errorPosition = ctx->sourceLength;
+        status = chunk_lexer_tokenize(ctx->source, ctx->sourceLength, ctx->jobs, CHUNK_LEXER_CHUNK_SIZE, buffer, &errorPosition);
+        ctx->sourcePosition = errorPosition;
+        if (status != SUCCESS) return status;
+        return (getSize(buffer) == 0) ? E_SYNTAX : SUCCESS;
+    }
+
     while (status == SUCCESS) {
         // get the token
-        status = scanner_get_token(&token);
-        if (!saveNewToken(token, buffer)) return E_INTERNAL;
+        status = scanner_get_token(&ctx->token, ctx);
+        if (!saveNewToken(ctx->token, buffer)) return E_INTERNAL;
         if (status != SUCCESS) return status;
         // save the token
-        if (token.type == TOKEN_EOF) break;
+        if (ctx->token.type == TOKEN_EOF) break;
     }
 
     // check, if we have the main function
@@ -101,11 +120,13 @@ enum ERR_CODES firstPass(FILE *input, LinkedList *buffer) {
 }
 
 // Function to parse the program
-enum ERR_CODES parser_parse(FILE *input, struct Program *program) {
+enum ERR_CODES parser_parse(FILE *input, struct Program *program, CompilerContext *ctx) {
     DEBUG_PRINT("parser_parse");
 
     // svae all the tokens to the buffer
-    enum ERR_CODES err = firstPass(input, buffer);
+    size_t span = TIMING_BEGIN(ctx->timing, "lex");
+    enum ERR_CODES err = firstPass(input, ctx->buffer, ctx);
+    TIMING_END(ctx->timing, span, NULL);
     if (err != SUCCESS) {
         DEBUG_PRINT("Error in first pass");
         DEBUG_PRINT("Error code: %d\n", err);
@@ -113,109 +134,264 @@ enum ERR_CODES parser_parse(FILE *input, struct Program *program) {
     }
 
     DEBUG_PRINT("parser_second_pass");
-    DEBUG_PRINT("Current token: %s\n", currentToken()->value);
+    DEBUG_PRINT("Current token: %s\n", currentToken(ctx)->value);
 
     // parse the program
-    if (!parse_program(program)) return (globalError == SUCCESS) ? E_SYNTAX : globalError;
+    span = TIMING_BEGIN(ctx->timing, "parse");
+    enum MEMORY_TAG scope = MEMORY_SCOPE_BEGIN(MEMORY_PARSER);
+    bool parsed = parse_program(program, ctx);
+    MEMORY_SCOPE_END(scope);
+    TIMING_END(ctx->timing, span, NULL);
+    if (!parsed) return (ctx->globalError == SUCCESS) ? E_SYNTAX : ctx->globalError;
     return SUCCESS;
 }
 
 // Function to parse the program
-bool parse_program(struct Program *program) {
+bool parse_program(struct Program *program, CompilerContext *ctx) {
     DEBUG_PRINT("Parsing <program>\n");
 
     // init the ast
     program->functions = initLinkedList(true);
-    if (!program->functions) {return false; globalError = E_INTERNAL;}
+    if (!program->functions) {return false; ctx->globalError = E_INTERNAL;}
 
-    if (!parse_prolog()) return false; // prolog
-    if (!parse_functions(program->functions)) return false; // prolog functions[0 - n] 
-    if (!match(TOKEN_EOF)) return false; // program EOF
+    if (ctx->pipeline && !pipelinePullFunction(ctx)) return false; // wait for the tokens of the prolog
+    if (!parse_prolog(ctx)) return false; // prolog
+    if (!parse_functions(program->functions, ctx)) return false; // prolog functions[0 - n] 
+    if (!match(TOKEN_EOF, ctx)) return false; // program EOF
 
     DEBUG_PRINT("Successfully parsed <program>\n");
     return true;
 }
 
 // Function to parse the prolog
-bool parse_prolog(void) {
+bool parse_prolog(CompilerContext *ctx) {
     DEBUG_PRINT("Parsing <prolog>\n");
 
-    if (!match(TOKEN_CONST)) return false; // const
-    if (!match(TOKEN_IFJ)) return false; // const ifj
-    if (!match(TOKEN_ASSIGN)) return false; // const ifj =
-    if (!match(TOKEN_AT)) return false; // const ifj = @
-    if (!match(TOKEN_IMPORT)) return false; // const ifj = @import
-    if (!match(TOKEN_LPAR)) return false; // const ifj = @import(
-    if (!match(TOKEN_STRING_LITERAL)) return false; // const ifj = @import("string")
-    tokenIndex--; // go back to the string literal
-    if (strcmp(currentToken()->value, "ifj24.zig") != 0) return false; // const ifj = @import("ifj24.zig"
-    tokenIndex++; // go to the next token
-    if (!match(TOKEN_RPAR)) return false; // const ifj = @import("ifj24.zig")
-    if (!match(TOKEN_SEMICOLON)) return false; // const ifj = @import("ifj24.zig");
+    if (!match(TOKEN_CONST, ctx)) return false; // const
+    if (!match(TOKEN_IFJ, ctx)) return false; // const ifj
+    if (!match(TOKEN_ASSIGN, ctx)) return false; // const ifj =
+    if (!match(TOKEN_AT, ctx)) return false; // const ifj = @
+    if (!match(TOKEN_IMPORT, ctx)) return false; // const ifj = @import
+    if (!match(TOKEN_LPAR, ctx)) return false; // const ifj = @import(
+    if (!match(TOKEN_STRING_LITERAL, ctx)) return false; // const ifj = @import("string")
+    ctx->tokenIndex--; // go back to the string literal
+    if (strcmp(currentToken(ctx)->value, "ifj24.zig") != 0) return false; // const ifj = @import("ifj24.zig"
+    ctx->tokenIndex++; // go to the next token
+    if (!match(TOKEN_RPAR, ctx)) return false; // const ifj = @import("ifj24.zig")
+    if (!match(TOKEN_SEMICOLON, ctx)) return false; // const ifj = @import("ifj24.zig");
 
     DEBUG_PRINT("Successfully parsed <prolog>\n");
     return true;
 }
 
 // Function to parse the functions
-bool parse_functions(LinkedList *functions) {
+bool parse_functions(LinkedList *functions, CompilerContext *ctx) {
     DEBUG_PRINT("Parsing <functions>\n");
 
-    while (parse_next_function()) {
+    // the functions do not depend on each other, bigger programs are parsed on more threads
+    bool parsed;
+    if (ctx->jobs > 1 && !ctx->pipeline && parse_functions_parallel(functions, ctx, &parsed)) return parsed;
+
+    // wait for the tokens of the whole next function
+    while ((!ctx->pipeline || pipelinePullFunction(ctx)) && parse_next_function(ctx)) {
 
         // alocate memory for ast
-        Function *function = malloc(sizeof(struct Function));
-        if (!function) {return false; globalError = E_INTERNAL;}
+        Function *function = MEMORY_MALLOC(MEMORY_AST, sizeof(struct Function));
+        if (!function) {return false; ctx->globalError = E_INTERNAL;}
         memset(function, 0, sizeof(struct Function));
 
         // init the ast
         function->params = initLinkedList(true);
-        if (!function->params) {return false; globalError = E_INTERNAL;}
-        if (!insertNodeAtIndex(functions, (void *)function, -1)) {return false; globalError = E_INTERNAL;}
+        if (!function->params) {return false; ctx->globalError = E_INTERNAL;}
+        if (!insertNodeAtIndex(functions, (void *)function, -1)) {return false; ctx->globalError = E_INTERNAL;}
 
         // parse the function
-        if (!parse_function(function)) return false;
+        if (!parse_function(function, ctx)) return false;
+        if (ctx->pipeline) pipelinePushFunction(ctx, function);
     }
+    if (ctx->pipeline && ctx->pipeline->status != SUCCESS) return false;
 
     DEBUG_PRINT("Successfully parsed <functions>\n");
     return true;
 }
 
+// Function to free the functions, that were not merged to the program
+static void parse_free_functions(FunctionParse *parses, unsigned int from, unsigned int count) {
+    for (unsigned int i = from; i < count; i++) {
+        if (!parses[i].function) continue;
+        freeFunction(parses[i].function);
+        free(parses[i].function);
+    }
+}
+
+// Function to parse the functions on the work pool
+bool parse_functions_parallel(LinkedList *functions, CompilerContext *ctx, bool *parsed) {
+    unsigned int size = getSize(ctx->buffer);
+    if (ctx->tokenIndex >= size) return false;
+
+    // the shared buffer cannot be walked by more threads, so the tokens are collected first
+    TOKEN_PTR *tokens = (TOKEN_PTR *)malloc(size * sizeof(TOKEN_PTR));
+    if (!tokens) return false;
+    for (unsigned int i = 0; i < size; i++) tokens[i] = (TOKEN_PTR)getDataAtIndex(ctx->buffer, i);
+
+    // split the functions, every one ends, where the braces of its body are matched
+    FunctionParse *parses = NULL;
+    unsigned int count = 0, capacity = 0;
+    unsigned int index = ctx->tokenIndex;
+    bool split = true;
+    while (split && index < size && tokens[index]->type == TOKEN_PUB) {
+        unsigned int end = index;
+        int depth = 0;
+        while (end < size && tokens[end]->type != TOKEN_LBRACE && tokens[end]->type != TOKEN_EOF) end++;
+        while (end < size && tokens[end]->type != TOKEN_EOF) {
+            if (tokens[end]->type == TOKEN_LBRACE) depth++;
+            if (tokens[end]->type == TOKEN_RBRACE && --depth == 0) break;
+            end++;
+        }
+        if (end >= size || tokens[end]->type != TOKEN_RBRACE) split = false;
+
+        if (split && count == capacity) {
+            capacity = capacity ? capacity * 2 : 64;
+            FunctionParse *bigger = (FunctionParse *)realloc(parses, capacity * sizeof(FunctionParse));
+            if (bigger) parses = bigger;
+            else split = false;
+        }
+        if (!split) break;
+
+        parses[count].function = NULL;
+        parses[count].tokens = tokens;
+        parses[count].start = index;
+        parses[count].end = end + 1;
+        parses[count].eof = tokens[size - 1];
+        parses[count].ctx = *ctx;
+        parses[count].ctx.buffer = NULL;
+        parses[count].ctx.tokenIndex = 0;
+        parses[count].ctx.globalError = SUCCESS;
+        parses[count].success = false;
+        count++;
+        index = end + 1;
+    }
+
+    // anything else after the functions is left for the sequential parser to report
+    if (index >= size || tokens[index]->type != TOKEN_EOF || count < PARALLEL_MIN_FUNCTIONS) split = false;
+    if (split) split = workPoolRun(count, ctx->jobs, parse_function_task, parses, NULL);
+
+    // the result is used only, if every function ended, where the sequential parser would end it
+    unsigned int failed = count;
+    for (unsigned int i = 0; i < count && split; i++) {
+        unsigned int length = parses[i].end - parses[i].start;
+        if (!parses[i].function || !parses[i].ctx.buffer) split = false;
+        else if (parses[i].success && parses[i].ctx.tokenIndex != length) split = false;
+        else if (!parses[i].success && parses[i].ctx.tokenIndex >= length) split = false;
+        else if (!parses[i].success) failed = i;
+        if (failed < count) break;
+    }
+
+    // merge in order, up to the first function with an error, the same as the sequential parser
+    unsigned int merged = 0;
+    if (split) {
+        *parsed = failed == count;
+        for (; merged < count && merged <= failed; merged++) {
+            if (!insertNodeAtIndex(functions, (void *)parses[merged].function, -1)) {
+                ctx->globalError = E_INTERNAL;
+                *parsed = false;
+                break;
+            }
+        }
+        if (failed < count) {
+            ctx->tokenIndex = parses[failed].start + parses[failed].ctx.tokenIndex;
+            if (ctx->globalError == SUCCESS) ctx->globalError = parses[failed].ctx.globalError;
+        } else {
+            ctx->tokenIndex = index;
+        }
+    }
+
+    parse_free_functions(parses, merged, count);
+    for (unsigned int i = 0; i < count; i++) removeList(&parses[i].ctx.buffer);
+    free(parses);
+    free(tokens);
+    return split;
+}
+
+// Function to copy the tokens of a single function to its own buffer and parse it
+static void parse_function_buffered(FunctionParse *parse, CompilerContext *ctx) {
+    // the buffer of the function ends with the EOF token, the same as the whole buffer
+    ctx->buffer = initLinkedList(false);
+    if (!ctx->buffer) return;
+    for (unsigned int i = parse->start; i < parse->end; i++) {
+        if (!insertNodeAtIndex(ctx->buffer, (void *)parse->tokens[i], -1)) return;
+    }
+    if (!insertNodeAtIndex(ctx->buffer, (void *)parse->eof, -1)) return;
+
+    // the same allocation as in parse_functions
+    Function *function = MEMORY_MALLOC(MEMORY_AST, sizeof(struct Function));
+    if (!function) return;
+    memset(function, 0, sizeof(struct Function));
+    function->params = initLinkedList(true);
+    parse->function = function;
+    if (!function->params) return;
+
+    parse->success = parse_function(function, ctx);
+}
+
+// Function to parse a single function on the work pool
+void parse_function_task(void *data, size_t index) {
+    FunctionParse *parse = &((FunctionParse *)data)[index];
+    CompilerContext *ctx = &parse->ctx;
+    enum MEMORY_TAG scope = MEMORY_SCOPE_BEGIN(MEMORY_PARSER);
+    parse_function_buffered(parse, ctx);
+    MEMORY_SCOPE_END(scope);
+}
+
 // Function to parse the function
-bool parse_function(struct Function *function) {
+bool parse_function(struct Function *function, CompilerContext *ctx) {
     DEBUG_PRINT("Parsing <function>\n");
 
-    if (!match(TOKEN_PUB)) return false; // pub
-    if (!match(TOKEN_FN)) return false; // pub fn
-    if (currentToken()->type != TOKEN_IDENTIFIER) return false; // pub fn identifier
+    // a function with an error is not timed, the compilation stops at it
+    size_t span = TIMING_BEGIN(ctx->timing, "parse function");
+    if (!parse_function_header(function, ctx)) return false; // pub fn identifier(params) ret_type {
+    if (!parse_func_body(&function->body, ctx)) return false; // pub fn identifier(params) ret_type { ...
+    if (!match(TOKEN_RBRACE, ctx)) return false; // pub fn identifier(params) ret_type { ... }
+    TIMING_END(ctx->timing, span, function->id.name);
+#ifdef COMPILER_STATS
+    countFunctionNodes(function);
+#endif
+
+    DEBUG_PRINT("Successfully parsed <function>\n");
+    return true;
+}
 
-    DEBUG_PRINT("Function name: %s\n", currentToken()->value);
+// Function to parse the header of the function
+bool parse_function_header(struct Function *function, CompilerContext *ctx) {
+    DEBUG_PRINT("Parsing <function_header>\n");
 
-    function->id.name = currentToken()->value;
-    if (!function->id.name) {return false; globalError = E_INTERNAL;}
-    getNextToken();
+    if (!match(TOKEN_PUB, ctx)) return false; // pub
+    if (!match(TOKEN_FN, ctx)) return false; // pub fn
+    if (currentToken(ctx)->type != TOKEN_IDENTIFIER) return false; // pub fn identifier
 
-    if (!match(TOKEN_LPAR)) return false; // pub fn identifier(
-    if (!parse_params(function->params)) return false; // pub fn identifier(params
-    if (!match(TOKEN_RPAR)) return false; // pub fn identifier(params)
-    if (!parse_data_type(&function->returnType)) return false; // pub fn identifier(params) ret_type
-    if (!match(TOKEN_LBRACE)) return false; // pub fn identifier(params) ret_type {
-    if (!parse_func_body(&function->body)) return false; // pub fn identifier(params) ret_type { ...
-    if (!match(TOKEN_RBRACE)) return false; // pub fn identifier(params) ret_type { ... }
+    DEBUG_PRINT("Function name: %s\n", currentToken(ctx)->value);
 
-    DEBUG_PRINT("Successfully parsed <function>\n");
+    function->id.name = currentToken(ctx)->value;
+    if (!function->id.name) {return false; ctx->globalError = E_INTERNAL;}
+    getNextToken(ctx);
+
+    if (!match(TOKEN_LPAR, ctx)) return false; // pub fn identifier(
+    if (!parse_params(function->params, ctx)) return false; // pub fn identifier(params
+    if (!match(TOKEN_RPAR, ctx)) return false; // pub fn identifier(params)
+    if (!parse_data_type(&function->returnType, ctx)) return false; // pub fn identifier(params) ret_type
+    if (!match(TOKEN_LBRACE, ctx)) return false; // pub fn identifier(params) ret_type {
     return true;
 }
 
 // Function to parse the next function
-bool parse_next_function(void) {
+bool parse_next_function(CompilerContext *ctx) {
     DEBUG_PRINT("Parsing <next_function>\n");
 
-    if (currentToken()->type == TOKEN_EOF) {
+    if (currentToken(ctx)->type == TOKEN_EOF) {
         DEBUG_PRINT("End of tokens reached, end the program.\n");
         return false;
     }
-    if (currentToken()->type != TOKEN_PUB) return false; 
+    if (currentToken(ctx)->type != TOKEN_PUB) return false; 
 
     // pub
     DEBUG_PRINT("Successfully parsed <next_function> (empty)\n");
@@ -223,26 +399,26 @@ bool parse_next_function(void) {
 }
 
 // Function to parse the parameters
-bool parse_params(LinkedList *params) {
+bool parse_params(LinkedList *params, CompilerContext *ctx) {
     DEBUG_PRINT("Parsing <params>\n");
 
     // Handle empty params case
-    if (currentToken()->type == TOKEN_RPAR) {
+    if (currentToken(ctx)->type == TOKEN_RPAR) {
         DEBUG_PRINT("Successfully parsed <params> (empty)\n");
         return true;
     }
 
     while (1) {
         // ast prepare
-        Param *param = malloc(sizeof(Param));
-        if (!param) {return false; globalError = E_INTERNAL;}
+        Param *param = MEMORY_MALLOC(MEMORY_AST, sizeof(Param));
+        if (!param) {return false; ctx->globalError = E_INTERNAL;}
         memset(param, 0, sizeof(Param));
-        if (!insertNodeAtIndex(params, (void *)param, -1)) {return false; globalError = E_INTERNAL;}
+        if (!insertNodeAtIndex(params, (void *)param, -1)) {return false; ctx->globalError = E_INTERNAL;}
 
         // parse the parameter
-        if (!parse_parameter(param)) return false;  
-        if (currentToken()->type != TOKEN_COMMA) break;
-        getNextToken();
+        if (!parse_parameter(param, ctx)) return false;  
+        if (currentToken(ctx)->type != TOKEN_COMMA) break;
+        getNextToken(ctx);
     }
 
     DEBUG_PRINT("Successfully parsed <params>\n");
@@ -250,46 +426,46 @@ bool parse_params(LinkedList *params) {
 }
 
 // Function to parse the parameter
-bool parse_parameter(Param *param) {
+bool parse_parameter(Param *param, CompilerContext *ctx) {
     DEBUG_PRINT("Parsing <parameter>\n");
 
     // Handle empty parameter case
-    if (currentToken()->type != TOKEN_IDENTIFIER) {
+    if (currentToken(ctx)->type != TOKEN_IDENTIFIER) {
         DEBUG_PRINT("Successfully parsed <parameter> (empty)\n");
         return true;
     }
 
     // save the parameter to the ast
-    DEBUG_PRINT("Parameter name: %s\n", currentToken()->value);
-    param->id.name = currentToken()->value;
-    if (!param->id.name) {return false; globalError = E_INTERNAL;}
-    getNextToken(); // consume identifier
+    DEBUG_PRINT("Parameter name: %s\n", currentToken(ctx)->value);
+    param->id.name = currentToken(ctx)->value;
+    if (!param->id.name) {return false; ctx->globalError = E_INTERNAL;}
+    getNextToken(ctx); // consume identifier
 
-    if (!match(TOKEN_COLON)) return false; // identifier :
-    if (!parse_data_type(&param->type)) return false; // identifier : ...
+    if (!match(TOKEN_COLON, ctx)) return false; // identifier :
+    if (!parse_data_type(&param->type, ctx)) return false; // identifier : ...
 
     DEBUG_PRINT("Successfully parsed <parameter>\n");
     return true;
 }
 
 // Function to parse the data type
-bool parse_func_call_params(LinkedList *attributes) {
+bool parse_func_call_params(LinkedList *attributes, CompilerContext *ctx) {
     DEBUG_PRINT("Parsing <function_call_params>\n");
 
-    if (currentToken()->type == TOKEN_RPAR) { // )
+    if (currentToken(ctx)->type == TOKEN_RPAR) { // )
         DEBUG_PRINT("Successfully parsed function parameters (empty)\n");
         return true;
     }
 
     while (1) {
-        Expression *expr = malloc(sizeof(Expression));
-        if (!expr) {return false; globalError = E_INTERNAL;}
+        Expression *expr = MEMORY_MALLOC(MEMORY_AST, sizeof(Expression));
+        if (!expr) {return false; ctx->globalError = E_INTERNAL;}
         memset(expr, 0, sizeof(Expression));
-        if (!insertNodeAtIndex(attributes, (void *)expr, -1)) {return false; globalError = E_INTERNAL;} 
+        if (!insertNodeAtIndex(attributes, (void *)expr, -1)) {return false; ctx->globalError = E_INTERNAL;} 
 
-        if (!parse_func_call_param(expr)) return false; // parse the parameter
-        if (currentToken()->type != TOKEN_COMMA) break;
-        getNextToken();
+        if (!parse_func_call_param(expr, ctx)) return false; // parse the parameter
+        if (currentToken(ctx)->type != TOKEN_COMMA) break;
+        getNextToken(ctx);
     }
 
     DEBUG_PRINT("Successfully parsed <function_call_params>\n");
@@ -297,55 +473,56 @@ bool parse_func_call_params(LinkedList *attributes) {
 }
 
 // Function to parse the function call parameter
-bool parse_func_call_param(Expression *expr) {
+bool parse_func_call_param(Expression *expr, CompilerContext *ctx) {
     DEBUG_PRINT("Parsing <function_call_param>\n");
 
     // empty params
-    if (currentToken()->type == TOKEN_RPAR) {
+    if (currentToken(ctx)->type == TOKEN_RPAR) {
         DEBUG_PRINT("Successfully parsed <function_call_params> (empty)\n");
         return true;
     }
 
     // literal
-    if (isLiteral(currentToken()->type)) {
-        DEBUG_PRINT("Data type: %s\n", currentToken()->value);
+    if (isLiteral(currentToken(ctx)->type)) {
+        DEBUG_PRINT("Data type: %s\n", currentToken(ctx)->value);
 
         expr->expr_type = LiteralExpressionType;
-        expr->data.literal.value = currentToken()->value;
-        if (!expr->data.literal.value) {return false; globalError = E_INTERNAL;}
+        expr->data.literal.value = currentToken(ctx)->value;
+        if (!expr->data.literal.value) {return false; ctx->globalError = E_INTERNAL;}
 
-        expr->data_type.data_type = covertTokneDataType(currentToken()->type);
+        expr->data_type.data_type = covertTokneDataType(currentToken(ctx)->type);
         expr->data.literal.data_type = expr->data_type;
+        parseLiteralNumber(&expr->data.literal);
 
-        getNextToken();
+        getNextToken(ctx);
         return true;
     }
 
     // identifier
-    if (currentToken()->type == TOKEN_IDENTIFIER) {
+    if (currentToken(ctx)->type == TOKEN_IDENTIFIER) {
 
-        DEBUG_PRINT("Identifier: %s\n", currentToken()->value);
+        DEBUG_PRINT("Identifier: %s\n", currentToken(ctx)->value);
 
         expr->expr_type = IdentifierExpressionType;
-        expr->data.identifier.name = currentToken()->value;
-        if (!expr->data.identifier.name) {return false; globalError = E_INTERNAL;} 
+        expr->data.identifier.name = currentToken(ctx)->value;
+        if (!expr->data.identifier.name) {return false; ctx->globalError = E_INTERNAL;} 
 
-        getNextToken();
+        getNextToken(ctx);
         return true;
     }
 
     // string literal
-    if (currentToken()->type == TOKEN_STRING_LITERAL) {
-        DEBUG_PRINT("String: %s\n", currentToken()->value);
+    if (currentToken(ctx)->type == TOKEN_STRING_LITERAL) {
+        DEBUG_PRINT("String: %s\n", currentToken(ctx)->value);
 
         expr->expr_type = LiteralExpressionType;
-        expr->data.literal.value = currentToken()->value;
-        if (!expr->data.literal.value) {return false; globalError = E_INTERNAL;}
+        expr->data.literal.value = currentToken(ctx)->value;
+        if (!expr->data.literal.value) {return false; ctx->globalError = E_INTERNAL;}
 
         expr->data_type.data_type = dTypeU8;
         expr->data.literal.data_type = expr->data_type;
 
-        getNextToken();
+        getNextToken(ctx);
         return true;
     }
 
@@ -354,57 +531,57 @@ bool parse_func_call_param(Expression *expr) {
 }
 
 // Function to parse the data type
-bool parse_data_type(DataType *data_type) {
+bool parse_data_type(DataType *data_type, CompilerContext *ctx) {
     DEBUG_PRINT("Parsing <data_type>\n");
 
     // Check if the data type is nullable
-    if (currentToken()->type == TOKEN_QUESTION_MARK) { 
+    if (currentToken(ctx)->type == TOKEN_QUESTION_MARK) { 
         data_type->is_nullable = true;
-        getNextToken();
+        getNextToken(ctx);
     }
 
     // Check if the data type is valid
-    if (!isDataType(currentToken()->type)) {
-        DEBUG_PRINT("Expected data type but got: %s\n", currentToken()->value);
+    if (!isDataType(currentToken(ctx)->type)) {
+        DEBUG_PRINT("Expected data type but got: %s\n", currentToken(ctx)->value);
         return false;
     }
 
-    data_type->data_type = covertTokneDataType(currentToken()->type);
-    getNextToken();
+    data_type->data_type = covertTokneDataType(currentToken(ctx)->type);
+    getNextToken(ctx);
 
     DEBUG_PRINT("Successfully parsed <data_type>: %d\n", data_type->data_type);
     return true;
 }
 
 // Function to parse the function body
-bool parse_func_body(Body *body) {
+bool parse_func_body(Body *body, CompilerContext *ctx) {
     DEBUG_PRINT("Parsing <func_body>\n");
-    if (!parse_body(body)) return false;
+    if (!parse_body(body, ctx)) return false;
 
     DEBUG_PRINT("Successfully parsed <func_body>\n");
     return true;
 }
 
 // Function to parse the body
-bool parse_body(Body *body) {
+bool parse_body(Body *body, CompilerContext *ctx) {
     DEBUG_PRINT("Parsing <body>\n");
 
     // empty body
-    if (currentToken()->type == TOKEN_RBRACE) {
+    if (currentToken(ctx)->type == TOKEN_RBRACE) {
         DEBUG_PRINT("Successfully parsed <body> (empty)\n");
         return true;
     }
 
     body->statements = initLinkedList(true);
-    if (!body->statements) {return false; globalError = E_INTERNAL;}
+    if (!body->statements) {return false; ctx->globalError = E_INTERNAL;}
 
-    while (parse_body_content_next()) {
-        Statement *statement = malloc(sizeof(Statement));
-        if (!statement) {return false; globalError = E_INTERNAL;}
+    while (parse_body_content_next(ctx)) {
+        Statement *statement = MEMORY_MALLOC(MEMORY_AST, sizeof(Statement));
+        if (!statement) {return false; ctx->globalError = E_INTERNAL;}
         memset(statement, 0, sizeof(Statement));
 
-        if (!insertNodeAtIndex(body->statements, (void *)statement, -1)) {return false; globalError = E_INTERNAL;}
-        if (!parse_body_content(statement)) return false;
+        if (!insertNodeAtIndex(body->statements, (void *)statement, -1)) {return false; ctx->globalError = E_INTERNAL;}
+        if (!parse_body_content(statement, ctx)) return false;
     }
 
     DEBUG_PRINT("Successfully parsed <body>\n");
@@ -412,10 +589,10 @@ bool parse_body(Body *body) {
 }
 
 // Function to parse the body content
-bool parse_body_content(struct Statement *statement) {
+bool parse_body_content(struct Statement *statement, CompilerContext *ctx) {
     DEBUG_PRINT("Parsing <body_content>\n");
 
-    TOKEN_PTR token = currentToken();
+    TOKEN_PTR token = currentToken(ctx);
     TOKEN_PTR nextToken;
 
     // printf("Deciding on token: \t%s\n", token->value);
@@ -423,41 +600,41 @@ bool parse_body_content(struct Statement *statement) {
     case TOKEN_CONST:
     case TOKEN_VAR:
         statement->type = VariableDefinitionStatementType;
-        return parse_var_def(&statement->data.variable_definition_statement);
+        return parse_var_def(&statement->data.variable_definition_statement, ctx);
 		
     case TOKEN_IF:
         statement->type = IfStatementType;
-        return parse_if(&statement->data.if_statement);
+        return parse_if(&statement->data.if_statement, ctx);
 
     case TOKEN_WHILE:
         statement->type = WhileStatementType;
-        return parse_while(&statement->data.while_statement);
+        return parse_while(&statement->data.while_statement, ctx);
 
     case TOKEN_RETURN:
         statement->type = ReturnStatementType;
-        getNextToken(); // Consume 'return'
-        if (!parse_ret_value(&statement->data.return_statement)) return false;
-        return match(TOKEN_SEMICOLON);
+        getNextToken(ctx); // Consume 'return'
+        if (!parse_ret_value(&statement->data.return_statement, ctx)) return false;
+        return match(TOKEN_SEMICOLON, ctx);
 
     case TOKEN_IDENTIFIER:
-        nextToken = getDataAtIndex(buffer, tokenIndex + 1);
+        nextToken = getDataAtIndex(ctx->buffer, ctx->tokenIndex + 1);
         if (nextToken && nextToken->type == TOKEN_ASSIGN) {
             statement->type = AssigmentStatementType;
-            return parse_var_assign(&statement->data.assigment_statement);
+            return parse_var_assign(&statement->data.assigment_statement, ctx);
         }
 
         statement->type = FunctionCallStatementType;
-        return parse_func_call_statement(&statement->data.function_call_statement);
+        return parse_func_call_statement(&statement->data.function_call_statement, ctx);
 
 	case TOKEN_IFJ: 
         statement->type = FunctionCallStatementType;
-        if (!parse_native_func_call(&statement->data.function_call_statement)) return false;
-		if (!match(TOKEN_SEMICOLON)) return false;
+        if (!parse_native_func_call(&statement->data.function_call_statement, ctx)) return false;
+		if (!match(TOKEN_SEMICOLON, ctx)) return false;
 		return true; 
 
     case TOKEN_DELETE_VALUE:
         statement->type = AssigmentStatementType;
-        return parse_var_assign(&statement->data.assigment_statement);
+        return parse_var_assign(&statement->data.assigment_statement, ctx);
 
     default:
         DEBUG_PRINT("Syntax error: unexpected token %s\n, expected: const, var, if, while, return, "" identifier, ifj, _", token->value);
@@ -468,8 +645,8 @@ bool parse_body_content(struct Statement *statement) {
 }
 
 // Function to parse the next body content
-bool parse_body_content_next(void) {
-    switch (currentToken()->type) {
+bool parse_body_content_next(CompilerContext *ctx) {
+    switch (currentToken(ctx)->type) {
         case TOKEN_IDENTIFIER:
         case TOKEN_CONST:
         case TOKEN_IF:
@@ -485,56 +662,56 @@ bool parse_body_content_next(void) {
 }
 
 // Function to parse the variable definition
-bool parse_var_def(VariableDefinitionStatement *variable_definition_statement) {
+bool parse_var_def(VariableDefinitionStatement *variable_definition_statement, CompilerContext *ctx) {
     DEBUG_PRINT("Parsing <var_def>\n");
 
     // Check if it starts with 'const' or 'var'
-    if (currentToken()->type != TOKEN_CONST && currentToken()->type != TOKEN_VAR) return false; // const | var
+    if (currentToken(ctx)->type != TOKEN_CONST && currentToken(ctx)->type != TOKEN_VAR) return false; // const | var
 
     // ast save
-    if (currentToken()->type == TOKEN_CONST) {
+    if (currentToken(ctx)->type == TOKEN_CONST) {
         variable_definition_statement->isConst = true;
     } else {
         variable_definition_statement->isConst = false;
     }
-    getNextToken();
+    getNextToken(ctx);
 
     // Variable identifier
-    if (currentToken()->type != TOKEN_IDENTIFIER) return false; // const | var identifier
+    if (currentToken(ctx)->type != TOKEN_IDENTIFIER) return false; // const | var identifier
 
     // ast save
-    variable_definition_statement->id.name = currentToken()->value;
+    variable_definition_statement->id.name = currentToken(ctx)->value;
     if (!variable_definition_statement->id.name) return false;
-    getNextToken();
+    getNextToken(ctx);
 
     // Variable type (not required)
-    if (currentToken()->type == TOKEN_COLON) {
-        if (!match(TOKEN_COLON)) return false; // const | var identifier :
-        if (!parse_data_type(&variable_definition_statement->type)) return false; // const | var identifier : ...
+    if (currentToken(ctx)->type == TOKEN_COLON) {
+        if (!match(TOKEN_COLON, ctx)) return false; // const | var identifier :
+        if (!parse_data_type(&variable_definition_statement->type, ctx)) return false; // const | var identifier : ...
     } else {
         variable_definition_statement->type.data_type = dTypeNone;
         variable_definition_statement->type.is_nullable = false;
     }
 
-    if (!match(TOKEN_ASSIGN)) return false; // const | var identifier ... =
+    if (!match(TOKEN_ASSIGN, ctx)) return false; // const | var identifier ... =
 
     // parser the right side of the expression
-    if (!parse_no_truth_expr(&variable_definition_statement->value)) return false; // const | var identifier ... = ...
-    if (!match(TOKEN_SEMICOLON)) return false; // const | var identifier ... = ... ;
+    if (!parse_no_truth_expr(&variable_definition_statement->value, ctx)) return false; // const | var identifier ... = ...
+    if (!match(TOKEN_SEMICOLON, ctx)) return false; // const | var identifier ... = ... ;
 
     DEBUG_PRINT("Successfully parsed <var_def>\n");
     return true;
 }
 
 // Function to parse the if statement
-bool parse_if(IfStatement *if_statement) {
+bool parse_if(IfStatement *if_statement, CompilerContext *ctx) {
     DEBUG_PRINT("Parsing <if>\n");
 
-    if (!match(TOKEN_IF)) return false;
-    if (!match(TOKEN_LPAR)) return false;
+    if (!match(TOKEN_IF, ctx)) return false;
+    if (!match(TOKEN_LPAR, ctx)) return false;
 
-    TOKEN_PTR curToken = currentToken();
-    TOKEN_PTR nextToken = getNextToken();
+    TOKEN_PTR curToken = currentToken(ctx);
+    TOKEN_PTR nextToken = getNextToken(ctx);
 
     DEBUG_PRINT("Current token: %s\n", curToken->value);
     DEBUG_PRINT("Next token: %s\n", nextToken->value);
@@ -545,65 +722,65 @@ bool parse_if(IfStatement *if_statement) {
         // save the current token into the expression ..
         if_statement->condition.expr_type = IdentifierExpressionType;
         if_statement->condition.data.identifier.name = curToken->value;
-        if (!if_statement->condition.data.identifier.name) {return false; globalError = E_INTERNAL;}
+        if (!if_statement->condition.data.identifier.name) {return false; ctx->globalError = E_INTERNAL;}
 
-        tokenIndex++;
-        if (!match(TOKEN_PIPE)) return false;
-        if (!match(TOKEN_IDENTIFIER)) return false;
-        tokenIndex--;
+        ctx->tokenIndex++;
+        if (!match(TOKEN_PIPE, ctx)) return false;
+        if (!match(TOKEN_IDENTIFIER, ctx)) return false;
+        ctx->tokenIndex--;
 
         // saving the not nullable var name
-        if_statement->non_nullable.name = currentToken()->value;
+        if_statement->non_nullable.name = currentToken(ctx)->value;
         if (!if_statement->non_nullable.name) return false;
-        tokenIndex++;
-        if (!match(TOKEN_PIPE)) return false;
+        ctx->tokenIndex++;
+        if (!match(TOKEN_PIPE, ctx)) return false;
         DEBUG_PRINT("Successfully parsed if (a) |na|\n");
 
         // handeling if (exp) {...}
     } else {
         DEBUG_PRINT("Handeling if (exp) {...}\n");
-        tokenIndex--; // got back to the start of the expression
-        if (!parse_truth_expr(&if_statement->condition)) return false;
-        if (!match(TOKEN_RPAR)) return false;
+        ctx->tokenIndex--; // got back to the start of the expression
+        if (!parse_truth_expr(&if_statement->condition, ctx)) return false;
+        if (!match(TOKEN_RPAR, ctx)) return false;
         DEBUG_PRINT("Successfully parsed if (exp)\n");
     }
     // checking the if else bodyes
-    if (!match(TOKEN_LBRACE)) return false; // if () {
-    if (!parse_body(&if_statement->if_body)) return false; // if () { ...
-    if (!match(TOKEN_RBRACE)) return false; // if () { ... }
-    if (!parse_else(if_statement)) return false; // if () { ... } else { ... }
+    if (!match(TOKEN_LBRACE, ctx)) return false; // if () {
+    if (!parse_body(&if_statement->if_body, ctx)) return false; // if () { ...
+    if (!match(TOKEN_RBRACE, ctx)) return false; // if () { ... }
+    if (!parse_else(if_statement, ctx)) return false; // if () { ... } else { ... }
 
     DEBUG_PRINT("Successfully parsed <if>\n");
     return true;
 }
 
 // Function to parse the else statement
-bool parse_else(IfStatement *if_statement) {
+bool parse_else(IfStatement *if_statement, CompilerContext *ctx) {
     DEBUG_PRINT("Parsing <else>\n");
 
-    if (currentToken()->type != TOKEN_ELSE) { // else
+    if (currentToken(ctx)->type != TOKEN_ELSE) { // else
         DEBUG_PRINT("No else clause found\n");
         return false;
     }
 
-    getNextToken();
-    if (!match(TOKEN_LBRACE)) return false; // else {
-    if (!parse_body(&if_statement->else_body)) return false; // else { ...
-    if (!match(TOKEN_RBRACE)) return false; // else { ... }
+    getNextToken(ctx);
+    if (!match(TOKEN_LBRACE, ctx)) return false; // else {
+    if (!parse_body(&if_statement->else_body, ctx)) return false; // else { ...
+    if (!match(TOKEN_RBRACE, ctx)) return false; // else { ... }
 
     DEBUG_PRINT("Successfully parsed <else>\n");
     return true;
 }
 
 // Function to parse the while statement
-bool parse_while(WhileStatement *while_statement) {
+bool parse_while(WhileStatement *while_statement, CompilerContext *ctx) {
     DEBUG_PRINT("Parsing <while>\n");
 
-    if (!match(TOKEN_WHILE)) return false; // while
-    if (!match(TOKEN_LPAR)) return false; // while (
+    if (!match(TOKEN_WHILE, ctx)) return false; // while
+    if (!match(TOKEN_LPAR, ctx)) return false; // while (
 
-    TOKEN_PTR curToken = currentToken();
-    TOKEN_PTR nextToken = getNextToken();
+    TOKEN_PTR curToken = currentToken(ctx);
+    TOKEN_PTR nextToken = getNextToken(ctx);
 
     // handeling while (a) |na| {...}
     if (curToken->type == TOKEN_IDENTIFIER && nextToken->type == TOKEN_RPAR) {
@@ -611,203 +788,208 @@ bool parse_while(WhileStatement *while_statement) {
         // save the current token into the expression ..
         while_statement->condition.expr_type = IdentifierExpressionType;
         while_statement->condition.data.identifier.name = curToken->value;
-        if (!while_statement->condition.data.identifier.name)  {return false; globalError = E_INTERNAL;}
+        if (!while_statement->condition.data.identifier.name)  {return false; ctx->globalError = E_INTERNAL;}
 
-        tokenIndex++;
-        if (!match(TOKEN_PIPE)) return false;
-        if (!match(TOKEN_IDENTIFIER)) return false;
-        tokenIndex--;
+        ctx->tokenIndex++;
+        if (!match(TOKEN_PIPE, ctx)) return false;
+        if (!match(TOKEN_IDENTIFIER, ctx)) return false;
+        ctx->tokenIndex--;
 
         // saving the not nullable var name
-        while_statement->non_nullable.name = currentToken()->value;
+        while_statement->non_nullable.name = currentToken(ctx)->value;
         if (!while_statement->non_nullable.name) return false;
-        tokenIndex++;
-        if (!match(TOKEN_PIPE)) return false;
+        ctx->tokenIndex++;
+        if (!match(TOKEN_PIPE, ctx)) return false;
 
     // handeling while (exp) {...}
     } else {
-        tokenIndex--; // got back to the start of the expression
-        if (!parse_truth_expr(&while_statement->condition)) return false;
-        if (!match(TOKEN_RPAR)) return false;
+        ctx->tokenIndex--; // got back to the start of the expression
+        if (!parse_truth_expr(&while_statement->condition, ctx)) return false;
+        if (!match(TOKEN_RPAR, ctx)) return false;
     }
 
-    if (!match(TOKEN_LBRACE)) return false; // while () {
-    if (!parse_body(&while_statement->body)) return false; // while () { ...
-    if (!match(TOKEN_RBRACE)) return false; // while () { ... }
+    if (!match(TOKEN_LBRACE, ctx)) return false; // while () {
+    if (!parse_body(&while_statement->body, ctx)) return false; // while () { ...
+    if (!match(TOKEN_RBRACE, ctx)) return false; // while () { ... }
 
     DEBUG_PRINT("Successfully parsed <while>\n");
     return true;
 }
 
 // Function to parse the return statement
-bool parse_ret_value(ReturnStatement *return_statement) {
+bool parse_ret_value(ReturnStatement *return_statement, CompilerContext *ctx) {
     DEBUG_PRINT("Parsing <ret_value>\n");
 
     // Check for empty return
-    if (currentToken()->type == TOKEN_SEMICOLON) {
+    if (currentToken(ctx)->type == TOKEN_SEMICOLON) {
         return_statement->empty = true;
         DEBUG_PRINT("Empty return value\n");
         return true;
     }
 
     return_statement->empty = false;
-    if (!parse_no_truth_expr(&return_statement->value)) return false;
+    if (!parse_no_truth_expr(&return_statement->value, ctx)) return false;
 
     DEBUG_PRINT("Successfully parsed <ret_value>\n");
     return true;
 }
 
 // Function to parse the native function call
-bool parse_native_func_call(FunctionCall *function_call) {
+bool parse_native_func_call(FunctionCall *function_call, CompilerContext *ctx) {
     DEBUG_PRINT("Parsing <native_func_call>\n");
 
-	if (currentToken()->type != TOKEN_IFJ) return false;
-    getNextToken();
+	if (currentToken(ctx)->type != TOKEN_IFJ) return false;
+    getNextToken(ctx);
 
-    if (!match(TOKEN_CONCATENATE)) return false; // ifj.
-    if (!match(TOKEN_IDENTIFIER)) return false; // ifj.identifier
-	tokenIndex--; 
+    if (!match(TOKEN_CONCATENATE, ctx)) return false; // ifj.
+    if (!match(TOKEN_IDENTIFIER, ctx)) return false; // ifj.identifier
+	ctx->tokenIndex--; 
 
     // save the func call to the ast
-    char *func_name = malloc(strlen(currentToken()->value) + 6);
+    char *func_name = malloc(strlen(currentToken(ctx)->value) + 6);
     if (!func_name) return false;
 
     strcpy(func_name, "$ifj_");
-    strcat(func_name, currentToken()->value);
+    strcat(func_name, currentToken(ctx)->value);
 
-    free(currentToken()->value);
-    currentToken()->value = func_name;
-	tokenIndex++; 
+    free(currentToken(ctx)->value);
+    currentToken(ctx)->value = func_name;
+	ctx->tokenIndex++; 
 
     function_call->func_id.name = func_name;
     function_call->arguments = initLinkedList(true);
 
-    if (!function_call->arguments) {return false; globalError = E_INTERNAL;}
-    if (!match(TOKEN_LPAR)) return false; // ifj.identifier(
-    if (!parse_func_call_params(function_call->arguments)) return false; // ifj.identifier(...)
-    if (!match(TOKEN_RPAR)) return false; // ifj.identifier(...)
+    if (!function_call->arguments) {return false; ctx->globalError = E_INTERNAL;}
+    if (!match(TOKEN_LPAR, ctx)) return false; // ifj.identifier(
+    if (!parse_func_call_params(function_call->arguments, ctx)) return false; // ifj.identifier(...)
+    if (!match(TOKEN_RPAR, ctx)) return false; // ifj.identifier(...)
 
     DEBUG_PRINT("Successfully parsed <native_func_call>\n");
     return true;
 }
 
 // Function to parse the user function call
-bool parse_user_func_call(FunctionCall *function_call) {
+bool parse_user_func_call(FunctionCall *function_call, CompilerContext *ctx) {
     DEBUG_PRINT("Parsing <user_func_call>\n");
 
-    if (currentToken()->type != TOKEN_IDENTIFIER) return false; // identifier
+    if (currentToken(ctx)->type != TOKEN_IDENTIFIER) return false; // identifier
 
     // add to the ast
-    function_call->func_id.name = currentToken()->value;
-    if (!function_call->func_id.name) {return false; globalError = E_INTERNAL;}
+    function_call->func_id.name = currentToken(ctx)->value;
+    if (!function_call->func_id.name) {return false; ctx->globalError = E_INTERNAL;}
 
     function_call->arguments = initLinkedList(true);
-    if (!function_call->arguments) {return false; globalError = E_INTERNAL;}
-    getNextToken();
+    if (!function_call->arguments) {return false; ctx->globalError = E_INTERNAL;}
+    getNextToken(ctx);
 
-    if (!match(TOKEN_LPAR)) return false; // identifier(
-    if (!parse_func_call_params(function_call->arguments)) return false; // identifier(...
-    if (!match(TOKEN_RPAR)) return false; // identifier(...)
+    if (!match(TOKEN_LPAR, ctx)) return false; // identifier(
+    if (!parse_func_call_params(function_call->arguments, ctx)) return false; // identifier(...
+    if (!match(TOKEN_RPAR, ctx)) return false; // identifier(...)
 
     DEBUG_PRINT("Successfully parsed <user_func_call>\n");
     return true;
 }
 
 // Function to parse the function call statement
-bool parse_func_call_statement(FunctionCall *function_call) {
+bool parse_func_call_statement(FunctionCall *function_call, CompilerContext *ctx) {
     DEBUG_PRINT("Parsing <func_call_statement>\n");
 
-    if (currentToken()->type != TOKEN_IDENTIFIER) return false; // identifier
-    if (!parse_user_func_call(function_call)) return false; // identifier(...)
-    if (!match(TOKEN_SEMICOLON)) return false; // identifier(...);
+    if (currentToken(ctx)->type != TOKEN_IDENTIFIER) return false; // identifier
+    if (!parse_user_func_call(function_call, ctx)) return false; // identifier(...)
+    if (!match(TOKEN_SEMICOLON, ctx)) return false; // identifier(...);
 
     DEBUG_PRINT("Successfully parsed <func_call_statement>\n");
     return true;
 }
 
 // Function to parse the variable assignment
-bool parse_var_assign(AssigmentStatement *assign_statement) {
+bool parse_var_assign(AssigmentStatement *assign_statement, CompilerContext *ctx) {
     DEBUG_PRINT("Parsing <var_assign>\n");
 
-    if (currentToken()->type != TOKEN_IDENTIFIER && currentToken()->type != TOKEN_DELETE_VALUE) return false; // identifier || _
+    if (currentToken(ctx)->type != TOKEN_IDENTIFIER && currentToken(ctx)->type != TOKEN_DELETE_VALUE) return false; // identifier || _
 
     // save to the ast
-    assign_statement->id.name = currentToken()->value;
+    assign_statement->id.name = currentToken(ctx)->value;
     if (!assign_statement->id.name) return false;
-    if (currentToken()->type == TOKEN_DELETE_VALUE) assign_statement->discard = true;
-    getNextToken();
+    if (currentToken(ctx)->type == TOKEN_DELETE_VALUE) assign_statement->discard = true;
+    getNextToken(ctx);
 
-    if (!match(TOKEN_ASSIGN)) return false; // identifier =
-    if (!parse_no_truth_expr(&assign_statement->value)) return false; // identifier = ...
-    if (!match(TOKEN_SEMICOLON)) return false; // identifier = ...;
+    if (!match(TOKEN_ASSIGN, ctx)) return false; // identifier =
+    if (!parse_no_truth_expr(&assign_statement->value, ctx)) return false; // identifier = ...
+    if (!match(TOKEN_SEMICOLON, ctx)) return false; // identifier = ...;
 
     DEBUG_PRINT("Successfully parsed <var_assign>\n");
     return true;
 }
 
 // Function to parse the no truth expression
-bool parse_no_truth_expr(Expression *expr) {
+bool parse_no_truth_expr(Expression *expr, CompilerContext *ctx) {
     DEBUG_PRINT("Parsing <no_truth_expr>\n");
-    DEBUG_PRINT("Current token: %s\n", currentToken()->value);
+    DEBUG_PRINT("Current token: %s\n", currentToken(ctx)->value);
 
-    if (currentToken()->type == TOKEN_IDENTIFIER || isLiteral(currentToken()->type)) {
-        TOKEN_PTR nextToken = getDataAtIndex(buffer, tokenIndex + 1);
+    if (currentToken(ctx)->type == TOKEN_IDENTIFIER || isLiteral(currentToken(ctx)->type)) {
+        TOKEN_PTR nextToken = getDataAtIndex(ctx->buffer, ctx->tokenIndex + 1);
 
         // = <identifier>; or = <literal>;
         if (nextToken && nextToken->type == TOKEN_SEMICOLON) {
             // = <identifier>;
-            if (currentToken()->type == TOKEN_IDENTIFIER) {
+            if (currentToken(ctx)->type == TOKEN_IDENTIFIER) {
                 DEBUG_PRINT("Identifier ending with ;");
                 expr->expr_type = IdentifierExpressionType;
-                expr->data.identifier.name = currentToken()->value;
-                getNextToken(); // move to semicolon
+                expr->data.identifier.name = currentToken(ctx)->value;
+                getNextToken(ctx); // move to semicolon
                 return true;
             }
 
             // = <literal>;
-            if (isLiteral(currentToken()->type)) {
+            if (isLiteral(currentToken(ctx)->type)) {
                 DEBUG_PRINT("Literar ending with ;");
                 expr->expr_type = LiteralExpressionType;
-                expr->data.literal.value = currentToken()->value;
-                if (currentToken()->type == TOKEN_NULL) { // handeling of null;
+                expr->data.literal.value = currentToken(ctx)->value;
+                if (currentToken(ctx)->type == TOKEN_NULL) { // handeling of null;
                     expr->data.literal.data_type.is_nullable = true;
                     expr->data.literal.data_type.data_type = dTypeNone;
                     expr->data.literal.value = NULL;
                 } else {
                     expr->data.literal.data_type.is_nullable = false;
-                    expr->data.literal.data_type.data_type = covertTokneDataType(currentToken()->type);
+                    expr->data.literal.data_type.data_type = covertTokneDataType(currentToken(ctx)->type);
+                    parseLiteralNumber(&expr->data.literal);
                 }
 
-                getNextToken(); // move to semicolon
+                getNextToken(ctx); // move to semicolon
                 return true;
             }
         }
 
         // = <identifier>(...)
-        if (currentToken()->type == TOKEN_IDENTIFIER && nextToken && nextToken->type == TOKEN_LPAR) {
+        if (currentToken(ctx)->type == TOKEN_IDENTIFIER && nextToken && nextToken->type == TOKEN_LPAR) {
             expr->expr_type = FunctionCallExpressionType;
-            return parse_user_func_call(&expr->data.function_call);
+            return parse_user_func_call(&expr->data.function_call, ctx);
         }
     } 
 
-	if (currentToken()->type == TOKEN_IFJ) {
+	if (currentToken(ctx)->type == TOKEN_IFJ) {
 		expr->expr_type = FunctionCallExpressionType;
-		return parse_native_func_call(&expr->data.function_call);
+		return parse_native_func_call(&expr->data.function_call, ctx);
 	}
 
-    enum ERR_CODES err = startPrecedentAnalysis(buffer, &tokenIndex, true, expr);
+    enum MEMORY_TAG scope = MEMORY_SCOPE_BEGIN(MEMORY_PRECEDENCE);
+    enum ERR_CODES err = startPrecedentAnalysis(ctx->buffer, &ctx->tokenIndex, true, expr);
+    MEMORY_SCOPE_END(scope);
     if (err != SUCCESS) return false;
     return true;
 }
 
 // Function to parse the truth expression
-bool parse_truth_expr(Expression *expr) {
+bool parse_truth_expr(Expression *expr, CompilerContext *ctx) {
     DEBUG_PRINT("Parsing <truth_expr>\n");
 
-    enum ERR_CODES err = startPrecedentAnalysis(buffer, &tokenIndex, false, expr);
+    enum MEMORY_TAG scope = MEMORY_SCOPE_BEGIN(MEMORY_PRECEDENCE);
+    enum ERR_CODES err = startPrecedentAnalysis(ctx->buffer, &ctx->tokenIndex, false, expr);
+    MEMORY_SCOPE_END(scope);
     if (err != SUCCESS) {
-        printf("Error in startPrecedentAnalysis: %d\n", err);
-        globalError = err;
+        DEBUG_PRINT("Error in startPrecedentAnalysis: %d\n", err);
+        ctx->globalError = err;
         return false;
     }
     return true;
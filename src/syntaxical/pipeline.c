@@ -0,0 +1,166 @@
+/** AUTHOR
+ *
+ * @author agent <agent@local>
+ * @file pipeline.c
+ * @date 19.10.2026
+ * @brief Implementation of the pipelined front end, the tokens and the parsed functions are passed by lock-free rings
+ */
+
+#include <pthread.h>
+#include <stdlib.h>
+
+#ifdef USE_CUSTOM_STRUCTURE
+#include "syntaxical/pipeline.h"
+#include "syntaxical/parser.h"
+#include "lexical/scanner.h"
+#include "semantical/sem_analyzer.h"
+#include "utility/memory.h"
+#else
+#include "pipeline.h"
+#include "parser.h"
+#include "scanner.h"
+#include "sem_analyzer.h"
+#include "memory.h"
+#endif
+
+// Function to lex the whole source, it is the lexer thread
+static void *pipelineLexer(void *data) {
+    Pipeline *pipeline = (Pipeline *)data;
+
+    // the lexer has its own scanner, the one of the compilation is not used
+    CompilerContext ctx;
+    compilerContextInit(&ctx, NULL, NULL);
+    scanner_init_buffer(pipeline->source, pipeline->length, &ctx);
+
+    PipelineToken item;
+    do {
+        item.status = scanner_get_token(&item.token, &ctx);
+        item.position = ctx.sourcePosition;
+        spscRingPush(pipeline->tokens, &item);
+    } while (item.status == SUCCESS && item.token.type != TOKEN_EOF);
+    return NULL;
+}
+
+// Function to add the definitions of the parsed functions, it is the definitions thread
+static void *pipelineSignatures(void *data) {
+    Pipeline *pipeline = (Pipeline *)data;
+
+    // after the first error, the rest is left to analyzeProgram, it reports the same error
+    bool failed = false;
+    Function *function;
+    enum MEMORY_TAG scope = MEMORY_SCOPE_BEGIN(MEMORY_SYMTABLE);
+    for (spscRingPop(pipeline->functions, &function); function; spscRingPop(pipeline->functions, &function)) {
+        if (!failed && analyzeFunctionSignature(function, pipeline->table) == SUCCESS) pipeline->signatures++;
+        else failed = true;
+    }
+    MEMORY_SCOPE_END(scope);
+    return NULL;
+}
+
+// Function to take the next token from the lexer thread and save it to the buffer
+static bool pipelinePullToken(Pipeline *pipeline, LinkedList *buffer) {
+    if (pipeline->lexed) return false;
+
+    PipelineToken item;
+    spscRingPop(pipeline->tokens, &item);
+    if (item.status != SUCCESS || item.token.type == TOKEN_EOF) pipeline->lexed = true;
+    pipeline->position = item.position;
+
+    // the token is kept even on error, the same as the first pass does
+    if (!saveNewToken(item.token, buffer) && pipeline->status == SUCCESS) pipeline->status = E_INTERNAL;
+    if (item.status != SUCCESS && pipeline->status == SUCCESS) pipeline->status = item.status;
+    return true;
+}
+
+// Function to wait for the tokens of the next function
+bool pipelinePullFunction(CompilerContext *ctx) {
+    Pipeline *pipeline = ctx->pipeline;
+
+    // the tokens already pulled as the look ahead are counted too
+    unsigned int index = ctx->tokenIndex;
+    unsigned int after = 0;
+    int depth = 0;
+    bool closed = false;
+    while (after < PIPELINE_LOOK_AHEAD) {
+        if (index >= getSize(ctx->buffer) && !pipelinePullToken(pipeline, ctx->buffer)) break;
+        TOKEN_PTR token = (TOKEN_PTR)getDataAtIndex(ctx->buffer, index);
+
+        if (closed) {
+            after++;
+        } else if (token->type == TOKEN_LBRACE) {
+            depth++;
+        } else if (token->type == TOKEN_RBRACE && depth > 0) {
+            closed = --depth == 0;
+        } else if (token->type == TOKEN_PUB && depth == 0 && index > ctx->tokenIndex) {
+            // the prolog, or a function without a body, ends before the next function
+            closed = true;
+            after++;
+        }
+        index++;
+    }
+
+    // the buffer ends with the token, that failed, the parser could read after it
+    return pipeline->status == SUCCESS;
+}
+
+// Function to pass a parsed function to the definitions thread
+void pipelinePushFunction(CompilerContext *ctx, Function *function) {
+    if (ctx->pipeline->functions) spscRingPush(ctx->pipeline->functions, &function);
+}
+
+// Function to parse the program on the pipeline
+enum ERR_CODES pipelineParse(Program *program, CompilerContext *ctx) {
+    if (!ctx->source) return parser_parse(NULL, program, ctx);
+
+    Pipeline pipeline;
+    pipeline.source = ctx->source;
+    pipeline.length = ctx->sourceLength;
+    pipeline.tokens = spscRingInit(PIPELINE_TOKEN_RING, sizeof(PipelineToken));
+    pipeline.functions = spscRingInit(PIPELINE_FUNCTION_RING, sizeof(Function *));
+    pipeline.table = ctx->table;
+    pipeline.lexed = false;
+    pipeline.status = SUCCESS;
+    pipeline.position = 0;
+    pipeline.signatures = 0;
+
+    // without the lexer thread, there is nothing to overlap
+    pthread_t lexer, signatures;
+    if (!pipeline.tokens || !pipeline.functions || pthread_create(&lexer, NULL, pipelineLexer, &pipeline) != 0) {
+        spscRingFree(&pipeline.tokens);
+        spscRingFree(&pipeline.functions);
+        return parser_parse(NULL, program, ctx);
+    }
+
+    // without the definitions thread, analyzeProgram adds all of them
+    bool collecting = pthread_create(&signatures, NULL, pipelineSignatures, &pipeline) == 0;
+    if (!collecting) spscRingFree(&pipeline.functions);
+
+    // the lexer runs at the same time, so the phases are timed together
+    ctx->pipeline = &pipeline;
+    size_t span = TIMING_BEGIN(ctx->timing, "lex and parse");
+    enum MEMORY_TAG scope = MEMORY_SCOPE_BEGIN(MEMORY_PARSER);
+    bool parsed = parse_program(program, ctx);
+    MEMORY_SCOPE_END(scope);
+
+    // a lexical error anywhere wins over the syntax error, the same as after the first pass, so lex to the end
+    while (pipelinePullToken(&pipeline, ctx->buffer));
+    pthread_join(lexer, NULL);
+    TIMING_END(ctx->timing, span, NULL);
+
+    if (collecting) {
+        Function *end = NULL;
+        spscRingPush(pipeline.functions, &end);
+        pthread_join(signatures, NULL);
+        ctx->signatures = pipeline.signatures;
+    }
+    ctx->pipeline = NULL;
+    spscRingFree(&pipeline.tokens);
+    spscRingFree(&pipeline.functions);
+
+    if (pipeline.status != SUCCESS) {
+        ctx->sourcePosition = pipeline.position;
+        return pipeline.status;
+    }
+    if (!parsed) return (ctx->globalError == SUCCESS) ? E_SYNTAX : ctx->globalError;
+    return SUCCESS;
+}
@@ -16,9 +16,13 @@
 #ifdef USE_CUSTOM_STRUCTURE
 #include "syntaxical/precedent.h"
 #include "utility/my_utils.h"
+#include "utility/memory.h"
+#include "utility/statistics.h"
 #else
 #include "precedent.h"
 #include "my_utils.h"
+#include "memory.h"
+#include "statistics.h"
 #endif
 
 // Precedent table
@@ -330,6 +334,7 @@ enum ERR_CODES startPrecedentAnalysis(LinkedList *buffer, unsigned int *startIdx
                 removeStack(&stack);
                 return E_INTERNAL;
             }
+            STATS_MAX(precedenceMaxDepth, getSize(stack));
 
             if (token->type == TOKEN_IDENTIFIER) {
                 newToken->ast_node.expr_type = IdentifierExpressionType;
@@ -351,6 +356,7 @@ enum ERR_CODES startPrecedentAnalysis(LinkedList *buffer, unsigned int *startIdx
                 newToken->ast_node.data_type.is_nullable = token->type == TOKEN_NULL;
                 newToken->ast_node.data_type.data_type = covertTokneDataType(token->type);
                 newToken->ast_node.data.literal.data_type = newToken->ast_node.data_type;
+                parseLiteralNumber(&newToken->ast_node.data.literal);
             }
 
             DEBUG_PRINT("Inserted the token to the stack");
@@ -429,8 +435,12 @@ enum ERR_CODES startPrecedentAnalysis(LinkedList *buffer, unsigned int *startIdx
                 }
             }
 
-            // correct check for expresion syntax
-            if (expr) *expr = last->ast_node;
+            // correct check for expresion syntax, without a caller for the tree, the tree is freed with the stack
+            if (!expr) {
+                removeStack(&stack);
+                return SUCCESS;
+            }
+            *expr = last->ast_node;
             removeList(&stack);
             return SUCCESS;
         }
@@ -465,11 +475,11 @@ enum ERR_CODES _applyRulesExpresion(LinkedList *stack, unsigned int ruleStartIdx
             item2->content.operation != TOKEN_MULTIPLY && item2->content.operation != TOKEN_DIVIDE)
             return E_SYNTAX; // invalid operand
 
-        Expression *left = malloc(sizeof(Expression));
+        Expression *left = MEMORY_MALLOC(MEMORY_AST, sizeof(Expression));
         if (left == NULL)
             return E_INTERNAL;
 
-        Expression *right = malloc(sizeof(Expression));
+        Expression *right = MEMORY_MALLOC(MEMORY_AST, sizeof(Expression));
         if (right == NULL)
             return E_INTERNAL;
 
@@ -582,11 +592,11 @@ enum ERR_CODES _applyRulesTruthExpression(LinkedList *stack, unsigned int ruleSt
         DEBUG_PRINT("E -> E operand E");
         // we have to check if the operand is + - * /
 
-        Expression *left = malloc(sizeof(Expression));
+        Expression *left = MEMORY_MALLOC(MEMORY_AST, sizeof(Expression));
         if (left == NULL)
             return E_INTERNAL;
 
-        Expression *right = malloc(sizeof(Expression));
+        Expression *right = MEMORY_MALLOC(MEMORY_AST, sizeof(Expression));
         if (right == NULL)
             return E_INTERNAL;
 
@@ -621,11 +631,11 @@ enum ERR_CODES _applyRulesTruthExpression(LinkedList *stack, unsigned int ruleSt
 
         item3->content.stateTruthExpression = STATE_TEX_R;
 
-        Expression *left = malloc(sizeof(Expression));
+        Expression *left = MEMORY_MALLOC(MEMORY_AST, sizeof(Expression));
         if (left == NULL)
             return E_INTERNAL;
 
-        Expression *right = malloc(sizeof(Expression));
+        Expression *right = MEMORY_MALLOC(MEMORY_AST, sizeof(Expression));
         if (right == NULL)
             return E_INTERNAL;
 
@@ -14,9 +14,11 @@
 #ifdef USE_CUSTOM_STRUCTURE
 #include "utility/binary_search_tree.h"
 #include "utility/linked_list.h"
+#include "utility/statistics.h"
 #else
 #include "binary_search_tree.h"
 #include "linked_list.h"
+#include "statistics.h"
 #endif
 
 void (*freeDataFunction)(void **);
@@ -43,16 +45,20 @@ BST *bstInit(void (*freeFunction)(void **data)) {
     return tree;
 }
 
-// Internal function to calculate the height of a node.
+// Internal function to get the height of a node, the heights are kept in the nodes
 int _bstCalculateHeight(TreeNode *node) {
     if (node == NULL) return -1; // Return -1 for an empty node (base case for height)
 
-    // Recursively calculate height of left and right subtrees
+    return node->height;
+}
+
+// Internal function to update the height of a node from the heights of its children
+void _bstUpdateHeight(TreeNode *node) {
     int leftHeight = _bstCalculateHeight(node->left);
     int rightHeight = _bstCalculateHeight(node->right);
 
     // Return the greater of the two heights plus 1 (for the current node)
-    return (leftHeight > rightHeight ? leftHeight : rightHeight) + 1;
+    node->height = (leftHeight > rightHeight ? leftHeight : rightHeight) + 1;
 }
 
 // External function to calculate the height of the tree
@@ -69,6 +75,9 @@ TreeNode * _bstRotLeft(TreeNode *root) {
     root->right = newRoot->left;
     newRoot->left = root;
 
+    // the old root is the child now, so it is updated first
+    _bstUpdateHeight(root);
+    _bstUpdateHeight(newRoot);
     return newRoot;
 }
 
@@ -78,6 +87,8 @@ TreeNode * _bstRotRight(TreeNode *root) {
     root->left = newRoot->right;
     newRoot->right = root;
 
+    _bstUpdateHeight(root);
+    _bstUpdateHeight(newRoot);
     return newRoot;
 }
 
@@ -89,37 +100,66 @@ int _bstGetBalanceFactor(TreeNode *node) {
     return _bstCalculateHeight(node->left) - _bstCalculateHeight(node->right);
 }
 
+// Internal function to balance a node, whose children are balanced already
+TreeNode *_bstBalanceNode(TreeNode *node) {
 
-// Function to balance the tree (after insertion/deletion)
-bool bstBalanceTree(BST *tree) {
+    if (node == NULL) return NULL;
 
-    if (tree == NULL) return false; // Handle null pointer case
-
-    int balanceFactor = _bstGetBalanceFactor(tree->root);
+    _bstUpdateHeight(node);
+    int balanceFactor = _bstGetBalanceFactor(node);
 
     // Left-heavy case (balance factor > 1)
     if (balanceFactor > 1) {
-        if (_bstGetBalanceFactor(tree->root->left) < 0) {
+        if (_bstGetBalanceFactor(node->left) < 0) {
             // Left-Right (LR) case
-            tree->root->left = _bstRotLeft(tree->root->left);
+            node->left = _bstRotLeft(node->left);
         }
         // Left-Left (LL) case
-        tree->root = _bstRotRight(tree->root);
+        return _bstRotRight(node);
     }
 
     // Right-heavy case (balance factor < -1)
-    else if (balanceFactor < -1) {
-        if (_bstGetBalanceFactor(tree->root->right) > 0) {
+    if (balanceFactor < -1) {
+        if (_bstGetBalanceFactor(node->right) > 0) {
             // Right-Left (RL) case
-            tree->root->right = _bstRotRight(tree->root->right);
+            node->right = _bstRotRight(node->right);
         }
         // Right-Right (RR) case
-        tree->root = _bstRotLeft(tree->root);
+        return _bstRotLeft(node);
     }
 
+    return node;
+}
+
+// Function to balance the tree (after insertion/deletion)
+bool bstBalanceTree(BST *tree) {
+
+    if (tree == NULL) return false; // Handle null pointer case
+
+    tree->root = _bstBalanceNode(tree->root);
+
     return true; // Tree is balanced
 }
 
+// Internal function to insert a node into a subtree, every node on the path is balanced on the way back
+TreeNode *_bstInsertNode(TreeNode *node, TreeNode *newNode, bool *inserted) {
+
+    if (node == NULL) {
+        *inserted = true;
+        return newNode;
+    }
+
+    if (newNode->key < node->key) {
+        node->left = _bstInsertNode(node->left, newNode, inserted);
+    } else if (newNode->key > node->key) {
+        node->right = _bstInsertNode(node->right, newNode, inserted);
+    } else {
+        return node; // Key already exists in the tree
+    }
+
+    return *inserted ? _bstBalanceNode(node) : node;
+}
+
 // Function to insert a node, to the tree
 bool bstInsertNode(BST *tree, unsigned int key, void *data) {
 
@@ -135,114 +175,70 @@ bool bstInsertNode(BST *tree, unsigned int key, void *data) {
     newNode->data = data;
     newNode->left = NULL;
     newNode->right = NULL;
+    newNode->height = 0;
 
-    // If the tree is empty, set the new node as the root
-    if (tree->root == NULL) {
-        tree->root = newNode;
-        tree->size++;
-        return true;
-    }
-
-    // Traverse the tree to find the correct insertion point
-    TreeNode *current = tree->root;
-    TreeNode *parent = NULL;
-
-    while (current != NULL) {
-        parent = current;
+    // Insert the new node at the correct position, the tree stays balanced
+    bool inserted = false;
+    tree->root = _bstInsertNode(tree->root, newNode, &inserted);
 
-        if (key < current->key) {
-            current = current->left;
-        } else if (key > current->key) {
-            current = current->right;
-        } else {
-            free(newNode);
-            return false; // Key already exists in the tree
-        }
-    }
-
-    // Insert the new node at the correct position
-    if (key < parent->key) {
-        parent->left = newNode;
-    } else {
-        parent->right = newNode;
+    if (!inserted) {
+        free(newNode);
+        return false; // Key already exists in the tree
     }
 
     tree->size++;
 
-    return bstBalanceTree(tree);
+    return true;
 }
 
-bool bstPopNode(BST *tree, unsigned int key, void **returnData) {
-    if (tree == NULL || tree->root == NULL) return false; // Handle null tree
-
-    TreeNode *current = tree->root;
-    TreeNode *parent = NULL;
-
-    // Find the node to be removed
-    while (current != NULL) {
-        if (key == current->key) {
-            break;
-        }
-
-        parent = current;
-
-        if (key < current->key) {
-            current = current->left;
-        } else {
-            current = current->right;
-        }
-    }
-
-    if (current == NULL) return false; // Key not found
-
-    *returnData = current->data; // Set the returnData to the node's data
+// Internal function to remove a node from a subtree, every node on the path is balanced on the way back
+TreeNode *_bstPopNode(TreeNode *node, unsigned int key, void **returnData, bool *found) {
 
-    // Now unlink the node from the tree
-    TreeNode *replacement = NULL;
+    if (node == NULL) return NULL; // Key not found
 
-    // Case 1: Node has no children
-    if (current->left == NULL && current->right == NULL) {
-        replacement = NULL;
-
-    // Case 2: Node has one child
-    } else if (current->left == NULL || current->right == NULL) {
-        replacement = (current->left != NULL) ? current->left : current->right;
-
-    // Case 3: Node has two children
+    if (key < node->key) {
+        node->left = _bstPopNode(node->left, key, returnData, found);
+    } else if (key > node->key) {
+        node->right = _bstPopNode(node->right, key, returnData, found);
     } else {
-        // Find in-order successor (smallest node in the right subtree)
-        TreeNode *successor = current->right;
-        TreeNode *successorParent = current;
+        *found = true;
+        *returnData = node->data; // Set the returnData to the node's data
+
+        // Node has at most one child, the child takes its place
+        if (node->left == NULL || node->right == NULL) {
+            TreeNode *replacement = (node->left != NULL) ? node->left : node->right;
+            free(node); // Free the removed node
+            return replacement;
+        }
 
+        // Node has two children, the in-order successor (smallest node in the right subtree) takes its place
+        TreeNode *successor = node->right;
         while (successor->left != NULL) {
-            successorParent = successor;
             successor = successor->left;
         }
+        node->key = successor->key;
+        node->data = successor->data;
 
-        // Swap values with successor (no need to swap the actual nodes)
-        current->key = successor->key;
-        current->data = successor->data;
-
-        // Remove the successor (it will have at most one child)
-        current = successor;
-        parent = successorParent;
-        replacement = current->right; // Successor has no left child, so it's right child or NULL
+        // Remove the successor (it has no left child)
+        void *successorData = NULL;
+        bool successorFound = false;
+        node->right = _bstPopNode(node->right, node->key, &successorData, &successorFound);
     }
 
-    // Unlink the node
-    if (parent == NULL) {
-        tree->root = replacement; // If no parent, we're removing the root
-    } else if (parent->left == current) {
-        parent->left = replacement;
-    } else {
-        parent->right = replacement;
-    }
+    return *found ? _bstBalanceNode(node) : node;
+}
+
+bool bstPopNode(BST *tree, unsigned int key, void **returnData) {
+    if (tree == NULL || tree->root == NULL) return false; // Handle null tree
+
+    bool found = false;
+    tree->root = _bstPopNode(tree->root, key, returnData, &found);
+
+    if (!found) return false; // Key not found
 
-    free(current); // Free the removed node
     tree->size--;
 
-    // Now balance the tree
-    return bstBalanceTree(tree);
+    return true;
 }
 
 // Function to remove a node from the tree
@@ -262,9 +258,11 @@ void *bstSearchForNode(BST *tree, unsigned int key) {
     if (tree == NULL || tree->root == NULL) return NULL; // Handle null tree
 
     TreeNode *current = tree->root;
+    STATS_ADD(bstSearches, 1);
 
     // Traverse the tree to find the node
     while (current != NULL) {
+        STATS_ADD(bstVisited, 1);
         if (key == current->key) {
             return current->data; // Return the data if the key matches
         }
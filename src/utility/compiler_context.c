@@ -0,0 +1,43 @@
+/** AUTHOR
+ *
+ * @author agent <agent@local>
+ * @file compiler_context.c
+ * @date 19.10.2026
+ * @brief Implementation of the state of a single compilation
+ */
+
+#ifdef USE_CUSTOM_STRUCTURE
+#include "utility/compiler_context.h"
+#else
+#include "compiler_context.h"
+#endif
+
+// Function to initialize the compiler context
+void compilerContextInit(CompilerContext *ctx, SymTable *table, OutputBuffer *out) {
+    ctx->file = NULL;
+    ctx->source = NULL;
+    ctx->sourceLength = 0;
+    ctx->sourcePosition = 0;
+    ctx->nextCharacter = EOF;
+    ctx->nextToken.value = NULL;
+    ctx->nextToken.type = TOKEN_NONE;
+
+    ctx->tokenIndex = 0;
+    ctx->buffer = table ? table->tokenBuffer : NULL;
+    ctx->table = table;
+    ctx->token.value = NULL;
+    ctx->token.type = TOKEN_NONE;
+    ctx->globalError = SUCCESS;
+
+    ctx->jobs = COMPILER_JOBS;
+    ctx->pipeline = NULL;
+    ctx->signatures = 0;
+
+    ctx->labelScope = NULL;
+    ctx->ifCounter = 0;
+    ctx->whileCounter = 0;
+    ctx->out = out;
+    ctx->indent = 0;
+
+    ctx->timing = NULL;
+}
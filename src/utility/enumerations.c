@@ -7,10 +7,13 @@
  * @brief Test file for the linked list implementation
  */
 
+#define _POSIX_C_SOURCE 200809L
+
 #include <string.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdarg.h>
+#include <time.h>
 #ifdef USE_CUSTOM_STRUCTURE
 #include "utility/enumerations.h"
 #else
@@ -299,6 +302,11 @@ TestInstancePtr initTestInstance(char *testName) {
     testInstance->testNumber = 1;
     testInstance->passes = 0;
     testInstance->fails = 0;
+    testInstance->benchNumber = 1;
+    testInstance->benchWarmup = 2;
+    testInstance->benchRuns = getenv("IFJ24_BENCH_RUNS") ? (unsigned int)atoi(getenv("IFJ24_BENCH_RUNS")) : 31;
+    if (testInstance->benchRuns < BENCH_MIN_RUNS) testInstance->benchRuns = BENCH_MIN_RUNS;
+    testInstance->benchmark = getenv("IFJ24_BENCH") != NULL;
     printf("\n\n%s=========== %s ==========%s\n", COLOR_WARN, testName, COLOR_RESET);
     return testInstance;
 }
@@ -308,6 +316,7 @@ void finishTestInstance(TestInstancePtr testInstance) {
     printf("\n%s=========== SUMMARY ==========%s\n", COLOR_WARN, COLOR_RESET);
     printf("%sPASSED%s: %u/%u\n", COLOR_PASS, COLOR_RESET, testInstance->passes, testInstance->testNumber-1);
     printf("%sFAILED%s: %u/%u\n", COLOR_FAIL, COLOR_RESET, testInstance->fails, testInstance->testNumber-1);
+    if (testInstance->benchNumber > 1) printf("%sBENCHMARKS%s: %u\n", COLOR_INFO, COLOR_RESET, testInstance->benchNumber-1);
     if (testInstance->fails == 0) {
         printf("%s** ALL TESTS PASSED **%s\n", COLOR_PASS, COLOR_RESET);
         printf("Note: This is the part where we do a happy dance!\n");
@@ -334,3 +343,78 @@ void testCase(TestInstancePtr testInstance, bool testResult, char *testName, cha
     }
     printf("\n");
 }
+
+// Function to get the time of the monotonic clock in nanoseconds
+static double benchNow(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec * 1e9 + (double)now.tv_nsec;
+}
+
+// Function to compare two samples for qsort
+static int benchCompare(const void *first, const void *second) {
+    double a = *(const double *)first;
+    double b = *(const double *)second;
+    return (a > b) - (a < b);
+}
+
+// Function to run a single timed run of a benchmark case
+static double benchRun(BenchCase *bench) {
+    if (bench->setup) bench->setup(bench->data);
+    double start = benchNow();
+    bench->run(bench->data);
+    double elapsed = benchNow() - start;
+    if (bench->teardown) bench->teardown(bench->data);
+    return elapsed;
+}
+
+// Function to run a benchmark case
+void benchCase(TestInstancePtr testInstance, BenchCase *bench) {
+    printf("BENCH %u: %s\n", testInstance->benchNumber, bench->benchName);
+    testInstance->benchNumber++;
+
+    // without the measuring, only check, that the case runs
+    if (!testInstance->benchmark) {
+        benchRun(bench);
+        printf("  %sRUN%s: %zu operations, set IFJ24_BENCH to measure\n\n", COLOR_INFO, COLOR_RESET, bench->operations);
+        return;
+    }
+
+    for (unsigned int i = 0; i < testInstance->benchWarmup; i++) benchRun(bench);
+
+    double *samples = (double *)malloc(testInstance->benchRuns * sizeof(double));
+    if (!samples) return;
+    unsigned int runs = 0;
+    double total = 0.0;
+    while (runs < testInstance->benchRuns && (runs < BENCH_MIN_RUNS || total < BENCH_TIME_BUDGET)) {
+        samples[runs] = benchRun(bench);
+        total += samples[runs++];
+    }
+
+    // the p99 is the nearest rank, with less than 100 runs it is close to the slowest one
+    qsort(samples, runs, sizeof(double), benchCompare);
+    double operations = bench->operations ? (double)bench->operations : 1.0;
+    double median = (runs % 2) ? samples[runs / 2] : (samples[runs / 2 - 1] + samples[runs / 2]) / 2.0;
+    unsigned int p99 = (unsigned int)((99 * runs + 99) / 100) - 1;
+    printf("  %sTIME%s: %zu ops x %u runs, min %.2f ns/op, median %.2f ns/op, p99 %.2f ns/op\n\n", COLOR_INFO, COLOR_RESET,
+           bench->operations, runs, samples[0] / operations, median / operations, samples[p99] / operations);
+    free(samples);
+}
+
+// Function to limit the size of the benchmarks, when they are not measured
+size_t benchSize(TestInstancePtr testInstance, size_t size) {
+    if (testInstance->benchmark || size < BENCH_SMOKE_SIZE) return size;
+    return BENCH_SMOKE_SIZE;
+}
+
+// Function to run the benchmark cases for all the sizes
+void benchSweep(TestInstancePtr testInstance, BenchSweepCase *cases, size_t count, void *data, unsigned int *size, size_t maxSize) {
+    for (*size = 10; *size <= benchSize(testInstance, maxSize); *size *= 10) {
+        for (size_t i = 0; i < count; i++) {
+            char name[64];
+            snprintf(name, sizeof(name), "%s n=%u", cases[i].benchName, *size);
+            size_t operations = cases[i].operations ? cases[i].operations : *size;
+            benchCase(testInstance, &(BenchCase){name, operations, data, cases[i].setup, cases[i].run, cases[i].teardown});
+        }
+    }
+}
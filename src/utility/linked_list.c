@@ -13,8 +13,10 @@
 
 #ifdef USE_CUSTOM_STRUCTURE
 #include "utility/linked_list.h"
+#include "utility/statistics.h"
 #else
 #include "linked_list.h"
+#include "statistics.h"
 #endif
 
 // Function to check, if list is empty
@@ -161,6 +163,8 @@ bool _moveActiveElement(struct LinkedList *list, int index) {
     }
 
     // now we need to move the active element
+    STATS_ADD(listMoves, 1);
+    STATS_ADD(listSteps, steps);
     for (unsigned int i = 0; i < steps; i++) {
         if (direction == FORWARD) {
             startNode = startNode->next;
@@ -359,6 +363,28 @@ void *getDataAtIndex(struct LinkedList *list, int index) {
     return list->lastAccessedNode->data;
 }
 
+// Function to get data at index, without moving the active element
+void *peekDataAtIndex(struct LinkedList *list, int index) {
+
+    // check for internal error
+    if (list == NULL) return NULL;
+
+    // convert the index to the positive index
+    unsigned int newIndex = (index < 0) ? list->size + index : (unsigned int)index;
+    if (newIndex >= list->size) return NULL;
+
+    // walk from the closer end
+    struct Node *node;
+    if (newIndex < list->size / 2) {
+        node = list->head;
+        for (unsigned int i = 0; i < newIndex; i++) node = node->next;
+    } else {
+        node = list->tail;
+        for (unsigned int i = list->size - 1; i > newIndex; i--) node = node->prev;
+    }
+    return node->data;
+}
+
 // Function to replace data at index
 bool replaceDataAtIndex(struct LinkedList *list, int index, void *data, void **returnData) {
 
@@ -0,0 +1,232 @@
+/** AUTHOR
+ *
+ * @author agent <agent@local>
+ * @file memory.c
+ * @date 19.10.2026
+ * @brief Implementation of the tracking allocator, every allocation is counted under the subsystem, that made it
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdint.h>
+#include <string.h>
+#include <sys/resource.h>
+#include <unistd.h>
+
+#ifdef USE_CUSTOM_STRUCTURE
+#include "utility/memory.h"
+#include "utility/enumerations.h"
+#else
+#include "memory.h"
+#include "enumerations.h"
+#endif
+
+// bytes before every allocation, keep its size and tag there, a multiple of the alignment of malloc
+#define MEMORY_HEADER 16
+
+// names of the tags, in the order of enum MEMORY_TAG
+static const char *memoryTagNames[MEMORY_TAG_COUNT] = {
+    "other", "scanner", "parser", "precedence", "ast", "symtable", "codegen",
+};
+
+// Struct for the header before every allocation
+typedef struct MemoryHeader {
+    size_t size; // bytes requested
+    unsigned int tag; // the tag counting the allocation
+} MemoryHeader;
+
+// the counters of the whole process
+MemoryStats memoryStats;
+
+// Function to get the name of the tag
+const char *memoryTagName(enum MEMORY_TAG tag) {
+    return ((unsigned int)tag < MEMORY_TAG_COUNT) ? memoryTagNames[tag] : "unknown";
+}
+
+// Function to tell, if the allocations are tracked
+bool memoryTrackingEnabled(void) {
+#ifdef MEMORY_TRACKING
+    return true;
+#else
+    return false;
+#endif
+}
+
+// Function to get the peak RSS
+size_t memoryPeakRss(void) {
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0 || usage.ru_maxrss < 0) return 0;
+    return (size_t)usage.ru_maxrss;
+}
+
+#ifdef MEMORY_TRACKING
+
+// the tag of the allocations of the thread
+static __thread enum MEMORY_TAG memoryScope = MEMORY_OTHER;
+
+// the real allocator, the calls of the compiler are redirected to the wrappers by the linker
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t count, size_t size);
+void *__real_realloc(void *pointer, size_t size);
+void __real_free(void *pointer);
+
+// Function to raise the counter to the value, if it is bigger
+static void memoryMax(size_t *counter, size_t value) {
+    size_t current = __atomic_load_n(counter, __ATOMIC_RELAXED);
+    while (value > current && !__atomic_compare_exchange_n(counter, &current, value, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+}
+
+// Function to count the allocated bytes under the tag
+static void memoryCount(MemoryTagStats *stats, size_t size) {
+    memoryMax(&stats->peak, __atomic_add_fetch(&stats->current, size, __ATOMIC_RELAXED));
+    __atomic_fetch_add(&stats->total, size, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&stats->blocks, 1, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&stats->allocations, 1, __ATOMIC_RELAXED);
+}
+
+// Function to uncount the freed bytes
+static void memoryUncount(MemoryTagStats *stats, size_t size) {
+    __atomic_fetch_sub(&stats->current, size, __ATOMIC_RELAXED);
+    __atomic_fetch_sub(&stats->blocks, 1, __ATOMIC_RELAXED);
+}
+
+// Function to write the header of a new block and count it
+static void *memoryAllocated(void *block, size_t size, enum MEMORY_TAG tag) {
+    if (!block) return NULL;
+    MemoryHeader header = {size, (unsigned int)tag};
+    memcpy(block, &header, sizeof(MemoryHeader));
+    memoryCount(&memoryStats.tags[tag], size);
+    memoryCount(&memoryStats.all, size);
+    return (unsigned char *)block + MEMORY_HEADER;
+}
+
+// Function to read the header of a block and uncount it
+static void *memoryReleased(void *pointer, MemoryHeader *header) {
+    void *block = (unsigned char *)pointer - MEMORY_HEADER;
+    memcpy(header, block, sizeof(MemoryHeader));
+    memoryUncount(&memoryStats.tags[header->tag], header->size);
+    memoryUncount(&memoryStats.all, header->size);
+    return block;
+}
+
+// Function to start counting the allocations of the thread under the tag
+enum MEMORY_TAG memoryScopeEnter(enum MEMORY_TAG tag) {
+    enum MEMORY_TAG previous = memoryScope;
+    memoryScope = tag;
+    return previous;
+}
+
+// Function to count the allocations of the thread under the previous tag again
+void memoryScopeLeave(enum MEMORY_TAG previous) {
+    memoryScope = previous;
+}
+
+// Function to allocate under the tag
+void *memoryMalloc(enum MEMORY_TAG tag, size_t size) {
+    __atomic_fetch_add(&memoryStats.mallocCalls, 1, __ATOMIC_RELAXED);
+    if (size > SIZE_MAX - MEMORY_HEADER) return NULL;
+    return memoryAllocated(__real_malloc(size + MEMORY_HEADER), size, tag);
+}
+
+// Function to count a malloc under the tag of the scope
+void *__wrap_malloc(size_t size) {
+    return memoryMalloc(memoryScope, size);
+}
+
+// Function to count a calloc under the tag of the scope
+void *__wrap_calloc(size_t count, size_t size) {
+    __atomic_fetch_add(&memoryStats.callocCalls, 1, __ATOMIC_RELAXED);
+    if (size && count > (SIZE_MAX - MEMORY_HEADER) / size) return NULL;
+    return memoryAllocated(__real_calloc(1, count * size + MEMORY_HEADER), count * size, memoryScope);
+}
+
+// Function to count a realloc, the block keeps its tag, the old block stays counted, if it cannot be resized
+void *__wrap_realloc(void *pointer, size_t size) {
+    __atomic_fetch_add(&memoryStats.reallocCalls, 1, __ATOMIC_RELAXED);
+    if (size > SIZE_MAX - MEMORY_HEADER) return NULL;
+    if (!pointer) return memoryAllocated(__real_malloc(size + MEMORY_HEADER), size, memoryScope);
+
+    MemoryHeader header;
+    memcpy(&header, (unsigned char *)pointer - MEMORY_HEADER, sizeof(MemoryHeader));
+    void *block = __real_realloc((unsigned char *)pointer - MEMORY_HEADER, size + MEMORY_HEADER);
+    if (!block) return NULL;
+
+    // the moved block has the old header, it is uncounted from there
+    memoryReleased((unsigned char *)block + MEMORY_HEADER, &header);
+    return memoryAllocated(block, size, (enum MEMORY_TAG)header.tag);
+}
+
+// Function to count a free
+void __wrap_free(void *pointer) {
+    if (!pointer) return;
+    __atomic_fetch_add(&memoryStats.freeCalls, 1, __ATOMIC_RELAXED);
+    MemoryHeader header;
+    __real_free(memoryReleased(pointer, &header));
+}
+
+// Function to report the leaks at the exit, IFJ24_MEMORY_REPORT prints the report always,
+// IFJ24_MEMORY_STRICT makes a leak fail the process
+static void memoryAtExit(void) {
+    size_t leaked = __atomic_load_n(&memoryStats.all.blocks, __ATOMIC_RELAXED);
+    if (leaked == 0 && !getenv("IFJ24_MEMORY_REPORT")) return;
+    memoryPrintReport(stderr);
+    if (leaked > 0 && getenv("IFJ24_MEMORY_STRICT")) {
+        fflush(NULL);
+        _exit(E_INTERNAL);
+    }
+}
+
+// Function to register the report, before main runs
+__attribute__((constructor)) static void memoryRegister(void) {
+    atexit(memoryAtExit);
+}
+
+#else
+
+// Function to start a scope, nothing is counted without the tracking
+enum MEMORY_TAG memoryScopeEnter(enum MEMORY_TAG tag) {
+    (void)tag;
+    return MEMORY_OTHER;
+}
+
+// Function to end a scope, nothing is counted without the tracking
+void memoryScopeLeave(enum MEMORY_TAG previous) {
+    (void)previous;
+}
+
+// Function to allocate under the tag, nothing is counted without the tracking
+void *memoryMalloc(enum MEMORY_TAG tag, size_t size) {
+    (void)tag;
+    return malloc(size);
+}
+
+#endif // MEMORY_TRACKING
+
+// Function to print the report
+void memoryPrintReport(FILE *output) {
+    if (!memoryTrackingEnabled()) {
+        fprintf(output, "memory: the tracking is compiled out\n");
+        return;
+    }
+
+    fprintf(output, "memory: %-12s %14s %14s %14s %10s\n", "tag", "current B", "peak B", "total B", "blocks");
+    for (int i = 0; i < MEMORY_TAG_COUNT; i++) {
+        MemoryTagStats *stats = &memoryStats.tags[i];
+        if (stats->allocations == 0) continue;
+        fprintf(output, "memory: %-12s %14zu %14zu %14zu %10zu\n", memoryTagNames[i], stats->current, stats->peak, stats->total,
+                stats->blocks);
+    }
+    MemoryTagStats *all = &memoryStats.all;
+    fprintf(output, "memory: %-12s %14zu %14zu %14zu %10zu\n", "all", all->current, all->peak, all->total, all->blocks);
+    fprintf(output, "memory: peak RSS %zu KiB\n", memoryPeakRss());
+
+    if (all->blocks == 0) {
+        fprintf(output, "memory: no leaks\n");
+        return;
+    }
+    fprintf(output, "memory: leaked %zu bytes in %zu blocks:", all->current, all->blocks);
+    for (int i = 0; i < MEMORY_TAG_COUNT; i++) {
+        if (memoryStats.tags[i].blocks) fprintf(output, " %s %zu", memoryTagNames[i], memoryStats.tags[i].blocks);
+    }
+    fprintf(output, "\n");
+}
@@ -0,0 +1,210 @@
+/** AUTHOR
+ *
+ * @author agent <agent@local>
+ * @file output_buffer.c
+ * @date 19.10.2026
+ * @brief Implementation of the in-memory output buffer of the generated code
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef USE_CUSTOM_STRUCTURE
+#include "utility/output_buffer.h"
+#else
+#include "output_buffer.h"
+#endif
+
+// Function to init the output buffer
+OutputBuffer *outputBufferInit(FILE *stream, size_t chunkSize) {
+    OutputBuffer *buffer = (OutputBuffer *)malloc(sizeof(OutputBuffer));
+    if (!buffer) return NULL;
+
+    buffer->capacity = OUTPUT_BUFFER_INIT_CAPACITY;
+    if (chunkSize > buffer->capacity) buffer->capacity = chunkSize;
+
+    buffer->data = (char *)malloc(buffer->capacity);
+    if (!buffer->data) {
+        free(buffer);
+        return NULL;
+    }
+
+    buffer->size = 0;
+    buffer->stream = stream;
+    buffer->chunkSize = chunkSize;
+    buffer->error = false;
+    return buffer;
+}
+
+// Function to free the output buffer
+void outputBufferFree(OutputBuffer **buffer) {
+    if (!buffer || !*buffer) return;
+    free((*buffer)->data);
+    free(*buffer);
+    *buffer = NULL;
+}
+
+// Function to make space for more bytes in the buffer
+bool outputBufferReserve(OutputBuffer *buffer, size_t length) {
+    if (buffer->error) return false;
+    if (buffer->size + length <= buffer->capacity) return true;
+
+    // streaming mode, write out the full chunk instead of growing
+    if (buffer->chunkSize && buffer->stream) {
+        if (!outputBufferFlush(buffer)) return false;
+        if (length <= buffer->capacity) return true;
+    }
+
+    size_t capacity = buffer->capacity;
+    while (buffer->size + length > capacity) capacity *= 2;
+
+    char *data = (char *)realloc(buffer->data, capacity);
+    if (!data) {
+        buffer->error = true;
+        return false;
+    }
+    buffer->data = data;
+    buffer->capacity = capacity;
+    return true;
+}
+
+// Function to append bytes to the buffer
+void outputBufferAppendN(OutputBuffer *buffer, const char *data, size_t length) {
+    if (!outputBufferReserve(buffer, length)) return;
+    memcpy(buffer->data + buffer->size, data, length);
+    buffer->size += length;
+}
+
+// Function to append a literal to the buffer
+void outputBufferAppend(OutputBuffer *buffer, const char *str) {
+    outputBufferAppendN(buffer, str, strlen(str));
+}
+
+// Function to append a literal and a new line to the buffer
+void outputBufferAppendLine(OutputBuffer *buffer, const char *str) {
+    size_t length = strlen(str);
+    if (!outputBufferReserve(buffer, length + 1)) return;
+    memcpy(buffer->data + buffer->size, str, length);
+    buffer->data[buffer->size + length] = '\n';
+    buffer->size += length + 1;
+}
+
+// Function to append a character to the buffer
+void outputBufferAppendChar(OutputBuffer *buffer, char c) {
+    if (!outputBufferReserve(buffer, 1)) return;
+    buffer->data[buffer->size++] = c;
+}
+
+// Function to append a decimal integer to the buffer
+void outputBufferAppendInt(OutputBuffer *buffer, long long value) {
+    char digits[24];
+    int length = 0;
+
+    // work with the negative value, so LLONG_MIN does not overflow
+    bool negative = value < 0;
+    if (!negative) value = -value;
+
+    do {
+        digits[sizeof(digits) - 1 - length++] = (char)('0' - value % 10);
+        value /= 10;
+    } while (value);
+    if (negative) digits[sizeof(digits) - 1 - length++] = '-';
+
+    outputBufferAppendN(buffer, digits + sizeof(digits) - length, length);
+}
+
+// Function to append a double in the hexadecimal notation
+void outputBufferAppendHexFloat(OutputBuffer *buffer, double value) {
+    static const char hexDigits[] = "0123456789abcdef";
+
+    uint64_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+
+    bool negative = bits >> 63;
+    int exponent = (int)((bits >> 52) & 0x7ff);
+    uint64_t mantissa = bits & 0xfffffffffffffULL;
+
+    if (exponent == 0x7ff) {
+        if (mantissa) outputBufferAppend(buffer, negative ? "-nan" : "nan");
+        else outputBufferAppend(buffer, negative ? "-inf" : "inf");
+        return;
+    }
+
+    // sign, leading digit and dot, 13 mantissa digits, 'p', sign and up to 4 exponent digits
+    char text[32];
+    int length = 0;
+
+    if (negative) text[length++] = '-';
+    text[length++] = '0';
+    text[length++] = 'x';
+
+    if (exponent == 0 && mantissa == 0) {
+        text[length++] = '0';
+    } else if (exponent == 0) {
+        // subnormal, printed as 0x0.<mantissa>p-1022
+        text[length++] = '0';
+        exponent = -1022;
+    } else {
+        text[length++] = '1';
+        exponent -= 1023;
+    }
+
+    if (mantissa) {
+        text[length++] = '.';
+        while (mantissa) {
+            text[length++] = hexDigits[(mantissa >> 48) & 0xf];
+            mantissa = (mantissa << 4) & 0xfffffffffffffULL;
+        }
+    }
+
+    text[length++] = 'p';
+    text[length++] = exponent < 0 ? '-' : '+';
+    outputBufferAppendN(buffer, text, length);
+    outputBufferAppendInt(buffer, exponent < 0 ? -exponent : exponent);
+}
+
+// Function to append an escaped string to the buffer
+void outputBufferAppendEscaped(OutputBuffer *buffer, const char *str) {
+    const char *start = str;
+
+    for (const char *c = str; *c; c++) {
+        unsigned char byte = (unsigned char)*c;
+        if (byte > 32 && byte != '#' && byte != '\\') continue;
+
+        // copy the run of plain characters at once
+        outputBufferAppendN(buffer, start, c - start);
+        char escape[4] = {'\\', (char)('0' + byte / 100), (char)('0' + byte / 10 % 10), (char)('0' + byte % 10)};
+        outputBufferAppendN(buffer, escape, 4);
+        start = c + 1;
+    }
+    outputBufferAppend(buffer, start);
+}
+
+// Function to append a numbered label to the buffer
+void outputBufferAppendLabel(OutputBuffer *buffer, const char *prefix, long long id, const char *suffix) {
+    outputBufferAppend(buffer, prefix);
+    outputBufferAppendInt(buffer, id);
+    outputBufferAppend(buffer, suffix);
+}
+
+// Function to append a local variable to the buffer
+void outputBufferAppendVar(OutputBuffer *buffer, const char *name, long long id) {
+    outputBufferAppendN(buffer, "TF@", 3);
+    outputBufferAppend(buffer, name);
+    outputBufferAppendChar(buffer, '_');
+    outputBufferAppendInt(buffer, id);
+}
+
+// Function to write the buffer to the stream
+bool outputBufferFlush(OutputBuffer *buffer) {
+    if (buffer->error) return false;
+    if (!buffer->stream) return true; // in memory, the data stays
+
+    if (buffer->size && fwrite(buffer->data, 1, buffer->size, buffer->stream) != buffer->size) {
+        buffer->error = true;
+        return false;
+    }
+    buffer->size = 0;
+    return true;
+}
@@ -0,0 +1,93 @@
+/** AUTHOR
+ *
+ * @author agent <agent@local>
+ * @file spsc_ring.c
+ * @date 19.10.2026
+ * @brief Implementation of the bounded lock-free ring of a single producer and a single consumer thread
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <sched.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef USE_CUSTOM_STRUCTURE
+#include "utility/spsc_ring.h"
+#else
+#include "spsc_ring.h"
+#endif
+
+// a waiting thread spins this many times, before it gives up its time slice
+#define SPSC_RING_SPINS 64
+
+// Function to create a ring
+SpscRing *spscRingInit(size_t capacity, size_t elementSize) {
+    size_t size = 2;
+    while (size < capacity) size *= 2;
+
+    SpscRing *ring = (SpscRing *)malloc(sizeof(SpscRing));
+    if (!ring) return NULL;
+    memset(ring, 0, sizeof(SpscRing));
+
+    ring->slots = (unsigned char *)malloc(size * elementSize);
+    if (!ring->slots) {
+        free(ring);
+        return NULL;
+    }
+    ring->elementSize = elementSize;
+    ring->mask = size - 1;
+    return ring;
+}
+
+// Function to free the ring
+void spscRingFree(SpscRing **ring) {
+    if (!ring || !*ring) return;
+    free((*ring)->slots);
+    free(*ring);
+    *ring = NULL;
+}
+
+// Function to push an element, if there is space
+bool spscRingTryPush(SpscRing *ring, const void *element) {
+    size_t tail = ring->tail;
+
+    // the head is read again only, when the ring looks full
+    if (tail - ring->cachedHead > ring->mask) {
+        ring->cachedHead = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+        if (tail - ring->cachedHead > ring->mask) return false;
+    }
+
+    memcpy(ring->slots + (tail & ring->mask) * ring->elementSize, element, ring->elementSize);
+    __atomic_store_n(&ring->tail, tail + 1, __ATOMIC_RELEASE);
+    return true;
+}
+
+// Function to pop an element, if there is any
+bool spscRingTryPop(SpscRing *ring, void *element) {
+    size_t head = ring->head;
+
+    // the tail is read again only, when the ring looks empty
+    if (head == ring->cachedTail) {
+        ring->cachedTail = __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE);
+        if (head == ring->cachedTail) return false;
+    }
+
+    memcpy(element, ring->slots + (head & ring->mask) * ring->elementSize, ring->elementSize);
+    __atomic_store_n(&ring->head, head + 1, __ATOMIC_RELEASE);
+    return true;
+}
+
+// Function to push an element, waits while the ring is full
+void spscRingPush(SpscRing *ring, const void *element) {
+    for (unsigned int spins = 0; !spscRingTryPush(ring, element); spins++) {
+        if (spins >= SPSC_RING_SPINS) sched_yield();
+    }
+}
+
+// Function to pop an element, waits while the ring is empty
+void spscRingPop(SpscRing *ring, void *element) {
+    for (unsigned int spins = 0; !spscRingTryPop(ring, element); spins++) {
+        if (spins >= SPSC_RING_SPINS) sched_yield();
+    }
+}
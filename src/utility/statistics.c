@@ -0,0 +1,140 @@
+/** AUTHOR
+ *
+ * @author agent <agent@local>
+ * @file statistics.c
+ * @date 19.10.2026
+ * @brief Implementation of the internal counters of the compiler, they exist only in the builds with COMPILER_STATS
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef USE_CUSTOM_STRUCTURE
+#include "utility/statistics.h"
+#include "utility/memory.h"
+#else
+#include "statistics.h"
+#include "memory.h"
+#endif
+
+// most distinct opcodes counted, IFJcode24 has less
+#define STATS_OPCODES 96
+
+// longest counted opcode, including the null terminator
+#define STATS_OPCODE_LENGTH 16
+
+// the counters of the whole process
+CompilerStats compilerStats;
+
+// names of the statement types, in the order of enum StatementType
+static const char *statsStatementNames[STATS_STATEMENT_TYPES] = {
+    "function_call", "return", "while", "if", "assignment", "variable_definition",
+};
+
+// names of the expression types, in the order of enum ExpressionType
+static const char *statsExpressionNames[STATS_EXPRESSION_TYPES] = {
+    "identifier", "function_call", "literal", "binary",
+};
+
+// Struct for the count of a single opcode
+typedef struct StatsOpcode {
+    char name[STATS_OPCODE_LENGTH]; // the opcode
+    size_t count; // amount of its instructions
+} StatsOpcode;
+
+// Function to raise the counter to the value
+void statsMax(size_t *counter, size_t value) {
+    size_t current = __atomic_load_n(counter, __ATOMIC_RELAXED);
+    while (value > current && !__atomic_compare_exchange_n(counter, &current, value, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+}
+
+// Function to tell, if the counters were compiled in
+bool statsEnabled(void) {
+#ifdef COMPILER_STATS
+    return true;
+#else
+    return false;
+#endif
+}
+
+// Function to set all the counters to zero
+void statsReset(void) {
+    memset(&compilerStats, 0, sizeof(CompilerStats));
+}
+
+// Function to count the instructions by their opcode, a line of the code is an instruction
+static size_t statsCountOpcodes(const char *code, size_t length, StatsOpcode *opcodes) {
+    size_t count = 0;
+    size_t position = 0;
+    while (code && position < length) {
+        size_t end = position;
+        while (end < length && code[end] != '\n') end++;
+
+        // the header and the empty lines are not instructions
+        size_t word = position;
+        while (word < end && code[word] != ' ' && code[word] != '\r') word++;
+        size_t size = word - position;
+        if (size > 0 && size < STATS_OPCODE_LENGTH && code[position] != '.' && code[position] != '#') {
+            size_t i = 0;
+            while (i < count && (strncmp(opcodes[i].name, code + position, size) != 0 || opcodes[i].name[size] != '\0')) i++;
+            if (i == count && count < STATS_OPCODES) {
+                memcpy(opcodes[i].name, code + position, size);
+                opcodes[i].name[size] = '\0';
+                opcodes[i].count = 0;
+                count++;
+            }
+            if (i < count) opcodes[i].count++;
+        }
+        position = end + 1;
+    }
+    return count;
+}
+
+// Function to print the counters as JSON
+void statsPrintJson(FILE *output, const char *code, size_t length) {
+    CompilerStats *stats = &compilerStats;
+    size_t nodes = stats->functions + stats->params;
+    for (int i = 0; i < STATS_STATEMENT_TYPES; i++) nodes += stats->statements[i];
+    for (int i = 0; i < STATS_EXPRESSION_TYPES; i++) nodes += stats->expressions[i];
+
+    fprintf(output, "{\n");
+    fprintf(output, "  \"lexer\": {\"source_bytes\": %zu, \"tokens\": %zu, \"bytes_per_token\": %.3f},\n", stats->sourceBytes,
+            stats->tokens, stats->tokens ? (double)stats->sourceBytes / stats->tokens : 0.0);
+
+    fprintf(output, "  \"ast\": {\"nodes\": %zu, \"functions\": %zu, \"params\": %zu, \"statements\": {", nodes,
+            stats->functions, stats->params);
+    for (int i = 0; i < STATS_STATEMENT_TYPES; i++) {
+        fprintf(output, "%s\"%s\": %zu", i ? ", " : "", statsStatementNames[i], stats->statements[i]);
+    }
+    fprintf(output, "}, \"expressions\": {");
+    for (int i = 0; i < STATS_EXPRESSION_TYPES; i++) {
+        fprintf(output, "%s\"%s\": %zu", i ? ", " : "", statsExpressionNames[i], stats->expressions[i]);
+    }
+    fprintf(output, "}},\n");
+
+    fprintf(output, "  \"precedence\": {\"max_stack_depth\": %zu},\n", stats->precedenceMaxDepth);
+    fprintf(output, "  \"symtable\": {\"lookups\": %zu, \"probes\": %zu, \"bst_searches\": %zu, \"bst_nodes_visited\": %zu, "
+            "\"bst_depth_per_lookup\": %.3f},\n", stats->symtableLookups, stats->symtableProbes, stats->bstSearches,
+            stats->bstVisited, stats->bstSearches ? (double)stats->bstVisited / stats->bstSearches : 0.0);
+    fprintf(output, "  \"linked_list\": {\"active_moves\": %zu, \"steps_walked\": %zu},\n", stats->listMoves, stats->listSteps);
+
+    // the allocations are known only with the tracking allocator, the peak RSS always
+    MemoryStats *memory = &memoryStats;
+    fprintf(output, "  \"memory\": {\"tracked\": %s, \"malloc_calls\": %zu, \"calloc_calls\": %zu, \"realloc_calls\": %zu, "
+            "\"free_calls\": %zu, \"allocated_bytes\": %zu, \"peak_bytes\": %zu, \"current_bytes\": %zu, \"peak_rss_kib\": %zu, \"tags\": {",
+            memoryTrackingEnabled() ? "true" : "false", memory->mallocCalls, memory->callocCalls, memory->reallocCalls,
+            memory->freeCalls, memory->all.total, memory->all.peak, memory->all.current, memoryPeakRss());
+    for (int i = 0; i < MEMORY_TAG_COUNT; i++) {
+        fprintf(output, "%s\"%s\": {\"current\": %zu, \"peak\": %zu, \"total\": %zu}", i ? ", " : "",
+                memoryTagName((enum MEMORY_TAG)i), memory->tags[i].current, memory->tags[i].peak, memory->tags[i].total);
+    }
+    fprintf(output, "}},\n");
+
+    StatsOpcode opcodes[STATS_OPCODES];
+    size_t count = statsCountOpcodes(code, length, opcodes);
+    size_t instructions = 0;
+    for (size_t i = 0; i < count; i++) instructions += opcodes[i].count;
+    fprintf(output, "  \"codegen\": {\"code_bytes\": %zu, \"instructions\": %zu, \"opcodes\": {", code ? length : 0, instructions);
+    for (size_t i = 0; i < count; i++) fprintf(output, "%s\"%s\": %zu", i ? ", " : "", opcodes[i].name, opcodes[i].count);
+    fprintf(output, "}}\n}\n");
+}
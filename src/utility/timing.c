@@ -0,0 +1,222 @@
+/** AUTHOR
+ *
+ * @author agent <agent@local>
+ * @file timing.c
+ * @date 19.10.2026
+ * @brief Implementation of the timing of the compiler phases and of the single functions in them
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#ifdef USE_CUSTOM_STRUCTURE
+#include "utility/timing.h"
+#else
+#include "timing.h"
+#endif
+
+// Struct for a row of the summary, all the spans of the same name
+typedef struct TimingRow {
+    const char *name; // name of the spans
+    size_t count; // amount of the spans
+    uint64_t total; // summed durations, the spans on more threads can overlap
+    uint64_t max; // the longest span
+    const char *slowest; // detail of the longest span, NULL for a whole phase
+    bool nested; // the spans are of the single functions
+} TimingRow;
+
+// Function to read the monotonic clock in nanoseconds
+static uint64_t timingNow(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000000u + (uint64_t)now.tv_nsec;
+}
+
+// Function to initialize the timing
+bool timingInit(Timing *timing) {
+    timing->spans = NULL;
+    timing->count = 0;
+    timing->capacity = 0;
+    timing->threads = NULL;
+    timing->threadCount = 0;
+    timing->error = false;
+    timing->origin = timingNow();
+    return pthread_mutex_init(&timing->lock, NULL) == 0;
+}
+
+// Function to free the spans
+void timingFree(Timing *timing) {
+    for (size_t i = 0; i < timing->count; i++) free(timing->spans[i].detail);
+    free(timing->spans);
+    free(timing->threads);
+    timing->spans = NULL;
+    timing->threads = NULL;
+    timing->count = 0;
+    timing->capacity = 0;
+    timing->threadCount = 0;
+    pthread_mutex_destroy(&timing->lock);
+}
+
+// Function to find the index of the calling thread, the lock has to be held
+static bool timingThread(Timing *timing, unsigned int *index) {
+    pthread_t self = pthread_self();
+    for (unsigned int i = 0; i < timing->threadCount; i++) {
+        if (pthread_equal(timing->threads[i], self)) {
+            *index = i;
+            return true;
+        }
+    }
+
+    pthread_t *bigger = (pthread_t *)realloc(timing->threads, (timing->threadCount + 1) * sizeof(pthread_t));
+    if (!bigger) return false;
+    timing->threads = bigger;
+    timing->threads[timing->threadCount] = self;
+    *index = timing->threadCount++;
+    return true;
+}
+
+// Function to start a span
+size_t timingBegin(Timing *timing, const char *name) {
+    pthread_mutex_lock(&timing->lock);
+    size_t span = TIMING_NO_SPAN;
+    unsigned int thread;
+
+    if (timing->count == timing->capacity) {
+        size_t capacity = timing->capacity ? timing->capacity * 2 : 64;
+        TimingSpan *bigger = (TimingSpan *)realloc(timing->spans, capacity * sizeof(TimingSpan));
+        if (bigger) {
+            timing->spans = bigger;
+            timing->capacity = capacity;
+        }
+    }
+    if (timing->count < timing->capacity && timingThread(timing, &thread)) {
+        span = timing->count++;
+        timing->spans[span].name = name;
+        timing->spans[span].detail = NULL;
+        timing->spans[span].thread = thread;
+        timing->spans[span].done = false;
+        timing->spans[span].end = 0;
+
+        // the clock is read last, so the span does not include the allocation, the spans can move until unlocked
+        timing->spans[span].start = timingNow() - timing->origin;
+    } else {
+        timing->error = true;
+    }
+    pthread_mutex_unlock(&timing->lock);
+    return span;
+}
+
+// Function to end a span
+void timingEnd(Timing *timing, size_t span, const char *detail) {
+    if (span == TIMING_NO_SPAN) return;
+    uint64_t end = timingNow() - timing->origin;
+    char *copy = detail ? (char *)malloc(strlen(detail) + 1) : NULL;
+    if (copy) strcpy(copy, detail);
+
+    // the spans can be moved by a realloc on another thread
+    pthread_mutex_lock(&timing->lock);
+    TimingSpan *ended = &timing->spans[span];
+    ended->end = end;
+    ended->detail = copy;
+    ended->done = true;
+    if (detail && !copy) timing->error = true;
+    pthread_mutex_unlock(&timing->lock);
+}
+
+// Function to print the table of the phases
+void timingPrintSummary(Timing *timing, FILE *output) {
+    pthread_mutex_lock(&timing->lock);
+    TimingRow *rows = (TimingRow *)malloc((timing->count ? timing->count : 1) * sizeof(TimingRow));
+    if (!rows) {
+        pthread_mutex_unlock(&timing->lock);
+        fprintf(output, "timing: out of memory\n");
+        return;
+    }
+
+    // the rows are in the order, the phases were first started, the wall time is from the first start to the last end
+    size_t rowCount = 0;
+    uint64_t first = UINT64_MAX, last = 0;
+    for (size_t i = 0; i < timing->count; i++) {
+        TimingSpan *span = &timing->spans[i];
+        if (!span->done) continue;
+        if (span->start < first) first = span->start;
+        if (span->end > last) last = span->end;
+
+        size_t row = 0;
+        while (row < rowCount && strcmp(rows[row].name, span->name) != 0) row++;
+        if (row == rowCount) {
+            rows[rowCount++] = (TimingRow){span->name, 0, 0, 0, NULL, span->detail != NULL};
+        }
+
+        uint64_t duration = span->end - span->start;
+        rows[row].count++;
+        rows[row].total += duration;
+        if (rows[row].count == 1 || duration > rows[row].max) {
+            rows[row].max = duration;
+            rows[row].slowest = span->detail;
+        }
+    }
+    uint64_t wall = (rowCount > 0) ? last - first : 0;
+
+    fprintf(output, "===------------------------------------------------------------------===\n");
+    fprintf(output, "  phase timing, %.3f ms wall, %u thread%s%s\n", wall / 1e6, timing->threadCount,
+            timing->threadCount == 1 ? "" : "s", timing->error ? ", some spans were not recorded" : "");
+    fprintf(output, "===------------------------------------------------------------------===\n");
+    fprintf(output, "  %-22s %8s %12s %8s %10s  %s\n", "phase", "count", "total ms", "%", "max ms", "slowest");
+    for (size_t i = 0; i < rowCount; i++) {
+        fprintf(output, "  %s%-*s %8zu %12.3f %7.1f%% %10.3f  %s\n", rows[i].nested ? "  " : "", rows[i].nested ? 20 : 22,
+                rows[i].name, rows[i].count, rows[i].total / 1e6, wall ? 100.0 * rows[i].total / wall : 0.0,
+                rows[i].max / 1e6, rows[i].slowest ? rows[i].slowest : "");
+    }
+    pthread_mutex_unlock(&timing->lock);
+    free(rows);
+}
+
+// Function to write a string into the JSON, escaped
+static void timingWriteString(FILE *output, const char *string) {
+    fputc('"', output);
+    for (const unsigned char *c = (const unsigned char *)string; *c; c++) {
+        if (*c == '"' || *c == '\\') fprintf(output, "\\%c", *c);
+        else if (*c < 0x20) fprintf(output, "\\u%04x", *c);
+        else fputc(*c, output);
+    }
+    fputc('"', output);
+}
+
+// Function to write the spans in the trace event format
+bool timingWriteTrace(Timing *timing, const char *path) {
+    FILE *output = fopen(path, "w");
+    if (!output) return false;
+
+    // the complete events have the start and the duration in microseconds, the threads are named by their order
+    pthread_mutex_lock(&timing->lock);
+    fprintf(output, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+    fprintf(output, "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,\"args\":{\"name\":\"ifj24\"}}");
+    for (unsigned int i = 0; i < timing->threadCount; i++) {
+        fprintf(output, ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"%s %u\"}}", i,
+                i == 0 ? "main" : "worker", i);
+    }
+    for (size_t i = 0; i < timing->count; i++) {
+        TimingSpan *span = &timing->spans[i];
+        if (!span->done) continue;
+        fprintf(output, ",\n{\"name\":");
+        timingWriteString(output, span->name);
+        fprintf(output, ",\"cat\":\"%s\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%u", span->detail ? "function" : "phase",
+                span->start / 1e3, (span->end - span->start) / 1e3, span->thread);
+        if (span->detail) {
+            fprintf(output, ",\"args\":{\"function\":");
+            timingWriteString(output, span->detail);
+            fputc('}', output);
+        }
+        fputc('}', output);
+    }
+    fprintf(output, "\n]}\n");
+    pthread_mutex_unlock(&timing->lock);
+
+    bool written = !ferror(output);
+    if (fclose(output) != 0) written = false;
+    return written;
+}
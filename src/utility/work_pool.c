@@ -0,0 +1,136 @@
+/** AUTHOR
+ *
+ * @author agent <agent@local>
+ * @file work_pool.c
+ * @date 19.10.2026
+ * @brief Implementation of the thread pool with work stealing deques
+ */
+
+#include <stdlib.h>
+
+#ifdef USE_CUSTOM_STRUCTURE
+#include "utility/work_pool.h"
+#else
+#include "work_pool.h"
+#endif
+
+// Struct for the arguments of a worker thread
+typedef struct WorkWorker {
+    WorkPool *pool;
+    unsigned int id;
+    pthread_t thread;
+} WorkWorker;
+
+// Function to take the next task of the worker
+bool workDequePop(WorkDeque *deque, size_t *index) {
+    bool found = false;
+    pthread_mutex_lock(&deque->lock);
+    if (deque->top < deque->bottom) {
+        *index = deque->tasks[--deque->bottom];
+        found = true;
+    }
+    pthread_mutex_unlock(&deque->lock);
+    return found;
+}
+
+// Function to steal a task from another worker
+bool workDequeSteal(WorkDeque *deque, size_t *index) {
+    bool found = false;
+    pthread_mutex_lock(&deque->lock);
+    if (deque->top < deque->bottom) {
+        *index = deque->tasks[deque->top++];
+        found = true;
+    }
+    pthread_mutex_unlock(&deque->lock);
+    return found;
+}
+
+// Function to run the tasks of a single worker, then steal until every deque is empty
+static void *workPoolWorker(void *arg) {
+    WorkWorker *worker = (WorkWorker *)arg;
+    WorkPool *pool = worker->pool;
+    size_t index;
+    size_t stolen = 0;
+
+    while (true) {
+        if (workDequePop(&pool->deques[worker->id], &index)) {
+            pool->task(pool->data, index);
+            continue;
+        }
+
+        // no tasks are added while running, so once every deque is empty, the work is done
+        bool found = false;
+        for (unsigned int i = 1; i < pool->workerCount && !found; i++) {
+            found = workDequeSteal(&pool->deques[(worker->id + i) % pool->workerCount], &index);
+        }
+        if (!found) break;
+
+        stolen++;
+        pool->task(pool->data, index);
+    }
+
+    pthread_mutex_lock(&pool->statsLock);
+    pool->steals += stolen;
+    pthread_mutex_unlock(&pool->statsLock);
+    return NULL;
+}
+
+// Function to run all the tasks on the pool
+bool workPoolRun(size_t taskCount, unsigned int workerCount, WorkTask task, void *data, size_t *steals) {
+    if (steals) *steals = 0;
+
+    // no threads needed
+    if (workerCount <= 1 || taskCount <= 1) {
+        for (size_t i = 0; i < taskCount; i++) task(data, i);
+        return true;
+    }
+    if (workerCount > taskCount) workerCount = (unsigned int)taskCount;
+
+    WorkPool pool;
+    pool.workerCount = workerCount;
+    pool.task = task;
+    pool.data = data;
+    pool.steals = 0;
+
+    pool.deques = (WorkDeque *)malloc(workerCount * sizeof(WorkDeque));
+    size_t *tasks = (size_t *)malloc(taskCount * sizeof(size_t));
+    WorkWorker *workers = (WorkWorker *)malloc(workerCount * sizeof(WorkWorker));
+    if (!pool.deques || !tasks || !workers) {
+        free(pool.deques);
+        free(tasks);
+        free(workers);
+        return false;
+    }
+
+    // a continuous block for every worker, the owner works from its end, the thieves from its start
+    for (size_t i = 0; i < taskCount; i++) tasks[i] = i;
+    for (unsigned int w = 0; w < workerCount; w++) {
+        size_t start = taskCount * w / workerCount;
+        size_t end = taskCount * (w + 1) / workerCount;
+        pool.deques[w].tasks = tasks + start;
+        pool.deques[w].top = 0;
+        pool.deques[w].bottom = end - start;
+        pthread_mutex_init(&pool.deques[w].lock, NULL);
+    }
+    pthread_mutex_init(&pool.statsLock, NULL);
+
+    unsigned int started = 0;
+    for (; started < workerCount; started++) {
+        workers[started].pool = &pool;
+        workers[started].id = started;
+        if (pthread_create(&workers[started].thread, NULL, workPoolWorker, &workers[started]) != 0) break;
+    }
+
+    // the started workers steal the tasks of the ones, that failed to start
+    for (unsigned int w = 0; w < started; w++) pthread_join(workers[w].thread, NULL);
+    bool success = started > 0;
+
+    for (unsigned int w = 0; w < workerCount; w++) pthread_mutex_destroy(&pool.deques[w].lock);
+    pthread_mutex_destroy(&pool.statsLock);
+    if (steals) *steals = pool.steals;
+
+    free(pool.deques);
+    free(tasks);
+    free(workers);
+    return success;
+}
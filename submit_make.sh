@@ -19,12 +19,15 @@ fi
 # Create the submit directory
 mkdir -p "$SUBMIT_DIR/test_inputs"
 
+# The interpreter of the generated code is a separate tool, it is not submitted with the compiler
+EXCLUDED="-path src/interpreter -prune -o -path include/interpreter -prune -o"
+
 # Collect all .c and .h files, flattening the structure
-FILES=$(find src include -type f \( -name "*.c" -o -name "*.h" \) -exec basename {} \;)
+FILES=$(find src include $EXCLUDED -type f \( -name "*.c" -o -name "*.h" \) -exec basename {} \;)
 
 # Copy files into the submit directory
 for FILE in $FILES; do
-    find src include -type f -name "$FILE" -exec cp {} "$SUBMIT_DIR" \;
+    find src include $EXCLUDED -type f -name "$FILE" -exec cp {} "$SUBMIT_DIR" \;
 done
 
 # Add additional required files
@@ -34,7 +37,7 @@ cp ./docs/dokumentace.pdf "$SUBMIT_DIR/dokumentace.pdf"
 # Generate the new Makefile in the submit directory
 cat << 'EOF' > "$SUBMIT_DIR/Makefile"
 CC = gcc
-CFLAGS = -std=c99 -Wall -Wextra -pedantic -fcommon
+CFLAGS = -std=c99 -Wall -Wextra -pedantic -fcommon -pthread
 
 # Collect all .h and .c files in the current directory
 INCLUDES = $(wildcard ./*.h)
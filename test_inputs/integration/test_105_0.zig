@@ -0,0 +1,31 @@
+const ifj = @import("ifj24.zig");
+// tail recursive functions, the self calls are generated as jumps
+pub fn fact(n: i32, acc: i32) i32 {
+    if (n < 2) {
+        return acc;
+    } else {
+    }
+    const m = n - 1;
+    const a = acc * n;
+    var k: i32 = 0;
+    while (k < 2) {
+        const z = k + 1;
+        k = z;
+    }
+    return fact(m, a);
+}
+pub fn count(n: i32) i32 {
+    if (n == 0) {
+        return 0;
+    } else {
+    }
+    const m = n - 1;
+    return count(m);
+}
+pub fn main() void {
+    const r = fact(10, 1);
+    ifj.write(r);
+    ifj.write("\n");
+    const c = count(100000);
+    ifj.write(c);
+}
@@ -417,11 +417,129 @@ void test_case_2(void) {
     finishTestInstance(testInstance);
 }
 
+// keys inserted in order by the balance test, a tree without balancing would be a list of them
+#define BST_SORTED_SIZE 4095
+
+// highest AVL tree of BST_SORTED_SIZE nodes, 1.44 * log2(n + 2)
+#define BST_SORTED_MAX_HEIGHT 17
+
+void test_case_3(void) {
+
+    TestInstancePtr testInstance = initTestInstance("Binary Search Tree (BST) Test balance");
+
+    BST *tree = bstInit(NULL);
+    char data = 'A';
+
+    // Insert the keys in order, the worst case of an unbalanced tree
+    bool inserted = true;
+    for (unsigned int key = 0; key < BST_SORTED_SIZE; key++) inserted = bstInsertNode(tree, key, &data) && inserted;
+    testCase(
+        testInstance,
+        inserted && tree->size == BST_SORTED_SIZE && bstCalculateHeight(tree) <= BST_SORTED_MAX_HEIGHT,
+        "Inserting sorted keys",
+        "All keys inserted, the height is logarithmic (expected)",
+        "Keys missing or the tree is too high (unexpected)"
+    );
+
+    // Remove every odd key
+    bool removed = true;
+    for (unsigned int key = 1; key < BST_SORTED_SIZE; key += 2) removed = bstRemoveNode(tree, key) && removed;
+    bool found = true;
+    for (unsigned int key = 0; key < BST_SORTED_SIZE; key++) found = found && ((bstSearchForNode(tree, key) != NULL) == (key % 2 == 0));
+    testCase(
+        testInstance,
+        removed && found && tree->size == BST_SORTED_SIZE / 2 + 1 && bstCalculateHeight(tree) <= BST_SORTED_MAX_HEIGHT,
+        "Removing every odd key",
+        "Only the even keys are left, the height is logarithmic (expected)",
+        "Wrong keys left or the tree is too high (unexpected)"
+    );
+
+    testCase(
+        testInstance,
+        bstFree(&tree),
+        "Freeing the binary search tree",
+        "Tree freed successfully (expected)",
+        "Failed to free the tree (unexpected)"
+    );
+
+    finishTestInstance(testInstance);
+}
+
+// largest benchmarked tree
+#define BST_BENCH_MAX_SIZE 1000000
+
+// Struct for the state of the tree benchmarks
+typedef struct BstBench {
+    BST *tree; // the measured tree
+    unsigned int size; // nodes of the tree
+    size_t found; // found nodes, so the searches are not left out
+} BstBench;
+
+// Function to get the key of the index, spread like the hashes of the names
+unsigned int bstBenchKey(unsigned int index) {
+    return index * 2654435761u;
+}
+
+// Function to create an empty tree for the benchmark
+void bstBenchCreate(void *data) {
+    BstBench *bench = (BstBench *)data;
+    bench->tree = bstInit(NULL);
+}
+
+// Function to insert all the keys
+void bstBenchInsert(void *data) {
+    BstBench *bench = (BstBench *)data;
+    for (unsigned int i = 0; i < bench->size; i++) bstInsertNode(bench->tree, bstBenchKey(i), (void *)bench);
+}
+
+// Function to create a full tree for the benchmark
+void bstBenchFill(void *data) {
+    bstBenchCreate(data);
+    bstBenchInsert(data);
+}
+
+// Function to free the tree of the benchmark
+void bstBenchFree(void *data) {
+    BstBench *bench = (BstBench *)data;
+    if (bench->tree) bstFree(&bench->tree);
+}
+
+// Function to search for all the keys
+void bstBenchLookup(void *data) {
+    BstBench *bench = (BstBench *)data;
+    for (unsigned int i = 0; i < bench->size; i++) bench->found += bstSearchForNode(bench->tree, bstBenchKey(i)) != NULL;
+}
+
+// Function to list all the nodes in order, the only way to walk the tree
+void bstBenchNodes(void *data) {
+    BstBench *bench = (BstBench *)data;
+    LinkedList *nodes = bstGetNodes(bench->tree);
+    bench->found += getSize(nodes);
+    removeList(&nodes);
+}
+
+void bench_case_1(void) {
+
+    TestInstancePtr testInstance = initTestInstance("Binary Search Tree Benchmarks");
+
+    BstBench bench = {NULL, 0, 0};
+    benchSweep(testInstance, (BenchSweepCase[]){
+        {"insert", 0, bstBenchCreate, bstBenchInsert, bstBenchFree},
+        {"lookup", 0, bstBenchFill, bstBenchLookup, bstBenchFree},
+        {"in order access", 0, bstBenchFill, bstBenchNodes, bstBenchFree},
+        {"free", 0, bstBenchFill, bstBenchFree, NULL},
+    }, 4, &bench, &bench.size, BST_BENCH_MAX_SIZE);
+
+    finishTestInstance(testInstance);
+}
+
 
 int main(void) {
 
     test_case_1();
     test_case_2();
+    test_case_3();
+    bench_case_1();
 
     return 0;
 }
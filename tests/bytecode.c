@@ -0,0 +1,340 @@
+/** AUTHOR
+ *
+ * @author agent <agent@local>
+ * @file bytecode.c
+ * @date 19.10.2026
+ * @brief Test file for the fast engine of IFJcode24, its results are compared with the reference interpreter
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "ifj24.h"
+#include "interpreter/bytecode.h"
+#include "interpreter/ifjcode.h"
+#include "interpreter/interpreter.h"
+#include "utility/enumerations.h"
+
+// Function to load and run a code by one of the engines, the output is stored into the given buffer
+int runEngine(const char *text, const char *input, bool fast, char *written, size_t size) {
+    written[0] = '\0';
+
+    IfjCode code;
+    char diagnostic[IFJCODE_DIAGNOSTIC_LENGTH];
+    int status = ifjCodeLoad(text, strlen(text), &code, diagnostic);
+    if (status != IFJCODE_SUCCESS) {
+        ifjCodeFree(&code);
+        return status;
+    }
+
+    FILE *in = tmpfile();
+    FILE *out = tmpfile();
+    if (!in || !out) {
+        if (in) fclose(in);
+        if (out) fclose(out);
+        ifjCodeFree(&code);
+        return IFJCODE_E_INTERNAL;
+    }
+    fputs(input, in);
+    rewind(in);
+
+    if (fast) {
+        Bytecode bytecode;
+        BytecodeMachine machine;
+        status = bytecodeLoad(&code, &bytecode);
+        if (status == IFJCODE_SUCCESS) {
+            status = bytecodeMachineInit(&machine, &bytecode, in, out) ? bytecodeMachineRun(&machine) : IFJCODE_E_INTERNAL;
+            bytecodeMachineFree(&machine);
+        }
+        bytecodeFree(&bytecode);
+    } else {
+        Interpreter interpreter;
+        interpreterInit(&interpreter, &code, in, out, NULL);
+        status = interpreterRun(&interpreter);
+        interpreterFree(&interpreter);
+    }
+
+    rewind(out);
+    size_t length = fread(written, 1, size - 1, out);
+    written[length] = '\0';
+    fclose(in);
+    fclose(out);
+    ifjCodeFree(&code);
+    return status;
+}
+
+// Function to run a code by the fast engine, the output is stored into a static string
+int runFast(const char *text, const char *input, char **output) {
+    static char written[4096];
+    *output = written;
+    return runEngine(text, input, true, written, sizeof(written));
+}
+
+// Function to run a code by both engines, true if their outputs and exit codes are the same
+bool sameResults(const char *text, const char *input) {
+    static char reference[4096], fast[4096];
+    int expected = runEngine(text, input, false, reference, sizeof(reference));
+    int status = runEngine(text, input, true, fast, sizeof(fast));
+    return status == expected && strcmp(reference, fast) == 0;
+}
+
+void test1(void) {
+
+    TestInstancePtr testInstance = initTestInstance("Bytecode Test decoding");
+
+    const char *text =
+        ".IFJcode24\n"
+        "DEFVAR GF@_\n"
+        "CREATEFRAME\n"
+        "CALL function_main\n"
+        "EXIT int@0\n"
+        "LABEL function_main\n"
+        "PUSHFRAME\n"
+        "CREATEFRAME\n"
+        "DEFVAR TF@i\n"
+        "MOVE TF@i int@0\n"
+        "LABEL $while\n"
+        "PUSHS TF@i\n"
+        "PUSHS int@3\n"
+        "LTS\n"
+        "POPS GF@_\n"
+        "JUMPIFEQ $while_end GF@_ bool@false\n"
+        "PUSHS TF@i\n"
+        "PUSHS int@1\n"
+        "ADDS\n"
+        "POPS TF@i\n"
+        "JUMP $while\n"
+        "LABEL $while_end\n"
+        "WRITE TF@i\n"
+        "POPFRAME\n"
+        "RETURN\n";
+    IfjCode code;
+    Bytecode bytecode;
+    char diagnostic[IFJCODE_DIAGNOSTIC_LENGTH];
+    bool loaded = ifjCodeLoad(text, strlen(text), &code, diagnostic) == IFJCODE_SUCCESS && bytecodeLoad(&code, &bytecode) == IFJCODE_SUCCESS;
+    const BytecodeInstruction *instructions = bytecode.instructions;
+    testCase(
+        testInstance,
+        loaded && bytecode.size == 16 && bytecode.superinstructions == 2 && bytecode.globalCount == 1 &&
+            instructions[10].opcode == BC_PUSHS_PUSHS_BINARY_POPS && instructions[10].operation == OP_ADD &&
+            instructions[11].opcode == BC_JUMP && instructions[11].target == 8 && instructions[8].opcode == BC_PUSHS_PUSHS_BINARY_POPS &&
+            instructions[8].operands[2].kind == BYTECODE_GLOBAL && instructions[9].opcode == BC_JUMPIF && instructions[9].target == 12 &&
+            instructions[12].opcode == BC_WRITE && instructions[12].operands[0].kind == BYTECODE_TEMPORARY &&
+            instructions[12].operands[0].slot == 0 && instructions[15].opcode == BC_END,
+        "Decoding a loop of the generated code",
+        "The LABELs dropped, the jumps resolved, the variables given slots and the sequences fused (expected)",
+        "Wrong bytecode (unexpected)"
+    );
+    bytecodeFree(&bytecode);
+    ifjCodeFree(&code);
+
+    char *output;
+    int status = runFast(text, "", &output);
+    testCase(
+        testInstance,
+        status == 0 && strcmp(output, "3") == 0,
+        "Running the decoded loop",
+        "The loop ran three times (expected)",
+        "Wrong output or exit code (unexpected)"
+    );
+
+    finishTestInstance(testInstance);
+}
+
+void test2(void) {
+
+    TestInstancePtr testInstance = initTestInstance("Bytecode Test running");
+
+    const char *text =
+        ".IFJcode24\n"
+        "DEFVAR GF@a\n"
+        "CREATEFRAME\n"
+        "DEFVAR TF@b\n"
+        "MOVE TF@b int@7\n"
+        "PUSHFRAME\n"
+        "IDIV GF@a LF@b int@2\n"
+        "WRITE GF@a\n"
+        "PUSHS float@0x1.5p5\n"
+        "PUSHS float@2.0\n"
+        "DIVS\n"
+        "POPS GF@a\n"
+        "WRITE GF@a\n"
+        "CONCAT GF@a string@ab string@cd\n"
+        "SETCHAR GF@a int@1 string@X\n"
+        "WRITE GF@a\n"
+        "TYPE GF@a LF@b\n"
+        "WRITE GF@a\n"
+        "READ GF@a int\n"
+        "WRITE GF@a\n"
+        "READ GF@a int\n"
+        "TYPE GF@a GF@a\n"
+        "WRITE GF@a\n"
+        "POPFRAME\n"
+        "EXIT int@3\n";
+    char *output;
+    int status = runFast(text, "41\nnot a number\n", &output);
+    testCase(
+        testInstance,
+        status == 3 && strcmp(output, "30x1.5p4aXcdint41nil") == 0,
+        "Running the frames, the arithmetic, the strings and READ",
+        "The values written and the exit code returned (expected)",
+        "Wrong output or exit code (unexpected)"
+    );
+
+    const char *wrong[] = {
+        ".IFJcode24\nADD GF@x int@1 int@2\n",
+        ".IFJcode24\nDEFVAR GF@x\nADD GF@x int@1 float@1.0\n",
+        ".IFJcode24\nDEFVAR TF@x\n",
+        ".IFJcode24\nDEFVAR GF@x\nWRITE GF@x\n",
+        ".IFJcode24\nDEFVAR GF@x\nIDIV GF@x int@1 int@0\n",
+        ".IFJcode24\nDEFVAR GF@x\nGETCHAR GF@x string@ab int@2\n",
+        ".IFJcode24\nPOPS GF@_\n",
+        ".IFJcode24\nEXIT int@10\n",
+        ".IFJcode24\nDEFVAR GF@x\nPUSHS int@1\nPUSHS string@a\nADDS\nPOPS GF@x\n",
+        ".IFJcode24\nDEFVAR GF@x\nPUSHS int@1\nPOPS GF@x\nDEFVAR GF@x\n",
+    };
+    const int expected[] = {IFJCODE_E_UNDEFINED_VAR, IFJCODE_E_OPERAND_TYPE, IFJCODE_E_FRAME, IFJCODE_E_MISSING_VALUE, IFJCODE_E_OPERAND_VALUE,
+                            IFJCODE_E_STRING, IFJCODE_E_MISSING_VALUE, IFJCODE_E_OPERAND_VALUE, IFJCODE_E_OPERAND_TYPE, IFJCODE_E_SEMANTIC};
+    bool failed = true;
+    for (size_t i = 0; i < sizeof(expected) / sizeof(expected[0]); i++) {
+        failed = failed && runFast(wrong[i], "", &output) == expected[i] && sameResults(wrong[i], "");
+    }
+    testCase(
+        testInstance,
+        failed,
+        "Running wrong codes",
+        "Every runtime error with the exit code of the reference, also inside of a superinstruction (expected)",
+        "Wrong exit code (unexpected)"
+    );
+
+    finishTestInstance(testInstance);
+}
+
+void test3(void) {
+
+    TestInstancePtr testInstance = initTestInstance("Bytecode Test frames of other functions");
+
+    // the frame of the code outside of the functions is used by f, w is not in its layout at all
+    const char *text =
+        ".IFJcode24\n"
+        "CREATEFRAME\n"
+        "DEFVAR TF@x\n"
+        "MOVE TF@x int@5\n"
+        "CALL f\n"
+        "CALL f\n"
+        "PUSHFRAME\n"
+        "WRITE LF@x\n"
+        "WRITE LF@z\n"
+        "EXIT int@0\n"
+        "LABEL f\n"
+        "DEFVAR TF@w\n"
+        "MOVE TF@w int@2\n"
+        "DEFVAR TF@z\n"
+        "ADD TF@z TF@x TF@w\n"
+        "RETURN\n";
+    char *output;
+    int status = runFast(text, "", &output);
+    testCase(
+        testInstance,
+        status == IFJCODE_E_SEMANTIC && sameResults(text, ""),
+        "Defining the variables of another function twice",
+        "The second DEFVAR of the extra variable failed as a redefinition (expected)",
+        "Wrong exit code (unexpected)"
+    );
+
+    status = runFast(
+        ".IFJcode24\n"
+        "CREATEFRAME\n"
+        "DEFVAR TF@x\n"
+        "MOVE TF@x int@5\n"
+        "CALL f\n"
+        "PUSHFRAME\n"
+        "WRITE LF@x\n"
+        "WRITE LF@z\n"
+        "EXIT int@0\n"
+        "LABEL f\n"
+        "DEFVAR TF@w\n"
+        "MOVE TF@w int@2\n"
+        "DEFVAR TF@z\n"
+        "ADD TF@z TF@x TF@w\n"
+        "RETURN\n",
+        "", &output);
+    testCase(
+        testInstance,
+        status == 0 && strcmp(output, "57") == 0,
+        "Using a frame created outside of the function",
+        "The slots resolved by the names and the extra variable defined (expected)",
+        "Wrong output or exit code (unexpected)"
+    );
+
+    finishTestInstance(testInstance);
+}
+
+void test4(void) {
+
+    TestInstancePtr testInstance = initTestInstance("Bytecode Test generated code");
+
+    const char *source =
+        "const ifj = @import(\"ifj24.zig\");\n"
+        "pub fn factorial(n: i32) i32 {\n"
+        "    if (n < 2) {\n"
+        "        return 1;\n"
+        "    } else {\n"
+        "        const m = n - 1;\n"
+        "        const r = factorial(m);\n"
+        "        return n * r;\n"
+        "    }\n"
+        "}\n"
+        "pub fn main() void {\n"
+        "    const a = ifj.readi32();\n"
+        "    if (a) |n| {\n"
+        "        const r = factorial(n);\n"
+        "        ifj.write(r);\n"
+        "        var f: f64 = ifj.i2f(n);\n"
+        "        while (f > 0.5) {\n"
+        "            f = f / 2.0;\n"
+        "        }\n"
+        "        ifj.write(f);\n"
+        "        const t = ifj.string(\"factorial\");\n"
+        "        const s = ifj.substring(t, 0, 4);\n"
+        "        ifj.write(s);\n"
+        "    } else {\n"
+        "        ifj.write(\"null\");\n"
+        "    }\n"
+        "}\n";
+    Ifj24Result result;
+    int compiled = ifj24Compile(source, strlen(source), &result);
+
+    char *output;
+    int status = compiled == 0 ? runFast(result.code, "10\n", &output) : -1;
+    testCase(
+        testInstance,
+        status == 0 && strcmp(output, "36288000x1.4p-2fact") == 0,
+        "Running the generated code of a recursive factorial, a loop and the builtins",
+        "The factorial, the halved float and the substring written (expected)",
+        "Wrong output or exit code (unexpected)"
+    );
+
+    const char *inputs[] = {"10\n", "0\n", "-3\n", "", "x\n"};
+    bool same = compiled == 0;
+    for (size_t i = 0; i < sizeof(inputs) / sizeof(inputs[0]); i++) same = same && sameResults(result.code, inputs[i]);
+    testCase(
+        testInstance,
+        same,
+        "Comparing the engines over more inputs",
+        "The outputs and the exit codes of the reference (expected)",
+        "Different results (unexpected)"
+    );
+    ifj24ResultFree(&result);
+
+    finishTestInstance(testInstance);
+}
+
+
+int main(void) {
+    test1();
+    test2();
+    test3();
+    test4();
+    return 0;
+}
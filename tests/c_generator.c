@@ -0,0 +1,337 @@
+/** AUTHOR
+ *
+ * @author agent <agent@local>
+ * @file c_generator.c
+ * @date 19.10.2026
+ * @brief Test file for the C backend, the native programs are compared with the reference interpreter
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/wait.h>
+#include "ifj24.h"
+#include "interpreter/ifjcode.h"
+#include "interpreter/interpreter.h"
+#include "utility/enumerations.h"
+
+// exit code of a native program, that could not be built
+#define NATIVE_NOT_BUILT -1
+
+char *loopSource =
+    "const ifj = @import(\"ifj24.zig\");\n"
+    "pub fn main() void {\n"
+    "    var i: i32 = 0;\n"
+    "    var s: f64 = 0.5;\n"
+    "    while (i < 10) {\n"
+    "        s = s * 2.0 + 1;\n"
+    "        i = i + 1;\n"
+    "    }\n"
+    "    ifj.write(s);\n"
+    "    const d = i / 3;\n"
+    "    ifj.write(d);\n"
+    "}\n";
+
+char *nullableSource =
+    "const ifj = @import(\"ifj24.zig\");\n"
+    "pub fn pick(n: i32, x: ?f64) ?[]u8 {\n"
+    "    if (x) |v| {\n"
+    "        ifj.write(v);\n"
+    "    } else {}\n"
+    "    if (n == 0) {\n"
+    "        return null;\n"
+    "    } else {\n"
+    "        return ifj.string(\"a\\n\\\"b?\\\\\");\n"
+    "    }\n"
+    "}\n"
+    "pub fn main() void {\n"
+    "    const none: ?f64 = null;\n"
+    "    const q = pick(1, none);\n"
+    "    ifj.write(q);\n"
+    "    const r = pick(0, 2.5);\n"
+    "    if (r) |rr| {\n"
+    "        ifj.write(rr);\n"
+    "    } else {\n"
+    "        ifj.write(\"null\\n\");\n"
+    "    }\n"
+    "    const z = ifj.readi32();\n"
+    "    if (z) |zz| {\n"
+    "        ifj.write(zz);\n"
+    "    } else {\n"
+    "        ifj.write(\"no number\");\n"
+    "    }\n"
+    "    const ab = ifj.string(\"ab\");\n"
+    "    const c = ifj.concat(ab, ab);\n"
+    "    const e = ifj.strcmp(c, ab);\n"
+    "    ifj.write(e);\n"
+    "    const o = ifj.ord(c, 1);\n"
+    "    ifj.write(o);\n"
+    "    const h = ifj.chr(65);\n"
+    "    ifj.write(h);\n"
+    "    var sub = ifj.substring(c, 1, 3);\n"
+    "    while (sub) |w| {\n"
+    "        ifj.write(w);\n"
+    "        sub = ifj.substring(w, 1, 1);\n"
+    "    }\n"
+    "}\n";
+
+char *divisionSource =
+    "const ifj = @import(\"ifj24.zig\");\n"
+    "pub fn main() void {\n"
+    "    const a = ifj.readi32();\n"
+    "    if (a) |n| {\n"
+    "        const d = 10 / n;\n"
+    "        ifj.write(d);\n"
+    "    } else {}\n"
+    "}\n";
+
+char *recursionSource =
+    "const ifj = @import(\"ifj24.zig\");\n"
+    "pub fn factorial(n: i32) i32 {\n"
+    "    if (n < 2) {\n"
+    "        return 1;\n"
+    "    } else {\n"
+    "        const m = n - 1;\n"
+    "        const f = factorial(m);\n"
+    "        return n * f;\n"
+    "    }\n"
+    "}\n"
+    "pub fn main() void {\n"
+    "    const r = factorial(25);\n"
+    "    ifj.write(r);\n"
+    "}\n";
+
+// Function to compile a source by one of the backends, the caller frees the result
+bool compileSource(const char *source, bool emitC, Ifj24Result *result) {
+    Ifj24Options options;
+    ifj24OptionsInit(&options);
+    options.emitC = emitC;
+    return ifj24CompileWithOptions(source, strlen(source), &options, result) == SUCCESS;
+}
+
+// Function to run the source by the reference interpreter, the output is stored into the given buffer
+int runInterpreted(const char *source, const char *input, char *written, size_t size) {
+    written[0] = '\0';
+    Ifj24Result result;
+    if (!compileSource(source, false, &result)) return result.error;
+
+    IfjCode code;
+    char diagnostic[IFJCODE_DIAGNOSTIC_LENGTH];
+    int status = ifjCodeLoad(result.code, result.codeLength, &code, diagnostic);
+    FILE *in = tmpfile();
+    FILE *out = tmpfile();
+    if (status == IFJCODE_SUCCESS && in && out) {
+        fputs(input, in);
+        rewind(in);
+        Interpreter interpreter;
+        interpreterInit(&interpreter, &code, in, out, NULL);
+        status = interpreterRun(&interpreter);
+        interpreterFree(&interpreter);
+
+        rewind(out);
+        size_t length = fread(written, 1, size - 1, out);
+        written[length] = '\0';
+    }
+    if (in) fclose(in);
+    if (out) fclose(out);
+    ifjCodeFree(&code);
+    ifj24ResultFree(&result);
+    return status;
+}
+
+// Function to build the C source by the system C compiler and run it, the output is stored into the given buffer
+int runNative(const char *source, const char *input, char *written, size_t size) {
+    written[0] = '\0';
+    Ifj24Result result;
+    if (!compileSource(source, true, &result)) return NATIVE_NOT_BUILT;
+
+    char directory[] = "/tmp/ifj24_native_XXXXXX";
+    if (!mkdtemp(directory)) {
+        ifj24ResultFree(&result);
+        return NATIVE_NOT_BUILT;
+    }
+    char path[128], command[512];
+    snprintf(path, sizeof(path), "%s/program.c", directory);
+    FILE *file = fopen(path, "w");
+    if (file) {
+        fwrite(result.code, 1, result.codeLength, file);
+        fclose(file);
+    }
+    ifj24ResultFree(&result);
+    snprintf(path, sizeof(path), "%s/input", directory);
+    file = fopen(path, "w");
+    if (file) {
+        fputs(input, file);
+        fclose(file);
+    }
+
+    // the generated source has to build without a warning
+    int status = NATIVE_NOT_BUILT;
+    snprintf(command, sizeof(command), "cc -std=c99 -O2 -Wall -Wextra -pedantic -Werror -o %s/program %s/program.c 2>/dev/null",
+             directory, directory);
+    if (system(command) == 0) {
+        snprintf(command, sizeof(command), "%s/program < %s/input > %s/output 2>/dev/null", directory, directory, directory);
+        int raw = system(command);
+        status = WIFEXITED(raw) ? WEXITSTATUS(raw) : NATIVE_NOT_BUILT;
+
+        snprintf(path, sizeof(path), "%s/output", directory);
+        file = fopen(path, "r");
+        if (file) {
+            size_t length = fread(written, 1, size - 1, file);
+            written[length] = '\0';
+            fclose(file);
+        }
+    }
+
+    snprintf(command, sizeof(command), "rm -rf %s", directory);
+    if (system(command) != 0) fprintf(stderr, "cannot remove %s\n", directory);
+    return status;
+}
+
+// Function to run a source by both backends, true if their outputs and exit codes are the same
+bool sameResults(const char *source, const char *input) {
+    static char reference[4096], native[4096];
+    int expected = runInterpreted(source, input, reference, sizeof(reference));
+    int status = runNative(source, input, native, sizeof(native));
+    return status == expected && strcmp(reference, native) == 0;
+}
+
+void test1(void) {
+
+    TestInstancePtr testInstance = initTestInstance("C Backend Test generated source");
+
+    Ifj24Result result;
+    bool compiled = compileSource(loopSource, true, &result);
+    testCase(
+        testInstance,
+        compiled && strstr(result.code, ".IFJcode24") == NULL && strstr(result.code, "int main(void) {\n    f_main();") != NULL,
+        "Generating C from a valid program",
+        "C source with the entry point generated (expected)",
+        "No C source or IFJcode24 generated (unexpected)"
+    );
+
+    testCase(
+        testInstance,
+        compiled && strstr(result.code, "static void f_main(void) {") != NULL && strstr(result.code, "    ifj_i32 v_i_") != NULL &&
+            strstr(result.code, "    ifj_f64 v_s_") != NULL && strstr(result.code, "while ((v_i_") != NULL,
+        "Checking the locals of main",
+        "Typed C locals and a C loop (expected)",
+        "Untyped locals or the loop is missing (unexpected)"
+    );
+
+    testCase(
+        testInstance,
+        compiled && strstr(result.code, "ifj_add_i32(v_i_") != NULL && strstr(result.code, "ifj_div_i32(v_i_") != NULL &&
+            strstr(result.code, "((ifj_f64)1)") != NULL,
+        "Checking the arithmetic",
+        "Wrapping i32 arithmetic, checked division and converted literal (expected)",
+        "Wrong arithmetic (unexpected)"
+    );
+    ifj24ResultFree(&result);
+
+    compiled = compileSource(nullableSource, true, &result);
+    testCase(
+        testInstance,
+        compiled && strstr(result.code, "static ifj_opt_u8 f_pick(ifj_i32 v_n_") != NULL &&
+            strstr(result.code, "return ifj_null_u8();") != NULL && strstr(result.code, "ifj_some_f64(0x1.4p") != NULL &&
+            strstr(result.code, "\"a\\012\\042b\\077\\134\", 6}") != NULL,
+        "Generating the nullable values",
+        "Tagged structs, wrapped arguments and escaped literals (expected)",
+        "Wrong nullable values (unexpected)"
+    );
+    ifj24ResultFree(&result);
+
+    finishTestInstance(testInstance);
+}
+
+void test2(void) {
+
+    TestInstancePtr testInstance = initTestInstance("C Backend Test native run");
+
+    char output[4096];
+    int status = runNative(loopSource, "", output, sizeof(output));
+    testCase(
+        testInstance,
+        status == 0 && strcmp(output, "0x1.7fcp103") == 0,
+        "Building and running the loop",
+        "The same output as the interpreter (expected)",
+        "Not built or wrong output (unexpected)"
+    );
+
+    testCase(
+        testInstance,
+        sameResults(loopSource, ""),
+        "Comparing the loop with the interpreter",
+        "Same output and exit code (expected)",
+        "Different results (unexpected)"
+    );
+
+    testCase(
+        testInstance,
+        sameResults(recursionSource, ""),
+        "Comparing the recursion with the interpreter, the product wraps around",
+        "Same output and exit code (expected)",
+        "Different results (unexpected)"
+    );
+
+    finishTestInstance(testInstance);
+}
+
+void test3(void) {
+
+    TestInstancePtr testInstance = initTestInstance("C Backend Test nullable values and builtins");
+
+    testCase(
+        testInstance,
+        sameResults(nullableSource, "42\n"),
+        "Comparing the nullable values and the string builtins",
+        "Same output and exit code (expected)",
+        "Different results (unexpected)"
+    );
+
+    testCase(
+        testInstance,
+        sameResults(nullableSource, "  -7 \n") && sameResults(nullableSource, "seven\n") && sameResults(nullableSource, ""),
+        "Comparing the reading of numbers, with spaces, of a word and at the end of the input",
+        "Same output and exit code (expected)",
+        "Different results (unexpected)"
+    );
+
+    finishTestInstance(testInstance);
+}
+
+void test4(void) {
+
+    TestInstancePtr testInstance = initTestInstance("C Backend Test runtime errors");
+
+    char output[4096];
+    int status = runNative(divisionSource, "0\n", output, sizeof(output));
+    testCase(
+        testInstance,
+        status == 57 && sameResults(divisionSource, "0\n"),
+        "Dividing by zero",
+        "Exit code 57, as the interpreter (expected)",
+        "Wrong exit code (unexpected)"
+    );
+
+    testCase(
+        testInstance,
+        sameResults(divisionSource, "-3\n"),
+        "Dividing a negative number",
+        "Same output and exit code (expected)",
+        "Different results (unexpected)"
+    );
+
+    finishTestInstance(testInstance);
+}
+
+int main(void) {
+    test1();
+    test2();
+    test3();
+    test4();
+    return 0;
+}
@@ -0,0 +1,354 @@
+/** AUTHOR
+ *
+ * @author agent <agent@local>
+ * @file cache.c
+ * @date 19.10.2026
+ * @brief Test file for the on-disk compile cache
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <dirent.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "cache.h"
+#include "utility/enumerations.h"
+
+// Function to count the entries in the cache directory
+int countEntries(const char *path) {
+    DIR *dir = opendir(path);
+    if (!dir) return -1;
+    int count = 0;
+    struct dirent *entry;
+    while ((entry = readdir(dir)) != NULL) {
+        if (strstr(entry->d_name, COMPILE_CACHE_EXTENSION) != NULL) count++;
+    }
+    closedir(dir);
+    return count;
+}
+
+// Function to wait, so the entries get different modification times
+void waitTick(void) {
+    struct timespec tick = {0, 20000000};
+    nanosleep(&tick, NULL);
+}
+
+// Function to remove the cache directory with its entries
+void removeCache(const char *path) {
+    DIR *dir = opendir(path);
+    if (!dir) return;
+    struct dirent *entry;
+    while ((entry = readdir(dir)) != NULL) {
+        if (entry->d_name[0] == '.' && (entry->d_name[1] == '\0' || strcmp(entry->d_name, "..") == 0)) continue;
+        char file[512];
+        snprintf(file, sizeof(file), "%s/%s", path, entry->d_name);
+        unlink(file);
+    }
+    closedir(dir);
+    rmdir(path);
+}
+
+void test1(void) {
+
+    TestInstancePtr testInstance = initTestInstance("Cache Test keys");
+
+    const char *source = "const ifj = @import(\"ifj24.zig\");\n";
+    Ifj24Options options;
+    ifj24OptionsInit(&options);
+    char first[COMPILE_CACHE_KEY_LENGTH + 1], second[COMPILE_CACHE_KEY_LENGTH + 1];
+
+    // the keys are only computed, the directory is never created
+    CompileCache cache = {"/nonexistent", ifj24BuildId(), 0, 0, 0, 0, 0, 0};
+
+    compileCacheKey(&cache, source, strlen(source), &options, first);
+    options.jobs = 4;
+    options.pipeline = 1;
+    compileCacheKey(&cache, source, strlen(source), &options, second);
+    testCase(
+        testInstance,
+        strlen(first) == COMPILE_CACHE_KEY_LENGTH && strcmp(first, second) == 0,
+        "Hashing a source with options, that do not change the code",
+        "The same key (expected)",
+        "Different keys (unexpected)"
+    );
+
+    options.streaming = 1;
+    compileCacheKey(&cache, source, strlen(source), &options, second);
+    testCase(
+        testInstance,
+        strcmp(first, second) != 0,
+        "Hashing a source in the streaming mode",
+        "Different key (expected)",
+        "The same key (unexpected)"
+    );
+
+    options.streaming = 0;
+    compileCacheKey(&cache, source, strlen(source) - 1, &options, second);
+    testCase(
+        testInstance,
+        strcmp(first, second) != 0,
+        "Hashing a changed source",
+        "Different key (expected)",
+        "The same key (unexpected)"
+    );
+
+    // a build with another inlining budget generates other code
+    CompileCache other = cache;
+    other.build = "1.0.0 inline=0";
+    compileCacheKey(&other, source, strlen(source), &options, second);
+    testCase(
+        testInstance,
+        strcmp(first, second) != 0 && strstr(ifj24BuildId(), ifj24Version()) == ifj24BuildId() &&
+            strstr(ifj24BuildId(), " inline=") != NULL,
+        "Hashing a source for another build",
+        "Different key, the build has the version and the budget (expected)",
+        "The same key (unexpected)"
+    );
+
+    finishTestInstance(testInstance);
+}
+
+void test2(void) {
+
+    TestInstancePtr testInstance = initTestInstance("Cache Test storing and looking up");
+
+    char path[] = "/tmp/ifj24_cacheXXXXXX";
+    CompileCache cache;
+    bool opened = mkdtemp(path) != NULL && compileCacheInit(&cache, path, 0);
+    testCase(
+        testInstance,
+        opened,
+        "Opening a cache directory",
+        "Cache opened (expected)",
+        "Cache not opened (unexpected)"
+    );
+
+    size_t length = 0;
+    char *code = compileCacheLoad(&cache, "0123456789abcdef0123456789abcdef", &length);
+    testCase(
+        testInstance,
+        code == NULL && cache.misses == 1 && cache.hits == 0,
+        "Looking up a missing key",
+        "Miss counted (expected)",
+        "Found or not counted (unexpected)"
+    );
+
+    const char *stored = ".IFJcode24\nEXIT int@0\n";
+    bool success = compileCacheStore(&cache, "0123456789abcdef0123456789abcdef", stored, strlen(stored));
+    code = compileCacheLoad(&cache, "0123456789abcdef0123456789abcdef", &length);
+    testCase(
+        testInstance,
+        success && code && length == strlen(stored) && strcmp(code, stored) == 0 && cache.hits == 1 && cache.stores == 1,
+        "Looking up a stored key",
+        "The same code and a hit counted (expected)",
+        "Wrong code or counters (unexpected)"
+    );
+    free(code);
+
+    testCase(
+        testInstance,
+        countEntries(path) == 1,
+        "Counting the entries after a store",
+        "Only the entry, no temporary file left (expected)",
+        "Wrong count of files (unexpected)"
+    );
+
+    removeCache(path);
+    finishTestInstance(testInstance);
+}
+
+void test3(void) {
+
+    TestInstancePtr testInstance = initTestInstance("Cache Test eviction");
+
+    char path[] = "/tmp/ifj24_cacheXXXXXX";
+    CompileCache cache;
+    char code[1000];
+    memset(code, 'x', sizeof(code));
+
+    // room for two entries, the first one is used again, so the second one is the oldest
+    bool opened = mkdtemp(path) != NULL && compileCacheInit(&cache, path, 2500);
+    compileCacheStore(&cache, "00000000000000000000000000000001", code, sizeof(code));
+    waitTick();
+    compileCacheStore(&cache, "00000000000000000000000000000002", code, sizeof(code));
+    waitTick();
+    size_t length;
+    free(compileCacheLoad(&cache, "00000000000000000000000000000001", &length));
+    waitTick();
+    compileCacheStore(&cache, "00000000000000000000000000000003", code, sizeof(code));
+
+    char *first = compileCacheLoad(&cache, "00000000000000000000000000000001", &length);
+    char *second = compileCacheLoad(&cache, "00000000000000000000000000000002", &length);
+    char *third = compileCacheLoad(&cache, "00000000000000000000000000000003", &length);
+    testCase(
+        testInstance,
+        opened && first && !second && third && cache.evictions == 1 && countEntries(path) == 2,
+        "Storing over the size limit",
+        "The least recently used entry evicted (expected)",
+        "Wrong entry evicted (unexpected)"
+    );
+    free(first);
+    free(second);
+    free(third);
+
+    removeCache(path);
+    finishTestInstance(testInstance);
+}
+
+void test4(void) {
+
+    TestInstancePtr testInstance = initTestInstance("Cache Test incremental compilation");
+
+    const char *functions =
+        "pub fn twice(x: i32) i32 {\n"
+        "    var y: i32 = x;\n"
+        "    y = y * 2;\n"
+        "    return y;\n"
+        "}\n"
+        "pub fn main() void {\n"
+        "    const r = twice(21);\n"
+        "    ifj.write(r);\n"
+        "}\n";
+    char first[512], second[512];
+    snprintf(first, sizeof(first), "const ifj = @import(\"ifj24.zig\");\n%s", functions);
+
+    // the new function moves the ids of the variables of the cached ones
+    snprintf(second, sizeof(second),
+             "const ifj = @import(\"ifj24.zig\");\n"
+             "pub fn other(a: i32, b: i32) i32 {\n"
+             "    const c = a + b;\n"
+             "    return c;\n"
+             "}\n%s", functions);
+
+    char path[] = "/tmp/ifj24_cacheXXXXXX";
+    CompileCache cache;
+    bool opened = mkdtemp(path) != NULL && compileCacheInit(&cache, path, 0);
+
+    Ifj24Options options;
+    ifj24OptionsInit(&options);
+    options.streaming = 1;
+    Ifj24Result clean, incremental;
+    int cleanError = ifj24CompileWithOptions(second, strlen(second), &options, &clean);
+
+    options.streaming = 0;
+    options.functionCache = &cache;
+    ifj24CompileWithOptions(first, strlen(first), &options, &incremental);
+    ifj24ResultFree(&incremental);
+    size_t hits = cache.hits;
+    int incrementalError = ifj24CompileWithOptions(second, strlen(second), &options, &incremental);
+    testCase(
+        testInstance,
+        opened && cleanError == SUCCESS && incrementalError == SUCCESS && cache.hits == hits + 2 &&
+            clean.codeLength == incremental.codeLength && memcmp(clean.code, incremental.code, clean.codeLength) == 0,
+        "Compiling a source with a new function before the cached ones",
+        "The cached functions reused, the same code as a clean build (expected)",
+        "Not reused or different code (unexpected)"
+    );
+    ifj24ResultFree(&clean);
+    ifj24ResultFree(&incremental);
+
+    // a changed definition of the called function makes the caller compile again
+    char *changed = strstr(second, "pub fn twice(x: i32) i32");
+    memmove(changed + 22, changed + 21, strlen(changed + 21) + 1);
+    changed[21] = '?';
+    options.functionCache = NULL;
+    options.streaming = 1;
+    cleanError = ifj24CompileWithOptions(second, strlen(second), &options, &clean);
+    options.functionCache = &cache;
+    size_t misses = cache.misses;
+    incrementalError = ifj24CompileWithOptions(second, strlen(second), &options, &incremental);
+    testCase(
+        testInstance,
+        cleanError == SUCCESS && incrementalError == SUCCESS && cache.misses == misses + 2 &&
+            clean.codeLength == incremental.codeLength && memcmp(clean.code, incremental.code, clean.codeLength) == 0,
+        "Compiling a source, whose called function changed its definition",
+        "The function and its caller compiled again (expected)",
+        "Stale code reused (unexpected)"
+    );
+    ifj24ResultFree(&clean);
+    ifj24ResultFree(&incremental);
+
+    removeCache(path);
+    finishTestInstance(testInstance);
+}
+
+// identity of the build before the version 1.2.0, which defines the variables of the loops in another order
+#define PREVIOUS_BUILD "1.1.0 inline=8"
+
+void test5(void) {
+
+    TestInstancePtr testInstance = initTestInstance("Cache Test entries of a previous version");
+
+    const char *source =
+        "const ifj = @import(\"ifj24.zig\");\n"
+        "pub fn count(n: i32) i32 {\n"
+        "    var i: i32 = 0;\n"
+        "    while (i < n) {\n"
+        "        const next = i + 1;\n"
+        "        i = next;\n"
+        "    }\n"
+        "    return i;\n"
+        "}\n"
+        "pub fn main() void {\n"
+        "    const r = count(3);\n"
+        "    ifj.write(r);\n"
+        "}\n";
+
+    char path[] = "/tmp/ifj24_cacheXXXXXX";
+    CompileCache cache;
+    bool opened = mkdtemp(path) != NULL && compileCacheInit(&cache, path, 0);
+    Ifj24Options options;
+    ifj24OptionsInit(&options);
+    char key[COMPILE_CACHE_KEY_LENGTH + 1];
+    Ifj24Result result;
+
+    // the directory is filled by the previous version, the whole source and every function of it
+    cache.build = PREVIOUS_BUILD;
+    compileCacheKey(&cache, source, strlen(source), &options, key);
+    compileCacheStore(&cache, key, "stale code", 10);
+    options.functionCache = &cache;
+    ifj24CompileWithOptions(source, strlen(source), &options, &result);
+    ifj24ResultFree(&result);
+    options.functionCache = NULL;
+    cache.build = ifj24BuildId();
+
+    compileCacheKey(&cache, source, strlen(source), &options, key);
+    size_t hits = cache.hits;
+    char *code = compileCacheLoad(&cache, key, &result.codeLength);
+    testCase(
+        testInstance,
+        opened && strncmp(ifj24BuildId(), PREVIOUS_BUILD, strlen(IFJ24_VERSION)) != 0 && code == NULL && cache.hits == hits,
+        "Looking up a source cached by the previous version (--cache)",
+        "Missed (expected)",
+        "The code of the previous version returned (unexpected)"
+    );
+    free(code);
+
+    options.functionCache = &cache;
+    size_t misses = cache.misses;
+    int error = ifj24CompileWithOptions(source, strlen(source), &options, &result);
+    testCase(
+        testInstance,
+        error == SUCCESS && cache.hits == hits && cache.misses == misses + 2,
+        "Compiling the functions cached by the previous version (--incremental)",
+        "Both functions missed and compiled again (expected)",
+        "The code of the previous version reused (unexpected)"
+    );
+    ifj24ResultFree(&result);
+
+    removeCache(path);
+    finishTestInstance(testInstance);
+}
+
+
+int main(void) {
+    test1();
+    test2();
+    test3();
+    test4();
+    test5();
+    return 0;
+}
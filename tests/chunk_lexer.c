@@ -0,0 +1,194 @@
+/** AUTHOR
+ *
+ * @author agent <agent@local>
+ * @file chunk_lexer.c
+ * @date 19.10.2026
+ * @brief Test file for the lexing in chunks, the tokens have to be the same as from a single scanner
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "utility/enumerations.h"
+#include "utility/linked_list.h"
+#include "lexical/scanner.h"
+#include "lexical/chunk_lexer.h"
+#include "syntaxical/parser.h"
+
+// multiline strings with blank lines, comments and text looking like comments, that a boundary must not split
+const char *TRICKY_SOURCE =
+    "const ifj = @import(\"ifj24.zig\");\n"
+    "// a comment \\\\ with a backslash\n"
+    "pub fn main() void {\n"
+    "    const s = \\\\first line // not a comment\n"
+    "        \\\\second line\n"
+    "\n"
+    "    \\\\after a blank line\n"
+    "    ;\n"
+    "    ifj.write(s); // \"not a string\n"
+    "    ifj.write(\\\\inside a call\n"
+    "    \\\\more\n"
+    "    );\n"
+    "    var x: i32 = 42;\n"
+    "    x = x + 1;\n"
+    "}\n";
+
+// Function to free the token buffer with the values of the tokens, the same as the symbol table does
+void removeTokens(LinkedList **tokens) {
+    for (unsigned int i = 0; i < getSize(*tokens); i++) free(((TOKEN_PTR)getDataAtIndex(*tokens, i))->value);
+    removeList(tokens);
+}
+
+// Function to lex the whole source by a single scanner, the same as the first pass
+enum ERR_CODES lexSequential(const char *source, size_t length, LinkedList *buffer, size_t *errorPosition) {
+    CompilerContext ctx;
+    compilerContextInit(&ctx, NULL, NULL);
+    scanner_init_buffer(source, length, &ctx);
+
+    struct TOKEN token;
+    enum ERR_CODES status = SUCCESS;
+    while (status == SUCCESS) {
+        status = scanner_get_token(&token, &ctx);
+        if (!saveNewToken(token, buffer)) return E_INTERNAL;
+        if (token.type == TOKEN_EOF) break;
+    }
+    *errorPosition = ctx.sourcePosition;
+    return status;
+}
+
+// Function to compare two token buffers, the token, that caused an error, has no defined value
+bool sameTokens(LinkedList *first, LinkedList *second, bool error) {
+    if (getSize(first) != getSize(second)) return false;
+    for (unsigned int i = 0; i + (error ? 1 : 0) < getSize(first); i++) {
+        TOKEN_PTR a = (TOKEN_PTR)getDataAtIndex(first, i);
+        TOKEN_PTR b = (TOKEN_PTR)getDataAtIndex(second, i);
+        if (a->type != b->type || strcmp(a->value, b->value) != 0) return false;
+    }
+    return true;
+}
+
+// Function to check, that every chunk size gives the same tokens and error as a single scanner
+bool sameForAllChunkSizes(const char *source, size_t length) {
+    LinkedList *expected = initLinkedList(true);
+    size_t expectedPosition, errorPosition = 0;
+    enum ERR_CODES expectedStatus = lexSequential(source, length, expected, &expectedPosition);
+
+    bool same = true;
+    for (size_t chunkSize = 1; chunkSize <= length + 1 && same; chunkSize++) {
+        LinkedList *tokens = initLinkedList(true);
+        enum ERR_CODES status = chunk_lexer_tokenize(source, length, 4, chunkSize, tokens, &errorPosition);
+        same = status == expectedStatus && sameTokens(expected, tokens, status != SUCCESS);
+        if (status != SUCCESS && errorPosition != expectedPosition) same = false;
+        removeTokens(&tokens);
+    }
+
+    removeTokens(&expected);
+    return same;
+}
+
+// Function to read a whole file
+char *readWholeFile(const char *path, size_t *length) {
+    FILE *file = fopen(path, "rb");
+    if (!file) return NULL;
+    char *source = NULL;
+    size_t capacity = 0;
+    *length = 0;
+    int c;
+    while ((c = fgetc(file)) != EOF) {
+        if (*length == capacity) {
+            capacity = capacity ? capacity * 2 : 4096;
+            source = (char *)realloc(source, capacity);
+        }
+        source[(*length)++] = (char)c;
+    }
+    fclose(file);
+    return source;
+}
+
+void test1(void) {
+
+    TestInstancePtr testInstance = initTestInstance("Chunk Lexer Test boundaries");
+
+    const char *source = "a\n\\\\b\n  \\\\c\n;\nd\n\n)\ne\n";
+    size_t length = strlen(source);
+
+    testCase(
+        testInstance,
+        chunk_lexer_next_boundary(source, length, 0) == 2 + 4 + 6 + 2,
+        "Skipping the lines of a multiline string",
+        "The chunk starts after the string ends (expected)",
+        "The chunk starts inside of the string (unexpected)"
+    );
+
+    testCase(
+        testInstance,
+        chunk_lexer_next_boundary(source, length, 15) == length - 2,
+        "Skipping an empty line and a line starting with )",
+        "The chunk starts at the line of e (expected)",
+        "The chunk starts at a line, that can continue a string (unexpected)"
+    );
+
+    testCase(
+        testInstance,
+        chunk_lexer_next_boundary(source, length, length - 1) == length,
+        "No boundary at the end",
+        "The chunk ends at the end of the source (expected)",
+        "Found a boundary after the end (unexpected)"
+    );
+
+    finishTestInstance(testInstance);
+}
+
+void test2(void) {
+
+    TestInstancePtr testInstance = initTestInstance("Chunk Lexer Test the same tokens");
+
+    testCase(
+        testInstance,
+        sameForAllChunkSizes(TRICKY_SOURCE, strlen(TRICKY_SOURCE)),
+        "Lexing multiline strings and comments in chunks of every size",
+        "The same tokens as from a single scanner (expected)",
+        "The tokens differ (unexpected)"
+    );
+
+    size_t length = 0;
+    char *source = readWholeFile("./test_inputs/lexical/input.txt", &length);
+    testCase(
+        testInstance,
+        source && sameForAllChunkSizes(source, length),
+        "Lexing the lexical test input in chunks of every size",
+        "The same tokens as from a single scanner (expected)",
+        "The tokens differ (unexpected)"
+    );
+    free(source);
+
+    const char *broken = "var a = 1;\nvar c = \\\\3;\nvar d = 4;\nvar b = \"unterminated\n";
+    testCase(
+        testInstance,
+        sameForAllChunkSizes(broken, strlen(broken)),
+        "Lexing a source with a lexical error in chunks",
+        "The same error as from a single scanner (expected)",
+        "The error differs (unexpected)"
+    );
+
+    LinkedList *tokens = initLinkedList(true);
+    enum ERR_CODES status = chunk_lexer_tokenize("", 0, 4, 16, tokens, NULL);
+    TOKEN_PTR last = (TOKEN_PTR)getDataAtIndex(tokens, 0);
+    testCase(
+        testInstance,
+        status == SUCCESS && getSize(tokens) == 1 && last->type == TOKEN_EOF,
+        "Lexing an empty source",
+        "Only the EOF token (expected)",
+        "Wrong tokens (unexpected)"
+    );
+    removeTokens(&tokens);
+
+    finishTestInstance(testInstance);
+}
+
+
+int main(void) {
+    test1();
+    test2();
+    return 0;
+}
@@ -0,0 +1,325 @@
+/** AUTHOR
+ *
+ * @author agent <agent@local>
+ * @file ifj24.c
+ * @date 19.10.2026
+ * @brief Test file for the in-memory compile API of the library
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "ifj24.h"
+#include "utility/enumerations.h"
+
+char *validSource =
+    "const ifj = @import(\"ifj24.zig\");\n"
+    "pub fn main() void {\n"
+    "    const a: i32 = 40 + 2;\n"
+    "    ifj.write(a);\n"
+    "}\n";
+
+char *lexicalErrorSource =
+    "const ifj = @import(\"ifj24.zig\");\n"
+    "pub fn main() void {\n"
+    "    const a: i32 = 40 $ 2;\n"
+    "}\n";
+
+char *semanticErrorSource =
+    "const ifj = @import(\"ifj24.zig\");\n"
+    "pub fn main() void {\n"
+    "    ifj.write(b);\n"
+    "}\n";
+
+void test1(void) {
+
+    TestInstancePtr testInstance = initTestInstance("Library Test compiling a valid source in memory");
+
+    Ifj24Result result;
+    int error = ifj24Compile(validSource, strlen(validSource), &result);
+    testCase(
+        testInstance,
+        error == SUCCESS && result.error == SUCCESS && result.diagnostic[0] == '\0',
+        "Compiling a valid program",
+        "Program compiled without error (expected)",
+        "Program did not compile (unexpected)"
+    );
+
+    testCase(
+        testInstance,
+        result.code != NULL && strlen(result.code) == result.codeLength && strncmp(result.code, ".IFJcode24\n", 11) == 0,
+        "Checking the generated code",
+        "Code is null terminated and starts with the header (expected)",
+        "Code is missing or malformed (unexpected)"
+    );
+
+    // a second compilation of the same source gives the same code
+    Ifj24Result second;
+    ifj24Compile(validSource, strlen(validSource), &second);
+    testCase(
+        testInstance,
+        second.codeLength == result.codeLength && memcmp(second.code, result.code, result.codeLength) == 0,
+        "Compiling the source again",
+        "Same code generated (expected)",
+        "Different code generated (unexpected)"
+    );
+
+    ifj24ResultFree(&second);
+    ifj24ResultFree(&result);
+    testCase(
+        testInstance,
+        result.code == NULL && result.codeLength == 0,
+        "Freeing the result",
+        "Code freed and reset (expected)",
+        "Code not reset (unexpected)"
+    );
+
+    finishTestInstance(testInstance);
+}
+
+void test2(void) {
+
+    TestInstancePtr testInstance = initTestInstance("Library Test reporting errors");
+
+    Ifj24Result result;
+    int error = ifj24Compile(lexicalErrorSource, strlen(lexicalErrorSource), &result);
+    testCase(
+        testInstance,
+        error == E_LEXICAL && result.code == NULL && strstr(result.diagnostic, "line 3") != NULL,
+        "Compiling a source with a lexical error",
+        "Lexical error reported at line 3 (expected)",
+        "Wrong error or diagnostic (unexpected)"
+    );
+    ifj24ResultFree(&result);
+
+    error = ifj24Compile(semanticErrorSource, strlen(semanticErrorSource), &result);
+    testCase(
+        testInstance,
+        error == E_SEMANTIC_UND_FUNC_OR_VAR && result.code == NULL && strcmp(result.diagnostic, ifj24ErrorName(error)) == 0,
+        "Compiling a source with an undefined variable",
+        "Semantic error reported (expected)",
+        "Wrong error or diagnostic (unexpected)"
+    );
+    ifj24ResultFree(&result);
+
+    // the source does not have to be null terminated, the rest of the buffer is ignored
+    error = ifj24Compile(validSource, 10, &result);
+    testCase(
+        testInstance,
+        error == E_SYNTAX && result.diagnostic[0] != '\0',
+        "Compiling only a prefix of the source",
+        "Syntax error reported (expected)",
+        "Prefix was not rejected (unexpected)"
+    );
+    ifj24ResultFree(&result);
+
+    finishTestInstance(testInstance);
+}
+
+// Function to make a source with many functions, one of them can have a syntax error
+char *manyFunctionsSource(int functions, int broken) {
+    char *source = (char *)malloc(functions * 160 + 128);
+    if (!source) return NULL;
+
+    strcpy(source, "const ifj = @import(\"ifj24.zig\");\n");
+    for (int i = 0; i < functions; i++) {
+        char function[160];
+        snprintf(function, sizeof(function),
+                 "pub fn f_%d(a: i32) i32 {\n    var x: i32 = a + %d;\n    if (x > 3) { x = x - 1; } else { x = %s; }\n    return x;\n}\n",
+                 i, i, (i == broken) ? "* 2" : "x + 1");
+        strcat(source, function);
+    }
+    strcat(source, "pub fn main() void {\n    const r = f_0(1);\n    ifj.write(r);\n}\n");
+    return source;
+}
+
+void test3(void) {
+
+    TestInstancePtr testInstance = initTestInstance("Library Test compiling on more threads");
+
+    Ifj24Options options;
+    ifj24OptionsInit(&options);
+    Ifj24Result serial, parallel;
+
+    char *source = manyFunctionsSource(24, -1);
+    options.jobs = 1;
+    int serialError = ifj24CompileWithOptions(source, strlen(source), &options, &serial);
+    options.jobs = 4;
+    int parallelError = ifj24CompileWithOptions(source, strlen(source), &options, &parallel);
+    testCase(
+        testInstance,
+        serialError == SUCCESS && parallelError == SUCCESS && serial.codeLength == parallel.codeLength &&
+            memcmp(serial.code, parallel.code, serial.codeLength) == 0,
+        "Compiling many functions on 1 and 4 threads",
+        "The same code (expected)",
+        "The code differs (unexpected)"
+    );
+    ifj24ResultFree(&serial);
+    ifj24ResultFree(&parallel);
+    free(source);
+
+    source = manyFunctionsSource(24, 17);
+    options.jobs = 1;
+    serialError = ifj24CompileWithOptions(source, strlen(source), &options, &serial);
+    options.jobs = 4;
+    parallelError = ifj24CompileWithOptions(source, strlen(source), &options, &parallel);
+    testCase(
+        testInstance,
+        serialError == E_SYNTAX && parallelError == E_SYNTAX && strcmp(serial.diagnostic, parallel.diagnostic) == 0,
+        "Compiling many functions with a syntax error on 1 and 4 threads",
+        "The same error and diagnostic (expected)",
+        "The error differs (unexpected)"
+    );
+    ifj24ResultFree(&serial);
+    ifj24ResultFree(&parallel);
+    free(source);
+
+    finishTestInstance(testInstance);
+}
+
+void test4(void) {
+
+    TestInstancePtr testInstance = initTestInstance("Library Test the pipelined front end");
+
+    Ifj24Options options;
+    ifj24OptionsInit(&options);
+    Ifj24Result serial, pipelined;
+
+    char *source = manyFunctionsSource(24, -1);
+    int serialError = ifj24CompileWithOptions(source, strlen(source), &options, &serial);
+    options.pipeline = 1;
+    int pipelinedError = ifj24CompileWithOptions(source, strlen(source), &options, &pipelined);
+    testCase(
+        testInstance,
+        serialError == SUCCESS && pipelinedError == SUCCESS && serial.codeLength == pipelined.codeLength &&
+            memcmp(serial.code, pipelined.code, serial.codeLength) == 0,
+        "Compiling many functions with and without the pipeline",
+        "The same code (expected)",
+        "The code differs (unexpected)"
+    );
+    ifj24ResultFree(&serial);
+    ifj24ResultFree(&pipelined);
+    free(source);
+
+    // the lexical error is after the syntax error, but it wins, the same as without the pipeline
+    source = manyFunctionsSource(24, 3);
+    source[strlen(source) - 3] = '$';
+    int error = ifj24CompileWithOptions(source, strlen(source), &options, &pipelined);
+    testCase(
+        testInstance,
+        error == E_LEXICAL && strstr(pipelined.diagnostic, "lexical") != NULL,
+        "Compiling a syntax error followed by a lexical error on the pipeline",
+        "Lexical error reported (expected)",
+        "Wrong error (unexpected)"
+    );
+    ifj24ResultFree(&pipelined);
+    free(source);
+
+    error = ifj24CompileWithOptions(semanticErrorSource, strlen(semanticErrorSource), &options, &pipelined);
+    testCase(
+        testInstance,
+        error == E_SEMANTIC_UND_FUNC_OR_VAR,
+        "Compiling a semantic error on the pipeline",
+        "Semantic error reported (expected)",
+        "Wrong error (unexpected)"
+    );
+    ifj24ResultFree(&pipelined);
+
+    finishTestInstance(testInstance);
+}
+void test5(void) {
+
+    TestInstancePtr testInstance = initTestInstance("Library Test the streaming mode");
+
+    Ifj24Options options;
+    ifj24OptionsInit(&options);
+    options.streaming = 1;
+    Ifj24Result streamed, whole;
+
+    char *source = manyFunctionsSource(24, -1);
+    int error = ifj24CompileWithOptions(source, strlen(source), &options, &streamed);
+    testCase(
+        testInstance,
+        error == SUCCESS && strstr(streamed.code, "LABEL function_f_23\n") != NULL && strstr(streamed.code, "LABEL function_main\n") != NULL,
+        "Compiling many functions a function at a time",
+        "Code of every function generated (expected)",
+        "Compilation failed or a function is missing (unexpected)"
+    );
+    ifj24ResultFree(&streamed);
+    free(source);
+
+    // main calls a function, that was not read yet, the pre-scan knows its definition
+    const char *forward =
+        "const ifj = @import(\"ifj24.zig\");\n"
+        "pub fn main() void {\n"
+        "    const r = twice(21);\n"
+        "    ifj.write(r);\n"
+        "}\n"
+        "pub fn twice(x: i32) i32 {\n"
+        "    return x * 2;\n"
+        "}\n";
+    error = ifj24CompileWithOptions(forward, strlen(forward), &options, &streamed);
+    testCase(
+        testInstance,
+        error == SUCCESS && strstr(streamed.code, "CALL function_twice\n") != NULL,
+        "Compiling a call of a function defined later",
+        "Function called, not inlined (expected)",
+        "Compilation failed or the call is missing (unexpected)"
+    );
+    ifj24ResultFree(&streamed);
+
+    // the streaming pass reports the error itself, with the function and the line it is in
+    source = manyFunctionsSource(24, 17);
+    error = ifj24CompileWithOptions(source, strlen(source), &options, &streamed);
+    options.streaming = 0;
+    int wholeError = ifj24CompileWithOptions(source, strlen(source), &options, &whole);
+    testCase(
+        testInstance,
+        error == E_SYNTAX && wholeError == E_SYNTAX && strstr(streamed.diagnostic, "in function 'f_17' at line 87") != NULL,
+        "Compiling a syntax error a function at a time",
+        "The same error, the function and the line reported (expected)",
+        "Different error or diagnostic (unexpected)"
+    );
+    ifj24ResultFree(&streamed);
+    ifj24ResultFree(&whole);
+
+    // the lexical errors are found by the pre-scan at the same character
+    source[strlen(source) - 40] = '#';
+    options.streaming = 1;
+    error = ifj24CompileWithOptions(source, strlen(source), &options, &streamed);
+    options.streaming = 0;
+    wholeError = ifj24CompileWithOptions(source, strlen(source), &options, &whole);
+    testCase(
+        testInstance,
+        error == E_LEXICAL && wholeError == E_LEXICAL && strcmp(streamed.diagnostic, whole.diagnostic) == 0,
+        "Compiling a lexical error a function at a time",
+        "The same error and diagnostic (expected)",
+        "Different error (unexpected)"
+    );
+    ifj24ResultFree(&streamed);
+    ifj24ResultFree(&whole);
+    free(source);
+
+    options.streaming = 1;
+    error = ifj24CompileWithOptions(semanticErrorSource, strlen(semanticErrorSource), &options, &streamed);
+    testCase(
+        testInstance,
+        error == E_SEMANTIC_UND_FUNC_OR_VAR,
+        "Compiling a semantic error a function at a time",
+        "Semantic error reported (expected)",
+        "Wrong error (unexpected)"
+    );
+    ifj24ResultFree(&streamed);
+
+    finishTestInstance(testInstance);
+}
+
+
+int main(void) {
+    test1();
+    test2();
+    test3();
+    test4();
+    test5();
+    return 0;
+}
@@ -0,0 +1,284 @@
+/** AUTHOR
+ *
+ * @author agent <agent@local>
+ * @file interpreter.c
+ * @date 19.10.2026
+ * @brief Test file for the loader and the reference interpreter of IFJcode24
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "ifj24.h"
+#include "interpreter/ifjcode.h"
+#include "interpreter/interpreter.h"
+#include "utility/enumerations.h"
+
+// Function to load and run a code, the output is stored into a static string
+int runCode(const char *text, const char *input, InterpreterCounts *counts, char **output) {
+    static char written[4096];
+    written[0] = '\0';
+    *output = written;
+
+    IfjCode code;
+    char diagnostic[IFJCODE_DIAGNOSTIC_LENGTH];
+    int status = ifjCodeLoad(text, strlen(text), &code, diagnostic);
+    if (status != IFJCODE_SUCCESS) {
+        ifjCodeFree(&code);
+        return status;
+    }
+
+    FILE *in = tmpfile();
+    FILE *out = tmpfile();
+    if (!in || !out || (counts && !interpreterCountsInit(counts, &code))) {
+        if (in) fclose(in);
+        if (out) fclose(out);
+        ifjCodeFree(&code);
+        return IFJCODE_E_INTERNAL;
+    }
+    fputs(input, in);
+    rewind(in);
+
+    Interpreter interpreter;
+    interpreterInit(&interpreter, &code, in, out, counts);
+    status = interpreterRun(&interpreter);
+    interpreterFree(&interpreter);
+
+    rewind(out);
+    size_t length = fread(written, 1, sizeof(written) - 1, out);
+    written[length] = '\0';
+    fclose(in);
+    fclose(out);
+
+    // the counts need the names of the labels, they are checked here
+    if (counts) {
+        FILE *printed = tmpfile();
+        if (printed) {
+            interpreterCountsPrint(counts, &code, printed, true);
+            rewind(printed);
+            length = fread(written, 1, sizeof(written) - 1, printed);
+            written[length] = '\0';
+            fclose(printed);
+        }
+        interpreterCountsFree(counts);
+    }
+    ifjCodeFree(&code);
+    return status;
+}
+
+void test1(void) {
+
+    TestInstancePtr testInstance = initTestInstance("Interpreter Test loading");
+
+    IfjCode code;
+    char diagnostic[IFJCODE_DIAGNOSTIC_LENGTH];
+    const char *text =
+        ".ifjcode24 # the header is not case sensitive\n"
+        "DEFVAR GF@x\n"
+        "jump skip\n"
+        "MOVE GF@x string@a\\032b\\035c\n"
+        "LABEL skip\n"
+        "EXIT int@0\n";
+    int status = ifjCodeLoad(text, strlen(text), &code, diagnostic);
+    testCase(
+        testInstance,
+        status == IFJCODE_SUCCESS && code.size == 5 && code.labelCount == 1 && code.symbolCount == 1 &&
+            code.instructions[1].opcode == OP_JUMP && code.instructions[1].operands[0].target == 4 &&
+            strcmp(code.instructions[2].operands[1].value.data.string->data, "a b#c") == 0 &&
+            code.instructions[4].label == 0 && code.instructions[0].label == IFJCODE_NO_LABEL,
+        "Loading a code with a comment, a forward jump and escapes",
+        "The jump resolved after its label and the escapes decoded (expected)",
+        "Wrong code (unexpected)"
+    );
+    ifjCodeFree(&code);
+
+    const char *wrong[] = {
+        "DEFVAR GF@x\n",
+        ".IFJcode24\nJUMP nowhere\n",
+        ".IFJcode24\nLABEL a\nLABEL a\n",
+        ".IFJcode24\nMOVE GF@x int@1 int@2\n",
+        ".IFJcode24\nPUSHS string@\\12\n",
+        ".IFJcode24\nADD XF@x int@1 int@2\n",
+    };
+    const int expected[] = {IFJCODE_E_SYNTAX, IFJCODE_E_SEMANTIC, IFJCODE_E_SEMANTIC, IFJCODE_E_SYNTAX, IFJCODE_E_SYNTAX, IFJCODE_E_SYNTAX};
+    bool rejected = true;
+    for (size_t i = 0; i < sizeof(expected) / sizeof(expected[0]); i++) {
+        rejected = rejected && ifjCodeLoad(wrong[i], strlen(wrong[i]), &code, diagnostic) == expected[i] && diagnostic[0];
+        ifjCodeFree(&code);
+    }
+    testCase(
+        testInstance,
+        rejected,
+        "Loading wrong codes",
+        "Missing header, undefined and redefined label, extra operand, escape and frame rejected (expected)",
+        "A wrong code loaded (unexpected)"
+    );
+
+    finishTestInstance(testInstance);
+}
+
+void test2(void) {
+
+    TestInstancePtr testInstance = initTestInstance("Interpreter Test running");
+
+    char *output;
+    int status = runCode(
+        ".IFJcode24\n"
+        "DEFVAR GF@a\n"
+        "CREATEFRAME\n"
+        "DEFVAR TF@b\n"
+        "MOVE TF@b int@7\n"
+        "PUSHFRAME\n"
+        "IDIV GF@a LF@b int@2\n"
+        "WRITE GF@a\n"
+        "PUSHS float@0x1.5p5\n"
+        "PUSHS float@2.0\n"
+        "DIVS\n"
+        "POPS GF@a\n"
+        "WRITE GF@a\n"
+        "CONCAT GF@a string@ab string@cd\n"
+        "SETCHAR GF@a int@1 string@X\n"
+        "WRITE GF@a\n"
+        "TYPE GF@a LF@b\n"
+        "WRITE GF@a\n"
+        "READ GF@a int\n"
+        "WRITE GF@a\n"
+        "READ GF@a int\n"
+        "TYPE GF@a GF@a\n"
+        "WRITE GF@a\n"
+        "POPFRAME\n"
+        "EXIT int@3\n",
+        "41\nnot a number\n", NULL, &output);
+    testCase(
+        testInstance,
+        status == 3 && strcmp(output, "30x1.5p4aXcdint41nil") == 0,
+        "Running the frames, the arithmetic, the strings and READ",
+        "The values written and the exit code returned (expected)",
+        "Wrong output or exit code (unexpected)"
+    );
+
+    const char *wrong[] = {
+        ".IFJcode24\nADD GF@x int@1 int@2\n",
+        ".IFJcode24\nDEFVAR GF@x\nADD GF@x int@1 float@1.0\n",
+        ".IFJcode24\nDEFVAR TF@x\n",
+        ".IFJcode24\nDEFVAR GF@x\nWRITE GF@x\n",
+        ".IFJcode24\nDEFVAR GF@x\nIDIV GF@x int@1 int@0\n",
+        ".IFJcode24\nDEFVAR GF@x\nGETCHAR GF@x string@ab int@2\n",
+        ".IFJcode24\nPOPS GF@_\n",
+        ".IFJcode24\nEXIT int@10\n",
+    };
+    const int expected[] = {IFJCODE_E_UNDEFINED_VAR, IFJCODE_E_OPERAND_TYPE, IFJCODE_E_FRAME, IFJCODE_E_MISSING_VALUE,
+                            IFJCODE_E_OPERAND_VALUE, IFJCODE_E_STRING, IFJCODE_E_MISSING_VALUE, IFJCODE_E_OPERAND_VALUE};
+    bool failed = true;
+    for (size_t i = 0; i < sizeof(expected) / sizeof(expected[0]); i++) {
+        failed = failed && runCode(wrong[i], "", NULL, &output) == expected[i];
+    }
+    testCase(
+        testInstance,
+        failed,
+        "Running wrong codes",
+        "Every runtime error with its exit code (expected)",
+        "Wrong exit code (unexpected)"
+    );
+
+    finishTestInstance(testInstance);
+}
+
+void test3(void) {
+
+    TestInstancePtr testInstance = initTestInstance("Interpreter Test counts");
+
+    InterpreterCounts counts;
+    char *output;
+    int status = runCode(
+        ".IFJcode24\n"
+        "DEFVAR GF@i\n"
+        "MOVE GF@i int@0\n"
+        "CALL twice\n"
+        "CALL twice\n"
+        "EXIT int@0\n"
+        "LABEL twice\n"
+        "ADD GF@i GF@i int@1\n"
+        "LABEL twice_end\n"
+        "RETURN\n",
+        "", &counts, &output);
+    testCase(
+        testInstance,
+        status == 0 && strstr(output, "\"executed\": 9") && strstr(output, "{\"name\": \"CALL\", \"instructions\": 2}") &&
+            strstr(output, "{\"name\": \"twice\", \"instructions\": 4, \"calls\": 2}") &&
+            strstr(output, "{\"name\": \"(top)\", \"instructions\": 5, \"calls\": 0}") &&
+            strstr(output, "{\"name\": \"twice_end\", \"instructions\": 2}") && !strstr(output, "LABEL"),
+        "Counting a code with two calls",
+        "The instructions counted per opcode, function and label, without the labels (expected)",
+        "Wrong counts (unexpected)"
+    );
+
+    finishTestInstance(testInstance);
+}
+
+void test4(void) {
+
+    TestInstancePtr testInstance = initTestInstance("Interpreter Test generated code");
+
+    const char *source =
+        "const ifj = @import(\"ifj24.zig\");\n"
+        "pub fn factorial(n: i32) i32 {\n"
+        "    if (n < 2) {\n"
+        "        return 1;\n"
+        "    } else {\n"
+        "        const m = n - 1;\n"
+        "        const r = factorial(m);\n"
+        "        return n * r;\n"
+        "    }\n"
+        "}\n"
+        "pub fn main() void {\n"
+        "    const a = ifj.readi32();\n"
+        "    if (a) |n| {\n"
+        "        const r = factorial(n);\n"
+        "        ifj.write(r);\n"
+        "        const t = ifj.string(\"factorial\");\n"
+        "        const s = ifj.substring(t, 0, 4);\n"
+        "        ifj.write(s);\n"
+        "        const u = ifj.string(\"g\");\n"
+        "        const c = ifj.strcmp(t, u);\n"
+        "        ifj.write(c);\n"
+        "        const f = ifj.i2f(n);\n"
+        "        ifj.write(f);\n"
+        "    } else {\n"
+        "        ifj.write(\"null\");\n"
+        "    }\n"
+        "}\n";
+    Ifj24Result result;
+    int compiled = ifj24Compile(source, strlen(source), &result);
+
+    char *output;
+    int status = compiled == 0 ? runCode(result.code, "10\n", NULL, &output) : -1;
+    testCase(
+        testInstance,
+        status == 0 && strcmp(output, "3628800fact-10x1.4p3") == 0,
+        "Running the generated code of a recursive factorial and the builtins",
+        "The factorial, the substring, the comparison and the float written (expected)",
+        "Wrong output or exit code (unexpected)"
+    );
+
+    status = compiled == 0 ? runCode(result.code, "", NULL, &output) : -1;
+    testCase(
+        testInstance,
+        status == 0 && strcmp(output, "null") == 0,
+        "Running the generated code without an input",
+        "READ returned nil (expected)",
+        "Wrong output or exit code (unexpected)"
+    );
+    ifj24ResultFree(&result);
+
+    finishTestInstance(testInstance);
+}
+
+
+int main(void) {
+    test1();
+    test2();
+    test3();
+    test4();
+    return 0;
+}
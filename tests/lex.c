@@ -40,7 +40,9 @@ void compare_tokens(FILE *expected_file)
 
     // Initialize scanner
     FILE *input = fopen("./test_inputs/lexical/input.txt", "r");
-    scanner_init(input);
+    CompilerContext ctx;
+    compilerContextInit(&ctx, NULL, NULL);
+    scanner_init(input, &ctx);
 
     // Initialize test instance
     testInstance = initTestInstance("Lexical Analyzer Token Comparison Test");
@@ -49,7 +51,7 @@ void compare_tokens(FILE *expected_file)
     char *expectedLine = read_line(expected_file);
 
     // First token from lexical analyzer
-    status = scanner_get_token(&token);
+    status = scanner_get_token(&token, &ctx);
 
     // Loop through tokens from both lexical analyzer and expected file
     while (expectedLine != NULL)
@@ -88,9 +90,12 @@ void compare_tokens(FILE *expected_file)
         );
 
         // Get the next token from lexical analyzer and file
-        status = scanner_get_token(&token);
+        free(token.value);
+        status = scanner_get_token(&token, &ctx);
         expectedLine = read_line(expected_file);
     }
+    free(token.value);
+    fclose(input);
 
     // Finish test instance
     finishTestInstance(testInstance);
@@ -252,9 +252,111 @@ void test_2(void) {
     finishTestInstance(testInstance);
 }
 
+void test_3(void) {
+
+    TestInstancePtr testInstance = initTestInstance("Linked List Test with peeking");
+
+    struct LinkedList *list = initLinkedList(false);
+    int values[7] = {0, 1, 2, 3, 4, 5, 6};
+    for (int i = 0; i < 7; i++) insertNodeAtIndex(list, (void *)&values[i], -1);
+
+    // move the active element somewhere, peeking must not change it
+    getDataAtIndex(list, 2);
+    bool correct = true;
+    for (int i = 0; i < 7; i++) {
+        int *data = (int *)peekDataAtIndex(list, i);
+        if (!data || *data != i) correct = false;
+    }
+    testCase(
+        testInstance,
+        correct && list->lastAccessedIndex == 2,
+        "Peeking every index",
+        "Correct data, active element not moved (expected)",
+        "Wrong data or active element moved (unexpected)"
+    );
+
+    int *last = (int *)peekDataAtIndex(list, -1);
+    testCase(
+        testInstance,
+        last && *last == 6 && peekDataAtIndex(list, 7) == NULL && peekDataAtIndex(NULL, 0) == NULL,
+        "Peeking negative and invalid indexes",
+        "Last element found, out of bounds gives NULL (expected)",
+        "Wrong result for the index (unexpected)"
+    );
+
+    removeList(&list);
+    finishTestInstance(testInstance);
+}
+
+// lookups done by a single run of the lookup benchmark, every one walks the list
+#define LIST_BENCH_LOOKUPS 1000
+
+// Struct for the state of the list benchmarks
+typedef struct ListBench {
+    struct LinkedList *list; // the measured list
+    unsigned int size; // elements of the list
+    size_t sum; // sum of the read elements, so the reads are not left out
+} ListBench;
+
+// Function to create an empty list for the benchmark
+void listBenchCreate(void *data) {
+    ListBench *bench = (ListBench *)data;
+    bench->list = initLinkedList(false);
+}
+
+// Function to create a full list for the benchmark, the elements are the indexes
+void listBenchFill(void *data) {
+    ListBench *bench = (ListBench *)data;
+    listBenchCreate(data);
+    for (unsigned int i = 0; i < bench->size; i++) insertNodeAtIndex(bench->list, (void *)(size_t)i, -1);
+}
+
+// Function to free the list of the benchmark
+void listBenchFree(void *data) {
+    ListBench *bench = (ListBench *)data;
+    if (bench->list) removeList(&bench->list);
+}
+
+// Function to append all the elements
+void listBenchInsert(void *data) {
+    ListBench *bench = (ListBench *)data;
+    for (unsigned int i = 0; i < bench->size; i++) insertNodeAtIndex(bench->list, (void *)(size_t)i, -1);
+}
+
+// Function to read all the elements by their index, the same order as the compiler reads the tokens
+void listBenchIndex(void *data) {
+    ListBench *bench = (ListBench *)data;
+    for (unsigned int i = 0; i < bench->size; i++) bench->sum += (size_t)getDataAtIndex(bench->list, (int)i);
+}
+
+// Function to look up elements spread over the list, without the active element
+void listBenchLookup(void *data) {
+    ListBench *bench = (ListBench *)data;
+    for (unsigned int i = 0; i < LIST_BENCH_LOOKUPS; i++) {
+        bench->sum += (size_t)peekDataAtIndex(bench->list, (int)((size_t)i * 7919 % bench->size));
+    }
+}
+
+void bench_1(void) {
+
+    TestInstancePtr testInstance = initTestInstance("Linked List Benchmarks");
+
+    ListBench bench = {NULL, 0, 0};
+    benchSweep(testInstance, (BenchSweepCase[]){
+        {"insert", 0, listBenchCreate, listBenchInsert, listBenchFree},
+        {"indexed access", 0, listBenchFill, listBenchIndex, listBenchFree},
+        {"lookup", LIST_BENCH_LOOKUPS, listBenchFill, listBenchLookup, listBenchFree},
+        {"free", 0, listBenchFill, listBenchFree, NULL},
+    }, 4, &bench, &bench.size, 1000000);
+
+    finishTestInstance(testInstance);
+}
+
 
 int main(void) {
     test1();
     test_2();
+    test_3();
+    bench_1();
     return 0;
 }
@@ -0,0 +1,127 @@
+/** AUTHOR
+ *
+ * @author agent <agent@local>
+ * @file memory.c
+ * @date 19.10.2026
+ * @brief Test file for the tracking allocator, run by make memory file=memory to test the tracking itself
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "utility/memory.h"
+#include "utility/enumerations.h"
+
+// Function to print the report into a string
+char *printReport(void) {
+    static char report[4096];
+    FILE *output = tmpfile();
+    if (!output) return NULL;
+    memoryPrintReport(output);
+    rewind(output);
+    size_t length = fread(report, 1, sizeof(report) - 1, output);
+    report[length] = '\0';
+    fclose(output);
+    return report;
+}
+
+void test1(void) {
+
+    TestInstancePtr testInstance = initTestInstance("Memory Test tags");
+
+    testCase(
+        testInstance,
+        strcmp(memoryTagName(MEMORY_SCANNER), "scanner") == 0 && strcmp(memoryTagName(MEMORY_CODEGEN), "codegen") == 0 &&
+            strcmp(memoryTagName(MEMORY_TAG_COUNT), "unknown") == 0,
+        "Naming the tags",
+        "The names of the subsystems (expected)",
+        "Wrong names (unexpected)"
+    );
+
+    enum MEMORY_TAG outer = MEMORY_SCOPE_BEGIN(MEMORY_PARSER);
+    enum MEMORY_TAG inner = MEMORY_SCOPE_BEGIN(MEMORY_PRECEDENCE);
+    MEMORY_SCOPE_END(inner);
+    enum MEMORY_TAG restored = MEMORY_SCOPE_BEGIN(MEMORY_OTHER);
+    MEMORY_SCOPE_END(restored);
+    MEMORY_SCOPE_END(outer);
+    testCase(
+        testInstance,
+        outer == MEMORY_OTHER && inner == (memoryTrackingEnabled() ? MEMORY_PARSER : MEMORY_OTHER) &&
+            restored == (memoryTrackingEnabled() ? MEMORY_PARSER : MEMORY_OTHER),
+        "Nesting the scopes",
+        "The previous tag returned and restored (expected)",
+        "Wrong tags (unexpected)"
+    );
+
+    finishTestInstance(testInstance);
+}
+
+void test2(void) {
+
+    TestInstancePtr testInstance = initTestInstance("Memory Test counting");
+
+    size_t before = memoryStats.tags[MEMORY_AST].current;
+    size_t total = memoryStats.tags[MEMORY_AST].total;
+    char *block = MEMORY_MALLOC(MEMORY_AST, 100);
+    bool counted = memoryStats.tags[MEMORY_AST].current == before + (memoryTrackingEnabled() ? 100 : 0);
+
+    enum MEMORY_TAG scope = MEMORY_SCOPE_BEGIN(MEMORY_SYMTABLE);
+    block = realloc(block, 300);
+    MEMORY_SCOPE_END(scope);
+    bool moved = memoryStats.tags[MEMORY_AST].current == before + (memoryTrackingEnabled() ? 300 : 0);
+    testCase(
+        testInstance,
+        block && counted && moved,
+        "Allocating under a tag and resizing the block in another scope",
+        "The block counted under its own tag (expected)",
+        "Wrong counters (unexpected)"
+    );
+
+    if (block) memset(block, 'x', 300);
+    free(block);
+    testCase(
+        testInstance,
+        memoryStats.tags[MEMORY_AST].current == before &&
+            memoryStats.tags[MEMORY_AST].total == total + (memoryTrackingEnabled() ? 400 : 0) &&
+            memoryStats.tags[MEMORY_AST].peak >= memoryStats.tags[MEMORY_AST].current,
+        "Freeing the block",
+        "The current bytes back, the total kept (expected)",
+        "Wrong counters (unexpected)"
+    );
+
+    finishTestInstance(testInstance);
+}
+
+void test3(void) {
+
+    TestInstancePtr testInstance = initTestInstance("Memory Test report");
+
+    char *report = printReport();
+    bool printed = report && (memoryTrackingEnabled() ? strstr(report, "memory: all") != NULL && strstr(report, "peak RSS") != NULL
+                                                      : strstr(report, "compiled out") != NULL);
+    testCase(
+        testInstance,
+        printed,
+        "Printing the report",
+        "The table of the tags, or a note without the tracking (expected)",
+        "Wrong report (unexpected)"
+    );
+
+    testCase(
+        testInstance,
+        memoryPeakRss() > 0,
+        "Getting the peak RSS",
+        "A non zero size (expected)",
+        "Zero size (unexpected)"
+    );
+
+    finishTestInstance(testInstance);
+}
+
+
+int main(void) {
+    test1();
+    test2();
+    test3();
+    return 0;
+}
@@ -0,0 +1,206 @@
+/** AUTHOR
+ *
+ * @author agent <agent@local>
+ * @file output_buffer.c
+ * @date 19.10.2026
+ * @brief Test file for the output buffer of the generated code
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "utility/output_buffer.h"
+#include "utility/enumerations.h"
+
+// compare the buffered bytes with the expected string
+bool bufferEquals(OutputBuffer *buffer, char *expected) {
+    return buffer->size == strlen(expected) && memcmp(buffer->data, expected, buffer->size) == 0;
+}
+
+void test1(void) {
+
+    TestInstancePtr testInstance = initTestInstance("Output Buffer Test with appenders, in memory");
+
+    OutputBuffer *buffer = outputBufferInit(NULL, 0);
+    testCase(
+        testInstance,
+        buffer != NULL,
+        "Initializing the output buffer",
+        "Buffer initialized successfully (expected)",
+        "Failed to initialize buffer (unexpected)"
+    );
+
+    outputBufferAppendLine(buffer, ".IFJcode24");
+    outputBufferAppend(buffer, "POPS ");
+    outputBufferAppendVar(buffer, "a", 12);
+    outputBufferAppendChar(buffer, '\n');
+    outputBufferAppendLabel(buffer, "LABEL $while_", 3, "_end\n");
+    testCase(
+        testInstance,
+        bufferEquals(buffer, ".IFJcode24\nPOPS TF@a_12\nLABEL $while_3_end\n"),
+        "Appending literal, variable and label",
+        "Buffer contains the expected code (expected)",
+        "Buffer contains different code (unexpected)"
+    );
+
+    buffer->size = 0;
+    outputBufferAppendInt(buffer, 0);
+    outputBufferAppendChar(buffer, ' ');
+    outputBufferAppendInt(buffer, -42);
+    outputBufferAppendChar(buffer, ' ');
+    outputBufferAppendInt(buffer, -9223372036854775807LL - 1);
+    testCase(
+        testInstance,
+        bufferEquals(buffer, "0 -42 -9223372036854775808"),
+        "Appending integers",
+        "Integers written correctly (expected)",
+        "Integers written incorrectly (unexpected)"
+    );
+
+    testCase(
+        testInstance,
+        outputBufferFlush(buffer) && bufferEquals(buffer, "0 -42 -9223372036854775808"),
+        "Flushing the in memory buffer",
+        "Data stays in the buffer (expected)",
+        "Data was lost (unexpected)"
+    );
+
+    // grow over the initial capacity
+    buffer->size = 0;
+    for (int i = 0; i < OUTPUT_BUFFER_INIT_CAPACITY; i++) outputBufferAppend(buffer, "ab");
+    testCase(
+        testInstance,
+        buffer->size == 2 * OUTPUT_BUFFER_INIT_CAPACITY && buffer->capacity >= buffer->size && !buffer->error &&
+            buffer->data[buffer->size - 1] == 'b',
+        "Growing the buffer",
+        "Buffer grew and kept the data (expected)",
+        "Buffer did not grow correctly (unexpected)"
+    );
+
+    outputBufferFree(&buffer);
+    testCase(
+        testInstance,
+        buffer == NULL,
+        "Freeing the buffer",
+        "Buffer pointer set to NULL (expected)",
+        "Buffer pointer not reset (unexpected)"
+    );
+
+    finishTestInstance(testInstance);
+}
+
+void test2(void) {
+
+    TestInstancePtr testInstance = initTestInstance("Output Buffer Test with chunked flushes to a stream");
+
+    FILE *stream = tmpfile();
+    OutputBuffer *buffer = outputBufferInit(stream, 16);
+    testCase(
+        testInstance,
+        stream != NULL && buffer != NULL,
+        "Initializing the buffer with a stream",
+        "Buffer initialized successfully (expected)",
+        "Failed to initialize buffer (unexpected)"
+    );
+
+    // more than the whole capacity, so at least one chunk is written before the final flush
+    int lines = OUTPUT_BUFFER_INIT_CAPACITY / 4;
+    for (int i = 0; i < lines; i++) outputBufferAppendLabel(buffer, "JUMP $if_", i % 10, "_end\n");
+    testCase(
+        testInstance,
+        buffer->capacity == OUTPUT_BUFFER_INIT_CAPACITY && !buffer->error,
+        "Appending over the capacity",
+        "Buffer flushed instead of growing (expected)",
+        "Buffer grew or failed (unexpected)"
+    );
+
+    testCase(
+        testInstance,
+        outputBufferFlush(buffer) && buffer->size == 0,
+        "Final flush",
+        "Buffer written and emptied (expected)",
+        "Flush failed (unexpected)"
+    );
+
+    // read the stream back and check every line
+    rewind(stream);
+    char line[32];
+    bool correct = true;
+    for (int i = 0; i < lines && correct; i++) {
+        char expected[32];
+        snprintf(expected, sizeof(expected), "JUMP $if_%d_end\n", i % 10);
+        correct = fgets(line, sizeof(line), stream) && strcmp(line, expected) == 0;
+    }
+    correct = correct && fgets(line, sizeof(line), stream) == NULL;
+    testCase(
+        testInstance,
+        correct,
+        "Reading the stream back",
+        "Stream contains all the lines in order (expected)",
+        "Stream content differs (unexpected)"
+    );
+
+    outputBufferFree(&buffer);
+    fclose(stream);
+    finishTestInstance(testInstance);
+}
+
+void test3(void) {
+
+    TestInstancePtr testInstance = initTestInstance("Output Buffer Test with literal emitters");
+
+    OutputBuffer *buffer = outputBufferInit(NULL, 0);
+
+    // the hex float has to be the same text as printf gives
+    double values[] = {0.0, -0.0, 1.0, -1.0, 0.5, 3.14, 1e-300, 4.9e-324, 2.2250738585072009e-308, 1.7976931348623157e308, 1e20, 0.1, 123456.789};
+    bool correct = true;
+    for (unsigned int i = 0; i < sizeof(values) / sizeof(values[0]); i++) {
+        char expected[64];
+        snprintf(expected, sizeof(expected), "%a", values[i]);
+
+        buffer->size = 0;
+        outputBufferAppendHexFloat(buffer, values[i]);
+        if (!bufferEquals(buffer, expected)) {
+            printf("$$ %s != %.*s\n", expected, (int)buffer->size, buffer->data);
+            correct = false;
+        }
+    }
+    testCase(
+        testInstance,
+        correct,
+        "Appending hex floats",
+        "All floats match printf (expected)",
+        "Some floats differ from printf (unexpected)"
+    );
+
+    buffer->size = 0;
+    outputBufferAppendEscaped(buffer, "a b\n#\\\x01\xc3\xa1z");
+    testCase(
+        testInstance,
+        bufferEquals(buffer, "a\\032b\\010\\035\\092\\001\xc3\xa1z"),
+        "Appending an escaped string",
+        "White space, #, \\ and control characters escaped, utf-8 kept (expected)",
+        "String escaped incorrectly (unexpected)"
+    );
+
+    buffer->size = 0;
+    outputBufferAppendEscaped(buffer, "");
+    testCase(
+        testInstance,
+        buffer->size == 0,
+        "Appending an empty escaped string",
+        "Nothing appended (expected)",
+        "Something was appended (unexpected)"
+    );
+
+    outputBufferFree(&buffer);
+    finishTestInstance(testInstance);
+}
+
+
+int main(void) {
+    test1();
+    test2();
+    test3();
+    return 0;
+}
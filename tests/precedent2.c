@@ -28,7 +28,9 @@ int main(void) {
 
     test = initTestInstance("Precedent analysis test for expressions");
 
-    enum ERR_CODES err = firstPass(input, table->tokenBuffer);
+    CompilerContext ctx;
+    compilerContextInit(&ctx, table, NULL);
+    enum ERR_CODES err = firstPass(input, table->tokenBuffer, &ctx);
     testCase(
         test,
         err == SUCCESS,
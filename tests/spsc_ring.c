@@ -0,0 +1,113 @@
+/** AUTHOR
+ *
+ * @author agent <agent@local>
+ * @file spsc_ring.c
+ * @date 19.10.2026
+ * @brief Test file for the lock-free ring of a single producer and a single consumer
+ */
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include "utility/spsc_ring.h"
+#include "utility/enumerations.h"
+
+#define ELEMENT_COUNT 200000
+
+// the producer pushes the numbers in order, the small ring makes both threads wait often
+void *produce(void *data) {
+    SpscRing *ring = (SpscRing *)data;
+    for (size_t i = 0; i < ELEMENT_COUNT; i++) spscRingPush(ring, &i);
+    return NULL;
+}
+
+void test1(void) {
+
+    TestInstancePtr testInstance = initTestInstance("SPSC Ring Test single thread");
+
+    SpscRing *ring = spscRingInit(5, sizeof(int));
+    testCase(
+        testInstance,
+        ring != NULL && ring->mask == 7,
+        "Creating a ring of 5 elements",
+        "Capacity rounded up to 8 (expected)",
+        "Wrong capacity (unexpected)"
+    );
+
+    int value = 0;
+    testCase(
+        testInstance,
+        !spscRingTryPop(ring, &value),
+        "Popping from an empty ring",
+        "Nothing popped (expected)",
+        "Popped from an empty ring (unexpected)"
+    );
+
+    bool pushed = true;
+    for (int i = 0; i < 8; i++) pushed = pushed && spscRingTryPush(ring, &i);
+    int extra = 8;
+    testCase(
+        testInstance,
+        pushed && !spscRingTryPush(ring, &extra),
+        "Pushing to a full ring",
+        "8 pushed, the 9th rejected (expected)",
+        "Wrong count of elements fits the ring (unexpected)"
+    );
+
+    bool ordered = true;
+    for (int i = 0; i < 8; i++) ordered = ordered && spscRingTryPop(ring, &value) && value == i;
+    testCase(
+        testInstance,
+        ordered && !spscRingTryPop(ring, &value),
+        "Popping all the elements",
+        "Elements in the order they were pushed (expected)",
+        "Wrong order or count (unexpected)"
+    );
+
+    spscRingFree(&ring);
+    testCase(
+        testInstance,
+        ring == NULL,
+        "Freeing the ring",
+        "Ring freed and set to NULL (expected)",
+        "Ring not reset (unexpected)"
+    );
+
+    finishTestInstance(testInstance);
+}
+
+void test2(void) {
+
+    TestInstancePtr testInstance = initTestInstance("SPSC Ring Test two threads");
+
+    SpscRing *ring = spscRingInit(16, sizeof(size_t));
+    pthread_t producer;
+    bool started = ring && pthread_create(&producer, NULL, produce, ring) == 0;
+
+    bool ordered = started;
+    for (size_t i = 0; i < ELEMENT_COUNT && ordered; i++) {
+        size_t value;
+        spscRingPop(ring, &value);
+        ordered = value == i;
+    }
+    if (started) pthread_join(producer, NULL);
+
+    size_t value;
+    testCase(
+        testInstance,
+        ordered && !spscRingTryPop(ring, &value),
+        "Passing elements from a producer thread",
+        "Every element arrived once and in order (expected)",
+        "Lost, repeated or reordered element (unexpected)"
+    );
+
+    spscRingFree(&ring);
+    finishTestInstance(testInstance);
+}
+
+
+int main(void) {
+    test1();
+    test2();
+    return 0;
+}
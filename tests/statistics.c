@@ -0,0 +1,91 @@
+/** AUTHOR
+ *
+ * @author agent <agent@local>
+ * @file statistics.c
+ * @date 19.10.2026
+ * @brief Test file for the internal counters of the compiler
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "utility/statistics.h"
+#include "utility/enumerations.h"
+
+// Function to print the counters into a string
+char *printJson(const char *code) {
+    static char json[4096];
+    FILE *output = tmpfile();
+    if (!output) return NULL;
+    statsPrintJson(output, code, code ? strlen(code) : 0);
+    rewind(output);
+    size_t length = fread(json, 1, sizeof(json) - 1, output);
+    json[length] = '\0';
+    fclose(output);
+    return json;
+}
+
+void test1(void) {
+
+    TestInstancePtr testInstance = initTestInstance("Statistics Test counters");
+
+    size_t counter = 3;
+    statsMax(&counter, 2);
+    bool kept = counter == 3;
+    statsMax(&counter, 7);
+    testCase(
+        testInstance,
+        kept && counter == 7,
+        "Raising a counter to a smaller and a bigger value",
+        "Only the bigger value kept (expected)",
+        "Wrong value (unexpected)"
+    );
+
+    statsReset();
+    char *json = printJson(NULL);
+    testCase(
+        testInstance,
+        json && json[0] == '{' && strstr(json, "\"tokens\": 0") && strstr(json, "\"instructions\": 0") &&
+            strstr(json, "\"opcodes\": {}") && strstr(json, "}}\n}\n"),
+        "Printing the counters after a reset",
+        "A JSON object with zero counters (expected)",
+        "Wrong JSON (unexpected)"
+    );
+
+    finishTestInstance(testInstance);
+}
+
+void test2(void) {
+
+    TestInstancePtr testInstance = initTestInstance("Statistics Test opcodes");
+
+    const char *code =
+        ".IFJcode24\n"
+        "DEFVAR GF@_\n"
+        "CREATEFRAME\n"
+        "\n"
+        "LABEL function_main\n"
+        "PUSHS int@1\n"
+        "PUSHS int@2\n"
+        "ADDS\n"
+        "POPS GF@_\n"
+        "EXIT int@0";
+    char *json = printJson(code);
+    testCase(
+        testInstance,
+        json && strstr(json, "\"instructions\": 8") && strstr(json, "\"PUSHS\": 2") && strstr(json, "\"EXIT\": 1") &&
+            strstr(json, "\"DEFVAR\": 1") && !strstr(json, ".IFJcode24"),
+        "Counting the instructions of a code",
+        "Every line but the header counted by its opcode (expected)",
+        "Wrong counts (unexpected)"
+    );
+
+    finishTestInstance(testInstance);
+}
+
+
+int main(void) {
+    test1();
+    test2();
+    return 0;
+}
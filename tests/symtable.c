@@ -202,7 +202,76 @@ void test_variables(void) {
 
 }
 
+// largest benchmarked scope
+#define SYMTABLE_BENCH_MAX_SIZE 1000000
+
+// Struct for the state of the symbol table benchmarks
+typedef struct SymTableBench {
+    SymTable *table; // the measured table
+    char **names; // names of the variables, the table does not own them
+    unsigned int size; // variables declared in a single function scope
+    size_t found; // found variables, so the searches are not left out
+} SymTableBench;
+
+// Function to create a table with an empty function scope for the benchmark
+void symTableBenchCreate(void *data) {
+    SymTableBench *bench = (SymTableBench *)data;
+    bench->table = symTableInit();
+    symTableMoveScopeDown(bench->table, SYM_FUNCTION);
+}
+
+// Function to declare all the variables
+void symTableBenchDeclare(void *data) {
+    SymTableBench *bench = (SymTableBench *)data;
+    for (unsigned int i = 0; i < bench->size; i++) symTableDeclareVariable(bench->table, bench->names[i], dTypeI32, true, false, false);
+}
+
+// Function to create a table with all the variables for the benchmark
+void symTableBenchFill(void *data) {
+    symTableBenchCreate(data);
+    symTableBenchDeclare(data);
+}
+
+// Function to free the table of the benchmark
+void symTableBenchFree(void *data) {
+    SymTableBench *bench = (SymTableBench *)data;
+    if (bench->table) symTableFree(&bench->table);
+}
+
+// Function to search for all the variables
+void symTableBenchLookup(void *data) {
+    SymTableBench *bench = (SymTableBench *)data;
+    for (unsigned int i = 0; i < bench->size; i++) bench->found += symTableFindVariable(bench->table, bench->names[i]) != NULL;
+}
+
+void bench_variables(void) {
+
+    TestInstancePtr testInstance = initTestInstance("Symbol Table Benchmarks");
+
+    // the names of the largest size, the smaller sizes use the start of them
+    size_t maxSize = benchSize(testInstance, SYMTABLE_BENCH_MAX_SIZE);
+    SymTableBench bench = {NULL, (char **)calloc(maxSize, sizeof(char *)), 0, 0};
+    if (bench.names) {
+        for (unsigned int i = 0; i < maxSize; i++) {
+            bench.names[i] = (char *)malloc(16);
+            if (bench.names[i]) snprintf(bench.names[i], 16, "var%u", i);
+        }
+
+        benchSweep(testInstance, (BenchSweepCase[]){
+            {"declare", 0, symTableBenchCreate, symTableBenchDeclare, symTableBenchFree},
+            {"lookup", 0, symTableBenchFill, symTableBenchLookup, symTableBenchFree},
+            {"free", 0, symTableBenchFill, symTableBenchFree, NULL},
+        }, 3, &bench, &bench.size, SYMTABLE_BENCH_MAX_SIZE);
+
+        for (unsigned int i = 0; i < maxSize; i++) free(bench.names[i]);
+        free(bench.names);
+    }
+
+    finishTestInstance(testInstance);
+}
+
 int main(void) {
     test_variables();
+    bench_variables();
     return 0;
 }
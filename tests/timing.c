@@ -0,0 +1,177 @@
+/** AUTHOR
+ *
+ * @author agent <agent@local>
+ * @file timing.c
+ * @date 19.10.2026
+ * @brief Test file for the timing of the compiler phases
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "ifj24.h"
+#include "utility/timing.h"
+#include "utility/enumerations.h"
+
+// Function to count the spans of the name, that were ended
+size_t countSpans(Timing *timing, const char *name) {
+    size_t count = 0;
+    for (size_t i = 0; i < timing->count; i++) {
+        if (timing->spans[i].done && strcmp(timing->spans[i].name, name) == 0) count++;
+    }
+    return count;
+}
+
+// Function to find the ended span of the function
+TimingSpan *findSpan(Timing *timing, const char *name, const char *detail) {
+    for (size_t i = 0; i < timing->count; i++) {
+        TimingSpan *span = &timing->spans[i];
+        if (span->done && strcmp(span->name, name) == 0 && span->detail && strcmp(span->detail, detail) == 0) return span;
+    }
+    return NULL;
+}
+
+// Function to read the whole file
+char *readFile(const char *path) {
+    FILE *input = fopen(path, "r");
+    if (!input) return NULL;
+    char *content = (char *)calloc(1 << 16, 1);
+    if (content) fread(content, 1, (1 << 16) - 1, input);
+    fclose(input);
+    return content;
+}
+
+const char *source =
+    "const ifj = @import(\"ifj24.zig\");\n"
+    "pub fn twice(x: i32) i32 {\n"
+    "    return x * 2;\n"
+    "}\n"
+    "pub fn main() void {\n"
+    "    const r = twice(21);\n"
+    "    ifj.write(r);\n"
+    "}\n";
+
+void test1(void) {
+
+    TestInstancePtr testInstance = initTestInstance("Timing Test spans");
+
+    Timing timing;
+    bool initialized = timingInit(&timing);
+    // the macros are given a pointer, as in the compiler, where the timing is optional
+    Timing *enabled = &timing;
+    size_t outer = TIMING_BEGIN(enabled, "phase");
+    size_t inner = TIMING_BEGIN(enabled, "phase function");
+    TIMING_END(enabled, inner, "first");
+    size_t open = TIMING_BEGIN(enabled, "phase function");
+    TIMING_END(enabled, outer, NULL);
+    testCase(
+        testInstance,
+        initialized && timing.count == 3 && countSpans(&timing, "phase") == 1 && countSpans(&timing, "phase function") == 1 &&
+            timing.spans[outer].start <= timing.spans[inner].start && timing.spans[inner].end <= timing.spans[outer].end &&
+            !timing.spans[open].done && timing.threadCount == 1,
+        "Recording nested spans, one of them not ended",
+        "Only the ended spans counted, nested in time (expected)",
+        "Wrong spans (unexpected)"
+    );
+
+    Timing *disabled = NULL;
+    size_t none = TIMING_BEGIN(disabled, "phase");
+    TIMING_END(disabled, none, "ignored");
+    testCase(
+        testInstance,
+        none == TIMING_NO_SPAN,
+        "Starting a span without the timing",
+        "Nothing recorded (expected)",
+        "A span returned (unexpected)"
+    );
+
+    timingFree(&timing);
+    finishTestInstance(testInstance);
+}
+
+void test2(void) {
+
+    TestInstancePtr testInstance = initTestInstance("Timing Test compilation");
+
+    Ifj24Options options;
+    ifj24OptionsInit(&options);
+    Timing timing;
+    timingInit(&timing);
+    options.timing = &timing;
+    Ifj24Result timed, plain;
+    int error = ifj24CompileWithOptions(source, strlen(source), &options, &timed);
+    ifj24Compile(source, strlen(source), &plain);
+    testCase(
+        testInstance,
+        error == SUCCESS && timed.codeLength == plain.codeLength && memcmp(timed.code, plain.code, plain.codeLength) == 0,
+        "Compiling with the timing",
+        "The same code as without it (expected)",
+        "Different code (unexpected)"
+    );
+    ifj24ResultFree(&timed);
+    ifj24ResultFree(&plain);
+
+    testCase(
+        testInstance,
+        countSpans(&timing, "lex") == 1 && countSpans(&timing, "parse") == 1 && countSpans(&timing, "analyze") == 1 &&
+            countSpans(&timing, "inline") == 1 && countSpans(&timing, "generate") == 1 &&
+            findSpan(&timing, "parse function", "twice") && findSpan(&timing, "analyze function", "main") &&
+            findSpan(&timing, "generate function", "twice"),
+        "Looking at the recorded phases",
+        "Every phase and every function timed (expected)",
+        "A span missing (unexpected)"
+    );
+
+    char path[] = "/tmp/ifj24_trace.json";
+    bool written = timingWriteTrace(&timing, path);
+    char *trace = readFile(path);
+    testCase(
+        testInstance,
+        written && trace && strncmp(trace, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[", 39) == 0 &&
+            strstr(trace, "\"name\":\"analyze\",\"cat\":\"phase\",\"ph\":\"X\"") &&
+            strstr(trace, "\"args\":{\"function\":\"twice\"}") && strstr(trace, "]}\n"),
+        "Writing the trace",
+        "Complete events of the phases and the functions (expected)",
+        "Wrong trace (unexpected)"
+    );
+    free(trace);
+    remove(path);
+
+    timingFree(&timing);
+    finishTestInstance(testInstance);
+}
+
+void test3(void) {
+
+    TestInstancePtr testInstance = initTestInstance("Timing Test streaming mode");
+
+    Ifj24Options options;
+    ifj24OptionsInit(&options);
+    Timing timing;
+    timingInit(&timing);
+    options.timing = &timing;
+    options.streaming = 1;
+    Ifj24Result result;
+    int error = ifj24CompileWithOptions(source, strlen(source), &options, &result);
+    testCase(
+        testInstance,
+        error == SUCCESS && countSpans(&timing, "prescan") == 1 && countSpans(&timing, "stream") == 1 &&
+            countSpans(&timing, "parse function") == 2 && countSpans(&timing, "analyze function") == 2 &&
+            countSpans(&timing, "generate function") == 2 && countSpans(&timing, "lex") == 0,
+        "Compiling a function at a time with the timing",
+        "The pre-scan and every function timed (expected)",
+        "Wrong spans (unexpected)"
+    );
+    ifj24ResultFree(&result);
+
+    timingFree(&timing);
+    finishTestInstance(testInstance);
+}
+
+
+int main(void) {
+    test1();
+    test2();
+    test3();
+    return 0;
+}
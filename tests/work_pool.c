@@ -0,0 +1,126 @@
+/** AUTHOR
+ *
+ * @author agent <agent@local>
+ * @file work_pool.c
+ * @date 19.10.2026
+ * @brief Test file for the thread pool with work stealing deques
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include "utility/work_pool.h"
+#include "utility/enumerations.h"
+
+#define TASK_COUNT 10000
+
+// every task counts how many times it ran, only its own slot is written, so no lock is needed
+void countTask(void *data, size_t index) {
+    int *runs = (int *)data;
+    runs[index]++;
+
+    // uneven tasks, so the workers run out of work at different times and steal
+    volatile unsigned long spin = 0;
+    for (unsigned long i = 0; i < (index % 7) * 100; i++) spin += i;
+}
+
+// check, that every task ran exactly once
+bool everyTaskOnce(int *runs, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        if (runs[i] != 1) return false;
+    }
+    return true;
+}
+
+void test1(void) {
+
+    TestInstancePtr testInstance = initTestInstance("Work Pool Test running tasks");
+
+    int *runs = (int *)calloc(TASK_COUNT, sizeof(int));
+    size_t steals;
+    bool success = workPoolRun(TASK_COUNT, 1, countTask, runs, &steals);
+    testCase(
+        testInstance,
+        success && everyTaskOnce(runs, TASK_COUNT) && steals == 0,
+        "Running the tasks on the calling thread",
+        "Every task ran once, nothing stolen (expected)",
+        "Some task did not run exactly once (unexpected)"
+    );
+
+    for (unsigned int workers = 2; workers <= 16; workers *= 2) {
+        for (size_t i = 0; i < TASK_COUNT; i++) runs[i] = 0;
+        success = workPoolRun(TASK_COUNT, workers, countTask, runs, &steals);
+        testCase(
+            testInstance,
+            success && everyTaskOnce(runs, TASK_COUNT) && steals <= TASK_COUNT,
+            "Running the tasks on more workers",
+            "Every task ran once (expected)",
+            "Some task did not run exactly once (unexpected)"
+        );
+    }
+
+    // more workers than tasks
+    for (size_t i = 0; i < 3; i++) runs[i] = 0;
+    success = workPoolRun(3, 8, countTask, runs, NULL);
+    testCase(
+        testInstance,
+        success && everyTaskOnce(runs, 3),
+        "Running less tasks than workers",
+        "Every task ran once (expected)",
+        "Some task did not run exactly once (unexpected)"
+    );
+
+    testCase(
+        testInstance,
+        workPoolRun(0, 4, countTask, runs, NULL),
+        "Running no tasks",
+        "Nothing to do (expected)",
+        "Failed on an empty pool (unexpected)"
+    );
+
+    free(runs);
+    finishTestInstance(testInstance);
+}
+
+void test2(void) {
+
+    TestInstancePtr testInstance = initTestInstance("Work Pool Test with the deque");
+
+    size_t tasks[] = {0, 1, 2, 3};
+    WorkDeque deque = {tasks, 0, 4, PTHREAD_MUTEX_INITIALIZER};
+    size_t index = 99;
+
+    testCase(
+        testInstance,
+        workDequePop(&deque, &index) && index == 3,
+        "Popping the owner task",
+        "Last task taken from the bottom (expected)",
+        "Wrong task popped (unexpected)"
+    );
+
+    testCase(
+        testInstance,
+        workDequeSteal(&deque, &index) && index == 0,
+        "Stealing a task",
+        "First task taken from the top (expected)",
+        "Wrong task stolen (unexpected)"
+    );
+
+    bool second = workDequePop(&deque, &index) && index == 2;
+    bool third = workDequeSteal(&deque, &index) && index == 1;
+    testCase(
+        testInstance,
+        second && third && !workDequePop(&deque, &index) && !workDequeSteal(&deque, &index),
+        "Emptying the deque",
+        "Both ends meet, the deque is empty (expected)",
+        "Deque returned too many or too few tasks (unexpected)"
+    );
+
+    finishTestInstance(testInstance);
+}
+
+
+int main(void) {
+    test1();
+    test2();
+    return 0;
+}